@@ -0,0 +1,205 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/SoundRecorder.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Specialized SoundRecorder which stores the captured
+///        audio data into a preallocated lock-free ring buffer
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API RingBufferSoundRecorder : public SoundRecorder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the recorder with a fixed capacity
+    ///
+    /// The ring buffer is allocated once here, and never
+    /// reallocated afterwards. Its capacity is rounded up to
+    /// the next power of two.
+    ///
+    /// \param capacity Minimum number of samples that the ring buffer can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit RingBufferSoundRecorder(base::SizeT capacity = 44'100u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RingBufferSoundRecorder() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop recorded samples from the ring buffer
+    ///
+    /// Must only be called from a single consumer thread.
+    /// Only whole frames are read (i.e. the number of read
+    /// samples is always a multiple of the channel count of
+    /// the capture device used for the last capture).
+    ///
+    /// \param samples  Destination buffer
+    /// \param maxCount Maximum number of samples to write into `samples`
+    ///
+    /// \return Number of samples actually written into `samples`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT readSamples(base::I16* samples, base::SizeT maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop recorded samples from the ring buffer, converted to floats
+    ///
+    /// Same as the 16-bit overload, but the samples are
+    /// normalized to the `[-1, 1]` range.
+    ///
+    /// \param samples  Destination buffer
+    /// \param maxCount Maximum number of samples to write into `samples`
+    ///
+    /// \return Number of samples actually written into `samples`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT readSamples(float* samples, base::SizeT maxCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard all the samples currently stored in the ring buffer
+    ///
+    /// Must only be called from the consumer thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    void discardSamples();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples ready to be read
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getAvailableSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the capacity of the ring buffer, in samples
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getCapacity() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the last started capture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the ring buffer was full
+    ///        when the capture thread tried to write into it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getOverrunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of samples dropped due to overruns
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getDroppedSampleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the overrun and dropped sample counters to zero
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetCounters();
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start capturing audio data
+    ///
+    /// \return `true` to start the capture, or `false` to abort it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onStart(CaptureDevice& captureDevice) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push a new chunk of recorded samples into the ring buffer
+    ///
+    /// Called from the capture thread: never allocates or locks.
+    /// Whole frames that do not fit in the ring buffer are dropped.
+    ///
+    /// \param samples     Pointer to the new chunk of recorded samples
+    /// \param sampleCount Number of samples pointed by `samples`
+    ///
+    /// \return Always `true`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool onProcessSamples(const base::I16* samples, base::SizeT sampleCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 384> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RingBufferSoundRecorder
+/// \ingroup audio
+///
+/// `sf::RingBufferSoundRecorder` is a `sf::SoundRecorder` that
+/// hands recorded samples over to another thread through a
+/// single-producer single-consumer ring buffer.
+///
+/// The ring buffer is preallocated on construction: the capture
+/// thread only copies samples into it and updates an atomic index,
+/// so it never allocates memory nor takes a lock. A consumer thread
+/// (typically the main or networking thread) pulls samples at its
+/// own pace with `readSamples`, either as 16-bit integers or as
+/// normalized floats. The latency is bounded by the capacity of
+/// the ring buffer.
+///
+/// If the consumer falls behind and the ring buffer fills up, the
+/// newest samples are dropped and the overrun counters are
+/// incremented, so that the condition can be detected and reported.
+///
+/// Usage example:
+/// \code
+/// sf::RingBufferSoundRecorder recorder(/* capacity */ 8192u);
+///
+/// if (!recorder.start(captureDevice))
+/// {
+///     // Handle error...
+/// }
+///
+/// sf::base::I16 chunk[1024];
+///
+/// while (running)
+/// {
+///     const sf::base::SizeT count = recorder.readSamples(chunk, 1024u);
+///     // Send `chunk` over the network, etc...
+///
+///     if (recorder.getOverrunCount() > 0u)
+///     {
+///         // Consumer is too slow, increase capacity or read more often...
+///     }
+/// }
+///
+/// if (!recorder.stop())
+/// {
+///     // Handle error...
+/// }
+/// \endcode
+///
+/// \see `sf::SoundRecorder`, `sf::SoundBufferRecorder`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/MemoryResource.hpp"
+#include "SFML/Base/Priv/VectorUtils.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Stateless allocator that uses the global aligned `operator new`
+///
+/// Default allocator of `sf::base::Vector`.
+///
+////////////////////////////////////////////////////////////
+struct DefaultAllocator
+{
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard, gnu::always_inline]] static T* allocate(const SizeT count)
+    {
+        return priv::VectorUtils::allocate<T>(count);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[gnu::always_inline]] static void deallocate(T* const p, const SizeT count) noexcept
+    {
+        priv::VectorUtils::deallocate(p, count);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] friend constexpr bool operator==(DefaultAllocator, DefaultAllocator) noexcept
+    {
+        return true;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Allocator that forwards to a runtime `sf::base::MemoryResource`
+///
+/// A default-constructed `ResourceAllocator` has no resource and
+/// behaves exactly like `sf::base::DefaultAllocator`. The resource
+/// is not owned and must outlive every container using it.
+///
+////////////////////////////////////////////////////////////
+class ResourceAllocator
+{
+public:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr ResourceAllocator() = default;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] constexpr /* implicit */ ResourceAllocator(MemoryResource& resource) noexcept :
+        m_resource{&resource}
+    {
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard, gnu::always_inline]] T* allocate(const SizeT count) const
+    {
+        if (m_resource == nullptr)
+            return priv::VectorUtils::allocate<T>(count);
+
+        return count == 0u ? nullptr : static_cast<T*>(m_resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[gnu::always_inline]] void deallocate(T* const p, const SizeT count) const noexcept
+    {
+        if (m_resource == nullptr)
+        {
+            priv::VectorUtils::deallocate(p, count);
+            return;
+        }
+
+        if (p != nullptr)
+            m_resource->deallocate(p, count * sizeof(T), alignof(T));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] constexpr MemoryResource* getResource() const noexcept
+    {
+        return m_resource;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] friend constexpr bool operator==(const ResourceAllocator& lhs,
+                                                                       const ResourceAllocator& rhs) noexcept
+    {
+        return lhs.m_resource == rhs.m_resource;
+    }
+
+
+private:
+    ////////////////////////////////////////////////////////////
+    MemoryResource* m_resource{nullptr}; //!< Non-owning, `nullptr` means global `operator new`
+};
+
+} // namespace sf::base
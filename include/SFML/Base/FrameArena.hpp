@@ -0,0 +1,86 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/MonotonicBufferResource.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Bump allocator meant to be reset once per frame
+///
+/// Behaves like `sf::base::MonotonicBufferResource`, but `reset`
+/// keeps the memory around for the next frame instead of returning
+/// it to the heap. If a frame overflowed the current block, `reset`
+/// replaces all blocks with a single one large enough for the whole
+/// frame, so that steady-state frames never touch the heap.
+///
+/// Containers allocating from the arena must be destroyed (or
+/// must have released their storage) before `reset` is called.
+///
+/// Not thread-safe.
+///
+////////////////////////////////////////////////////////////
+class FrameArena : public MonotonicBufferResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the arena with an initial block of `capacity` bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit FrameArena(const SizeT capacity = 64u * 1024u) : MonotonicBufferResource{capacity}
+    {
+        allocateChunk(capacity);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Invalidate all allocations and recycle the memory for the next frame
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset()
+    {
+        m_peakBytesAllocated = SFML_BASE_MAX(m_peakBytesAllocated, m_bytesAllocated);
+        m_bytesAllocated     = 0u;
+
+        if (m_chunks == nullptr) // Released by the user, next allocation will get a new block
+            return;
+
+        if (m_chunks->next == nullptr)
+        {
+            // Single block: just rewind
+            m_current = reinterpret_cast<char*>(m_chunks) + chunkHeaderSize;
+            return;
+        }
+
+        // Frame overflowed into multiple blocks: coalesce them into one
+        const SizeT totalBytes = m_chunkBytes;
+
+        release();
+        m_nextChunkSize = totalBytes;
+        allocateChunk(totalBytes);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the highest number of bytes allocated in a single frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getPeakBytesAllocated() const noexcept
+    {
+        return SFML_BASE_MAX(m_peakBytesAllocated, m_bytesAllocated);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SizeT m_peakBytesAllocated{0u}; //!< High-water mark across frames
+};
+
+} // namespace sf::base
@@ -0,0 +1,59 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Abstract interface for a source of raw memory
+///
+/// Similar in spirit to `std::pmr::memory_resource`. Containers
+/// refer to a resource through `sf::base::ResourceAllocator`, which
+/// allows the allocation strategy to be chosen at runtime without
+/// changing the type of the container.
+///
+/// \see `sf::base::MonotonicBufferResource`, `sf::base::FrameArena`, `sf::base::PoolResource`
+///
+////////////////////////////////////////////////////////////
+class MemoryResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~MemoryResource() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate `bytes` bytes aligned to `alignment`
+    ///
+    /// `alignment` must be a power of two.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual void* allocate(SizeT bytes, SizeT alignment) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return memory previously obtained from `allocate`
+    ///
+    /// `bytes` and `alignment` must match the original request.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void deallocate(void* p, SizeT bytes, SizeT alignment) noexcept = 0;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] MemoryResource()                       = default;
+    MemoryResource(const MemoryResource&)                = default;
+    MemoryResource& operator=(const MemoryResource&)     = default;
+    MemoryResource(MemoryResource&&) noexcept            = default;
+    MemoryResource& operator=(MemoryResource&&) noexcept = default;
+};
+
+} // namespace sf::base
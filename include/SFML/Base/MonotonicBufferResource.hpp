@@ -0,0 +1,202 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/FwdStdAlignedNewDelete.hpp"
+#include "SFML/Base/MaxAlignT.hpp"
+#include "SFML/Base/MemoryResource.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Bump allocator that only releases memory all at once
+///
+/// Allocations are served by advancing a pointer into the current
+/// chunk. When the chunk is exhausted, a new one (twice as large as
+/// the previous one) is obtained from the global `operator new`.
+/// `deallocate` is a no-op: memory is only reclaimed by `release`
+/// or on destruction.
+///
+/// Optionally, an initial user-provided buffer (e.g. on the stack)
+/// is used before any heap chunk is allocated.
+///
+/// Not thread-safe.
+///
+////////////////////////////////////////////////////////////
+class MonotonicBufferResource : public MemoryResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct without an initial buffer
+    ///
+    /// \param initialChunkSize Size in bytes of the first heap chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit MonotonicBufferResource(const SizeT initialChunkSize = 4096u) :
+        m_nextChunkSize{SFML_BASE_MAX(initialChunkSize, SizeT{64u})}
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct using `buffer` before falling back to the heap
+    ///
+    /// The buffer is not owned and must outlive the resource.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit MonotonicBufferResource(void* const buffer, const SizeT bufferSize) :
+        m_current{static_cast<char*>(buffer)},
+        m_end{static_cast<char*>(buffer) + bufferSize},
+        m_initialBuffer{static_cast<char*>(buffer)},
+        m_initialBufferSize{bufferSize},
+        m_nextChunkSize{SFML_BASE_MAX(bufferSize * 2u, SizeT{64u})}
+    {
+        SFML_BASE_ASSERT(buffer != nullptr || bufferSize == 0u);
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~MonotonicBufferResource() override
+    {
+        release();
+    }
+
+    ////////////////////////////////////////////////////////////
+    MonotonicBufferResource(const MonotonicBufferResource&)            = delete;
+    MonotonicBufferResource& operator=(const MonotonicBufferResource&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* allocate(const SizeT bytes, const SizeT alignment) override
+    {
+        SFML_BASE_ASSERT(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+
+        if (char* const p = tryBump(bytes, alignment); p != nullptr) [[likely]]
+            return p;
+
+        allocateChunk(bytes + alignment);
+
+        char* const p = tryBump(bytes, alignment);
+        SFML_BASE_ASSERT(p != nullptr);
+        return p;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void deallocate(void*, SizeT, SizeT) noexcept override
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free all heap chunks and rewind to the initial buffer
+    ///
+    /// Every pointer previously returned by `allocate` is invalidated.
+    ///
+    ////////////////////////////////////////////////////////////
+    void release() noexcept
+    {
+        while (m_chunks != nullptr)
+        {
+            ChunkHeader* const next = m_chunks->next;
+            ::operator delete(m_chunks, std::align_val_t{chunkAlignment});
+            m_chunks = next;
+        }
+
+        m_current        = m_initialBuffer;
+        m_end            = m_initialBuffer + m_initialBufferSize;
+        m_chunkBytes     = 0u;
+        m_bytesAllocated = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes handed out since the last release or reset
+    ///
+    /// Includes alignment padding.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getBytesAllocated() const noexcept
+    {
+        return m_bytesAllocated;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total size of the heap chunks currently owned
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getChunkBytes() const noexcept
+    {
+        return m_chunkBytes;
+    }
+
+protected:
+    ////////////////////////////////////////////////////////////
+    struct ChunkHeader
+    {
+        ChunkHeader* next;
+        SizeT        size; //!< Usable bytes following the header
+    };
+
+    ////////////////////////////////////////////////////////////
+    enum : SizeT
+    {
+        chunkAlignment  = alignof(MaxAlignT),
+        chunkHeaderSize = (sizeof(ChunkHeader) + chunkAlignment - 1u) & ~(chunkAlignment - 1u)
+    };
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] char* tryBump(const SizeT bytes, const SizeT alignment) noexcept
+    {
+        if (m_current == nullptr)
+            return nullptr;
+
+        const auto address = reinterpret_cast<SizeT>(m_current);
+        const auto padding = (alignment - (address & (alignment - 1u))) & (alignment - 1u);
+
+        if (padding + bytes > static_cast<SizeT>(m_end - m_current))
+            return nullptr;
+
+        char* const result = m_current + padding;
+
+        m_current = result + bytes;
+        m_bytesAllocated += padding + bytes;
+
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::cold, gnu::noinline]] void allocateChunk(const SizeT minUsableBytes)
+    {
+        const SizeT usableBytes = SFML_BASE_MAX(m_nextChunkSize, minUsableBytes);
+
+        auto* const chunk = static_cast<ChunkHeader*>(
+            ::operator new(chunkHeaderSize + usableBytes, std::align_val_t{chunkAlignment}));
+
+        chunk->next = m_chunks;
+        chunk->size = usableBytes;
+
+        m_chunks  = chunk;
+        m_current = reinterpret_cast<char*>(chunk) + chunkHeaderSize;
+        m_end     = m_current + usableBytes;
+
+        m_chunkBytes += usableBytes;
+        m_nextChunkSize = usableBytes * 2u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    ChunkHeader* m_chunks{nullptr};        //!< Singly-linked list of owned heap chunks, newest first
+    char*        m_current{nullptr};       //!< Next free byte in the active buffer
+    char*        m_end{nullptr};           //!< One past the last byte of the active buffer
+    char*        m_initialBuffer{nullptr}; //!< Optional user-provided buffer
+    SizeT        m_initialBufferSize{0u};  //!< Size of `m_initialBuffer`
+    SizeT        m_nextChunkSize;          //!< Usable size of the next heap chunk
+    SizeT        m_chunkBytes{0u};         //!< Sum of the usable sizes of all owned chunks
+    SizeT        m_bytesAllocated{0u};     //!< Bytes handed out, including padding
+};
+
+} // namespace sf::base
@@ -0,0 +1,235 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/FwdStdAlignedNewDelete.hpp"
+#include "SFML/Base/MemoryResource.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Size-class pool allocator with per-class free lists
+///
+/// Requests up to `maxPooledBlockSize` bytes are rounded up to the
+/// next power of two (minimum `minPooledBlockSize`) and served from a
+/// free list for that size class. Free lists are refilled by carving
+/// large chunks obtained from the global `operator new`. Deallocated
+/// blocks go back to their free list and are reused by later requests
+/// of the same size class, which keeps long sessions with churning
+/// containers from fragmenting the general-purpose heap.
+///
+/// Larger (or over-aligned) requests are forwarded to the global
+/// `operator new`. All chunks are freed on destruction.
+///
+/// Not thread-safe.
+///
+////////////////////////////////////////////////////////////
+class PoolResource : public MemoryResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    enum : SizeT
+    {
+        minPooledBlockSize = 16u,
+        maxPooledBlockSize = 64u * 1024u,
+        sizeClassCount     = 13u, // log2(maxPooledBlockSize / minPooledBlockSize) + 1
+        chunkAlignment     = 64u,
+        minChunkSize       = 16u * 1024u
+    };
+
+    static_assert((minPooledBlockSize << (sizeClassCount - 1u)) == maxPooledBlockSize);
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PoolResource() = default;
+
+    ////////////////////////////////////////////////////////////
+    ~PoolResource() override
+    {
+        release();
+    }
+
+    ////////////////////////////////////////////////////////////
+    PoolResource(const PoolResource&)            = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* allocate(const SizeT bytes, const SizeT alignment) override
+    {
+        SFML_BASE_ASSERT(alignment > 0u && (alignment & (alignment - 1u)) == 0u);
+
+        const SizeT sizeClass = getSizeClass(bytes, alignment);
+
+        if (sizeClass == sizeClassCount) [[unlikely]]
+        {
+            ++m_largeAllocationCount;
+            return ::operator new(bytes, std::align_val_t{SFML_BASE_MAX(alignment, SizeT{chunkAlignment})});
+        }
+
+        if (m_freeLists[sizeClass] == nullptr) [[unlikely]]
+            refill(sizeClass);
+
+        FreeBlock* const block = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block->next;
+
+        m_bytesInUse += getBlockSize(sizeClass);
+        return block;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void deallocate(void* const p, const SizeT bytes, const SizeT alignment) noexcept override
+    {
+        if (p == nullptr)
+            return;
+
+        const SizeT sizeClass = getSizeClass(bytes, alignment);
+
+        if (sizeClass == sizeClassCount) [[unlikely]]
+        {
+            ::operator delete(p, std::align_val_t{SFML_BASE_MAX(alignment, SizeT{chunkAlignment})});
+            return;
+        }
+
+        auto* const block      = static_cast<FreeBlock*>(p);
+        block->next            = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = block;
+
+        SFML_BASE_ASSERT(m_bytesInUse >= getBlockSize(sizeClass));
+        m_bytesInUse -= getBlockSize(sizeClass);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free every chunk owned by the pool
+    ///
+    /// Every pooled pointer previously returned by `allocate` is
+    /// invalidated. Large allocations are not affected.
+    ///
+    ////////////////////////////////////////////////////////////
+    void release() noexcept
+    {
+        while (m_chunks != nullptr)
+        {
+            Chunk* const next = m_chunks->next;
+            ::operator delete(m_chunks, std::align_val_t{chunkAlignment});
+            m_chunks = next;
+        }
+
+        for (FreeBlock*& freeList : m_freeLists)
+            freeList = nullptr;
+
+        m_chunkBytes = 0u;
+        m_bytesInUse = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pooled bytes currently handed out
+    ///
+    /// Block sizes are counted after rounding up to their size class.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getBytesInUse() const noexcept
+    {
+        return m_bytesInUse;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total size of the chunks obtained from the heap
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getChunkBytes() const noexcept
+    {
+        return m_chunkBytes;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of requests that bypassed the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT getLargeAllocationCount() const noexcept
+    {
+        return m_largeAllocationCount;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        Chunk* next;
+    };
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::const]] static constexpr SizeT getBlockSize(const SizeT sizeClass) noexcept
+    {
+        return SizeT{minPooledBlockSize} << sizeClass;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size class for a request, or `sizeClassCount` if it is not pooled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::const]] static constexpr SizeT getSizeClass(const SizeT bytes,
+                                                                                       const SizeT alignment) noexcept
+    {
+        // Blocks are aligned to `min(blockSize, chunkAlignment)`
+        if (alignment > chunkAlignment)
+            return sizeClassCount;
+
+        const SizeT requiredSize = SFML_BASE_MAX(bytes, alignment);
+
+        SizeT sizeClass = 0u;
+        while (sizeClass < sizeClassCount && getBlockSize(sizeClass) < requiredSize)
+            ++sizeClass;
+
+        return sizeClass;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::cold, gnu::noinline]] void refill(const SizeT sizeClass)
+    {
+        const SizeT blockSize  = getBlockSize(sizeClass);
+        const SizeT blockCount = SFML_BASE_MAX(SizeT{minChunkSize} / blockSize, SizeT{4u});
+        const SizeT usable     = blockSize * blockCount;
+
+        // The header occupies a full `chunkAlignment` slot so that blocks stay aligned
+        auto* const chunk = static_cast<Chunk*>(::operator new(chunkAlignment + usable, std::align_val_t{chunkAlignment}));
+
+        chunk->next = m_chunks;
+        m_chunks    = chunk;
+
+        m_chunkBytes += usable;
+
+        char* const blocks = reinterpret_cast<char*>(chunk) + chunkAlignment;
+
+        // Thread the new blocks in address order onto the (empty) free list
+        for (SizeT i = blockCount; i-- > 0u;)
+        {
+            auto* const block      = reinterpret_cast<FreeBlock*>(blocks + i * blockSize);
+            block->next            = m_freeLists[sizeClass];
+            m_freeLists[sizeClass] = block;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    FreeBlock* m_freeLists[sizeClassCount]{}; //!< One intrusive free list per size class
+    Chunk*     m_chunks{nullptr};             //!< Singly-linked list of owned chunks
+    SizeT      m_chunkBytes{0u};              //!< Sum of the usable sizes of all owned chunks
+    SizeT      m_bytesInUse{0u};              //!< Pooled bytes currently handed out
+    SizeT      m_largeAllocationCount{0u};    //!< Requests forwarded to the global heap
+};
+
+} // namespace sf::base
@@ -6,6 +6,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Base/Allocator.hpp"
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/InitializerList.hpp" // IWYU pragma: keep
 #include "SFML/Base/MinMaxMacros.hpp"
@@ -19,7 +20,7 @@
 namespace sf::base
 {
 ////////////////////////////////////////////////////////////
-template <typename TItem>
+template <typename TItem, typename TAllocator = DefaultAllocator>
 class [[nodiscard]] Vector
 {
 private:
@@ -28,6 +29,8 @@ private:
     TItem* m_endSize{nullptr};
     TItem* m_endCapacity{nullptr};
 
+    [[no_unique_address]] TAllocator m_allocator{};
+
 
     ////////////////////////////////////////////////////////////
     [[gnu::cold, gnu::noinline, gnu::flatten]] void reserveImpl(const SizeT targetCapacity)
@@ -38,13 +41,13 @@ private:
 
         SFML_BASE_ASSERT(finalNewCapacity > capacity()); // Should only be called to grow
 
-        auto*      newData = priv::VectorUtils::allocate<TItem>(finalNewCapacity);
+        auto*      newData = m_allocator.template allocate<TItem>(finalNewCapacity);
         const auto oldSize = size();
 
         if (m_data != nullptr)
         {
             priv::VectorUtils::relocateRange(newData, m_data, m_endSize);
-            priv::VectorUtils::deallocate(m_data, currentCapacity);
+            m_allocator.deallocate(m_data, currentCapacity);
         }
         else
         {
@@ -76,17 +79,24 @@ public:
     using difference_type = PtrDiffT;
     using iterator        = TItem*;
     using const_iterator  = const TItem*;
+    using allocator_type  = TAllocator;
 
 
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector() = default;
 
 
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] explicit Vector(const TAllocator& allocator) noexcept : m_allocator{allocator}
+    {
+    }
+
+
     ////////////////////////////////////////////////////////////
     ~Vector()
     {
         priv::VectorUtils::destroyRange(m_data, m_endSize);
-        priv::VectorUtils::deallocate(m_data, capacity());
+        m_allocator.deallocate(m_data, capacity());
     }
 
 
@@ -96,7 +106,7 @@ public:
         if (initialSize == 0u)
             return;
 
-        m_data    = priv::VectorUtils::allocate<TItem>(initialSize);
+        m_data    = m_allocator.template allocate<TItem>(initialSize);
         m_endSize = m_endCapacity = m_data + initialSize;
 
         priv::VectorUtils::defaultConstructRange(m_data, m_endSize);
@@ -109,7 +119,7 @@ public:
         if (initialSize == 0u)
             return;
 
-        m_data    = priv::VectorUtils::allocate<TItem>(initialSize);
+        m_data    = m_allocator.template allocate<TItem>(initialSize);
         m_endSize = m_endCapacity = m_data + initialSize;
 
         priv::VectorUtils::copyConstructRange(m_data, m_endSize, value);
@@ -125,7 +135,7 @@ public:
         if (srcCount == 0u)
             return;
 
-        m_data    = priv::VectorUtils::allocate<TItem>(srcCount);
+        m_data    = m_allocator.template allocate<TItem>(srcCount);
         m_endSize = m_endCapacity = m_data + srcCount;
 
         priv::VectorUtils::copyRange(m_data, srcBegin, srcEnd);
@@ -140,9 +150,10 @@ public:
 
     ////////////////////////////////////////////////////////////
     [[nodiscard, gnu::always_inline]] Vector(const Vector& rhs) :
-        m_data{rhs.m_data == nullptr ? nullptr : priv::VectorUtils::allocate<TItem>(rhs.size())},
+        m_data{rhs.m_data == nullptr ? nullptr : rhs.m_allocator.template allocate<TItem>(rhs.size())},
         m_endSize{m_data + rhs.size()},
-        m_endCapacity{m_data + rhs.size()}
+        m_endCapacity{m_data + rhs.size()},
+        m_allocator{rhs.m_allocator}
     {
         priv::VectorUtils::copyRange(m_data, rhs.m_data, rhs.m_endSize);
     }
@@ -168,7 +179,8 @@ public:
     [[nodiscard, gnu::always_inline]] Vector(Vector&& rhs) noexcept :
         m_data{rhs.m_data},
         m_endSize{rhs.m_endSize},
-        m_endCapacity{rhs.m_endCapacity}
+        m_endCapacity{rhs.m_endCapacity},
+        m_allocator{rhs.m_allocator}
     {
         rhs.m_data    = nullptr;
         rhs.m_endSize = rhs.m_endCapacity = nullptr;
@@ -182,11 +194,13 @@ public:
             return *this;
 
         priv::VectorUtils::destroyRange(m_data, m_endSize);
-        priv::VectorUtils::deallocate(m_data, capacity());
+        m_allocator.deallocate(m_data, capacity());
 
+        // The allocator propagates with the storage it owns
         m_data        = rhs.m_data;
         m_endSize     = rhs.m_endSize;
         m_endCapacity = rhs.m_endCapacity;
+        m_allocator   = rhs.m_allocator;
 
         rhs.m_data    = nullptr;
         rhs.m_endSize = rhs.m_endCapacity = nullptr;
@@ -264,7 +278,7 @@ public:
         if (currentSize == 0u)
         {
             priv::VectorUtils::destroyRange(m_data, m_endSize);
-            priv::VectorUtils::deallocate(m_data, capacity());
+            m_allocator.deallocate(m_data, capacity());
 
             m_data    = nullptr;
             m_endSize = m_endCapacity = nullptr;
@@ -272,10 +286,10 @@ public:
             return;
         }
 
-        auto* newData = priv::VectorUtils::allocate<TItem>(currentSize);
+        auto* newData = m_allocator.template allocate<TItem>(currentSize);
 
         priv::VectorUtils::relocateRange(newData, m_data, m_endSize);
-        priv::VectorUtils::deallocate(m_data, capacity());
+        m_allocator.deallocate(m_data, capacity());
 
         m_data    = newData;
         m_endSize = m_endCapacity = m_data + currentSize;
@@ -429,6 +443,14 @@ public:
         base::genericSwap(m_data, rhs.m_data);
         base::genericSwap(m_endSize, rhs.m_endSize);
         base::genericSwap(m_endCapacity, rhs.m_endCapacity);
+        base::genericSwap(m_allocator, rhs.m_allocator);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const TAllocator& getAllocator() const noexcept
+    {
+        return m_allocator;
     }
 
 
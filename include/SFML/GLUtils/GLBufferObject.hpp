@@ -110,4 +110,15 @@ struct GLElementBufferObject : priv::GLBufferObject<GL_ELEMENT_ARRAY_BUFFER, GL_
     using priv::GLBufferObject<GL_ELEMENT_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER_BINDING>::GLBufferObject;
 };
 
+////////////////////////////////////////////////////////////
+/// \brief Specialization of GLBufferObject for Draw Indirect Buffer Objects.
+///
+/// Provides RAII management for buffers storing indirect draw commands (`GL_DRAW_INDIRECT_BUFFER`).
+///
+////////////////////////////////////////////////////////////
+struct GLDrawIndirectBufferObject : priv::GLBufferObject<GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING>
+{
+    using priv::GLBufferObject<GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING>::GLBufferObject;
+};
+
 } // namespace sf
@@ -0,0 +1,207 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/GLUtils/GLBufferObject.hpp"
+#include "SFML/GLUtils/GLCheck.hpp"
+#include "SFML/GLUtils/Glad.hpp"
+
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Manages an OpenGL buffer sub-allocated linearly with `glBufferSubData`.
+/// \ingroup glutils
+///
+/// Unlike `GLPersistentBuffer`, this class only relies on features
+/// available in OpenGL ES and WebGL. Each write is appended after the
+/// previous one, so that the GPU can still read earlier regions while
+/// the CPU fills new ones, without respecifying the buffer storage.
+///
+/// When the buffer is full, or when the caller knows that the GPU may
+/// still be reading from it (see `invalidate`), the next write orphans
+/// the storage with `glBufferData`: the driver hands out fresh memory
+/// instead of stalling until the pending draws complete.
+///
+/// A minimum capacity can be requested with `reserve`, and `grow`
+/// orphans the storage for a geometrically larger one, so that the
+/// buffer reaches a steady size after a few writes.
+///
+/// Writes start at 4-byte aligned offsets, as required by vertex
+/// attributes and indices of any type.
+///
+/// The buffer object must be bound before calling `write`.
+///
+/// \tparam TBufferObject The type of the underlying buffer object (e.g., `GLVertexBufferObject`).
+///
+////////////////////////////////////////////////////////////
+template <typename TBufferObject>
+class [[nodiscard]] GLStreamingBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] bool fits(const base::SizeT byteCount) const
+    {
+        return m_cursor + alignedSize(byteCount) <= m_capacity;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] bool isEmpty() const
+    {
+        return m_cursor == 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] base::SizeT getCapacity() const
+    {
+        return m_capacity;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of times the storage was (re)specified
+    ///
+    /// Includes the initial allocation, growth, and orphaning.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] base::SizeT getOrphanCount() const
+    {
+        return m_orphanCount;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restart writing from the beginning of the buffer
+    ///
+    /// Only safe once the GPU is done reading from the buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void rewind()
+    {
+        m_cursor = 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restart writing from the beginning of fresh buffer storage
+    ///
+    /// Used when the GPU may still be reading from the buffer: the
+    /// storage is orphaned on the next write.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void invalidate()
+    {
+        m_cursor     = 0u;
+        m_mustOrphan = true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure that the storage holds at least `capacity` bytes
+    ///
+    /// If it is smaller, the storage is orphaned on the next write,
+    /// which restarts from the beginning of the buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(const base::SizeT capacity)
+    {
+        m_minCapacity = SFML_BASE_MAX(m_minCapacity, alignedSize(capacity));
+
+        if (m_capacity < m_minCapacity)
+            invalidate();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restart writing from the beginning of larger fresh storage
+    ///
+    /// Used instead of `invalidate` when the buffer cannot fit a write
+    /// of `byteCount` bytes, the storage grows geometrically.
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(const base::SizeT byteCount)
+    {
+        const auto geometricGrowthTarget = m_capacity + (m_capacity / 2u); // Equivalent to `capacity * 1.5`
+
+        m_minCapacity = SFML_BASE_MAX(m_minCapacity, alignedSize(SFML_BASE_MAX(geometricGrowthTarget, byteCount)));
+        invalidate();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append data to the buffer
+    ///
+    /// \return Byte offset of the written data in the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] base::SizeT write(const void* const data, const base::SizeT byteCount)
+    {
+        if (m_mustOrphan || !fits(byteCount)) [[unlikely]]
+            orphan(byteCount);
+
+        const base::SizeT offset = m_cursor;
+
+        glCheck(glBufferSubData(TBufferObject::bufferType,
+                                static_cast<GLintptr>(offset),
+                                static_cast<GLsizeiptr>(byteCount),
+                                data));
+
+        m_cursor += alignedSize(byteCount);
+        return offset;
+    }
+
+
+private:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::const]] static base::SizeT alignedSize(const base::SizeT byteCount)
+    {
+        return (byteCount + 3u) & ~base::SizeT{3u};
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::cold, gnu::noinline]] void orphan(const base::SizeT byteCount)
+    {
+        const auto geometricGrowthTarget = m_capacity + (m_capacity / 2u); // Equivalent to `capacity * 1.5`
+        const auto requiredCapacity      = SFML_BASE_MAX(alignedSize(byteCount), m_minCapacity);
+        const auto newCapacity           = m_capacity >= requiredCapacity
+                                               ? m_capacity
+                                               : SFML_BASE_MAX(requiredCapacity, geometricGrowthTarget);
+
+        // Respecifying the storage detaches the old one, which is released once the GPU is done with it
+        glCheck(glBufferData(TBufferObject::bufferType, static_cast<GLsizeiptr>(newCapacity), nullptr, GL_STREAM_DRAW));
+
+        m_capacity   = newCapacity;
+        m_cursor     = 0u;
+        m_mustOrphan = false;
+
+        ++m_orphanCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::SizeT m_capacity{0u};    //!< Currently allocated capacity of the buffer
+    base::SizeT m_minCapacity{0u}; //!< Capacity requested with `reserve`, applied on the next orphaning
+    base::SizeT m_cursor{0u};      //!< Byte offset of the next write
+    base::SizeT m_orphanCount{0u}; //!< Number of times the storage was (re)specified
+    bool        m_mustOrphan{};    //!< Whether the storage must be orphaned before the next write
+};
+
+
+////////////////////////////////////////////////////////////
+// Explicit instantiation declarations
+////////////////////////////////////////////////////////////
+extern template class GLStreamingBuffer<GLVertexBufferObject>;
+extern template class GLStreamingBuffer<GLElementBufferObject>;
+
+} // namespace sf
@@ -122,6 +122,153 @@ void main()
     sf_fragColor = sf_v_color * texture(sf_u_texture, sf_v_texCoord);
 }
 
+)glsl";
+
+    ////////////////////////////////////////////////////////////
+    /// \brief GLSL source code for the built-in instanced sprite vertex shader
+    ///
+    /// Used by `sf::CPUInstancedSpriteBatch` and `sf::PersistentGPUInstancedSpriteBatch`
+    /// together with `srcFragment`. Each instance is a sprite: the four corners
+    /// of its quad are derived from `gl_VertexID` and transformed on the GPU,
+    /// so no per-vertex data is needed.
+    ///
+    /// Inputs (per-instance attributes):
+    /// - `vec2 sf_a_instancePosition`: Position of the sprite
+    /// - `vec4 sf_a_instanceColor`: Color of the sprite
+    /// - `vec4 sf_a_instanceTextureRect`: Non-normalized texture rectangle (position, size)
+    /// - `vec2 sf_a_instanceScale`: Scale of the sprite
+    /// - `vec2 sf_a_instanceOrigin`: Origin of the sprite, in local coordinates
+    /// - `float sf_a_instanceRotation`: Rotation of the sprite, in radians
+    ///
+    /// Uniforms and outputs are the same as `srcVertex`.
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr const char* srcInstancedSpriteVertex = R"glsl(
+
+layout(location = 0) uniform mat4 sf_u_mvpMatrix;
+layout(location = 1) uniform sampler2D sf_u_texture;
+
+layout(location = 0) in vec2 sf_a_instancePosition;
+layout(location = 1) in vec4 sf_a_instanceColor;
+layout(location = 2) in vec4 sf_a_instanceTextureRect;
+layout(location = 3) in vec2 sf_a_instanceScale;
+layout(location = 4) in vec2 sf_a_instanceOrigin;
+layout(location = 5) in float sf_a_instanceRotation;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+
+void main()
+{
+    // Quad corners in triangle strip order: (0, 0), (0, 1), (1, 0), (1, 1)
+    vec2 corner = vec2(float(gl_VertexID >> 1), float(gl_VertexID & 1));
+
+    vec2 local = corner * abs(sf_a_instanceTextureRect.zw);
+    vec2 scaled = (local - sf_a_instanceOrigin) * sf_a_instanceScale;
+
+    float s = sin(sf_a_instanceRotation);
+    float c = cos(sf_a_instanceRotation);
+
+    vec2 world = sf_a_instancePosition + vec2(c * scaled.x - s * scaled.y, s * scaled.x + c * scaled.y);
+
+    vec2 texCoord = sf_a_instanceTextureRect.xy + corner * sf_a_instanceTextureRect.zw;
+
+    gl_Position = sf_u_mvpMatrix * vec4(world, 0.0, 1.0);
+    sf_v_color = sf_a_instanceColor;
+    sf_v_texCoord = texCoord / vec2(textureSize(sf_u_texture, 0));
+}
+
+)glsl";
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of textures sampled by the built-in multi-draw shader
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr unsigned int multiDrawTextureCount = 8u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief GLSL source code for the built-in multi-draw vertex shader
+    ///
+    /// Used by the multi-draw auto-batching path of `sf::RenderTarget`
+    /// together with `srcMultiDrawFragment`. Same as `srcVertex`, but
+    /// texture coordinates are left in pixels and the texture to sample
+    /// is selected per draw command.
+    ///
+    /// Additional inputs (per-instance attributes):
+    /// - `uint sf_a_textureSlot`: Index of the texture in `sf_u_textures`
+    ///
+    /// Additional outputs (varyings):
+    /// - `flat uint sf_v_textureSlot`: Passed-through texture slot
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr const char* srcMultiDrawVertex = R"glsl(
+
+layout(location = 0) uniform mat4 sf_u_mvpMatrix;
+
+layout(location = 0) in vec2 sf_a_position;
+layout(location = 1) in vec4 sf_a_color;
+layout(location = 2) in vec2 sf_a_texCoord;
+layout(location = 3) in uint sf_a_textureSlot;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+flat out uint sf_v_textureSlot;
+
+void main()
+{
+    gl_Position = sf_u_mvpMatrix * vec4(sf_a_position, 0.0, 1.0);
+    sf_v_color = sf_a_color;
+    sf_v_texCoord = sf_a_texCoord;
+    sf_v_textureSlot = sf_a_textureSlot;
+}
+
+)glsl";
+
+    ////////////////////////////////////////////////////////////
+    /// \brief GLSL source code for the built-in multi-draw fragment shader
+    ///
+    /// Samples the texture bound to the unit selected by `sf_v_textureSlot`
+    /// among `multiDrawTextureCount` units, then behaves as `srcFragment`.
+    ///
+    /// Uniforms:
+    /// - `sampler2D sf_u_textures[8]`: Textures of the current submission
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr const char* srcMultiDrawFragment = R"glsl(
+
+layout(location = 1) uniform sampler2D sf_u_textures[8];
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+flat in uint sf_v_textureSlot;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+vec4 sampleTexture(sampler2D tex)
+{
+    return texture(tex, sf_v_texCoord / vec2(textureSize(tex, 0)));
+}
+
+void main()
+{
+    // Sampler arrays can only be indexed by constants in all GLSL versions
+    vec4 texel;
+
+    switch (sf_v_textureSlot)
+    {
+        case 0u: texel = sampleTexture(sf_u_textures[0]); break;
+        case 1u: texel = sampleTexture(sf_u_textures[1]); break;
+        case 2u: texel = sampleTexture(sf_u_textures[2]); break;
+        case 3u: texel = sampleTexture(sf_u_textures[3]); break;
+        case 4u: texel = sampleTexture(sf_u_textures[4]); break;
+        case 5u: texel = sampleTexture(sf_u_textures[5]); break;
+        case 6u: texel = sampleTexture(sf_u_textures[6]); break;
+        default: texel = sampleTexture(sf_u_textures[7]); break;
+    }
+
+    sf_fragColor = sf_v_color * texel;
+}
+
 )glsl";
 
     ////////////////////////////////////////////////////////////
@@ -140,6 +287,31 @@ void main()
     /// \see sf::Shader::loadFromMemory
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Shader> create();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an `sf::Shader` instance from the instanced sprite shader sources
+    ///
+    /// Links `srcInstancedSpriteVertex` with `srcFragment`.
+    ///
+    /// \return An `sf::base::Optional<sf::Shader>` containing the compiled
+    ///         shader if successful, or `sf::base::nullOpt` otherwise.
+    ///
+    /// \see create
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Shader> createInstancedSprite();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an `sf::Shader` instance from the multi-draw shader sources
+    ///
+    /// Links `srcMultiDrawVertex` with `srcMultiDrawFragment`, and assigns
+    /// texture unit `i` to `sf_u_textures[i]`.
+    ///
+    /// \return An `sf::base::Optional<sf::Shader>` containing the compiled
+    ///         shader if successful, or `sf::base::nullOpt` otherwise.
+    ///
+    /// \see create
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Shader> createMultiDraw();
 };
 
 } // namespace sf
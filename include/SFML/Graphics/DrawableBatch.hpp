@@ -12,10 +12,15 @@
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/Transformable.hpp"
 #include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
 #include "SFML/Graphics/VertexSpan.hpp"
 
+#include "SFML/System/Rect2.hpp"
+
+#include "SFML/Base/Allocator.hpp"
 #include "SFML/Base/InPlacePImpl.hpp"
 #include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
 #include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/Vector.hpp"
 
@@ -27,6 +32,7 @@ namespace sf
 {
 class Font;
 class RenderTarget;
+class RetainedBatch;
 class Shape;
 class Text;
 
@@ -61,6 +67,28 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 struct CPUStorage
 {
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Vertices and indices are allocated from the global heap.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] CPUStorage() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the storage on top of a memory resource
+    ///
+    /// Vertices and indices are allocated from `resource`, which
+    /// must outlive the storage. Useful to build transient
+    /// per-frame batches on a `sf::base::FrameArena`.
+    ///
+    /// \param resource Memory resource used for all allocations
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit CPUStorage(base::MemoryResource& resource) : vertices{resource}, indices{resource}
+    {
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Clears all vertex and index data from the storage
     ///
@@ -160,8 +188,9 @@ struct CPUStorage
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    base::Vector<Vertex>    vertices; //!< CPU buffer for vertices
-    base::Vector<IndexType> indices;  //!< CPU buffer for indices
+    base::Vector<Vertex, base::ResourceAllocator>    vertices;                            //!< CPU buffer for vertices
+    base::Vector<IndexType, base::ResourceAllocator> indices;                             //!< CPU buffer for indices
+    VertexFormat                                     vertexFormat{VertexFormat::Float32}; //!< Layout used on upload
 };
 
 ////////////////////////////////////////////////////////////
@@ -359,6 +388,137 @@ struct PersistentGPUStorage
     IndexType nIndices{};  //!< Number of "active" indices in the buffer
 };
 
+////////////////////////////////////////////////////////////
+/// \brief Internal storage strategy for `DrawableBatchImpl` streaming CPU memory to a ring of GPU buffers
+///
+/// `StreamingGPUStorage` builds vertex and index data in CPU memory, like
+/// `CPUStorage`, but uploads it with `glBufferSubData` into a round-robin
+/// set of preallocated vertex/index buffer pairs instead of respecifying
+/// a single buffer on every draw. Successive draws are appended to the
+/// current pair, which starts with a minimum size and is first grown
+/// geometrically when full. Once it is large enough, a full pair gets
+/// a fence (where available) and the next pair is reused if the GPU is
+/// done with it, or orphaned otherwise, so that the CPU never waits on
+/// the GPU.
+///
+/// Only relies on features available in OpenGL ES and WebGL.
+///
+/// This struct is used as a template parameter for `sf::priv::DrawableBatchImpl`.
+///
+////////////////////////////////////////////////////////////
+struct StreamingGPUStorage : CPUStorage
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of the uploaded geometry in the GPU buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] GPURegion
+    {
+        base::SizeT vertexByteOffset; //!< Byte offset of the first vertex in the vertex buffer
+        base::SizeT indexOffset;      //!< Offset (in number of indices) of the first index in the index buffer
+        bool        shortIndices;     //!< Whether indices were uploaded as 16-bit integers
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Activity of the ring of GPU buffers since construction
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] StreamingStatistics
+    {
+        base::SizeT slotRotations;  //!< Number of times a full buffer pair was left for the next one
+        base::SizeT storageOrphans; //!< Number of times the storage of a buffer was (re)specified
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Vertices and indices are allocated from the global heap.
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit StreamingGPUStorage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the storage on top of a memory resource
+    ///
+    /// \param resource Memory resource used for all CPU-side allocations
+    ///
+    /// \see `CPUStorage::CPUStorage(base::MemoryResource&)`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit StreamingGPUStorage(base::MemoryResource& resource);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Releases GPU resources managed by this storage object.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamingGPUStorage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingGPUStorage(const StreamingGPUStorage&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingGPUStorage& operator=(const StreamingGPUStorage&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingGPUStorage(StreamingGPUStorage&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamingGPUStorage& operator=(StreamingGPUStorage&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Selects the buffer pair that will receive the current geometry
+    /// \warning Internal SFML detail, subject to change.
+    ///
+    /// Moves to the next buffer pair of the ring if the current one
+    /// cannot fit the committed vertices and indices, once packed
+    /// in `vertexFormat`.
+    ///
+    /// \return Const void pointer to the VAO group to bind before calling `uploadToGPU`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* acquireVAOGroup() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uploads the committed vertices and indices to the GPU
+    /// \warning Internal SFML detail, subject to change.
+    ///
+    /// Vertices are packed in `vertexFormat` on the way.
+    ///
+    /// The VAO group returned by the last call to `acquireVAOGroup`
+    /// must be bound.
+    ///
+    /// \return Location of the uploaded geometry in the GPU buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] GPURegion uploadToGPU() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the activity of the ring of GPU buffers
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] StreamingStatistics getStreamingStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    mutable base::InPlacePImpl<Impl, 576> impl; //!< Implementation details (ring of GPU buffers)
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Base class template for drawable batches
 /// \ingroup graphics
@@ -370,16 +530,18 @@ struct PersistentGPUStorage
 ///
 /// This class manages a collection of vertices and indices, using a
 /// storage strategy defined by the `TStorage` template parameter
-/// (e.g., `sf::priv::CPUStorage` or `sf::priv::PersistentGPUStorage`).
+/// (e.g., `sf::priv::CPUStorage`, `sf::priv::PersistentGPUStorage` or
+/// `sf::priv::StreamingGPUStorage`).
 /// It inherits from `sf::Transformable` to allow the entire batch
 /// to be transformed (translated, rotated, scaled).
 ///
-/// Users typically interact with derived classes like `sf::CPUDrawableBatch`
-/// or `sf::PersistentGPUDrawableBatch` rather than this template directly.
+/// Users typically interact with derived classes like `sf::CPUDrawableBatch`,
+/// `sf::PersistentGPUDrawableBatch` or `sf::StreamingGPUDrawableBatch` rather
+/// than this template directly.
 ///
 /// \tparam TStorage The storage strategy for vertex and index data
 ///
-/// \see sf::CPUDrawableBatch, sf::PersistentGPUDrawableBatch
+/// \see sf::CPUDrawableBatch, sf::PersistentGPUDrawableBatch, sf::StreamingGPUDrawableBatch
 ///
 ////////////////////////////////////////////////////////////
 template <typename TStorage>
@@ -485,6 +647,20 @@ public:
     ////////////////////////////////////////////////////////////
     void add(const Sprite& sprite);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds a contiguous range of `sf::Sprite` objects to the batch
+    ///
+    /// Equivalent to adding each sprite in turn, but culls the
+    /// sprites four at a time when a cull rectangle is set.
+    ///
+    /// \param sprites Pointer to the first sprite of the range
+    /// \param count   Number of sprites in the range
+    ///
+    /// \see `setCullRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Sprite* sprites, base::SizeT count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Adds an `sf::Shape` to the batch
     ///
@@ -676,16 +852,67 @@ public:
     ////////////////////////////////////////////////////////////
     VertexSpan add(const Font& font, const TextData& textData);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Sets the rectangle outside of which added drawables are skipped
+    ///
+    /// When set, `add` tests cheap conservative bounds of sprites,
+    /// shapes, texts, and circle, ellipse, pie slice, rectangle,
+    /// rounded rectangle, ring, ring pie slice and star shape data
+    /// against `cullRect`, and does not generate any geometry for
+    /// the ones entirely outside of it. Overloads returning a
+    /// `VertexSpan` return an empty span for culled shapes.
+    ///
+    /// The rectangle is expressed in the local coordinate system of
+    /// the batch, i.e. before the batch's own transform is applied.
+    /// Typically, it is set to the bounds of the view the batch is
+    /// drawn with (see `sf::View::getInverseTransform`).
+    ///
+    /// Culling is disabled by default.
+    ///
+    /// \param cullRect Cull rectangle (e.g. `base::makeOptional(rect)`), `base::nullOpt` to disable culling
+    ///
+    /// \see `getCullRect`, `getNumCulled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setCullRect(const base::Optional<Rect2f>& cullRect)
+    {
+        m_cullRect = cullRect;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the rectangle outside of which added drawables are skipped
+    ///
+    /// \see `setCullRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const base::Optional<Rect2f>& getCullRect() const noexcept
+    {
+        return m_cullRect;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of drawables skipped by culling since the last `clear`
+    ///
+    /// \see `setCullRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] base::SizeT getNumCulled() const noexcept
+    {
+        return m_numCulled;
+    }
+
     ////////////////////////////////////////////////////////////
     /// \brief Clears all geometry from the batch
     ///
     /// Removes all vertices and indices from the batch, making it empty.
-    /// This calls the `clear` method of the underlying storage.
+    /// This calls the `clear` method of the underlying storage and
+    /// resets the culled drawable counter. The cull rectangle is kept.
     ///
     ////////////////////////////////////////////////////////////
     [[gnu::always_inline]] void clear()
     {
         m_storage.clear();
+        m_numCulled = 0u;
     }
 
     ////////////////////////////////////////////////////////////
@@ -723,6 +950,7 @@ public:
 
 private:
     friend RenderTarget;
+    friend RetainedBatch;
 
     ////////////////////////////////////////////////////////////
     /// \brief Generates and adds vertices for a shape resembling a triangle fan
@@ -746,6 +974,30 @@ private:
                                               auto&&      pointFn,
                                               Vec2f       centerOffset = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Generates and adds vertices for a shape resembling a triangle fan
+    ///
+    /// Same as `drawTriangleFanShapeFromPoints`, but the positions of all
+    /// outer points are written at once by `positionsFn`, which allows
+    /// transforming cached unit-space points in bulk.
+    ///
+    /// \param nPoints Number of points on the shape's perimeter (excluding center)
+    /// \param descriptor Shape-specific data (e.g., `CircleShapeData`)
+    /// \param positionsFn A function that takes the shape's transform and a pointer
+    ///                    to the first outer vertex, writes the positions of the
+    ///                    `nPoints` outer vertices and returns their `priv::PointBounds`
+    /// \param centerOffset Offset for the central point of the fan, relative to the shape's origin
+    ///
+    /// \return A `VertexSpan` referring to the added vertices.
+    ///
+    /// \warning The returned span is invalidated after the next call to `add` or batch flush.
+    ///
+    ////////////////////////////////////////////////////////////
+    VertexSpan drawTriangleFanShapeFromPositions(base::SizeT nPoints,
+                                                 const auto& descriptor,
+                                                 auto&&      positionsFn,
+                                                 Vec2f       centerOffset = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Adds vertices for a shape's fill to the batch
     ///
@@ -770,11 +1022,23 @@ private:
     ////////////////////////////////////////////////////////////
     void addShapeOutline(const Transform& transform, const Vertex* data, base::SizeT size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Checks a drawable against the cull rectangle, counting culled drawables
+    ///
+    /// \param getBoundsFn Returns the bounds of the drawable, only invoked if a cull rectangle is set
+    ///
+    /// \return `true` if the drawable must be skipped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool cull(auto&& getBoundsFn);
+
 protected:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TStorage m_storage;
+    TStorage               m_storage;
+    base::Optional<Rect2f> m_cullRect;      //!< Drawables outside of this rectangle are skipped, if set
+    base::SizeT            m_numCulled{0u}; //!< Number of drawables skipped since the last `clear`
 };
 
 
@@ -783,6 +1047,7 @@ protected:
 ////////////////////////////////////////////////////////////
 extern template class DrawableBatchImpl<CPUStorage>;
 extern template class DrawableBatchImpl<PersistentGPUStorage>;
+extern template class DrawableBatchImpl<StreamingGPUStorage>;
 
 } // namespace sf::priv
 
@@ -808,12 +1073,58 @@ namespace sf
 /// window.draw(batch); // Data uploaded to GPU here
 /// \endcode
 ///
+/// A `sf::base::MemoryResource` can be passed on construction to
+/// allocate the batch's vertices and indices from it, e.g. a
+/// `sf::base::FrameArena` for batches rebuilt every frame:
+/// \code
+/// sf::base::FrameArena frameArena;
+///
+/// while (window.isOpen())
+/// {
+///     {
+///         sf::CPUDrawableBatch batch{frameArena};
+///         // ... add drawables
+///         window.draw(batch);
+///     }
+///
+///     frameArena.reset(); // all batches built on the arena must be gone
+/// }
+/// \endcode
+///
 /// \see sf::PersistentGPUDrawableBatch, sf::priv::DrawableBatchImpl, sf::priv::CPUStorage
 ///
 ////////////////////////////////////////////////////////////
 class CPUDrawableBatch : public priv::DrawableBatchImpl<priv::CPUStorage>
 {
     using DrawableBatchImpl<priv::CPUStorage>::DrawableBatchImpl;
+
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layout in which vertices are uploaded to the GPU
+    ///
+    /// Compact formats trade position and texture coordinate
+    /// precision for upload bandwidth. Takes effect on the next draw.
+    ///
+    /// \param format Vertex format to use, `sf::VertexFormat::Float32` by default
+    ///
+    /// \see `getVertexFormat`, `sf::VertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setVertexFormat(const VertexFormat format) noexcept
+    {
+        m_storage.vertexFormat = format;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout in which vertices are uploaded to the GPU
+    ///
+    /// \see `setVertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] VertexFormat getVertexFormat() const noexcept
+    {
+        return m_storage.vertexFormat;
+    }
 };
 
 ////////////////////////////////////////////////////////////
@@ -891,6 +1202,77 @@ public:
     }
 };
 
+////////////////////////////////////////////////////////////
+/// \brief A drawable batch that streams vertex data to a ring of GPU buffers
+/// \ingroup graphics
+///
+/// `StreamingGPUDrawableBatch` is a specialization of `DrawableBatchImpl`
+/// that uses `sf::priv::StreamingGPUStorage`. Vertex and index data is
+/// stored in CPU memory and appended with `glBufferSubData` to a set of
+/// preallocated GPU buffers used in round-robin when the batch is drawn.
+///
+/// Unlike `sf::PersistentGPUDrawableBatch`, it is supported on OpenGL ES
+/// and WebGL, where it is also what the render target uses for
+/// `sf::RenderTarget::AutoBatchMode::GPUStorage`.
+///
+/// Example:
+/// \code
+/// sf::StreamingGPUDrawableBatch batch;
+/// batch.add(sf::Sprite{/* ... */});
+/// // ... add more drawables
+///
+/// window.draw(batch); // Data appended to the current GPU buffer here
+/// \endcode
+///
+/// \see sf::CPUDrawableBatch, sf::priv::DrawableBatchImpl, sf::priv::StreamingGPUStorage
+///
+////////////////////////////////////////////////////////////
+class StreamingGPUDrawableBatch : public priv::DrawableBatchImpl<priv::StreamingGPUStorage>
+{
+    using DrawableBatchImpl<priv::StreamingGPUStorage>::DrawableBatchImpl;
+
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layout in which vertices are uploaded to the GPU
+    ///
+    /// Compact formats trade position and texture coordinate
+    /// precision for upload bandwidth. Takes effect on the next draw.
+    ///
+    /// \param format Vertex format to use, `sf::VertexFormat::Float32` by default
+    ///
+    /// \see `getVertexFormat`, `sf::VertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setVertexFormat(const VertexFormat format) noexcept
+    {
+        m_storage.vertexFormat = format;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout in which vertices are uploaded to the GPU
+    ///
+    /// \see `setVertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] VertexFormat getVertexFormat() const noexcept
+    {
+        return m_storage.vertexFormat;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the activity of the ring of GPU buffers
+    ///
+    /// Counts how often full buffer pairs were left for the next
+    /// one, and how often buffer storage was allocated, grown, or
+    /// orphaned. Useful to tune how geometry is split across draws.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] priv::StreamingGPUStorage::StreamingStatistics getStreamingStatistics() const
+    {
+        return m_storage.getStreamingStatistics();
+    }
+};
+
 } // namespace sf
 
 
@@ -899,8 +1281,8 @@ public:
 /// \ingroup graphics
 ///
 /// `sf::DrawableBatch` refers to a concept of batching drawables for performance,
-/// realized through concrete classes like `sf::CPUDrawableBatch` and
-/// `sf::PersistentGPUDrawableBatch`.
+/// realized through concrete classes like `sf::CPUDrawableBatch`,
+/// `sf::PersistentGPUDrawableBatch` and `sf::StreamingGPUDrawableBatch`.
 ///
 /// Batching draw calls is a common optimization technique in graphics programming.
 /// Instead of drawing each object (sprite, shape, text) individually, which
@@ -908,17 +1290,22 @@ public:
 /// are collected into a single "batch". This batch is then drawn with one
 /// (or very few) commands, reducing CPU overhead and often improving GPU efficiency.
 ///
-/// SFML provides two main types of drawable batches:
+/// SFML provides three main types of drawable batches:
 ///
 /// - `sf::CPUDrawableBatch`: Stores vertex data in CPU memory. Data is typically
 ///   uploaded to the GPU when the batch is drawn. Simpler to manage for
-///   highly dynamic data. This is the only supported batch type for OpenGL ES.
+///   highly dynamic data.
 ///
 /// - `sf::PersistentGPUDrawableBatch`: Stores vertex data in persistently mapped
 ///   GPU memory. Can be faster for large or less frequently updated batches
-///   as it allows direct modification of GPU data.
+///   as it allows direct modification of GPU data. Not available on OpenGL ES.
+///
+/// - `sf::StreamingGPUDrawableBatch`: Stores vertex data in CPU memory and
+///   appends it to a ring of preallocated GPU buffers when drawn, avoiding
+///   buffer reallocations and CPU/GPU synchronization stalls. Supported on
+///   OpenGL ES and WebGL.
 ///
-/// Both batch types inherit from `sf::Transformable`, allowing the entire
+/// All batch types inherit from `sf::Transformable`, allowing the entire
 /// group of batched objects to be transformed as a single unit.
 ///
 /// Usage example (using `sf::CPUDrawableBatch`):
@@ -941,6 +1328,6 @@ public:
 /// Choose the batch type based on your specific needs for update frequency
 /// and performance characteristics.
 ///
-/// \see sf::CPUDrawableBatch, sf::PersistentGPUDrawableBatch
+/// \see sf::CPUDrawableBatch, sf::PersistentGPUDrawableBatch, sf::StreamingGPUDrawableBatch
 ///
 ////////////////////////////////////////////////////////////
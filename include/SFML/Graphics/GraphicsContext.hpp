@@ -73,6 +73,12 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static Shader& getBuiltInShader();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the built-in shader used by instanced sprite batches
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Shader& getBuiltInInstancedSpriteShader();
+
     ////////////////////////////////////////////////////////////
     /// \brief Returns the built-in 1x1 white texture
     ///
@@ -136,6 +142,12 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static Shader& getInstalledBuiltInShader();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Returns the built-in instanced sprite shader (private `static` version)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Shader& getInstalledBuiltInInstancedSpriteShader();
+
     ////////////////////////////////////////////////////////////
     /// \brief Returns the built-in 1x1 white texture (private `static` version)
     ///
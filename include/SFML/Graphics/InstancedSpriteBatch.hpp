@@ -0,0 +1,346 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/Allocator.hpp"
+#include "SFML/Base/InPlacePImpl.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class RenderTarget;
+struct Sprite;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Per-sprite record uploaded by instanced sprite batches
+/// \ingroup graphics
+///
+/// The quad of the sprite is expanded and transformed in the
+/// vertex shader (see `sf::DefaultShader::srcInstancedSpriteVertex`),
+/// so a sprite takes 40 bytes on the GPU instead of the 104 bytes
+/// of its four vertices and six indices.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] SpriteInstance
+{
+    Vec2f     position;       //!< Position of the sprite
+    Color     color;          //!< Color of the sprite
+    base::I16 textureRect[4]; //!< Position and size of the texture rectangle in pixels (negative size flips)
+    Vec2f     scale;          //!< Scale of the sprite
+    Vec2f     origin;         //!< Origin of the sprite, in local coordinates
+    float     rotation;       //!< Rotation of the sprite, in radians
+};
+
+static_assert(sizeof(SpriteInstance) == 40u);
+
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Internal storage strategy for `InstancedSpriteBatchImpl` using CPU-side memory
+///
+/// Sprite instances are stored in a `sf::base::Vector` and uploaded
+/// to the GPU on each draw call.
+///
+////////////////////////////////////////////////////////////
+struct InstancedSpriteCPUStorage
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Instances are allocated from the global heap.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] InstancedSpriteCPUStorage() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the storage on top of a memory resource
+    ///
+    /// \param resource Memory resource used for all allocations, must outlive the storage
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit InstancedSpriteCPUStorage(base::MemoryResource& resource) : instances{resource}
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline, gnu::flatten]] void clear()
+    {
+        instances.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::flatten]] SpriteInstance* reserveMoreInstances(const base::SizeT count)
+    {
+        return instances.reserveMore(count);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline, gnu::flatten]] void commitMoreInstances(const base::SizeT count) noexcept
+    {
+        instances.unsafeSetSize(instances.size() + count);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::flatten, gnu::pure]] base::SizeT getNumInstances() const noexcept
+    {
+        return instances.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::Vector<SpriteInstance, base::ResourceAllocator> instances; //!< CPU buffer for sprite instances
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Internal storage strategy for `InstancedSpriteBatchImpl` using persistent GPU memory
+///
+/// Sprite instances are written directly into a persistently mapped
+/// GPU buffer. Like `sf::priv::PersistentGPUStorage`, not available
+/// on OpenGL ES.
+///
+////////////////////////////////////////////////////////////
+struct InstancedSpritePersistentGPUStorage
+{
+    ////////////////////////////////////////////////////////////
+    explicit InstancedSpritePersistentGPUStorage();
+    ~InstancedSpritePersistentGPUStorage();
+
+    ////////////////////////////////////////////////////////////
+    InstancedSpritePersistentGPUStorage(const InstancedSpritePersistentGPUStorage&)            = delete;
+    InstancedSpritePersistentGPUStorage& operator=(const InstancedSpritePersistentGPUStorage&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    InstancedSpritePersistentGPUStorage(InstancedSpritePersistentGPUStorage&&) noexcept;
+    InstancedSpritePersistentGPUStorage& operator=(InstancedSpritePersistentGPUStorage&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void clear()
+    {
+        nInstances = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SpriteInstance* reserveMoreInstances(base::SizeT count);
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void commitMoreInstances(const base::SizeT count) noexcept
+    {
+        nInstances += count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::flatten, gnu::pure]] base::SizeT getNumInstances() const noexcept
+    {
+        return nInstances;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets a pointer to the Vertex Array Object (VAO) group
+    /// \warning Internal SFML detail, subject to change.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getVAOGroup() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Flushes a range of instance writes to the GPU
+    ///
+    /// \param count  Number of instances in the range to flush
+    /// \param offset Offset (in number of instances) from the beginning of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushWritesToGPU(base::SizeT count, base::SizeT offset) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 128> impl; //!< Implementation details
+
+    base::SizeT nInstances{}; //!< Number of "active" instances in the buffer
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Base class template for instanced sprite batches
+///
+/// Stores one `sf::SpriteInstance` per sprite, using the storage
+/// strategy defined by `TStorage`. The whole batch is drawn with a
+/// single instanced draw call.
+///
+/// \tparam TStorage The storage policy (e.g., `InstancedSpriteCPUStorage`)
+///
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+class [[nodiscard]] SFML_GRAPHICS_API InstancedSpriteBatchImpl : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param storageArgs Arguments to pass to the `TStorage` constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... TStorageArgs>
+    explicit InstancedSpriteBatchImpl(TStorageArgs&&... storageArgs) : m_storage(SFML_BASE_FORWARD(storageArgs)...)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserves space for a given number of sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline, gnu::flatten]] void reserve(const base::SizeT spriteCount)
+    {
+        (void)m_storage.reserveMoreInstances(spriteCount);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds a sprite to the batch
+    ///
+    /// The texture rectangle is rounded to whole pixels.
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Adds a raw sprite instance to the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const SpriteInstance& instance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes all sprites from the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void clear()
+    {
+        m_storage.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Checks if the batch is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::flatten, gnu::pure]] bool isEmpty() const noexcept
+    {
+        return m_storage.getNumInstances() == 0u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of sprites in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::flatten, gnu::pure]] base::SizeT getNumSprites() const noexcept
+    {
+        return m_storage.getNumInstances();
+    }
+
+private:
+    friend RenderTarget;
+
+protected:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    TStorage m_storage;
+};
+
+
+////////////////////////////////////////////////////////////
+// Explicit instantiation declarations
+////////////////////////////////////////////////////////////
+extern template class InstancedSpriteBatchImpl<InstancedSpriteCPUStorage>;
+extern template class InstancedSpriteBatchImpl<InstancedSpritePersistentGPUStorage>;
+
+} // namespace sf::priv
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief An instanced sprite batch that stores instances in CPU memory
+/// \ingroup graphics
+///
+/// Instances are uploaded to the GPU when the batch is drawn.
+///
+/// \see sf::PersistentGPUInstancedSpriteBatch, sf::SpriteInstance
+///
+////////////////////////////////////////////////////////////
+class CPUInstancedSpriteBatch : public priv::InstancedSpriteBatchImpl<priv::InstancedSpriteCPUStorage>
+{
+    using InstancedSpriteBatchImpl<priv::InstancedSpriteCPUStorage>::InstancedSpriteBatchImpl;
+};
+
+////////////////////////////////////////////////////////////
+/// \brief An instanced sprite batch that stores instances in persistent GPU memory
+/// \ingroup graphics
+///
+/// Instances are written directly to persistently mapped GPU memory.
+/// As with `sf::PersistentGPUDrawableBatch`, the batch must not be
+/// modified while the GPU may still be reading from it. Not available
+/// on OpenGL ES.
+///
+/// \see sf::CPUInstancedSpriteBatch, sf::SpriteInstance
+///
+////////////////////////////////////////////////////////////
+class PersistentGPUInstancedSpriteBatch
+    : public priv::InstancedSpriteBatchImpl<priv::InstancedSpritePersistentGPUStorage>
+{
+    using InstancedSpriteBatchImpl<priv::InstancedSpritePersistentGPUStorage>::InstancedSpriteBatchImpl;
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InstancedSpriteBatch
+/// \ingroup graphics
+///
+/// Instanced sprite batches are an alternative to drawable batches
+/// for scenes made of many sprites sharing a texture. Instead of
+/// generating four transformed vertices and six indices per sprite
+/// on the CPU, they store a compact `sf::SpriteInstance` record and
+/// let the vertex shader expand and transform the quad.
+///
+/// By default, batches are drawn with the built-in instanced sprite
+/// shader. A custom shader must consume the per-instance attributes
+/// described in `sf::DefaultShader::srcInstancedSpriteVertex`.
+///
+/// Usage example:
+/// \code
+/// sf::CPUInstancedSpriteBatch batch;
+///
+/// for (const sf::Sprite& sprite : sprites)
+///     batch.add(sprite);
+///
+/// window.draw(batch, {.texture = &texture});
+/// \endcode
+///
+/// \see sf::CPUInstancedSpriteBatch, sf::PersistentGPUInstancedSpriteBatch, sf::CPUDrawableBatch
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,256 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Indirect draw command, laid out as expected by `glMultiDrawElementsIndirect`
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] DrawElementsIndirectCommand
+{
+    base::U32 count;         //!< Number of indices to draw
+    base::U32 instanceCount; //!< Number of instances to draw, always `1`
+    base::U32 firstIndex;    //!< Offset of the first index in the index buffer
+    base::I32 baseVertex;    //!< Value added to each index, always `0`
+    base::U32 baseInstance;  //!< Texture slot of the draw within its submission
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Builds indirect draw commands for ranges of indices drawn with different textures
+///
+/// Consecutive ranges of an index buffer, each drawn with its
+/// own texture, are grouped into submissions that can each be
+/// issued with a single `glMultiDrawElementsIndirect` call.
+/// Every submission uses at most `maxTexturesPerSubmission`
+/// distinct textures, and every command stores the slot of its
+/// texture in the table of its submission as `baseInstance`.
+///
+/// Draws are kept in the order they were added, so blending
+/// produces the same result as drawing the ranges one by one.
+///
+/// \tparam TTextureKey Equality-comparable texture identifier
+///
+////////////////////////////////////////////////////////////
+template <typename TTextureKey>
+class [[nodiscard]] MultiDrawCommandBuilder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Group of commands issued with a single multi-draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Submission
+    {
+        base::SizeT firstCommand; //!< Index of the first command of the submission
+        base::SizeT commandCount; //!< Number of commands of the submission
+        base::SizeT firstTexture; //!< Index of the first texture of the submission
+        base::SizeT textureCount; //!< Number of textures of the submission, bound to slots `0` to `textureCount - 1`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty builder
+    ///
+    /// \param maxTexturesPerSubmission Number of textures that can be bound at once
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit MultiDrawCommandBuilder(const base::SizeT maxTexturesPerSubmission) :
+        m_maxTexturesPerSubmission(maxTexturesPerSubmission)
+    {
+        SFML_BASE_ASSERT(maxTexturesPerSubmission > 0u);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a range of indices drawn with a given texture
+    ///
+    /// Empty ranges are ignored. A range that directly follows the
+    /// previous command and uses the same texture extends it
+    /// instead of adding a new command.
+    ///
+    /// \param textureKey Texture used to draw the range
+    /// \param firstIndex Offset of the first index of the range
+    /// \param indexCount Number of indices of the range
+    ///
+    ////////////////////////////////////////////////////////////
+    void addDraw(const TTextureKey& textureKey, const base::SizeT firstIndex, const base::SizeT indexCount)
+    {
+        if (indexCount == 0u)
+            return;
+
+        if (m_submissions.empty())
+            startSubmission();
+
+        const auto slot = static_cast<base::U32>(getOrAddTextureSlot(textureKey));
+
+        Submission& submission = m_submissions.back();
+
+        if (submission.commandCount > 0u)
+        {
+            DrawElementsIndirectCommand& last = m_commands.back();
+
+            if (last.baseInstance == slot && last.firstIndex + last.count == firstIndex)
+            {
+                last.count += static_cast<base::U32>(indexCount);
+                return;
+            }
+        }
+
+        m_commands.pushBack({
+            .count         = static_cast<base::U32>(indexCount),
+            .instanceCount = 1u,
+            .firstIndex    = static_cast<base::U32>(firstIndex),
+            .baseVertex    = 0,
+            .baseInstance  = slot,
+        });
+
+        ++submission.commandCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all commands, submissions and textures
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear() noexcept
+    {
+        m_commands.clear();
+        m_submissions.clear();
+        m_textures.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if no draw has been added since the last `clear`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return m_commands.empty();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the commands, in order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const DrawElementsIndirectCommand> getCommands() const noexcept
+    {
+        return {m_commands.data(), m_commands.size()};
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the submissions, in order
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const Submission> getSubmissions() const noexcept
+    {
+        return {m_submissions.data(), m_submissions.size()};
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture tables of all the submissions, concatenated
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const TTextureKey> getTextures() const noexcept
+    {
+        return {m_textures.data(), m_textures.size()};
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of textures of a submission
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getMaxTexturesPerSubmission() const noexcept
+    {
+        return m_maxTexturesPerSubmission;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new submission after the last command and texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void startSubmission()
+    {
+        m_submissions.pushBack({
+            .firstCommand = m_commands.size(),
+            .commandCount = 0u,
+            .firstTexture = m_textures.size(),
+            .textureCount = 0u,
+        });
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the slot of a texture in the current submission, adding it if needed
+    ///
+    /// Starts a new submission if the texture table of the current one is full.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getOrAddTextureSlot(const TTextureKey& textureKey)
+    {
+        const Submission& current = m_submissions.back();
+
+        // Texture tables are small, a linear search is the fastest option
+        for (base::SizeT i = 0u; i < current.textureCount; ++i)
+            if (m_textures[current.firstTexture + i] == textureKey)
+                return i;
+
+        if (current.textureCount == m_maxTexturesPerSubmission)
+            startSubmission();
+
+        m_textures.pushBack(textureKey);
+        return m_submissions.back().textureCount++;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::Vector<DrawElementsIndirectCommand> m_commands;                 //!< Commands of all submissions
+    base::Vector<Submission>                  m_submissions;              //!< Submissions, in order
+    base::Vector<TTextureKey>                 m_textures;                 //!< Texture tables of all submissions
+    base::SizeT                               m_maxTexturesPerSubmission; //!< Size of a texture table
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MultiDrawCommandBuilder
+/// \ingroup graphics
+///
+/// `sf::MultiDrawCommandBuilder` contains the CPU side of the
+/// multi-draw auto-batching path of `sf::RenderTarget`: it turns
+/// a sequence of texture changes within a batch into indirect
+/// draw commands, without touching OpenGL. Binding the textures
+/// of each submission and uploading the commands is left to the
+/// caller.
+///
+/// Usage example:
+/// \code
+/// sf::MultiDrawCommandBuilder<const sf::Texture*> builder(/* maxTexturesPerSubmission */ 8u);
+///
+/// builder.addDraw(&textureA, /* firstIndex */ 0u, /* indexCount */ 6u);
+/// builder.addDraw(&textureB, /* firstIndex */ 6u, /* indexCount */ 6u);
+/// builder.addDraw(&textureA, /* firstIndex */ 12u, /* indexCount */ 6u);
+///
+/// // One submission with two textures and three commands
+/// for (const auto& submission : builder.getSubmissions())
+/// {
+///     // Bind `builder.getTextures()[submission.firstTexture + slot]` to each slot,
+///     // then issue `submission.commandCount` commands from `submission.firstCommand`
+/// }
+/// \endcode
+///
+/// \see sf::RenderTarget::setAutoBatchMultiDrawEnabled
+///
+////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 #include "SFML/Graphics/IndexType.hpp"
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
 #include "SFML/Graphics/VertexSpan.hpp"
 
 #include "SFML/System/Rect2.hpp"
@@ -30,15 +31,20 @@
 namespace sf
 {
 class CPUDrawableBatch;
+class CPUInstancedSpriteBatch;
 
 template <typename TBufferObject>
 class GLPersistentBuffer;
 
 class Font;
 class PersistentGPUDrawableBatch;
+class PersistentGPUInstancedSpriteBatch;
+class RetainedBatch;
 class Shader;
 class Shape;
+class StreamingGPUDrawableBatch;
 class Text;
+class TextLogView;
 class Texture;
 class VertexBuffer;
 
@@ -101,8 +107,9 @@ public:
     ////////////////////////////////////////////////////////////
     struct DrawStatistics
     {
-        unsigned int drawCalls{0u};     //!< Number of draw calls
-        base::SizeT  drawnVertices{0u}; //!< Number of vertices drawn
+        unsigned int drawCalls{0u};       //!< Number of draw calls
+        base::SizeT  drawnVertices{0u};   //!< Number of vertices drawn
+        base::SizeT  culledDrawables{0u}; //!< Number of auto-batched drawables skipped by view culling
     };
 
     ////////////////////////////////////////////////////////////
@@ -206,7 +213,7 @@ public:
     {
         Disabled,   //!< Auto-batching is disabled
         CPUStorage, //!< Auto-batching is enabled with CPU storage
-        GPUStorage, //!< Auto-batching is enabled with GPU storage (fallback to CPU if GPU storage is not available)
+        GPUStorage, //!< Auto-batching is enabled with GPU storage (streamed to a ring of GPU buffers on OpenGL ES)
     };
 
     ////////////////////////////////////////////////////////////
@@ -261,6 +268,98 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::SizeT getAutoBatchVertexThreshold() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layout in which auto-batched vertices are uploaded
+    ///
+    /// Applies to `AutoBatchMode::CPUStorage`, and to
+    /// `AutoBatchMode::GPUStorage` on OpenGL ES. Persistently
+    /// mapped GPU storage always uses `sf::VertexFormat::Float32`.
+    ///
+    /// \param format Vertex format to use, `sf::VertexFormat::Float32` by default
+    ///
+    /// \see `getAutoBatchVertexFormat`, `sf::VertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAutoBatchVertexFormat(VertexFormat format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout in which auto-batched vertices are uploaded
+    ///
+    /// \see `setAutoBatchVertexFormat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] VertexFormat getAutoBatchVertexFormat() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable view culling of auto-batched drawables
+    ///
+    /// When enabled, auto-batched sprites, shapes, texts and shape
+    /// data entirely outside of the current view are skipped before
+    /// any vertex is generated for them, using the same conservative
+    /// bounds as `sf::CPUDrawableBatch::setCullRect`. The number of
+    /// skipped drawables is reported in `DrawStatistics::culledDrawables`.
+    ///
+    /// Culling only applies when auto-batching is enabled, and is
+    /// disabled by default.
+    ///
+    /// \param enabled `true` to skip drawables outside of the view
+    ///
+    /// \see `isAutoBatchCullingEnabled`, `setAutoBatchMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAutoBatchCullingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether view culling of auto-batched drawables is enabled
+    ///
+    /// \see `setAutoBatchCullingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAutoBatchCullingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable multi-draw submission of auto-batched drawables
+    ///
+    /// When enabled, drawing with a different texture no longer flushes
+    /// the GPU autobatch. Instead, the range of the batch drawn with each
+    /// texture becomes an indirect draw command, and all commands are
+    /// submitted with `glMultiDrawElementsIndirect` when the batch is
+    /// flushed. Up to `sf::DefaultShader::multiDrawTextureCount` textures
+    /// are bound per submission, so a frame alternating between a few
+    /// textures results in a handful of draw calls rather than one per
+    /// texture change.
+    ///
+    /// Only applies to `AutoBatchMode::GPUStorage` and to drawables drawn
+    /// without a custom shader: any other change of render states still
+    /// flushes the batch. Disabled by default, and cannot be enabled if
+    /// `isAutoBatchMultiDrawAvailable` returns `false`.
+    ///
+    /// \param enabled `true` to submit texture changes as multi-draw commands
+    ///
+    /// \see `isAutoBatchMultiDrawEnabled`, `setAutoBatchMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAutoBatchMultiDrawEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether multi-draw submission of auto-batched drawables is enabled
+    ///
+    /// \see `setAutoBatchMultiDrawEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAutoBatchMultiDrawEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system supports multi-draw submission of auto-batched drawables
+    ///
+    /// Requires OpenGL 4.3, or the `GL_ARB_multi_draw_indirect` and
+    /// `GL_ARB_base_instance` extensions. Never available on OpenGL ES.
+    ///
+    /// \see `setAutoBatchMultiDrawEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAutoBatchMultiDrawAvailable();
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the viewport of a view, applied to this render target
     ///
@@ -461,6 +560,15 @@ public:
     ////////////////////////////////////////////////////////////
     void draw(const Text& text, RenderStates states = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a text log view to the render target
+    ///
+    /// \param textLogView Text log view to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const TextLogView& textLogView, RenderStates states = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -473,6 +581,54 @@ public:
     ////////////////////////////////////////////////////////////
     void draw(const PersistentGPUDrawableBatch& drawableBatch, RenderStates states = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a streaming GPU drawable batch to the render target
+    ///
+    /// The batch geometry is appended to the current buffer of its
+    /// ring of GPU buffers, see `sf::StreamingGPUDrawableBatch`.
+    ///
+    /// \param drawableBatch Batch to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const StreamingGPUDrawableBatch& drawableBatch, const RenderStates& states = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw an instanced sprite batch to the render target
+    ///
+    /// All sprites are drawn with a single instanced draw call. The
+    /// built-in instanced sprite shader is used unless `states.shader`
+    /// is set, see `sf::DefaultShader::srcInstancedSpriteVertex`.
+    ///
+    /// \param spriteBatch Batch to draw
+    /// \param states      Render states to use for drawing, `states.texture` must be set
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const CPUInstancedSpriteBatch& spriteBatch, RenderStates states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a persistent GPU instanced sprite batch to the render target
+    ///
+    /// \param spriteBatch Batch to draw
+    /// \param states      Render states to use for drawing, `states.texture` must be set
+    ///
+    /// \see `draw(const CPUInstancedSpriteBatch&, RenderStates)`
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const PersistentGPUInstancedSpriteBatch& spriteBatch, RenderStates states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a retained batch to the render target
+    ///
+    /// Uploads the ranges of the batch that changed since it was
+    /// last drawn, then draws the whole batch with a single draw call.
+    ///
+    /// \param retainedBatch Batch to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const RetainedBatch& retainedBatch, RenderStates states = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -878,12 +1034,52 @@ private:
     ////////////////////////////////////////////////////////////
     void immediateDrawPersistentMappedIndexedVertices(const DrawPersistentMappedIndexedVerticesSettings& settings);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Immediately draw the recorded multi-draw commands of the GPU autobatch
+    ///
+    /// Will result in one OpenGL draw call per submission.
+    /// Clears the recorded commands.
+    ///
+    ////////////////////////////////////////////////////////////
+    void immediateMultiDrawGPUAutoBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the pending GPU autobatch geometry as a multi-draw command, if possible
+    ///
+    /// Only possible if `states` differ from the last render states
+    /// by their texture alone, see `setAutoBatchMultiDrawEnabled`.
+    ///
+    /// \return `true` if the geometry was recorded and no flush is needed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool recordAutoBatchTextureChange(const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
     ////////////////////////////////////////////////////////////
     void immediateDrawDrawableBatch(const CPUDrawableBatch& drawableBatch, RenderStates states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a streaming GPU drawable batch and draw it immediately, bypassing autobatching
+    ///
+    ////////////////////////////////////////////////////////////
+    void immediateDrawDrawableBatch(const StreamingGPUDrawableBatch& drawableBatch, RenderStates states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Immediately draw sprite instances stored in the VBO of `vaoGroup`
+    ///
+    /// \param vaoGroup      VAO group whose VBO holds the instances
+    /// \param instanceData  Instances to upload first, or `nullptr` if already on the GPU
+    /// \param instanceCount Number of instances to draw
+    /// \param states        Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void immediateDrawSpriteInstances(const GLVAOGroup& vaoGroup,
+                                      const void*       instanceData,
+                                      base::SizeT       instanceCount,
+                                      RenderStates      states);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -905,11 +1101,19 @@ private:
     [[gnu::always_inline]] void flushIfNeeded(const RenderStates& states)
     {
         // TODO P0: "withRenderStates" API that would avoid redundant state changes and flushes
-        if (m_numAutoBatchVertices >= m_autoBatchVertexThreshold || m_lastRenderStates != states)
+        if (m_numAutoBatchVertices >= m_autoBatchVertexThreshold)
         {
             flush();
             m_lastRenderStates = states;
         }
+        else if (m_lastRenderStates != states)
+        {
+            // Texture changes can be recorded as multi-draw commands instead
+            if (!m_autoBatchMultiDraw || !recordAutoBatchTextureChange(states))
+                flush();
+
+            m_lastRenderStates = states;
+        }
     }
 
     ////////////////////////////////////////////////////////////
@@ -1009,12 +1213,16 @@ private:
     /// This function is not intended to be used directly.
     /// Does not flush any batch in-flight.
     ///
-    /// \param type        Type of primitives to draw
-    /// \param indexCount  Number of indices to use when drawing
-    /// \param indexOffset Offset of the first index to use when drawing
+    /// \param type         Type of primitives to draw
+    /// \param indexCount   Number of indices to use when drawing
+    /// \param indexOffset  Offset of the first index to use when drawing
+    /// \param shortIndices Whether the bound indices are 16-bit instead of `IndexType`
     ///
     ////////////////////////////////////////////////////////////
-    void invokePrimitiveDrawCallIndexed(PrimitiveType type, base::SizeT indexCount, base::SizeT indexOffset);
+    void invokePrimitiveDrawCallIndexed(PrimitiveType type,
+                                        base::SizeT   indexCount,
+                                        base::SizeT   indexOffset,
+                                        bool          shortIndices = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Invoke primitive draw call: indexed with base vertex (not supported on OpenGL ES 3.1)
@@ -1145,11 +1353,12 @@ private:
     AutoBatchMode  m_autoBatchMode{AutoBatchMode::GPUStorage}; //!< Enable automatic batching of draw calls
     base::SizeT    m_numAutoBatchVertices{0u};                 //!< Number of vertices in the current autobatch
     base::SizeT    m_autoBatchVertexThreshold{32'768u};        //!< Threshold for batch vertex count
+    bool           m_autoBatchMultiDraw{false};                //!< Submit texture changes as multi-draw commands
     RenderStates   m_lastRenderStates;                         //!< Cached render states (autobatching)
 
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 1792> m_impl; //!< Implementation details
 };
 
 } // namespace sf
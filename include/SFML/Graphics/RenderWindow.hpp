@@ -12,6 +12,7 @@
 
 #include "SFML/Window/ContextSettings.hpp"
 #include "SFML/Window/Window.hpp"
+#include "SFML/Window/WindowEnums.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 #include "SFML/Window/WindowSettings.hpp"
 
@@ -19,6 +20,7 @@
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/Span.hpp"
 
 
 ////////////////////////////////////////////////////////////
@@ -169,6 +171,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> pollEvent();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Polls all pending events and forwards to `WindowBase::pollEvents`
+    ///
+    /// \see WindowBase::pollEvents
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const Event> pollEvents(EventCoalescing coalescing = EventCoalescing::Disabled);
+
     ////////////////////////////////////////////////////////////
     /// \brief Waits for the next event and forwards to `WindowBase::waitEvent`
     ///
@@ -0,0 +1,316 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/DrawableBatch.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class RenderTarget;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Batch of drawables retained in GPU memory across frames
+/// \ingroup graphics
+///
+/// Unlike the other drawable batches, which are meant to be
+/// rebuilt every frame, a retained batch keeps the geometry of
+/// each recorded drawable until it is explicitly updated or
+/// removed. Only the ranges touched since the last draw are
+/// uploaded to the GPU, so drawing an unchanged batch costs a
+/// single draw call and no data transfer.
+///
+/// Each recorded drawable is identified by a `Handle`, which
+/// stays valid until the drawable is removed or the batch is
+/// cleared.
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_GRAPHICS_API RetainedBatch : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifies a drawable recorded in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Handle
+    {
+        base::U32 index;      //!< Index of the item in the batch
+        base::U32 generation; //!< Detects handles to removed items
+
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool operator==(const Handle&) const = default;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit RetainedBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Releases the GPU buffers of the batch.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RetainedBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RetainedBatch(const RetainedBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RetainedBatch& operator=(const RetainedBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RetainedBatch(RetainedBatch&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RetainedBatch& operator=(RetainedBatch&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Records a drawable in the batch
+    ///
+    /// Accepts the same arguments as `sf::CPUDrawableBatch::add`
+    /// (e.g. a sprite, a shape, a text, shape data, or a font and
+    /// text data). The geometry of the drawable is generated once
+    /// and kept until the drawable is updated or removed.
+    ///
+    /// Space left by removed drawables is reused when the new
+    /// geometry fits in it.
+    ///
+    /// \param drawableArgs Drawable to record
+    ///
+    /// \return Handle to the recorded drawable
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle add(const auto&... drawableArgs)
+    {
+        m_scratchBatch.clear();
+        (void)m_scratchBatch.add(drawableArgs...);
+
+        return addFromScratchBatch();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replaces the geometry of a recorded drawable
+    ///
+    /// The geometry is rewritten in place if it fits in the space
+    /// previously used by the drawable (e.g. when moving a sprite),
+    /// otherwise it is relocated. `handle` stays valid either way.
+    ///
+    /// \param handle       Handle to a drawable recorded in the batch
+    /// \param drawableArgs New drawable, see `add`
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const Handle handle, const auto&... drawableArgs)
+    {
+        m_scratchBatch.clear();
+        (void)m_scratchBatch.add(drawableArgs...);
+
+        updateFromScratchBatch(handle);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes a recorded drawable from the batch
+    ///
+    /// Invalidates `handle`.
+    ///
+    /// \param handle Handle to a drawable recorded in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Checks whether `handle` refers to a drawable recorded in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Removes all drawables from the batch
+    ///
+    /// Invalidates all handles. GPU buffers are kept for reuse.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of drawables recorded in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getNumDrawables() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of vertices in the batch, including space left by removed drawables
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getNumVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of indices in the batch, including space left by removed drawables
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getNumIndices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets the number of bytes that the next draw will upload to the GPU
+    ///
+    /// Zero for a batch that did not change since it was last drawn.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getPendingUploadByteCount() const;
+
+private:
+    friend RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of a recorded drawable in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Item
+    {
+        base::SizeT vertexOffset;   //!< Offset of the first vertex of the drawable
+        base::SizeT vertexCapacity; //!< Number of vertices reserved for the drawable
+        base::SizeT indexOffset;    //!< Offset of the first index of the drawable
+        base::SizeT indexCapacity;  //!< Number of indices reserved for the drawable
+        base::U32   generation;     //!< Incremented when the drawable is removed
+        bool        alive;          //!< Whether the item holds a recorded drawable
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Records the geometry of the scratch batch as a new item
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle addFromScratchBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replaces the geometry of an item with the one of the scratch batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateFromScratchBatch(Handle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finds a removed item with enough space for the given geometry
+    ///
+    /// \return Position of the item in `m_freeItems`, or `m_freeItems.size()` if none fits
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT findFreeItem(base::SizeT vertexCount, base::SizeT indexCount) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Appends space for the given geometry at the end of the batch
+    ///
+    /// \return Dead item owning the new space
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Item appendItemStorage(base::SizeT vertexCount, base::SizeT indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copies the geometry of the scratch batch in the space of `item`
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeItem(const Item& item);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Turns all the indices of `item` into degenerate triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void eraseItemIndices(const Item& item);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Gets a pointer to the Vertex Array Object (VAO) group
+    /// \warning Internal SFML detail, subject to change.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getVAOGroup() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uploads the ranges modified since the last call to the GPU
+    /// \warning Internal SFML detail, subject to change.
+    ///
+    /// The VAO group returned by `getVAOGroup` must be bound.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadToGPU() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::Vector<Vertex>    m_vertices;         //!< CPU copy of the vertices of all items
+    base::Vector<IndexType> m_indices;          //!< CPU copy of the indices of all items
+    base::Vector<Item>      m_items;            //!< Location of each recorded drawable
+    base::Vector<base::U32> m_freeItems;        //!< Indices of removed items, whose space can be reused
+    base::SizeT             m_numDrawables{};   //!< Number of alive items
+    base::U32               m_baseGeneration{}; //!< Generation of new items, raised by `clear`
+    CPUDrawableBatch        m_scratchBatch;     //!< Generates the geometry of added drawables
+
+    struct Impl;
+    mutable base::InPlacePImpl<Impl, 256> m_impl; //!< GPU buffers and pending uploads
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RetainedBatch
+/// \ingroup graphics
+///
+/// Retained batches suit geometry that rarely changes, such as
+/// the tiles of a level: the drawables are recorded once, and
+/// the occasional change only re-uploads the affected range.
+///
+/// Removed drawables leave degenerate triangles behind, whose
+/// space is reused by later additions of the same size or
+/// smaller. Call `clear` and record the drawables again to
+/// compact a batch after many removals.
+///
+/// Usage example:
+/// \code
+/// sf::RetainedBatch tileBatch;
+///
+/// sf::base::Vector<sf::RetainedBatch::Handle> tileHandles;
+/// for (const sf::Sprite& tile : tiles)
+///     tileHandles.pushBack(tileBatch.add(tile));
+///
+/// // Later, when a single tile changes
+/// tileBatch.update(tileHandles[42], newTile);
+///
+/// window.draw(tileBatch, {.texture = &tileset});
+/// \endcode
+///
+/// \see sf::CPUDrawableBatch, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
@@ -84,6 +84,118 @@ public:
         int m_value;
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Type-safe wrapper over a valid shader uniform block index
+    ///
+    ////////////////////////////////////////////////////////////
+    class [[nodiscard]] UniformBlockIndex
+    {
+        friend Shader;
+
+    private:
+        [[nodiscard]] explicit UniformBlockIndex(unsigned int index);
+        unsigned int m_value;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform buffer object, holding data shared between shaders
+    ///
+    /// The memory layout of the data passed to `update` must match
+    /// the layout of the block in GLSL. Using `layout(std140)` in the
+    /// shader gives a well-defined layout: e.g. `vec4` and `mat4`
+    /// members map directly to `sf::Glsl::Vec4` and `sf::Glsl::Mat4`,
+    /// while `float` and `vec2` members are padded to 16 bytes in arrays.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API UniformBlock
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Create a uniform buffer of a given size
+        ///
+        /// The contents of the buffer are undefined until `update`
+        /// is called.
+        ///
+        /// \param size Size of the buffer, in bytes
+        ///
+        /// \return Uniform block on success, `base::nullOpt` otherwise
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] static base::Optional<UniformBlock> create(base::SizeT size);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        ~UniformBlock();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformBlock(const UniformBlock&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformBlock& operator=(const UniformBlock&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformBlock(UniformBlock&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        UniformBlock& operator=(UniformBlock&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Update a part of the buffer
+        ///
+        /// All shaders using this block observe the new contents
+        /// from their next draw onwards.
+        ///
+        /// \param data   Pointer to the new data
+        /// \param size   Size of the new data, in bytes
+        /// \param offset Offset in the buffer where to write, in bytes
+        ///
+        /// \return `true` on success, `false` if the range does not fit in the buffer
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool update(const void* data, base::SizeT size, base::SizeT offset = 0u);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the size of the buffer, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::SizeT getSize() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the underlying OpenGL handle of the buffer
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] unsigned int getNativeHandle() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \private
+        ///
+        /// \brief Construct from buffer object
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] explicit UniformBlock(base::PassKey<UniformBlock>&&, unsigned int buffer, base::SizeT size);
+
+    private:
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        unsigned int m_buffer; //!< OpenGL buffer object identifier
+        base::SizeT  m_size;   //!< Size of the buffer, in bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -123,6 +235,9 @@ public:
         Path vertexPath{};   // NOLINT(readability-redundant-member-init)
         Path fragmentPath{}; // NOLINT(readability-redundant-member-init)
         Path geometryPath{}; // NOLINT(readability-redundant-member-init)
+
+        Path binaryCacheDirectory{};  //!< Directory to cache linked program binaries in, disabled if empty
+        bool parallelCompile{false}; //!< Compile asynchronously if supported by the driver (see `isReady`)
     };
 
     ////////////////////////////////////////////////////////////
@@ -156,6 +271,9 @@ public:
         base::StringView vertexCode{};   // NOLINT(readability-redundant-member-init)
         base::StringView fragmentCode{}; // NOLINT(readability-redundant-member-init)
         base::StringView geometryCode{}; // NOLINT(readability-redundant-member-init)
+
+        Path binaryCacheDirectory{};  //!< Directory to cache linked program binaries in, disabled if empty
+        bool parallelCompile{false}; //!< Compile asynchronously if supported by the driver (see `isReady`)
     };
 
     ////////////////////////////////////////////////////////////
@@ -189,6 +307,9 @@ public:
         InputStream* vertexStream{nullptr};
         InputStream* fragmentStream{nullptr};
         InputStream* geometryStream{nullptr};
+
+        Path binaryCacheDirectory{};  //!< Directory to cache linked program binaries in, disabled if empty
+        bool parallelCompile{false}; //!< Compile asynchronously if supported by the driver (see `isReady`)
     };
 
     ////////////////////////////////////////////////////////////
@@ -213,6 +334,61 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Shader> loadFromStream(const LoadFromStreamSettings& settings);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the shader has finished compiling
+    ///
+    /// Shaders loaded with `parallelCompile` enabled are compiled
+    /// and linked by the driver in the background, if the
+    /// `KHR_parallel_shader_compile` extension is supported.
+    /// This function never blocks, and can be polled (e.g. once
+    /// per frame) to avoid stalling on the first use of the shader.
+    ///
+    /// Shaders compiled synchronously are always ready.
+    ///
+    /// \return `true` if the shader can be used without waiting
+    ///
+    /// \see `hasCompilationFailed`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the asynchronous compilation has failed
+    ///
+    /// Errors are reported once the compilation completes, either
+    /// by `isReady` or by the first `bind`. A shader whose
+    /// compilation failed must not be used for rendering.
+    ///
+    /// \return `true` if the shader is ready and failed to compile or link
+    ///
+    /// \see `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasCompilationFailed() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the program was restored from the binary cache
+    ///
+    /// \return `true` if the linked program was read from
+    ///         `binaryCacheDirectory` instead of being compiled
+    ///
+    /// \see `getBinaryCachePath`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLoadedFromBinaryCache() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the path of the binary cache file of the program
+    ///
+    /// The file is written once the program is linked, unless it
+    /// was loaded from it. The path is empty if no cache directory
+    /// was given, or if the driver does not support program binaries.
+    ///
+    /// \see `isLoadedFromBinaryCache`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Path& getBinaryCachePath() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -223,6 +399,16 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<UniformLocation> getUniformLocation(base::StringView uniformName) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of a shader uniform block
+    ///
+    /// \param blockName Name of the uniform block to search
+    ///
+    /// \return Index of the uniform block, or `sf::base::nullOpt` if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<UniformBlockIndex> getUniformBlockIndex(base::StringView blockName) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -487,6 +673,37 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(UniformLocation location, const Glsl::Mat4* matrixArray, base::SizeT length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify the buffer backing a uniform block
+    ///
+    /// The same `sf::Shader::UniformBlock` can be assigned to blocks
+    /// of several shaders, in order to share data such as the
+    /// view-projection matrix or the current time between them.
+    /// Like textures, `uniformBlock` must remain alive as long as
+    /// the shader uses it, no copy is made internally.
+    ///
+    /// Example:
+    /// \code
+    /// layout(std140) uniform Globals { mat4 viewProj; float time; }; // in the shader
+    /// \endcode
+    /// \code
+    /// shader.setUniformBlock(shader.getUniformBlockIndex("Globals").value(), globals);
+    /// \endcode
+    ///
+    /// \param index        Index of the uniform block in the shader
+    /// \param uniformBlock Buffer to assign
+    ///
+    /// \return `true` on success, `false` if all available binding points are used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformBlock(UniformBlockIndex index, const UniformBlock& uniformBlock) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform block
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(UniformBlockIndex index, const UniformBlock&& uniformBlock) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -517,6 +734,9 @@ public:
     /// // draw OpenGL stuff that use no shader...
     /// \endcode
     ///
+    /// Uniform values set since the last bind are uploaded by
+    /// this function.
+    ///
     /// \param shader Shader to bind, can be null to use no shader
     ///
     ////////////////////////////////////////////////////////////
@@ -566,16 +786,20 @@ private:
     /// If one of the arguments is a null pointer, the corresponding shader
     /// is not created.
     ///
-    /// \param vertexShaderCode   Source code of the vertex shader
-    /// \param geometryShaderCode Source code of the geometry shader
-    /// \param fragmentShaderCode Source code of the fragment shader
+    /// \param vertexShaderCode     Source code of the vertex shader
+    /// \param geometryShaderCode   Source code of the geometry shader
+    /// \param fragmentShaderCode   Source code of the fragment shader
+    /// \param binaryCacheDirectory Directory of the program binary cache, empty to disable it
+    /// \param parallelCompile      Defer the compile and link status checks, if supported
     ///
     /// \return Shader on success, `base::nullOpt` if any error happened
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Shader> compile(base::StringView vertexShaderCode,
                                                         base::StringView geometryShaderCode,
-                                                        base::StringView fragmentShaderCode);
+                                                        base::StringView fragmentShaderCode,
+                                                        const Path&      binaryCacheDirectory,
+                                                        bool             parallelCompile);
 
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
@@ -587,19 +811,18 @@ private:
     void bindTextures() const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief RAII object to save and restore the program
-    ///        binding while uniforms are being set
+    /// \brief Upload the uniform values changed since the last upload
     ///
-    /// Implementation is private in the .cpp file.
+    /// The program must be currently bound.
     ///
     ////////////////////////////////////////////////////////////
-    class [[nodiscard]] UniformBinder;
+    void applyPendingUniforms() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 192> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 448> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -666,6 +889,52 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniform values, including arrays set with `setUniformArray()`,
+/// are shadowed on the CPU side: setting a uniform does not issue
+/// any OpenGL call, and only the values that changed are uploaded
+/// when the shader is next used for drawing (or bound with `bind()`). Setting uniforms is therefore cheap, even many
+/// times per frame.
+///
+/// Data shared by several shaders, such as the view-projection
+/// matrix or the current time, can be stored once in a
+/// `sf::Shader::UniformBlock` and assigned to a uniform block
+/// of each shader:
+/// \code
+/// // GLSL: layout(std140) uniform Globals { mat4 viewProj; vec4 timeAndResolution; };
+/// struct Globals
+/// {
+///     sf::Glsl::Mat4 viewProj;
+///     sf::Glsl::Vec4 timeAndResolution;
+/// };
+///
+/// auto globals = sf::Shader::UniformBlock::create(sizeof(Globals)).value();
+///
+/// for (sf::Shader* shader : {&blurShader, &bloomShader})
+///     if (const auto index = shader->getUniformBlockIndex("Globals"))
+///         (void)shader->setUniformBlock(*index, globals);
+///
+/// // Once per frame
+/// const Globals data{...};
+/// (void)globals.update(&data, sizeof(data));
+/// \endcode
+///
+/// Compiling and linking shaders can take a noticeable amount of
+/// time. If `binaryCacheDirectory` is set when loading, the linked
+/// program is stored there (keyed by the source code and by the
+/// OpenGL driver), and following runs load it directly instead of
+/// compiling it again. If `parallelCompile` is set, the driver
+/// compiles the shader in the background, when supported:
+/// \code
+/// auto shader = sf::Shader::loadFromFile({.fragmentPath         = "blur.frag",
+///                                         .binaryCacheDirectory = "shader_cache",
+///                                         .parallelCompile      = true})
+///                   .value();
+///
+/// // Every frame, until the shader is ready
+/// if (shader.isReady() && !shader.hasCompilationFailed())
+///     window.draw(sprite, {.shader = &shader});
+/// \endcode
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the `RenderWindow::draw` function:
 /// \code
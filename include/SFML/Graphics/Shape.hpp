@@ -19,6 +19,7 @@
 #include "SFML/System/Rect2.hpp"
 #include "SFML/System/Vec2.hpp"
 
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Vector.hpp"
 
 
@@ -271,8 +272,9 @@ public:
     /// \brief TODO P1: docs
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline, gnu::pure]] ConstVertexSpan getFillVertices() const
+    [[nodiscard, gnu::always_inline]] ConstVertexSpan getFillVertices() const
     {
+        ensureGeometryUpdate();
         return {m_vertices.data(), m_verticesEndIndex};
     }
 
@@ -280,8 +282,9 @@ public:
     /// \brief TODO P1: docs
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline, gnu::pure]] ConstVertexSpan getOutlineVertices() const
+    [[nodiscard, gnu::always_inline]] ConstVertexSpan getOutlineVertices() const
     {
+        ensureGeometryUpdate();
         return {m_vertices.data() + m_verticesEndIndex, m_vertices.size() - m_verticesEndIndex};
     }
 
@@ -310,6 +313,7 @@ protected:
         {
             m_vertices.clear();
             m_verticesEndIndex = 0;
+            m_dirtyFlags       = 0u;
             return;
         }
 
@@ -327,11 +331,8 @@ protected:
         // Compute the center and make it the first vertex
         m_vertices[0].position = m_insideBounds.getCenter();
 
-        // Updates
-        updateFillColors();
-        updateTexCoords();
-        updateOutline();
-        updateOutlineTexCoords();
+        // Colors, texture coordinates and outline are computed when the vertices are next accessed
+        m_dirtyFlags = DirtyFillColors | DirtyTexCoords | DirtyOutline;
     }
 
 private:
@@ -340,47 +341,80 @@ private:
     template <typename TStorage>
     friend class priv::DrawableBatchImpl;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Parts of the geometry that are out of date
+    ///
+    ////////////////////////////////////////////////////////////
+    enum : base::U8
+    {
+        DirtyFillColors       = 1u << 0u, //!< Fill vertices' color
+        DirtyTexCoords        = 1u << 1u, //!< Fill vertices' texture coordinates
+        DirtyOutline          = 1u << 2u, //!< Outline vertices, including their color and texture coordinates
+        DirtyOutlineColors    = 1u << 3u, //!< Outline vertices' color
+        DirtyOutlineTexCoords = 1u << 4u, //!< Outline vertices' texture coordinates
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the geometry is updated
+    ///
+    /// Setters only mark the affected parts of the geometry as
+    /// dirty, so that changing several properties in a row
+    /// recomputes the outline at most once.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void ensureGeometryUpdate() const
+    {
+        if (m_dirtyFlags != 0u) [[unlikely]]
+            updateDirtyGeometry();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the dirty parts of the geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateDirtyGeometry() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateFillColors();
+    void updateFillColors() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateTexCoords();
+    void updateTexCoords() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' texture coordinates
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineTexCoords();
+    void updateOutlineTexCoords() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' position
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutline();
+    void updateOutline() const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Update the outline vertices' color
     ///
     ////////////////////////////////////////////////////////////
-    void updateOutlineColors();
+    void updateOutlineColors() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     /* Ordered to minimize padding */
-    base::Vector<Vertex> m_vertices;              //!< Vertex array containing the fill and outline geometry
-    base::SizeT          m_verticesEndIndex = 0u; //!< Index where the fill vertices end and outline vertices begin
+    mutable base::Vector<Vertex> m_vertices;              //!< Vertex array containing the fill and outline geometry
+    mutable base::SizeT          m_verticesEndIndex = 0u; //!< Index where the fill vertices end and outline ones begin
 
-    Rect2f m_textureRect{};        //!< Area of the source texture to display for the fill
-    Rect2f m_outlineTextureRect{}; //!< Area of the source texture to display for the outline
-    Rect2f m_insideBounds;         //!< Bounding rectangle of the inside (fill)
-    Rect2f m_bounds;               //!< Bounding rectangle of the whole shape (outline + fill)
+    Rect2f         m_textureRect{};        //!< Area of the source texture to display for the fill
+    Rect2f         m_outlineTextureRect{}; //!< Area of the source texture to display for the outline
+    Rect2f         m_insideBounds;         //!< Bounding rectangle of the inside (fill)
+    mutable Rect2f m_bounds;               //!< Bounding rectangle of the whole shape (outline + fill)
 
     float m_outlineThickness{}; //!< Thickness of the shape's outline
     float m_miterLimit{4.f};    //!< Limit on the ratio between miter length and outline thickness
@@ -388,6 +422,8 @@ private:
     Color m_fillColor{Color::White};    //!< Fill color
     Color m_outlineColor{Color::White}; //!< Outline color
 
+    mutable base::U8 m_dirtyFlags{}; //!< Parts of the geometry that need to be recomputed, see `ensureGeometryUpdate`
+
 public:
     SFML_DEFINE_TRANSFORMABLE_DATA_MEMBERS;
 };
@@ -22,6 +22,7 @@
 #include "SFML/System/UnicodeString.hpp"
 #include "SFML/System/Vec2.hpp"
 
+#include "SFML/Base/Allocator.hpp"
 #include "SFML/Base/EnumClassBitwiseOps.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/SizeT.hpp"
@@ -35,9 +36,15 @@ namespace sf
 {
 class Font;
 class RenderTarget;
+class Utf8String;
 struct RenderStates;
 } // namespace sf
 
+namespace sf::TextUtils
+{
+struct TextLayoutCursor;
+} // namespace sf::TextUtils
+
 
 namespace sf
 {
@@ -78,12 +85,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Text(const Font& font, const Data& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the text, allocating its geometry from a memory resource
+    ///
+    /// The vertices generated for the text are allocated from
+    /// `geometryResource`, which must outlive the text.
+    ///
+    /// \param font             Font used to draw the string
+    /// \param data             Data of the text
+    /// \param geometryResource Memory resource used for the text geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Text(const Font& font, const Data& data, base::MemoryResource& geometryResource);
+
     ////////////////////////////////////////////////////////////
     /// \brief Disallow construction from a temporary font
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Text(const Font&& font, const Data& data) = delete;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Text(const Font&& font, const Data& data, base::MemoryResource& geometryResource) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -135,6 +161,53 @@ public:
     ////////////////////////////////////////////////////////////
     void setString(const UnicodeString& string);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the text's string from a UTF-8 string
+    ///
+    /// The string is transcoded to UTF-32 with the vectorized
+    /// `sf::UtfBulk` path.
+    ///
+    /// \param string New string
+    ///
+    /// \see `getString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(const Utf8String& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a string at the end of the text's string
+    ///
+    /// Unlike `setString`, only the geometry of the last line
+    /// and of the appended characters is generated again when
+    /// the text is next drawn. This makes appending cheap even
+    /// for very long texts, e.g. logs or chat windows growing
+    /// one line at a time.
+    ///
+    /// \param string Characters to append
+    ///
+    /// \see `replaceSuffix`, `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendString(const UnicodeString& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the end of the text's string
+    ///
+    /// Replaces all the characters from `suffixBegin` onwards with
+    /// `replaceWith`. Only the geometry of the lines following
+    /// the first changed character is generated again when the
+    /// text is next drawn, see `appendString`.
+    ///
+    /// If `suffixBegin` is out of range, `replaceWith` is appended.
+    ///
+    /// \param suffixBegin Index of the first character to replace
+    /// \param replaceWith Characters replacing the end of the string
+    ///
+    /// \see `appendString`, `setString`
+    ///
+    ////////////////////////////////////////////////////////////
+    void replaceSuffix(base::SizeT suffixBegin, const UnicodeString& replaceWith);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the text's font
     ///
@@ -504,6 +577,12 @@ public:
     }
 
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Vertex storage, optionally backed by a user memory resource
+    ///
+    ////////////////////////////////////////////////////////////
+    using VertexVector = base::Vector<Vertex, base::ResourceAllocator>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure the text's geometry is updated
     ///
@@ -513,12 +592,41 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate(const Font& font) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Regenerate the geometry from the line containing `m_geometryDirtyIndex`
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometrySuffix(const Font& font) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record the layout state at the start of a line
+    ///
+    ////////////////////////////////////////////////////////////
+    void recordLineStart(const TextUtils::TextLayoutCursor& cursor,
+                         base::SizeT                        charIndex,
+                         base::SizeT                        outlineVertexCount) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Layout state at the start of a line, allows resuming the layout from there
+    ///
+    ////////////////////////////////////////////////////////////
+    struct LineStart
+    {
+        base::SizeT charIndex;       //!< Index of the first character of the line
+        base::SizeT fillVertexCount; //!< Number of fill vertices of the previous lines
+        float       y;               //!< Vertical position of the line
+        float       minX;            //!< Left bound of the previous lines (without outline)
+        float       minY;            //!< Top bound of the previous lines (without outline)
+        float       maxX;            //!< Right bound of the previous lines (without outline)
+        float       maxY;            //!< Bottom bound of the previous lines (without outline)
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     /* Ordered to minimize padding */
     UnicodeString                m_string;            //!< String to display
-    mutable base::Vector<Vertex> m_vertices;          //!< Vertex array containing the outline and fill geometry
+    mutable VertexVector         m_vertices;          //!< Vertex array containing the outline and fill geometry
     mutable Rect2f               m_bounds;            //!< Bounding rectangle of the text (in local coordinates)
     const Font*                  m_font{};            //!< Font used to display the string
     mutable base::SizeT m_fillVerticesStartIndex{};   //!< Index in the vertex array where the fill vertices start
@@ -533,8 +641,10 @@ public:
     SFML_DEFINE_TRANSFORMABLE_DATA_MEMBERS;
 
 private:
-    Style        m_style{Style::Regular}; //!< Text style (see Style enum)
-    mutable bool m_geometryNeedUpdate{};  //!< Does the geometry need to be recomputed?
+    mutable base::Vector<LineStart> m_lineStarts;                                    //!< Layout state at line starts
+    mutable base::SizeT             m_geometryDirtyIndex{UnicodeString::InvalidPos}; //!< First outdated character
+    Style                           m_style{Style::Regular};                         //!< Text style (see Style enum)
+    mutable bool                    m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
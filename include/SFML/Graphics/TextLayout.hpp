@@ -0,0 +1,295 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/TextData.hpp"
+#include "SFML/Graphics/TextStyle.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Font;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Word-wrapped layout of a paragraph of text
+/// \ingroup graphics
+///
+/// Splits a string into lines no wider than a given width,
+/// breaking lines between words. The width of each word is
+/// measured once per string, font, character size and style,
+/// so wrapping the same string to a different width does not
+/// access the font again.
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_GRAPHICS_API TextLayout
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Line of the layout
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Line
+    {
+        base::SizeT begin; //!< Index of the first character of the line
+        base::SizeT end;   //!< One past the index of the last character of the line, trailing whitespace excluded
+        float       width; //!< Width of the line, in pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the layout of a string
+    ///
+    /// The colors, outline and transform of `data` are ignored,
+    /// as they do not affect the layout.
+    ///
+    /// \param font      Font used to measure the string
+    /// \param data      String and text properties used to measure it
+    /// \param wrapWidth Maximum width of a line, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextLayout(const Font& font, const TextData& data, float wrapWidth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextLayout(const Font&& font, const TextData& data, float wrapWidth) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the string to lay out
+    ///
+    ////////////////////////////////////////////////////////////
+    void setString(const UnicodeString& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the font used to measure the string
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFont(const Font& font);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFont(const Font&& font) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the character size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCharacterSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the letter spacing factor, see `sf::Text::setLetterSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLetterSpacing(float spacingFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the line spacing factor, see `sf::Text::setLineSpacing`
+    ///
+    /// Only affects the height of the layout, lines are not wrapped again.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLineSpacing(float spacingFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the text style
+    ///
+    /// Only the bold style affects the layout.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setStyle(TextStyle style);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum width of a line, in pixels
+    ///
+    /// Words are never split: a word wider than `wrapWidth`
+    /// gets a line of its own and overflows it.
+    ///
+    /// Changing the width does not measure the string again,
+    /// and keeps the current lines without wrapping them again
+    /// if they are still valid for the new width.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setWrapWidth(float wrapWidth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the string being laid out
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const UnicodeString& getString() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the font used to measure the string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Font& getFont() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the character size, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getCharacterSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the letter spacing factor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLetterSpacing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the line spacing factor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLineSpacing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the text style
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextStyle getStyle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum width of a line, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getWrapWidth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the lines of the layout
+    ///
+    /// The layout is updated, if necessary, when this function
+    /// is invoked. Therefore it is not thread-safe.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const Line> getLines() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the layout, in pixels
+    ///
+    /// The width is the one of the widest line, the height is
+    /// the number of lines times the line spacing of the font.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vec2f getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the string with line breaks inserted between lines
+    ///
+    /// The whitespace at which lines are wrapped is replaced by
+    /// a line break. The result can be passed to `sf::Text::setString`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UnicodeString getWrappedString() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Word of the string, with its measured width
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Word
+    {
+        base::SizeT spaceBegin;  //!< Index of the first whitespace character preceding the word
+        base::SizeT begin;       //!< Index of the first character of the word
+        base::SizeT end;         //!< One past the index of the last character of the word
+        float       spaceWidth;  //!< Width of the whitespace preceding the word
+        float       width;       //!< Width of the word
+        bool        breakBefore; //!< Whether the word starts a paragraph
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Measure the words of the string, if needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureWordsUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wrap the words into lines, if needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureLinesUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the advance of a glyph, cached for ASCII characters
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGlyphAdvance(char32_t codePoint, bool isBold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard all the cached measurements
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateMeasurements();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    UnicodeString              m_string;                //!< String to lay out
+    mutable base::Vector<Word> m_words;                 //!< Measured words of the string
+    mutable base::Vector<Line> m_lines;                 //!< Lines of the layout
+    const Font*                m_font;                  //!< Font used to measure the string
+    mutable float              m_asciiAdvances[128]{};  //!< Cached advances of the ASCII glyphs
+    mutable base::U64          m_asciiAdvanceMask[2]{}; //!< Which entries of `m_asciiAdvances` are cached
+    unsigned int               m_characterSize;         //!< Base size of characters, in pixels
+    float                      m_letterSpacing;         //!< Spacing factor between letters
+    float                      m_lineSpacing;           //!< Spacing factor between lines
+    float                      m_wrapWidth;             //!< Maximum width of a line, in pixels
+    mutable float              m_maxLineWidth{};        //!< Width of the widest line
+    mutable float              m_minValidWrapWidth{};   //!< Lines stay valid down to this width...
+    mutable float              m_maxValidWrapWidth{};   //!< ...and up to (excluded) this width
+    TextStyle                  m_style;                 //!< Text style, only bold affects the layout
+    mutable bool               m_wordsNeedUpdate{true}; //!< Do the words need to be measured again?
+    mutable bool               m_linesNeedUpdate{true}; //!< Do the lines need to be wrapped again?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextLayout
+/// \ingroup graphics
+///
+/// `sf::TextLayout` wraps a paragraph to a given width in linear
+/// time, without measuring substrings repeatedly. It is meant to
+/// be kept alongside the `sf::Text` displaying the paragraph:
+/// colors and transforms do not affect the layout, and changing
+/// the wrap width reuses the measured words.
+///
+/// Usage example:
+/// \code
+/// const sf::TextData dialogData{.string = "A long line of dialog...", .characterSize = 20u};
+///
+/// sf::TextLayout layout(font, dialogData, /* wrapWidth */ 320.f);
+/// sf::Text       text(font, dialogData);
+///
+/// text.setString(layout.getWrappedString());
+///
+/// // Later, when the dialog box is resized
+/// layout.setWrapWidth(newWidth);
+/// text.setString(layout.getWrappedString());
+/// \endcode
+///
+/// \see sf::Text, sf::TextUtils
+///
+////////////////////////////////////////////////////////////
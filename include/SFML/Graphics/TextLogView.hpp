@@ -0,0 +1,180 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Text.hpp"
+#include "SFML/Graphics/TextData.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Font;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Scrolling multi-line text, made of individually cached lines
+/// \ingroup graphics
+///
+/// Each line is an independent `sf::Text`, whose geometry is
+/// generated once and kept until the line changes. When the
+/// view is full, pushing a new line scrolls the oldest one out
+/// of view and recycles it, together with its allocations, to
+/// display the new line.
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_GRAPHICS_API TextLogView : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty log view
+    ///
+    /// The string and the transform of `lineData` are ignored,
+    /// all its other properties apply to every line.
+    ///
+    /// \param font         Font used to draw the lines
+    /// \param lineData     Data shared by all lines
+    /// \param maxLineCount Number of lines that fit in the view, must be greater than zero
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextLogView(const Font& font, const TextData& lineData, base::SizeT maxLineCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextLogView(const Font&& font, const TextData& lineData, base::SizeT maxLineCount) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a line at the bottom of the view
+    ///
+    /// If the view is full, the top line scrolls out of view and
+    /// is recycled to display `line`.
+    ///
+    /// `line` should not contain line breaks.
+    ///
+    /// \param line Contents of the new line
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushLine(const UnicodeString& line);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append characters to the bottom line of the view
+    ///
+    /// Only the geometry of the appended characters is generated,
+    /// see `sf::Text::appendString`. Pushes a new line if the
+    /// view is empty.
+    ///
+    /// \param string Characters to append
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendToLastLine(const UnicodeString& string);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all lines from the view
+    ///
+    /// The lines are kept aside and recycled by later calls to `pushLine`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of lines in the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getLineCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of lines in the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getMaxLineCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the `index`-th line of the view, from the top
+    ///
+    /// The transform of the returned text is relative to the view.
+    ///
+    /// \param index Index of the line, must be lower than `getLineCount()`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Text& getLine(base::SizeT index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertical distance between two consecutive lines
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLineHeight() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the text of the `index`-th line of the view, from the top
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Text& getLineMut(base::SizeT index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move each line to its row after the lines scrolled
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateLinePositions();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Font*        m_font;         //!< Font used to draw the lines
+    TextData           m_lineData;     //!< Data shared by all lines
+    base::Vector<Text> m_lines;        //!< Ring buffer of lines, including recycled ones
+    base::SizeT        m_maxLineCount; //!< Number of lines that fit in the view
+    base::SizeT        m_lineCount{};  //!< Number of lines in the view
+    base::SizeT        m_firstLine{};  //!< Index of the top line in `m_lines`
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextLogView
+/// \ingroup graphics
+///
+/// `sf::TextLogView` suits in-game consoles and chat windows,
+/// which grow one line at a time: appending a line to a single
+/// large `sf::Text` would generate the geometry of all of its
+/// lines again, while a log view only generates the geometry of
+/// the new line.
+///
+/// When autobatching is enabled, all the lines of a log view
+/// are drawn with a single draw call.
+///
+/// Usage example:
+/// \code
+/// sf::TextLogView console(font, {.characterSize = 16u}, /* maxLineCount */ 32u);
+/// console.position = {8.f, 8.f};
+///
+/// console.pushLine("Welcome!");
+/// console.pushLine("> ");
+/// console.appendToLastLine("help");
+///
+/// window.draw(console);
+/// \endcode
+///
+/// \see sf::Text
+///
+////////////////////////////////////////////////////////////
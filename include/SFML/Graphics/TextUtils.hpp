@@ -16,6 +16,8 @@
 #include "SFML/System/UnicodeString.hpp"
 
 #include "SFML/Base/Builtin/Restrict.hpp"
+#include "SFML/Base/LambdaMacros.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Ceil.hpp"
 #include "SFML/Base/Math/Fabs.hpp"
 #include "SFML/Base/Math/Floor.hpp"
@@ -58,7 +60,9 @@ struct TextSpacingConstants
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard]] inline base::SizeT precomputeTextQuadCount(const UnicodeString& string, const TextStyle style)
+// `TString` is any range of `char32_t` code points (e.g. `sf::UnicodeString` or `sf::Utf8String`)
+template <typename TString>
+[[nodiscard]] inline base::SizeT precomputeTextQuadCount(const TString& string, const TextStyle style)
 {
     SFML_BASE_ASSERT(!string.isEmpty());
 
@@ -229,20 +233,60 @@ inline void addGlyphQuadPreTransformed(
 
 
 ////////////////////////////////////////////////////////////
-template <bool CalculateBounds>
-inline auto createTextGeometryAndGetBounds(
-    const base::SizeT    outlineVertexCount,
-    const Font&          font,
-    const UnicodeString& string,
-    const TextStyle      style,
-    const unsigned int   characterSize,
-    const float          letterSpacing,
-    const float          lineSpacing,
-    const float          outlineThickness,
-    const Color          fillColor,    // TODO P1: remove?
-    const Color          outlineColor, // TODO P1: remove?
-    auto&&               fAddLine,
-    auto&&               fAddGlyphQuad)
+// State of the text layout algorithm, captured at the start of
+// each line so that the layout can be resumed from there
+struct TextLayoutCursor
+{
+    base::SizeT fillIndex;    //!< Index of the next fill vertex
+    base::SizeT outlineIndex; //!< Index of the next outline vertex
+    float       x;            //!< Horizontal position of the next character
+    float       y;            //!< Vertical position of the current line
+    float       minX;         //!< Left bound so far (without outline)
+    float       minY;         //!< Top bound so far (without outline)
+    float       maxX;         //!< Right bound so far (without outline)
+    float       maxY;         //!< Bottom bound so far (without outline)
+    char32_t    prevChar;     //!< Previous character, used for kerning
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline TextLayoutCursor makeTextLayoutCursor(const base::SizeT  outlineVertexCount,
+                                                           const unsigned int characterSize)
+{
+    return {
+        .fillIndex    = outlineVertexCount,
+        .outlineIndex = 0u,
+        .x            = 0.f,
+        .y            = static_cast<float>(characterSize),
+        .minX         = static_cast<float>(characterSize),
+        .minY         = static_cast<float>(characterSize),
+        .maxX         = 0.f,
+        .maxY         = 0.f,
+        .prevChar     = 0,
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+// Lays out `string` starting from `cursor`, which is left past the end of the
+// generated geometry. `fOnLineStart` is invoked after each line break with the
+// cursor and the number of characters of `string` consumed so far: resuming
+// the layout from that cursor produces the same geometry as a full layout.
+template <bool CalculateBounds, typename TString>
+inline auto layoutTextGeometry(
+    TextLayoutCursor&  cursor,
+    const Font&        font,
+    const TString&     string,
+    const TextStyle    style,
+    const unsigned int characterSize,
+    const float        letterSpacing,
+    const float        lineSpacing,
+    const float        outlineThickness,
+    const Color        fillColor,
+    const Color        outlineColor,
+    auto&&             fAddLine,
+    auto&&             fAddGlyphQuad,
+    auto&&             fOnLineStart)
 {
     // Compute values related to the text style
     const bool  isBold             = !!(style & TextStyle::Bold);
@@ -266,26 +310,15 @@ inline auto createTextGeometryAndGetBounds(
                 finalLetterSpacing,
                 finalLineSpacing] = precomputeSpacingConstants(font, style, characterSize, letterSpacing, lineSpacing);
 
-    base::SizeT currFillIndex    = outlineVertexCount;
-    base::SizeT currOutlineIndex = 0u;
-
-    float x = 0.f;
-    auto  y = static_cast<float>(characterSize);
-
-    // Bounds state (only updated if `CalculateBounds` is `true`)
-    [[maybe_unused]] auto  minX = static_cast<float>(characterSize);
-    [[maybe_unused]] auto  minY = static_cast<float>(characterSize);
-    [[maybe_unused]] float maxX = 0.f;
-    [[maybe_unused]] float maxY = 0.f;
-
-    char32_t prevChar = 0;
+    // Work on a local copy, so that vertex writes cannot alias the cursor
+    TextLayoutCursor c = cursor;
 
     const auto addLines = [&](float offset)
     {
-        fAddLine(currFillIndex, x, y, fillColor, offset, underlineThickness, /* outlineThickness */ 0.f);
+        fAddLine(c.fillIndex, c.x, c.y, fillColor, offset, underlineThickness, /* outlineThickness */ 0.f);
 
         if (outlineThickness != 0.f)
-            fAddLine(currOutlineIndex, x, y, outlineColor, offset, underlineThickness, outlineThickness);
+            fAddLine(c.outlineIndex, c.x, c.y, outlineColor, offset, underlineThickness, outlineThickness);
     };
 
     const auto updateBoundsAndAdvance = [&](const Glyph& fillGlyph) SFML_BASE_LAMBDA_ALWAYS_INLINE
@@ -295,30 +328,34 @@ inline auto createTextGeometryAndGetBounds(
             const Vec2f p1 = fillGlyph.bounds.position;
             const Vec2f p2 = fillGlyph.bounds.position + fillGlyph.bounds.size;
 
-            const float newMinX = x + p1.x - italicShear * p2.y;
-            const float newMaxX = x + p2.x - italicShear * p1.y;
-            const float newMinY = y + p1.y;
-            const float newMaxY = y + p2.y;
+            const float newMinX = c.x + p1.x - italicShear * p2.y;
+            const float newMaxX = c.x + p2.x - italicShear * p1.y;
+            const float newMinY = c.y + p1.y;
+            const float newMaxY = c.y + p2.y;
 
-            minX = SFML_BASE_MIN(minX, newMinX);
-            maxX = SFML_BASE_MAX(maxX, newMaxX);
-            minY = SFML_BASE_MIN(minY, newMinY);
-            maxY = SFML_BASE_MAX(maxY, newMaxY);
+            c.minX = SFML_BASE_MIN(c.minX, newMinX);
+            c.maxX = SFML_BASE_MAX(c.maxX, newMaxX);
+            c.minY = SFML_BASE_MIN(c.minY, newMinY);
+            c.maxY = SFML_BASE_MAX(c.maxY, newMaxY);
         }
 
-        x += fillGlyph.advance + finalLetterSpacing;
+        c.x += fillGlyph.advance + finalLetterSpacing;
     };
 
+    base::SizeT charCount = 0u;
+
     for (const char32_t curChar : string)
     {
+        ++charCount;
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
 
         // Apply the kerning offset
-        x += font.getKerning(prevChar, curChar, characterSize, isBold);
+        c.x += font.getKerning(c.prevChar, curChar, characterSize, isBold);
 
-        if (curChar == U'\n' && prevChar != U'\n')
+        if (curChar == U'\n' && c.prevChar != U'\n')
         {
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined)
@@ -329,7 +366,7 @@ inline auto createTextGeometryAndGetBounds(
                 addLines(strikeThroughOffset);
         }
 
-        prevChar = curChar;
+        c.prevChar = curChar;
 
         // Handle special characters
         if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
@@ -337,31 +374,34 @@ inline auto createTextGeometryAndGetBounds(
             // Update the current bounds (min coordinates)
             if constexpr (CalculateBounds)
             {
-                minX = SFML_BASE_MIN(minX, x);
-                minY = SFML_BASE_MIN(minY, y);
+                c.minX = SFML_BASE_MIN(c.minX, c.x);
+                c.minY = SFML_BASE_MIN(c.minY, c.y);
             }
 
             switch (curChar)
             {
                 case U' ':
-                    x += whitespaceWidth;
+                    c.x += whitespaceWidth;
                     break;
                 case U'\t':
-                    x += whitespaceWidth * 4;
+                    c.x += whitespaceWidth * 4;
                     break;
                 case U'\n':
-                    y += finalLineSpacing;
-                    x = 0.f;
+                    c.y += finalLineSpacing;
+                    c.x = 0.f;
                     break;
             }
 
             // Update the current bounds (max coordinates)
             if constexpr (CalculateBounds)
             {
-                maxX = SFML_BASE_MAX(maxX, x);
-                maxY = SFML_BASE_MAX(maxY, y);
+                c.maxX = SFML_BASE_MAX(c.maxX, c.x);
+                c.maxY = SFML_BASE_MAX(c.maxY, c.y);
             }
 
+            if (curChar == U'\n')
+                fOnLineStart(static_cast<const TextLayoutCursor&>(c), charCount);
+
             // Next glyph, no need to create a quad for whitespace
             continue;
         }
@@ -369,7 +409,7 @@ inline auto createTextGeometryAndGetBounds(
         if (outlineThickness == 0.f)
         {
             const Glyph& fillGlyph = font.getGlyph(curChar, characterSize, isBold, /* outlineThickness */ 0.f);
-            fAddGlyphQuad(currFillIndex, Vec2f{x, y}, fillColor, fillGlyph, italicShear);
+            fAddGlyphQuad(c.fillIndex, Vec2f{c.x, c.y}, fillColor, fillGlyph, italicShear);
 
             updateBoundsAndAdvance(fillGlyph);
         }
@@ -378,8 +418,8 @@ inline auto createTextGeometryAndGetBounds(
             const auto& [fillGlyph,
                          outlineGlyph] = font.getFillAndOutlineGlyph(curChar, characterSize, isBold, outlineThickness);
 
-            fAddGlyphQuad(currFillIndex, Vec2f{x, y}, fillColor, fillGlyph, italicShear);
-            fAddGlyphQuad(currOutlineIndex, Vec2f{x, y}, outlineColor, outlineGlyph, italicShear);
+            fAddGlyphQuad(c.fillIndex, Vec2f{c.x, c.y}, fillColor, fillGlyph, italicShear);
+            fAddGlyphQuad(c.outlineIndex, Vec2f{c.x, c.y}, outlineColor, outlineGlyph, italicShear);
 
             updateBoundsAndAdvance(fillGlyph);
         }
@@ -391,28 +431,65 @@ inline auto createTextGeometryAndGetBounds(
         if (outlineThickness != 0.f)
         {
             const float outline = SFML_BASE_MATH_FABSF(SFML_BASE_MATH_CEILF(outlineThickness));
-            minX -= outline;
-            maxX += outline;
-            minY -= outline;
-            maxY += outline;
+            c.minX -= outline;
+            c.maxX += outline;
+            c.minY -= outline;
+            c.maxY += outline;
         }
     }
 
     // If we're using the underlined style, add the last line
-    if (isUnderlined && (x > 0))
+    if (isUnderlined && (c.x > 0))
         addLines(underlineOffset);
 
     // If we're using the strike through style, add the last line across all characters
-    if (isStrikeThrough && (x > 0))
+    if (isStrikeThrough && (c.x > 0))
         addLines(strikeThroughOffset);
 
+    cursor = c;
+
     if constexpr (CalculateBounds)
     {
-        return Rect2f{{minX, minY}, {maxX - minX, maxY - minY}};
+        return Rect2f{{c.minX, c.minY}, {c.maxX - c.minX, c.maxY - c.minY}};
     }
 }
 
 
+////////////////////////////////////////////////////////////
+template <bool CalculateBounds, typename TString>
+inline auto createTextGeometryAndGetBounds(
+    const base::SizeT  outlineVertexCount,
+    const Font&        font,
+    const TString&     string,
+    const TextStyle    style,
+    const unsigned int characterSize,
+    const float        letterSpacing,
+    const float        lineSpacing,
+    const float        outlineThickness,
+    const Color        fillColor,    // TODO P1: remove?
+    const Color        outlineColor, // TODO P1: remove?
+    auto&&             fAddLine,
+    auto&&             fAddGlyphQuad)
+{
+    TextLayoutCursor cursor = makeTextLayoutCursor(outlineVertexCount, characterSize);
+
+    return layoutTextGeometry<CalculateBounds>(cursor,
+                                               font,
+                                               string,
+                                               style,
+                                               characterSize,
+                                               letterSpacing,
+                                               lineSpacing,
+                                               outlineThickness,
+                                               fillColor,
+                                               outlineColor,
+                                               SFML_BASE_FORWARD(fAddLine),
+                                               SFML_BASE_FORWARD(fAddGlyphQuad),
+                                               /* fOnLineStart */
+                                               [](auto&&...) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {});
+}
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard]] inline Rect2f precomputeTextLocalBounds(const Font& font, const TextData& textData)
 {
@@ -468,6 +545,7 @@ inline auto createTextGeometryAndGetBounds(
 /// (`precomputeTextQuadCount`), and generating the vertex data for
 /// text rendering, including handling styles like underline and strikethrough,
 /// as well as character and line spacing (`createTextGeometryAndGetBounds`,
+/// `layoutTextGeometry`, which can resume the layout from the start of a line,
 /// `addGlyphQuad`, `addLine`).
 ///
 /// While these utilities are predominantly used internally by the `sf::Text`
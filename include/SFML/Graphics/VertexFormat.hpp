@@ -0,0 +1,29 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup graphics
+/// \brief Layouts in which batch vertices can be uploaded to the GPU
+///
+/// Batches always build `sf::Vertex` objects on the CPU. Compact
+/// formats are packed on upload, and the GPU converts them back
+/// to floating point when fetching vertex attributes: shaders,
+/// including the built-in one, work unchanged with all formats.
+///
+/// Compact formats also upload 16-bit indices when the batch
+/// has at most 65536 vertices. A sprite then takes 60 bytes
+/// instead of 104.
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] VertexFormat : unsigned char
+{
+    Float32,   //!< `sf::Vertex` as is, 32-bit float positions and texture coordinates (20 bytes)
+    Int16,     //!< 16-bit integer positions and texture coordinates (12 bytes), for pixel-aligned geometry
+    HalfFloat, //!< 16-bit float positions and 16-bit integer texture coordinates (12 bytes)
+};
+
+} // namespace sf
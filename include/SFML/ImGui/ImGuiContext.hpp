@@ -106,6 +106,28 @@ public:
     void render(RenderWindow& window);
     void render(RenderTarget& target);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable batched rendering
+    ///
+    /// When enabled, `render` uploads the geometry of all ImGui
+    /// windows at once, into a persistently mapped ring buffer on
+    /// desktop OpenGL, and merges consecutive draw commands that
+    /// share a texture and a clip rectangle. Recommended for
+    /// interfaces made of many windows.
+    ///
+    /// Disabled by default.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchedRenderingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether batched rendering is enabled
+    ///
+    /// \see `setBatchedRenderingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchedRenderingEnabled() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
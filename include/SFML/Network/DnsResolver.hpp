@@ -0,0 +1,224 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous host name resolver with a result cache
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API DnsResolver
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to the result of a pending or completed lookup
+    ///
+    /// Handles are cheap to copy, all copies refer to the same
+    /// lookup. A handle remains valid after the resolver that
+    /// created it is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API Lookup
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Lookup();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Lookup(const Lookup& rhs);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Lookup& operator=(const Lookup& rhs);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Lookup(Lookup&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Lookup& operator=(Lookup&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the lookup has completed, without blocking
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Block until the lookup has completed
+        ///
+        ////////////////////////////////////////////////////////////
+        void wait() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the resolved addresses
+        ///
+        /// The addresses are interleaved by family, starting with
+        /// IPv6, ready to be passed to `TcpSocket::connect`.
+        ///
+        /// \return Resolved addresses, empty if the lookup failed
+        ///         or has not completed yet
+        ///
+        /// \see `isReady`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::Span<const IpAddress> getAddresses() const;
+
+    private:
+        friend DnsResolver;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Create a new handle to `state`, taking a reference
+        ///
+        ////////////////////////////////////////////////////////////
+        struct State;
+        [[nodiscard]] explicit Lookup(State& state);
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        State* m_state; //!< Reference-counted state shared with the worker and the cache
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a resolver
+    ///
+    /// \param timeToLive  How long resolved addresses are cached
+    /// \param workerCount Number of lookups that can run concurrently
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit DnsResolver(Time timeToLive = seconds(60.f), base::SizeT workerCount = 2u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the lookups that are already running to complete.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~DnsResolver();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DnsResolver(const DnsResolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DnsResolver& operator=(const DnsResolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    DnsResolver(DnsResolver&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    DnsResolver& operator=(DnsResolver&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start resolving a host name, without blocking
+    ///
+    /// If the host name was resolved (or is being resolved) less
+    /// than `timeToLive` ago, the cached lookup is returned and
+    /// no new query is made. Failed lookups are not cached.
+    /// Address literals (e.g. "127.0.0.1" or "::1") complete
+    /// immediately.
+    ///
+    /// \param hostName Network name or address to resolve
+    ///
+    /// \return Handle to the lookup
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Lookup resolve(base::StringView hostName);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all cached lookups
+    ///
+    /// Existing handles are not affected.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of cached lookups, including pending ones
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getCacheSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::DnsResolver
+/// \ingroup network
+///
+/// `sf::IpAddressUtils::resolve` blocks until the system resolver
+/// answers, which can take seconds on a bad network. `sf::DnsResolver`
+/// runs the lookups on worker threads instead, and returns a handle
+/// that can be polled every frame.
+///
+/// Results are cached for a fixed time: the system resolver does
+/// not expose the TTL of the DNS records, so the cache duration is
+/// chosen by the application.
+///
+/// Usage example:
+/// \code
+/// sf::DnsResolver resolver;
+/// sf::DnsResolver::Lookup lookup = resolver.resolve("www.sfml-dev.org");
+///
+/// // ... later, e.g. in the game loop
+/// if (lookup.isReady())
+/// {
+///     sf::TcpSocket socket(/* isBlocking */ true);
+///     if (socket.connect(lookup.getAddresses(), 80, sf::seconds(5.f)) == sf::Socket::Status::Done)
+///         ...;
+/// }
+/// \endcode
+///
+/// \see sf::IpAddressUtils, sf::TcpSocket
+///
+////////////////////////////////////////////////////////////
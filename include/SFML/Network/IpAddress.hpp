@@ -10,6 +10,7 @@
 
 #include "SFML/System/Time.hpp"
 
+#include "SFML/Base/Array.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
 
@@ -28,12 +29,22 @@ class IpAddressUtils;
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Encapsulate an IPv4 network address
+/// \brief Encapsulate an IPv4 or IPv6 network address
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API IpAddress
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Address family
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type : base::U8
+    {
+        IpV4, //!< 32-bit IPv4 address
+        IpV6, //!< 128-bit IPv6 address
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the address from 4 bytes
     ///
@@ -64,6 +75,28 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] explicit IpAddress(base::U32 address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an IPv6 address from 16 bytes
+    ///
+    /// \param bytes Bytes of the address, in network order
+    ///
+    /// \see `toBytes`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit IpAddress(const base::Array<base::U8, 16>& bytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the family of the address
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the address is an IPv6 address
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isV6() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get an integer representation of the address
     ///
@@ -73,13 +106,26 @@ public:
     /// The integer produced by this function can then be converted
     /// back to a `sf::IpAddress` with the proper constructor.
     ///
+    /// Only valid for IPv4 addresses.
+    ///
     /// \return 32-bits unsigned integer representation of the address
     ///
-    /// \see `toString`
+    /// \see `toBytes`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::U32 toInteger() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the 16 bytes of the address, in network order
+    ///
+    /// IPv4 addresses are returned in their IPv4-mapped IPv6
+    /// form, i.e. `::ffff:a.b.c.d`.
+    ///
+    /// \see `toInteger`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Array<base::U8, 16> toBytes() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the computer's local address
     ///
@@ -135,9 +181,11 @@ public:
     // Static member data
     ////////////////////////////////////////////////////////////
     // NOLINTBEGIN(readability-identifier-naming)
-    static const IpAddress Any;       //!< Value representing any address (0.0.0.0)
-    static const IpAddress LocalHost; //!< The "localhost" address (for connecting a computer to itself locally)
-    static const IpAddress Broadcast; //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress Any;         //!< Value representing any address (0.0.0.0)
+    static const IpAddress LocalHost;   //!< The "localhost" address (for connecting a computer to itself locally)
+    static const IpAddress Broadcast;   //!< The "broadcast" address (for sending UDP messages to everyone on a local network)
+    static const IpAddress AnyV6;       //!< Value representing any IPv6 address (::)
+    static const IpAddress LocalHostV6; //!< The IPv6 "localhost" address (::1)
     // NOLINTEND(readability-identifier-naming)
 
 private:
@@ -147,7 +195,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    base::U32 m_address; //!< Address stored as an unsigned 32 bit integer
+    base::Array<base::U8, 16> m_bytes; //!< Address bytes in network order, IPv4 addresses are stored IPv4-mapped
+    Type                      m_type;  //!< Address family
 };
 
 ////////////////////////////////////////////////////////////
@@ -218,7 +267,8 @@ private:
 /// auto a9 = sf::IpAddress::getPublicAddress();        // my address on the internet
 /// \endcode
 ///
-/// Note that `sf::IpAddress` currently doesn't support IPv6
-/// nor other types of network addresses.
+/// IPv6 addresses are supported by `sf::IpAddressUtils`,
+/// `sf::DnsResolver` and `sf::TcpSocket::connect`. The other
+/// socket classes currently only support IPv4 addresses.
 ///
 ////////////////////////////////////////////////////////////
@@ -12,6 +12,7 @@
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/StringView.hpp"
+#include "SFML/Base/Vector.hpp"
 
 
 ////////////////////////////////////////////////////////////
@@ -26,7 +27,7 @@ class String;
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief Encapsulate an IPv4 network address
+/// \brief Conversions between IP addresses and strings
 ///
 ////////////////////////////////////////////////////////////
 class SFML_NETWORK_API IpAddressUtils
@@ -36,21 +37,44 @@ public:
     /// \brief Construct the address from a null-terminated string view
     ///
     /// Here \a address can be either a decimal address
-    /// (ex: "192.168.1.56") or a network name (ex: "localhost").
+    /// (ex: "192.168.1.56"), an IPv6 address (ex: "::1") or a
+    /// network name (ex: "localhost").
+    ///
+    /// Network names are resolved synchronously. If the name has
+    /// both IPv4 and IPv6 addresses, an IPv4 address is returned.
     ///
     /// \param address IP address or network name
     ///
     /// \return Address on success, `base::nullOpt` otherwise
     ///
+    /// \see `resolveAll`, `sf::DnsResolver`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<IpAddress> resolve(base::StringView address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the IPv4 and IPv6 addresses of a null-terminated network name
+    ///
+    /// Network names are resolved synchronously. The addresses are
+    /// interleaved by family, starting with IPv6, which is the order
+    /// in which `TcpSocket::connect` should try them.
+    ///
+    /// \param address IP address or network name
+    ///
+    /// \return Addresses on success, an empty vector otherwise
+    ///
+    /// \see `resolve`, `sf::DnsResolver`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Vector<IpAddress> resolveAll(base::StringView address);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get a string representation of the address
     ///
     /// The returned string is the decimal representation of the
-    /// IP address (like "192.168.1.56"), even if it was constructed
-    /// from a host name.
+    /// IP address (like "192.168.1.56"), or the standard text form
+    /// of an IPv6 address (like "2001:db8::1"), even if it was
+    /// constructed from a host name.
     ///
     /// \return String representation of the address
     ///
@@ -8,9 +8,13 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Network/Export.hpp"
 
+#include "SFML/Base/Allocator.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
 #include "SFML/Base/FwdStdString.hpp" // IWYU pragma: keep
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Trait/IsTriviallyCopyable.hpp"
 #include "SFML/Base/Vector.hpp"
 
 
@@ -20,6 +24,7 @@
 namespace sf
 {
 class UnicodeString;
+class Utf8String;
 } // namespace sf
 
 
@@ -41,6 +46,17 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Packet() = default;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty packet on top of a memory resource
+    ///
+    /// The packet's data is allocated from `resource`, which must
+    /// outlive the packet. Copies of the packet share the resource.
+    ///
+    /// \param resource Memory resource used for the packet data
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Packet(base::MemoryResource& resource);
+
     ////////////////////////////////////////////////////////////
     /// \brief Virtual destructor
     ///
@@ -264,6 +280,11 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator>>(UnicodeString& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& operator>>(Utf8String& data);
+
     ////////////////////////////////////////////////////////////
     /// Overload of `operator<<` to write data into the packet
     ///
@@ -345,6 +366,117 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const UnicodeString& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ///
+    /// Written as a byte length followed by the raw UTF-8 bytes,
+    /// which is up to 4x smaller than `sf::UnicodeString` for ASCII.
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& operator<<(const Utf8String& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an unsigned integer with a variable-length encoding
+    ///
+    /// The value is written 7 bits at a time, least significant
+    /// group first, with the high bit of each byte set when more
+    /// bytes follow (LEB128). Values below 128 take a single byte,
+    /// values below 16384 take two, and so on up to 10 bytes.
+    ///
+    /// \param data Value to append
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `extractVarUInt`, `appendVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& appendVarUInt(base::U64 data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a signed integer with a variable-length encoding
+    ///
+    /// The value is zigzag-encoded (0, -1, 1, -2, 2, ... map to
+    /// 0, 1, 2, 3, 4, ...) so that values close to zero take few
+    /// bytes whatever their sign, then written as `appendVarUInt`.
+    ///
+    /// \param data Value to append
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `extractVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& appendVarInt(base::I64 data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an unsigned integer written by `appendVarUInt`
+    ///
+    /// Invalidates the packet if the encoding is truncated or
+    /// longer than 10 bytes.
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractVarUInt(base::U64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a signed integer written by `appendVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& extractVarInt(base::I64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a contiguous range of trivially copyable objects
+    ///
+    /// The element count is written with `appendVarUInt`, followed
+    /// by the memory of the elements copied as a single block. This
+    /// is much faster than appending elements one by one, but the
+    /// bytes are in the byte order and layout of the host: only use
+    /// it between builds that agree on both.
+    ///
+    /// \param items Elements to append
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `extractVector`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& appendSpan(base::Span<const T> items)
+    {
+        static_assert(SFML_BASE_IS_TRIVIALLY_COPYABLE(T), "Only trivially copyable types can be appended as a span");
+
+        appendVarUInt(items.size());
+        append(items.data(), items.size() * sizeof(T));
+
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a range of objects written by `appendSpan`
+    ///
+    /// \param items Vector to fill with the elements, cleared first
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& extractVector(base::Vector<T>& items)
+    {
+        static_assert(SFML_BASE_IS_TRIVIALLY_COPYABLE(T), "Only trivially copyable types can be extracted as a span");
+
+        items.clear();
+
+        base::SizeT          count = 0u;
+        const unsigned char* bytes = nullptr;
+
+        if (extractCountedBytes(sizeof(T), count, bytes) && count > 0u)
+        {
+            items.resize(count);
+            SFML_BASE_MEMCPY(items.data(), bytes, count * sizeof(T));
+        }
+
+        return *this;
+    }
+
 protected:
     friend class TcpSocket;
     friend class UdpSocket;
@@ -401,6 +533,18 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool checkSize(base::SizeT size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a count written by `appendVarUInt`, followed by `count` elements of `elementSize` bytes
+    ///
+    /// \param elementSize Size of an element, in bytes
+    /// \param count       Filled with the number of elements
+    /// \param bytes       Filled with a pointer to the first element, within the packet
+    ///
+    /// \return `true` on success, `false` if the packet is too small (which invalidates it)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool extractCountedBytes(base::SizeT elementSize, base::SizeT& count, const unsigned char*& bytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the send position stored in the PImpl
     ///
@@ -412,10 +556,11 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    base::Vector<unsigned char> m_data;          //!< Data stored in the packet
-    base::SizeT                 m_readPos{};     //!< Current reading position in the packet
-    base::SizeT                 m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
-    bool                        m_isValid{true}; //!< Reading state of the packet
+    base::Vector<unsigned char, base::ResourceAllocator> m_data; //!< Data stored in the packet
+
+    base::SizeT m_readPos{};     //!< Current reading position in the packet
+    base::SizeT m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
+    bool        m_isValid{true}; //!< Reading state of the packet
 };
 
 } // namespace sf
@@ -477,7 +622,7 @@ private:
 /// \li `bool`
 /// \li fixed-size integer types (`int[8|16|32]_t`, `uint[8|16|32]_t`)
 /// \li floating point numbers (`float`, `double`)
-/// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::UnicodeString`)
+/// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::UnicodeString`, `sf::Utf8String`)
 ///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
@@ -502,6 +647,16 @@ private:
 /// }
 /// \endcode
 ///
+/// For aggregates, `sf::appendStruct` and `sf::extractStruct`
+/// (see `SFML/Network/PacketStruct.hpp`) visit every field
+/// automatically, without hand-written overloads.
+///
+/// Small integers can be written with `appendVarInt` and
+/// `appendVarUInt`, which use one byte per 7 significant bits,
+/// and arrays of trivially copyable objects with `appendSpan`.
+/// `sf::PacketBitWriter` packs booleans, ranged integers and
+/// quantized floats using only the bits they need.
+///
 /// Packets also provide an extra feature that allows to apply
 /// custom transformations to the data before it is sent,
 /// and after it is received. This is typically used to
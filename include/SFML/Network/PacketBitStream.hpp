@@ -0,0 +1,237 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Packet;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Writes values of arbitrary bit widths into a packet
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketBitWriter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start writing bits at the end of `packet`
+    ///
+    /// `packet` must outlive the writer, and must not be written
+    /// to directly until the writer is flushed.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PacketBitWriter(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor, flushes the pending bits
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PacketBitWriter();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBitWriter(const PacketBitWriter&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBitWriter& operator=(const PacketBitWriter&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the `bitCount` least significant bits of `value`
+    ///
+    /// \param value    Value to write, higher bits are ignored
+    /// \param bitCount Number of bits to write, in [1, 32]
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeBits(base::U32 value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a boolean as a single bit
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeBool(bool value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an integer known to be in [`min`, `max`]
+    ///
+    /// Uses the smallest number of bits that can represent every
+    /// value of the range, e.g. 7 bits for [0, 100]. Values out
+    /// of the range are clamped.
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeRangedInt(base::I32 value, base::I32 min, base::I32 max);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a float known to be in [`min`, `max`] with a fixed precision
+    ///
+    /// The range is divided in `2^bitCount - 1` steps and the
+    /// value is rounded to the nearest one: the error is at most
+    /// `(max - min) / (2^(bitCount + 1) - 2)`. For instance, an
+    /// angle in [0, 360] written with 12 bits is accurate to
+    /// 0.044 degrees. Values out of the range are clamped, and
+    /// NaN is written as `min`.
+    ///
+    /// \param value    Value to write
+    /// \param min      Lower bound of the range
+    /// \param max      Upper bound of the range, must be greater than `min`
+    /// \param bitCount Number of bits to write, in [1, 32]
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeQuantizedFloat(float value, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the pending bits to the packet, padded to a whole byte
+    ///
+    /// Called automatically by the destructor. Bytes can be
+    /// written directly to the packet after a flush.
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bits written since construction
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::U64 getBitCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Packet&      m_packet;          //!< Destination of the bits
+    base::U64    m_scratch{};       //!< Bits not yet appended to the packet, least significant first
+    unsigned int m_scratchBits{};   //!< Number of valid bits in `m_scratch`
+    base::U64    m_totalBitCount{}; //!< Number of bits written since construction
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Reads values written by `PacketBitWriter` from a packet
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketBitReader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading bits at the read position of `packet`
+    ///
+    /// The packet read position moves forward one byte at a time,
+    /// as bits are needed. Once every value has been read, the
+    /// packet is positioned after the padding written by
+    /// `PacketBitWriter::flush`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PacketBitReader(Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBitReader(const PacketBitReader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketBitReader& operator=(const PacketBitReader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a value written by `PacketBitWriter::writeBits`
+    ///
+    /// On failure, `value` is left untouched and the packet is
+    /// invalidated.
+    ///
+    /// \return `true` on success, `false` if there are not enough bits left
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readBits(base::U32& value, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a value written by `PacketBitWriter::writeBool`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readBool(bool& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a value written by `PacketBitWriter::writeRangedInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readRangedInt(base::I32& value, base::I32 min, base::I32 max);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a value written by `PacketBitWriter::writeQuantizedFloat`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool readQuantizedFloat(float& value, float min, float max, unsigned int bitCount);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Packet&      m_packet;        //!< Source of the bits
+    base::U64    m_scratch{};     //!< Bits read from the packet but not consumed yet, least significant first
+    unsigned int m_scratchBits{}; //!< Number of valid bits in `m_scratch`
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketBitWriter
+/// \ingroup network
+///
+/// `sf::Packet` writes whole bytes: a `bool` takes 8 bits and a
+/// health value in [0, 100] stored as `base::U8` wastes one.
+/// `sf::PacketBitWriter` packs values using exactly the number of
+/// bits they need, and `sf::PacketBitReader` reads them back.
+/// Bits are packed least significant first, which makes the
+/// format independent of the host byte order.
+///
+/// Bit-packed sections can be mixed with regular `sf::Packet`
+/// data: the writer pads its output to a whole byte when flushed.
+///
+/// Usage example:
+/// \code
+/// sf::Packet packet;
+/// packet << entityId; // byte-aligned data
+///
+/// {
+///     sf::PacketBitWriter writer(packet);
+///     writer.writeBool(isCrouching);
+///     writer.writeRangedInt(health, 0, 100);                       // 7 bits
+///     writer.writeQuantizedFloat(position.x, -512.f, 512.f, 16); // ~0.008 precision
+///     writer.writeQuantizedFloat(angle, 0.f, 360.f, 10);
+/// } // flushed here
+///
+/// // ...on the other side
+/// packet >> entityId;
+///
+/// sf::PacketBitReader reader(packet);
+/// if (reader.readBool(isCrouching) && reader.readRangedInt(health, 0, 100) &&
+///     reader.readQuantizedFloat(position.x, -512.f, 512.f, 16) && reader.readQuantizedFloat(angle, 0.f, 360.f, 10))
+///     ...;
+/// \endcode
+///
+/// \see sf::Packet
+///
+////////////////////////////////////////////////////////////
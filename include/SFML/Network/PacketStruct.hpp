@@ -0,0 +1,305 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/Array.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MiniPFR.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Trait/Conditional.hpp"
+#include "SFML/Base/Trait/IsAggregate.hpp"
+#include "SFML/Base/Trait/IsEnum.hpp"
+#include "SFML/Base/Trait/IsIntegral.hpp"
+#include "SFML/Base/Trait/IsSame.hpp"
+#include "SFML/Base/Trait/IsUnsigned.hpp"
+#include "SFML/Base/Trait/UnderlyingType.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Encoding of the integer fields written by `appendStruct`
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] PacketStructEncoding : unsigned char
+{
+    Fixed,   //!< Integers are written with `Packet::operator<<`, at their full width
+    Compact, //!< Integers wider than a byte are written with `Packet::appendVarInt` and `Packet::appendVarUInt`
+};
+
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool isPacketStructPointer = false;
+
+template <typename T>
+inline constexpr bool isPacketStructPointer<T*> = true;
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool isPacketStructArray = false;
+
+template <typename T, base::SizeT N>
+inline constexpr bool isPacketStructArray<base::Array<T, N>> = true;
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool isPacketStructVector = false;
+
+template <typename T, typename TAllocator>
+inline constexpr bool isPacketStructVector<base::Vector<T, TAllocator>> = true;
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+inline constexpr bool isPacketStructInteger = SFML_BASE_IS_INTEGRAL(T) && !SFML_BASE_IS_SAME(T, bool);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Return a value of the fixed-width integer type with the size and signedness of `T`
+///
+/// `int`, `long`, `char`, etc. don't necessarily match one of the
+/// `Packet::operator<<` overloads exactly.
+///
+////////////////////////////////////////////////////////////
+template <typename T>
+[[nodiscard]] constexpr auto makePacketStructFixedInteger()
+{
+    constexpr bool isUnsigned = SFML_BASE_IS_UNSIGNED(T);
+
+    if constexpr (sizeof(T) == 1u)
+        return base::Conditional<isUnsigned, base::U8, base::I8>{};
+    else if constexpr (sizeof(T) == 2u)
+        return base::Conditional<isUnsigned, base::U16, base::I16>{};
+    else if constexpr (sizeof(T) == 4u)
+        return base::Conditional<isUnsigned, base::U32, base::I32>{};
+    else
+        return base::Conditional<isUnsigned, base::U64, base::I64>{};
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+using PacketStructFixedInteger = decltype(makePacketStructFixedInteger<T>());
+
+
+////////////////////////////////////////////////////////////
+template <PacketStructEncoding Encoding, typename T>
+void appendStructField(Packet& packet, const T& field)
+{
+    static_assert(!isPacketStructPointer<T>, "Pointer fields cannot be serialized");
+
+    if constexpr (SFML_BASE_IS_ENUM(T))
+    {
+        appendStructField<Encoding>(packet, static_cast<SFML_BASE_UNDERLYING_TYPE(T)>(field));
+    }
+    else if constexpr (isPacketStructInteger<T>)
+    {
+        if constexpr (Encoding == PacketStructEncoding::Fixed || sizeof(T) == 1u)
+            packet << static_cast<PacketStructFixedInteger<T>>(field);
+        else if constexpr (SFML_BASE_IS_UNSIGNED(T))
+            packet.appendVarUInt(static_cast<base::U64>(field));
+        else
+            packet.appendVarInt(static_cast<base::I64>(field));
+    }
+    else if constexpr (requires { packet << field; })
+    {
+        packet << field;
+    }
+    else if constexpr (isPacketStructArray<T>)
+    {
+        for (const auto& element : field)
+            appendStructField<Encoding>(packet, element);
+    }
+    else if constexpr (isPacketStructVector<T>)
+    {
+        packet.appendVarUInt(field.size());
+
+        for (const auto& element : field)
+            appendStructField<Encoding>(packet, element);
+    }
+    else if constexpr (SFML_BASE_IS_AGGREGATE(T))
+    {
+        base::minipfr::forEachField(field,
+                                    [&packet](const auto& member) { appendStructField<Encoding>(packet, member); });
+    }
+    else
+    {
+        static_assert(sizeof(T) == 0u, "Field type cannot be serialized, provide an `operator<<` for it");
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <PacketStructEncoding Encoding, typename T>
+void extractStructField(Packet& packet, T& field)
+{
+    static_assert(!isPacketStructPointer<T>, "Pointer fields cannot be deserialized");
+
+    if constexpr (SFML_BASE_IS_ENUM(T))
+    {
+        SFML_BASE_UNDERLYING_TYPE(T) value{};
+        extractStructField<Encoding>(packet, value);
+
+        if (packet)
+            field = static_cast<T>(value);
+    }
+    else if constexpr (isPacketStructInteger<T>)
+    {
+        if constexpr (Encoding == PacketStructEncoding::Fixed || sizeof(T) == 1u)
+        {
+            PacketStructFixedInteger<T> value{};
+            if (packet >> value)
+                field = static_cast<T>(value);
+        }
+        else if constexpr (SFML_BASE_IS_UNSIGNED(T))
+        {
+            base::U64 value = 0u;
+            if (packet.extractVarUInt(value))
+                field = static_cast<T>(value);
+        }
+        else
+        {
+            base::I64 value = 0;
+            if (packet.extractVarInt(value))
+                field = static_cast<T>(value);
+        }
+    }
+    else if constexpr (requires { packet >> field; })
+    {
+        packet >> field;
+    }
+    else if constexpr (isPacketStructArray<T>)
+    {
+        for (auto& element : field)
+            extractStructField<Encoding>(packet, element);
+    }
+    else if constexpr (isPacketStructVector<T>)
+    {
+        field.clear();
+
+        base::U64 count = 0u;
+        if (!packet.extractVarUInt(count))
+            return;
+
+        // Stops as soon as the packet runs out of data, whatever the announced count
+        for (base::U64 i = 0u; i < count && packet; ++i)
+        {
+            typename T::value_type element{};
+            extractStructField<Encoding>(packet, element);
+
+            if (packet)
+                field.pushBack(static_cast<typename T::value_type&&>(element));
+        }
+    }
+    else if constexpr (SFML_BASE_IS_AGGREGATE(T))
+    {
+        base::minipfr::forEachField(field, [&packet](auto& member) { extractStructField<Encoding>(packet, member); });
+    }
+    else
+    {
+        static_assert(sizeof(T) == 0u, "Field type cannot be deserialized, provide an `operator>>` for it");
+    }
+}
+
+} // namespace sf::priv
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Append every field of an aggregate to a packet
+///
+/// Fields are visited in declaration order with `base::MiniPFR`,
+/// without any per-type boilerplate. Each field is written with
+/// the first rule that applies to its type:
+/// \li enumerations are written as their underlying type
+/// \li integers wider than a byte use a variable-length encoding,
+///     if `Encoding` is `PacketStructEncoding::Compact`
+/// \li types supported by `Packet::operator<<`, including
+///     user-defined overloads, use it
+/// \li `base::Array` elements are written one after the other
+/// \li `base::Vector` is written as its size followed by its elements
+/// \li nested aggregates are visited recursively
+///
+/// The receiver must use `extractStruct` with the same type and
+/// encoding. Reordering, adding or removing fields changes the
+/// format.
+///
+/// Usage example:
+/// \code
+/// struct PlayerState
+/// {
+///     sf::base::U32          id;
+///     sf::Vec2f              position;
+///     sf::base::I16          health;
+///     Team                   team; // enum
+///     sf::base::Vector<Item> inventory;
+/// };
+///
+/// sf::Packet packet;
+/// sf::appendStruct(packet, state);
+///
+/// // ...on the other side
+/// PlayerState received;
+/// if (sf::extractStruct(packet, received))
+///     ...;
+/// \endcode
+///
+/// \param packet Packet to append to
+/// \param object Aggregate to serialize
+///
+/// \return Reference to `packet`
+///
+/// \see `extractStruct`
+///
+////////////////////////////////////////////////////////////
+template <PacketStructEncoding Encoding = PacketStructEncoding::Compact, typename T>
+Packet& appendStruct(Packet& packet, const T& object)
+{
+    static_assert(SFML_BASE_IS_AGGREGATE(T), "`appendStruct` requires an aggregate type");
+
+    priv::appendStructField<Encoding>(packet, object);
+    return packet;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Extract every field of an aggregate written by `appendStruct`
+///
+/// On failure the packet is invalidated, and `object` may be
+/// partially filled. Integers that do not fit in their field
+/// are truncated.
+///
+/// \param packet Packet to extract from
+/// \param object Aggregate to fill
+///
+/// \return Reference to `packet`
+///
+/// \see `appendStruct`
+///
+////////////////////////////////////////////////////////////
+template <PacketStructEncoding Encoding = PacketStructEncoding::Compact, typename T>
+Packet& extractStruct(Packet& packet, T& object)
+{
+    static_assert(SFML_BASE_IS_AGGREGATE(T), "`extractStruct` requires an aggregate type");
+
+    priv::extractStructField<Encoding>(packet, object);
+    return packet;
+}
+
+} // namespace sf
+
@@ -0,0 +1,217 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Base/FwdStdString.hpp" // IWYU pragma: keep
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Read-only view over packet data owned elsewhere
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API PacketView
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a view over a sequence of bytes
+    ///
+    /// The bytes are not copied, and must outlive the view.
+    ///
+    /// \param data Pointer to the bytes to read from
+    /// \param size Number of bytes to read from
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PacketView(const void* data, base::SizeT size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the view
+    ///
+    /// \return The byte offset of the current read position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getReadPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the viewed data
+    ///
+    /// \return Pointer to the data
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the viewed data, in bytes
+    ///
+    /// \see `getData`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell if the reading position has reached the
+    ///        end of the view
+    ///
+    /// \return `true` if all data was read, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool endOfPacket() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Test the validity of the view, for reading
+    ///
+    /// Same semantics as `sf::Packet::operator bool`.
+    ///
+    /// \return `true` if last data extraction from the view was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit operator bool() const;
+
+    ////////////////////////////////////////////////////////////
+    /// Overload of `operator>>` to read data from the view
+    ///
+    /// The wire format is the same as `sf::Packet`.
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(bool& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::I8& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::U8& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::I16& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::U16& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::I32& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::U32& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::I64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::U64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(float& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(double& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(std::string& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a string written as `const char*` or `std::string`
+    ///
+    /// The resulting view points into the viewed data, no copy
+    /// is made. It is not null-terminated.
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& operator>>(base::StringView& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract an unsigned integer written by `Packet::appendVarUInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractVarUInt(base::U64& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a signed integer written by `Packet::appendVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    PacketView& extractVarInt(base::I64& data);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if the view can extract a given number of bytes
+    ///
+    /// This function updates accordingly the state of the view.
+    ///
+    /// \param size Size to check
+    ///
+    /// \return `true` if `size` bytes can be read from the view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool checkSize(base::SizeT size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const unsigned char* m_data;          //!< Viewed data
+    base::SizeT          m_size;          //!< Size of the viewed data, in bytes
+    base::SizeT          m_readPos{};     //!< Current reading position in the view
+    bool                 m_isValid{true}; //!< Reading state of the view
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PacketView
+/// \ingroup network
+///
+/// `sf::PacketView` reads data written with `sf::Packet`, without
+/// owning or copying it. It is returned by the batched receive
+/// functions of `sf::UdpSocket`, where each view points directly
+/// into the memory the datagram was received into.
+///
+/// Views are cheap to copy: each copy has its own read position.
+///
+/// \code
+/// for (const sf::UdpSocket::ReceivedDatagram& datagram : batch.getDatagrams())
+/// {
+///     sf::PacketView packet = datagram.toPacketView();
+///
+///     sf::base::U32 id = 0;
+///     float         x  = 0.f;
+///
+///     if (packet >> id >> x)
+///         ...;
+/// }
+/// \endcode
+///
+/// \see sf::Packet, sf::UdpSocket
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,309 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Packet;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Delta compression of a serialized snapshot against a baseline
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SnapshotDelta
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Largest snapshot accepted by `decode`, in bytes
+    ///
+    /// Protects the receiver against packets announcing huge
+    /// snapshots made of a few long runs.
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr base::SizeT maxSnapshotSize{1024u * 1024u};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the delta between `baseline` and `snapshot` to a packet
+    ///
+    /// The snapshot is XOR-ed with the baseline, and the residual
+    /// is run-length encoded: unchanged bytes cost nothing but the
+    /// length of their run. An empty baseline encodes the whole
+    /// snapshot. The sizes of the baseline and of the snapshot
+    /// don't need to match, missing baseline bytes are zero.
+    ///
+    /// \param baseline Snapshot known to the receiver
+    /// \param snapshot Snapshot to send
+    /// \param packet   Packet to append the delta to
+    ///
+    ////////////////////////////////////////////////////////////
+    static void encode(base::Span<const unsigned char> baseline,
+                       base::Span<const unsigned char> snapshot,
+                       Packet&                         packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a delta written by `encode` and apply it to `baseline`
+    ///
+    /// `snapshot` must not refer to the same memory as `baseline`.
+    ///
+    /// \param packet   Packet to extract the delta from
+    /// \param baseline Same baseline as the one passed to `encode`
+    /// \param snapshot Receives the reconstructed snapshot
+    ///
+    /// \return `true` on success, `false` if the delta is truncated or malformed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool decode(Packet&                         packet,
+                                     base::Span<const unsigned char> baseline,
+                                     base::Vector<unsigned char>&    snapshot);
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Fixed-capacity history of numbered snapshots
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SnapshotBaselineRing
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty ring
+    ///
+    /// \param capacity Number of snapshots kept, must not be zero
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SnapshotBaselineRing(base::SizeT capacity = 32u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a copy of a snapshot
+    ///
+    /// Overwrites the snapshot stored `capacity` sequences earlier.
+    /// The storage of overwritten snapshots is reused.
+    ///
+    /// \param sequence Sequence number of the snapshot, must not be zero
+    /// \param snapshot Snapshot data
+    ///
+    ////////////////////////////////////////////////////////////
+    void store(base::U32 sequence, base::Span<const unsigned char> snapshot);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a stored snapshot
+    ///
+    /// The returned pointer is invalidated by the next call to
+    /// `store` or `clear`.
+    ///
+    /// \return Snapshot with sequence number `sequence`, `nullptr` if it was never stored or was overwritten
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const base::Vector<unsigned char>* find(base::U32 sequence) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all stored snapshots
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of snapshots that can be stored
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getCapacity() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Snapshot stored in a slot of the ring
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        base::U32                   sequence{}; //!< Sequence number, zero if the slot is empty
+        base::Vector<unsigned char> bytes;      //!< Snapshot data
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::Vector<Entry> m_entries; //!< Slots, indexed by sequence number modulo the capacity
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Sender side of a stream of delta-compressed snapshots to one peer
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SnapshotDeltaEncoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an encoder
+    ///
+    /// \param historySize Number of sent snapshots that can be
+    ///                    used as baselines once acknowledged
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SnapshotDeltaEncoder(base::SizeT historySize = 32u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a snapshot to a packet
+    ///
+    /// The snapshot is encoded against the most recent snapshot
+    /// acknowledged by the peer, or sent whole if there is none.
+    ///
+    /// \param snapshot Serialized state to send
+    /// \param packet   Packet to append to
+    ///
+    /// \return Sequence number assigned to the snapshot
+    ///
+    ////////////////////////////////////////////////////////////
+    base::U32 encode(base::Span<const unsigned char> snapshot, Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record that the peer received a snapshot
+    ///
+    /// The snapshot becomes the baseline of the next ones, unless
+    /// a more recent snapshot was already acknowledged or it is
+    /// no longer in the history.
+    ///
+    /// \param sequence Sequence number returned by `SnapshotDeltaDecoder::decode`
+    ///
+    ////////////////////////////////////////////////////////////
+    void acknowledge(base::U32 sequence);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sequence number of the current baseline
+    ///
+    /// \return Sequence number, zero if no snapshot was acknowledged
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::U32 getBaselineSequence() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the history, the next snapshot is sent whole
+    ///
+    /// Use when the peer reconnects.
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SnapshotBaselineRing m_history;              //!< Sent snapshots
+    base::U32            m_nextSequence{1u};     //!< Sequence number of the next snapshot, never zero
+    base::U32            m_baselineSequence{0u}; //!< Most recent acknowledged snapshot, zero if none
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Receiver side of a stream of delta-compressed snapshots
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SnapshotDeltaDecoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a decoder
+    ///
+    /// \param historySize Number of received snapshots kept as
+    ///                    potential baselines, should match the
+    ///                    history size of the encoder
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SnapshotDeltaDecoder(base::SizeT historySize = 32u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract a snapshot written by `SnapshotDeltaEncoder::encode`
+    ///
+    /// On success, `sequence` should be sent back to the encoder
+    /// so that it is passed to `SnapshotDeltaEncoder::acknowledge`.
+    ///
+    /// \param packet   Packet to extract from
+    /// \param snapshot Receives the reconstructed snapshot
+    /// \param sequence Receives the sequence number of the snapshot
+    ///
+    /// \return `true` on success, `false` if the data is malformed or
+    ///         its baseline is no longer in the history
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool decode(Packet& packet, base::Vector<unsigned char>& snapshot, base::U32& sequence);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the history
+    ///
+    ////////////////////////////////////////////////////////////
+    void reset();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    SnapshotBaselineRing m_history; //!< Received snapshots
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SnapshotDelta
+/// \ingroup network
+///
+/// Most of the state of a game changes little from one tick to
+/// the next, yet sending every snapshot whole costs the same
+/// bandwidth as if everything had changed. Delta compression
+/// sends only the difference with a snapshot that the peer is
+/// known to have, the baseline.
+///
+/// `sf::SnapshotDeltaEncoder` and `sf::SnapshotDeltaDecoder`
+/// implement the usual protocol on top of `sf::SnapshotDelta`:
+/// the server keeps one encoder per client and encodes every
+/// snapshot against the latest one acknowledged by that client.
+/// Lost snapshots need no retransmission, the baseline simply
+/// stays older. If no acknowledgement arrives for `historySize`
+/// snapshots, they are sent whole until one does.
+///
+/// Snapshots are raw bytes, produced for instance with
+/// `sf::appendStruct` or `sf::PacketBitWriter`. Fields should
+/// keep their offset from one snapshot to the next: inserting
+/// bytes in the middle defeats the compression.
+///
+/// Usage example:
+/// \code
+/// // Server, for each client
+/// const auto* stateBytes = static_cast<const unsigned char*>(state.getData());
+///
+/// sf::Packet packet;
+/// client.encoder.encode({stateBytes, state.getDataSize()}, packet);
+/// client.connection.send(sf::UdpConnection::Channel::Unreliable, packet);
+///
+/// // ...when the client acknowledges a snapshot
+/// client.encoder.acknowledge(ackedSequence);
+///
+/// // Client
+/// sf::base::Vector<unsigned char> state;
+/// sf::base::U32 sequence = 0;
+/// if (decoder.decode(packet, state, sequence))
+///     sendAcknowledgement(sequence);
+/// \endcode
+///
+/// \see sf::Packet, sf::UdpConnection
+///
+////////////////////////////////////////////////////////////
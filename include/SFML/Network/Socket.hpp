@@ -170,6 +170,7 @@ protected:
 
 private:
     friend class SocketSelector;
+    friend class SocketReactor;
 
     ////////////////////////////////////////////////////////////
     // Member data
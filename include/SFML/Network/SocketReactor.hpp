@@ -0,0 +1,527 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Socket.hpp"
+#include "SFML/Network/SocketHandle.hpp"
+#include "SFML/Network/Task.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <coroutine>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Packet;
+class TcpListener;
+class TcpSocket;
+class UdpSocket;
+class UnicodeString;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Single-threaded event loop running coroutines that wait for sockets and timers
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API SocketReactor
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Outcome of an asynchronous operation
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Result
+    {
+        Socket::Status            status{Socket::Status::NotReady}; //!< Status, `NotReady` if the operation was dropped
+        base::SizeT               transferred{};                    //!< Number of bytes sent or received
+        base::Optional<IpAddress> remoteAddress;                    //!< Sender of a datagram received by a `UdpSocket`
+        unsigned short            remotePort{};                     //!< Port of the sender of a received datagram
+        bool                      timedOut{};                       //!< Whether the timeout of the operation expired
+        bool                      cancelled{};                      //!< Whether the operation was abandoned by `cancel`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending operation, to be awaited with `co_await`
+    ///
+    /// Returned by the asynchronous functions of the reactor.
+    /// The operation is attempted immediately when awaited, the
+    /// awaiting coroutine is only suspended if the socket is not
+    /// ready.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API [[nodiscard]] Operation
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Abandons the operation if it is pending, which happens
+        /// when the coroutine awaiting it is destroyed.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Operation();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Operation(const Operation&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Operation& operator=(const Operation&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Attempt the operation, tell whether it completed
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool await_ready();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Register the operation with the reactor
+        ///
+        ////////////////////////////////////////////////////////////
+        void await_suspend(std::coroutine_handle<> awaiting);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the outcome of the operation
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Result await_resume() const;
+
+    private:
+        friend SocketReactor;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Kind of operation
+        ///
+        ////////////////////////////////////////////////////////////
+        enum class Kind : unsigned char
+        {
+            Sleep,
+            Receive,
+            ReceivePacket,
+            Send,
+            SendPacket,
+            ReceiveDatagram,
+            SendDatagram,
+            Accept,
+            Connect,
+            TlsClient,
+            TlsServer
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief State of the operation in the reactor
+        ///
+        ////////////////////////////////////////////////////////////
+        enum class State : unsigned char
+        {
+            Idle,     //!< Not registered with the reactor
+            Waiting,  //!< Waiting for its socket or its deadline
+            Completed //!< Completed, the awaiting coroutine is about to be resumed
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Create an operation, used by `SocketReactor`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] explicit Operation(SocketReactor& reactor, Kind kind, Socket* socket, Time timeout);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor, only used to return operations that were not awaited yet
+        ///
+        ////////////////////////////////////////////////////////////
+        Operation(Operation&&) noexcept = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Try to make progress, store the result on completion
+        ///
+        /// \return `true` if the operation completed
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool attempt();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the operation waits for its socket to be writable
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isWaitingForWrite() const;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        SocketReactor*            m_reactor;            //!< Reactor that created the operation
+        Kind                      m_kind;               //!< Kind of operation
+        State                     m_state{};            //!< State of the operation in the reactor
+        bool                      m_started{};          //!< Whether the connection was initiated
+        Socket*                   m_socket;             //!< Socket of the operation, `nullptr` for timers
+        Time                      m_timeout;            //!< Maximum duration of the operation, zero for none
+        Time                      m_deadline;           //!< Time at which the operation expires, on the reactor clock
+        std::coroutine_handle<>   m_awaiting;           //!< Coroutine to resume on completion
+        Result                    m_result;             //!< Outcome of the operation
+        void*                     m_data{};             //!< Buffer to receive into
+        const void*               m_constData{};        //!< Data to send
+        base::SizeT               m_size{};             //!< Size of the buffer or of the data
+        Packet*                   m_packet{};           //!< Packet to send or to receive into
+        TcpSocket*                m_acceptedSocket{};   //!< Socket receiving the accepted connection
+        base::Optional<IpAddress> m_address;            //!< Address to connect or to send a datagram to
+        unsigned short            m_port{};             //!< Port to connect or to send a datagram to
+        const UnicodeString*      m_hostName{};         //!< Host name of the server, for TLS clients
+        bool                      m_verifyPeer{};       //!< Whether TLS clients verify the server
+        base::StringView          m_certificateChain;   //!< Certificate chain, for TLS servers
+        base::StringView          m_privateKey;         //!< Private key, for TLS servers
+        base::StringView          m_privateKeyPassword; //!< Password of the private key, for TLS servers
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a reactor without any task
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SocketReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys the tasks that did not complete.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SocketReactor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketReactor(const SocketReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SocketReactor& operator=(const SocketReactor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run a task to completion in the reactor
+    ///
+    /// The reactor takes ownership of the task, which starts
+    /// during the next call to `run` or `runOnce`.
+    ///
+    /// \param task Task to run
+    ///
+    ////////////////////////////////////////////////////////////
+    void spawn(Task<void>&& task);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the tasks until they all complete, or until `stop` is called
+    ///
+    ////////////////////////////////////////////////////////////
+    void run();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run the tasks that can make progress, waiting at most `maxWait` for one to be ready
+    ///
+    /// Meant to be called once per frame by applications that
+    /// have their own main loop.
+    ///
+    /// \param maxWait Maximum time to wait for a socket or a timer, zero to only run what is ready
+    ///
+    /// \return `true` if some tasks did not complete yet
+    ///
+    ////////////////////////////////////////////////////////////
+    bool runOnce(Time maxWait = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make `run` return as soon as possible
+    ///
+    /// Must be called from the thread running the reactor,
+    /// typically by one of its tasks. Tasks are not destroyed,
+    /// `run` can be called again to resume them.
+    ///
+    ////////////////////////////////////////////////////////////
+    void stop();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Abandon all the pending operations of a socket
+    ///
+    /// The coroutines awaiting them are resumed with
+    /// `Result::cancelled` set. Use before closing a socket that
+    /// other tasks are waiting for.
+    ///
+    /// \param socket Socket whose operations are cancelled
+    ///
+    /// \return Number of cancelled operations
+    ///
+    ////////////////////////////////////////////////////////////
+    base::SizeT cancel(const Socket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of spawned tasks that did not complete yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getTaskCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Suspend the awaiting coroutine for `duration`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation sleep(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive raw data, as soon as some is available
+    ///
+    /// \param socket  Non-blocking socket to receive from
+    /// \param data    Buffer to fill
+    /// \param size    Maximum number of bytes to receive
+    /// \param timeout Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await, `Result::transferred` is the number of bytes received
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation receive(TcpSocket& socket, void* data, base::SizeT size, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a whole packet
+    ///
+    /// \param socket  Non-blocking socket to receive from
+    /// \param packet  Packet to fill
+    /// \param timeout Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation receive(TcpSocket& socket, Packet& packet, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send all of the raw data
+    ///
+    /// \param socket  Non-blocking socket to send with
+    /// \param data    Data to send
+    /// \param size    Number of bytes to send
+    /// \param timeout Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await, `Result::transferred` is the number of bytes sent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation send(TcpSocket& socket, const void* data, base::SizeT size, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a whole packet
+    ///
+    /// \param socket  Non-blocking socket to send with
+    /// \param packet  Packet to send, must not be modified until the operation completes
+    /// \param timeout Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation send(TcpSocket& socket, Packet& packet, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive a datagram
+    ///
+    /// \param socket  Non-blocking socket to receive from
+    /// \param data    Buffer to fill
+    /// \param size    Size of the buffer
+    /// \param timeout Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await, the sender is stored in the result
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation receive(UdpSocket& socket, void* data, base::SizeT size, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a datagram
+    ///
+    /// \param socket        Non-blocking socket to send with
+    /// \param data          Data to send
+    /// \param size          Number of bytes to send
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver
+    /// \param timeout       Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation send(UdpSocket&     socket,
+                                 const void*    data,
+                                 base::SizeT    size,
+                                 IpAddress      remoteAddress,
+                                 unsigned short remotePort,
+                                 Time           timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept a new connection
+    ///
+    /// \param listener Non-blocking listener
+    /// \param socket   Socket that will hold the new connection, its blocking mode is kept
+    /// \param timeout  Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation accept(TcpListener& listener, TcpSocket& socket, Time timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect to a remote peer
+    ///
+    /// \param socket        Non-blocking socket to connect
+    /// \param remoteAddress Address of the peer
+    /// \param remotePort    Port of the peer
+    /// \param timeout       Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation connect(TcpSocket&     socket,
+                                    IpAddress      remoteAddress,
+                                    unsigned short remotePort,
+                                    Time           timeout = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Perform the TLS handshake as a client
+    ///
+    /// See `TcpSocket::setupTlsClient`. The status of the result
+    /// is `Done` if the handshake completed, `Disconnected` if
+    /// the socket is not connected and `Error` otherwise.
+    ///
+    /// \param socket     Non-blocking connected socket
+    /// \param hostName   Host name of the server, must outlive the operation
+    /// \param verifyPeer Whether the certificate of the server is verified
+    /// \param timeout    Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation setupTlsClient(TcpSocket&           socket,
+                                           const UnicodeString& hostName,
+                                           bool                 verifyPeer = true,
+                                           Time                 timeout    = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Perform the TLS handshake as a server
+    ///
+    /// See `TcpSocket::setupTlsServer`, and `setupTlsClient` for
+    /// the status of the result. The views must outlive the
+    /// operation.
+    ///
+    /// \param socket                 Non-blocking connected socket
+    /// \param certificateChainData   Certificate chain, in PEM or DER format
+    /// \param privateKeyData         Private key, in PEM or DER format
+    /// \param privateKeyPasswordData Password of the private key, empty if there is none
+    /// \param timeout                Maximum time to wait, zero for no limit
+    ///
+    /// \return Operation to await
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Operation setupTlsServer(TcpSocket&       socket,
+                                           base::StringView certificateChainData,
+                                           base::StringView privateKeyData,
+                                           base::StringView privateKeyPasswordData = "",
+                                           Time             timeout                = {});
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Called by a detached task when it completes
+    ///
+    ////////////////////////////////////////////////////////////
+    static void onTaskCompletion(void* reactor, std::coroutine_handle<> handle);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SocketReactor
+/// \ingroup network
+///
+/// Servers handling many connections usually put all their
+/// sockets in non-blocking mode and poll them in a loop, which
+/// turns the logic of every connection into a state machine
+/// and wastes CPU time on sockets that are `NotReady`.
+///
+/// `sf::SocketReactor` lets the logic of each connection be
+/// written as straight-line code in a C++20 coroutine
+/// returning `sf::Task`. Every `co_await` on an operation of
+/// the reactor first attempts the operation, and only if the
+/// socket is not ready, suspends the coroutine until the system
+/// reports that it is. Meanwhile, the reactor runs the other
+/// tasks. Timeouts, timers (`sleep`) and `cancel` resume
+/// coroutines without the operation completing, which is
+/// reported in the `Result`.
+///
+/// All the sockets used with a reactor must be in non-blocking
+/// mode. TLS sockets are supported: the handshake, and the
+/// reads and writes that the protocol performs behind the
+/// scenes, are awaited like the other operations.
+///
+/// A reactor, its sockets and its tasks must all be used from
+/// a single thread. To use several cores, run one reactor per
+/// thread, for instance each with its own `sf::TcpListener`
+/// sharing the same port with `TcpListenerSettings::reusePort`.
+///
+/// Usage example:
+/// \code
+/// sf::Task<> echo(sf::SocketReactor& reactor, sf::TcpSocket socket)
+/// {
+///     char buffer[1024];
+///
+///     while (true)
+///     {
+///         const auto received = co_await reactor.receive(socket, buffer, sizeof(buffer), sf::seconds(30.f));
+///         if (received.status != sf::Socket::Status::Done)
+///             co_return; // Disconnected, error or idle for too long
+///
+///         const auto sent = co_await reactor.send(socket, buffer, received.transferred);
+///         if (sent.status != sf::Socket::Status::Done)
+///             co_return;
+///     }
+/// }
+///
+/// sf::Task<> serve(sf::SocketReactor& reactor, sf::TcpListener& listener)
+/// {
+///     while (true)
+///     {
+///         sf::TcpSocket socket(/* isBlocking */ false);
+///         if ((co_await reactor.accept(listener, socket)).status == sf::Socket::Status::Done)
+///             reactor.spawn(echo(reactor, SFML_BASE_MOVE(socket)));
+///     }
+/// }
+///
+/// sf::SocketReactor reactor;
+/// sf::TcpListener listener(/* isBlocking */ false);
+/// (void)listener.listen(55001);
+///
+/// reactor.spawn(serve(reactor, listener));
+/// reactor.run();
+/// \endcode
+///
+/// \see sf::Task, sf::TcpSocket, sf::UdpSocket, sf::TcpListener
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,289 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Abort.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/Trait/IsSame.hpp"
+
+#include <coroutine>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class SocketReactor;
+
+template <typename T>
+class Task;
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Part of the promise of a `Task` that doesn't depend on its result type
+///
+////////////////////////////////////////////////////////////
+struct TaskPromiseBase
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Resume the awaiting coroutine, or notify the owner of a detached task
+    ///
+    ////////////////////////////////////////////////////////////
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename TPromise>
+        [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) const noexcept
+        {
+            TaskPromiseBase& promise = handle.promise();
+
+            if (promise.continuation)
+                return promise.continuation;
+
+            // Detached tasks are destroyed by their owner, the frame is no longer used after this call
+            if (promise.onDetachedCompletion != nullptr)
+                promise.onDetachedCompletion(promise.owner, handle);
+
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+    };
+
+    [[nodiscard]] std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    [[noreturn]] void unhandled_exception() const noexcept
+    {
+        base::abort();
+    }
+
+    using CompletionCallback = void (*)(void* owner, std::coroutine_handle<> handle);
+
+    std::coroutine_handle<> continuation;           //!< Coroutine awaiting the task, resumed when it completes
+    void*                   owner{};                //!< Owner of a detached task, passed to `onDetachedCompletion`
+    CompletionCallback      onDetachedCompletion{}; //!< Called when a detached task completes
+};
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+    [[nodiscard]] Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value)
+    {
+        result.emplace(SFML_BASE_FORWARD(value));
+    }
+
+    base::Optional<T> result; //!< Value passed to `co_return`
+};
+
+
+////////////////////////////////////////////////////////////
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+    [[nodiscard]] Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept
+    {
+    }
+};
+
+} // namespace sf::priv
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Lazily started coroutine producing a value of type `T`
+///
+////////////////////////////////////////////////////////////
+template <typename T = void>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = priv::TaskPromise<T>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys the coroutine if it was not started, or if it is
+    /// suspended. A task must not be destroyed while it runs.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Task()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Task(const Task&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Task& operator=(const Task&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Task(Task&& rhs) noexcept : m_handle(rhs.m_handle)
+    {
+        rhs.m_handle = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Task& operator=(Task&& rhs) noexcept
+    {
+        if (this == &rhs)
+            return *this;
+
+        if (m_handle)
+            m_handle.destroy();
+
+        m_handle     = rhs.m_handle;
+        rhs.m_handle = nullptr;
+
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the task and suspend the awaiting coroutine until it completes
+    ///
+    /// \return Value passed to `co_return` by the task
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] auto operator co_await() && noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+            {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() const
+            {
+                if constexpr (!SFML_BASE_IS_SAME(T, void))
+                    return SFML_BASE_MOVE(*handle.promise().result);
+            }
+        };
+
+        SFML_BASE_ASSERT(m_handle && "Awaited an empty or moved-from task");
+        return Awaiter{m_handle};
+    }
+
+private:
+    friend SocketReactor;
+    friend promise_type;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take ownership of a coroutine, used by the promise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::coroutine_handle<promise_type> m_handle; //!< Coroutine, null if moved from
+};
+
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+
+////////////////////////////////////////////////////////////
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+} // namespace sf::priv
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Task
+/// \ingroup network
+///
+/// `sf::Task` is the return type of coroutines run by
+/// `sf::SocketReactor`. A task doesn't start when it is
+/// called: it starts when another task awaits it with
+/// `co_await`, or when it is passed to `SocketReactor::spawn`.
+///
+/// Exceptions escaping a task abort the program.
+///
+/// Usage example:
+/// \code
+/// sf::Task<sf::base::SizeT> readHeader(sf::SocketReactor& reactor, sf::TcpSocket& socket, char* buffer)
+/// {
+///     const auto result = co_await reactor.receive(socket, buffer, 16);
+///     co_return result.transferred;
+/// }
+///
+/// sf::Task<> handleClient(sf::SocketReactor& reactor, sf::TcpSocket socket)
+/// {
+///     char buffer[16];
+///     const sf::base::SizeT size = co_await readHeader(reactor, socket, buffer);
+///     ...
+/// }
+/// \endcode
+///
+/// \see sf::SocketReactor
+///
+////////////////////////////////////////////////////////////
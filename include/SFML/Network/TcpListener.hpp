@@ -11,11 +11,28 @@
 #include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/Socket.hpp"
 
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
 
 namespace sf
 {
 class TcpSocket;
 
+////////////////////////////////////////////////////////////
+/// \brief Settings of a listening `TcpListener`
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] TcpListenerSettings
+{
+    bool        reusePort{false};      //!< Share the port with other listeners, connections are spread among them
+    int         backlog{0};            //!< Capacity of the queue of pending connections, 0 for the system maximum
+    bool        noDelay{true};         //!< Disable the Nagle algorithm on accepted sockets, see `TcpSocket::setNoDelay`
+    base::SizeT sendBufferSize{0u};    //!< Send buffer size of accepted sockets, 0 for the system default
+    base::SizeT receiveBufferSize{0u}; //!< Receive buffer size of accepted sockets, 0 for the system default
+};
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Socket that listens to new TCP connections
 ///
@@ -66,6 +83,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status listen(unsigned short port, IpAddress address = IpAddress::Any);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start listening for incoming connection attempts, with custom settings
+    ///
+    /// Same as the other overload, see `TcpListenerSettings` for
+    /// the available options. The settings of accepted sockets
+    /// apply to the sockets returned by `accept` and `acceptMany`
+    /// until the next call to `listen`.
+    ///
+    /// `settings.reusePort` lets several listeners, typically one
+    /// per thread, listen on the same port: the system spreads the
+    /// incoming connections among them (`SO_REUSEPORT`). All of
+    /// them must enable the option. It is not supported on Windows,
+    /// where listening fails.
+    ///
+    /// \param port     Port to listen on for incoming connection attempts
+    /// \param address  Address of the interface to listen on
+    /// \param settings Listening options, and options of the accepted sockets
+    ///
+    /// \return Status code
+    ///
+    /// \see `accept`, `acceptMany`, `close`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status listen(unsigned short port, IpAddress address, const TcpListenerSettings& settings);
+
     ////////////////////////////////////////////////////////////
     /// \brief Stop listening and close the socket
     ///
@@ -91,6 +133,39 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status accept(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Accept all the pending connections, up to `maxCount`
+    ///
+    /// Drains the queue of pending connections in a single call,
+    /// which keeps up with bursts of connection attempts better
+    /// than one `accept` per selector wake-up. The new sockets are
+    /// appended to `sockets`.
+    ///
+    /// If the listener is in blocking mode, this function waits
+    /// for the first connection only, the following ones are only
+    /// accepted if they are already pending.
+    ///
+    /// \param sockets                 Vector to append the accepted sockets to
+    /// \param maxCount                Maximum number of connections to accept
+    /// \param acceptedSocketsBlocking Blocking mode of the accepted sockets
+    ///
+    /// \return `Status::Done` if at least one connection was accepted,
+    ///         otherwise the status of the first failed attempt
+    ///         (`Status::NotReady` if no connection is pending)
+    ///
+    /// \see `accept`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status acceptMany(base::Vector<TcpSocket>& sockets,
+                                    base::SizeT              maxCount,
+                                    bool                     acceptedSocketsBlocking);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    TcpListenerSettings m_settings; //!< Settings passed to the last call to `listen`
 };
 
 
@@ -140,6 +215,25 @@ public:
 /// }
 /// \endcode
 ///
+/// A server facing many connection attempts at once, e.g.
+/// after a restart, can accept them in batches with
+/// `acceptMany`, and spread them over several threads that
+/// each own a listener created with `TcpListenerSettings::reusePort`:
+/// \code
+/// // On each worker thread
+/// sf::TcpListener listener(/* isBlocking */ false);
+/// if (listener.listen(55001, sf::IpAddress::Any, {.reusePort = true}) != sf::Socket::Status::Done)
+///     return;
+///
+/// sf::SocketSelector selector;
+/// selector.add(listener);
+///
+/// sf::base::Vector<sf::TcpSocket> clients;
+/// while (running)
+///     if (selector.wait(sf::milliseconds(100)) && selector.isReady(listener))
+///         (void)listener.acceptMany(clients, /* maxCount */ 64, /* acceptedSocketsBlocking */ false);
+/// \endcode
+///
 /// \see `sf::TcpSocket`, `sf::Socket`
 ///
 ////////////////////////////////////////////////////////////
@@ -15,6 +15,7 @@
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/StringView.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 #include "SFML/Base/Vector.hpp"
@@ -28,6 +29,7 @@ namespace sf
 class TcpListener;
 class IpAddress;
 class Packet;
+class TlsSessionCache;
 } // namespace sf
 
 namespace sf::base
@@ -157,6 +159,36 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status connect(IpAddress remoteAddress, unsigned short remotePort, Time timeout = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect the socket to the first reachable address of a list
+    ///
+    /// Connection attempts are started in the given order, a new
+    /// one every 250 milliseconds while none of the previous ones
+    /// has completed, and the first attempt that succeeds wins
+    /// ("Happy Eyeballs", RFC 8305). This hides the delay of an
+    /// unreachable IPv6 (or IPv4) route when a host has both.
+    /// Pass the addresses returned by `IpAddressUtils::resolveAll`
+    /// or `DnsResolver::Lookup::getAddresses`, which are already
+    /// interleaved by family.
+    ///
+    /// Unlike the single address overload, this function waits
+    /// for the outcome even if the socket is in non-blocking mode.
+    /// If the socket is already connected, the connection is
+    /// forcibly disconnected before attempting to connect again.
+    ///
+    /// \param remoteAddresses Addresses of the remote peer, in order of preference
+    /// \param remotePort      Port of the remote peer
+    /// \param timeout         Maximum time to wait for all the attempts, none if zero
+    ///
+    /// \return Status code
+    ///
+    /// \see `disconnect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status connect(base::Span<const IpAddress> remoteAddresses,
+                                 unsigned short              remotePort,
+                                 Time                        timeout = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Disconnect the socket from its remote peer
     ///
@@ -168,6 +200,39 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool disconnect();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the Nagle algorithm
+    ///
+    /// The Nagle algorithm buffers small writes to send them in
+    /// fewer segments, at the cost of latency. It is disabled by
+    /// default (`TCP_NODELAY`). The option applies to the current
+    /// connection: the socket must be connected, and the default
+    /// is restored by the next `connect`.
+    ///
+    /// \param noDelay `true` to send data immediately, `false` to let the system buffer it
+    ///
+    /// \return `true` on success, `false` if the socket is not connected or the option could not be set
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setNoDelay(bool noDelay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the kernel buffers of the connection
+    ///
+    /// Larger buffers sustain more throughput on links with a
+    /// high bandwidth-delay product, smaller ones limit the
+    /// memory used by many idle connections. The system may
+    /// round or clamp the sizes. Like `setNoDelay`, this
+    /// applies to the current connection.
+    ///
+    /// \param sendBufferSize    Size of the send buffer in bytes (`SO_SNDBUF`), 0 to keep the current size
+    /// \param receiveBufferSize Size of the receive buffer in bytes (`SO_RCVBUF`), 0 to keep the current size
+    ///
+    /// \return `true` on success, `false` if the socket is not connected or a size could not be set
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setBufferSizes(base::SizeT sendBufferSize, base::SizeT receiveBufferSize);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set up transport layer security as a client
     ///
@@ -494,6 +559,45 @@ public:
                                            base::StringView privateKeyData,
                                            base::StringView privateKeyPasswordData = "");
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Share TLS sessions with other sockets to resume them
+    ///
+    /// Must be called before `setupTlsClient` or `setupTlsServer`.
+    /// As a client, the last session established with the same
+    /// host and port is resumed if possible. As a server, the
+    /// cache issues session tickets and keeps session IDs.
+    ///
+    /// \param sessionCache Cache to use, must outlive the TLS session, or `nullptr` to stop using one
+    ///
+    /// \see `isTlsSessionResumed`, `sf::TlsSessionCache`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTlsSessionCache(TlsSessionCache* sessionCache);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the TLS handshake resumed a previous session
+    ///
+    /// \return `true` if the handshake is complete and skipped certificate authentication
+    ///
+    /// \see `setTlsSessionCache`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isTlsSessionResumed() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time spent performing the TLS handshake
+    ///
+    /// Measured from the first call to `setupTlsClient` or
+    /// `setupTlsServer`, after the certificates are loaded, to
+    /// the completion of the handshake. Includes the time spent
+    /// waiting for the peer, e.g. between calls to a non-blocking
+    /// socket.
+    ///
+    /// \return Handshake duration, zero if the handshake is not complete
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTlsHandshakeDuration() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the name of the TLS ciphersuite currently in use
     ///
@@ -592,6 +696,20 @@ public:
 
 private:
     friend class TcpListener;
+    friend class SocketReactor;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the last operation that could not proceed waits for the socket to be writable
+    ///
+    /// Without TLS, only sending waits for the socket to be
+    /// writable. With TLS, the protocol may need to write to
+    /// progress a handshake or a receive, and to read to
+    /// progress a send.
+    ///
+    /// \param sending Whether the operation is a send
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isWaitingForWrite(bool sending) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure holding the data of a pending packet
@@ -0,0 +1,212 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class TcpSocket;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Settings of a `TlsSessionCache`
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] TlsSessionCacheSettings
+{
+    base::SizeT maxSessions{256u};                  //!< Sessions kept for resumption, on each side
+    Time        sessionLifetime{seconds(86'400.f)}; //!< How long a session can be resumed, also the lifetime of tickets
+    bool        enableSessionTickets{true};         //!< Server: issue session tickets, resumed without server state
+    bool        enableSessionIds{true};             //!< Server: keep sessions for session ID resumption (TLS 1.2)
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Sessions shared by TLS connections so that they can
+///        skip the full handshake when reconnecting
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API TlsSessionCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Handshake metrics of the sockets using the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Statistics
+    {
+        base::U64 fullHandshakes{};       //!< Number of handshakes that authenticated the server with its certificate
+        base::U64 resumedHandshakes{};    //!< Number of handshakes that resumed a previous session
+        Time      fullHandshakeTime{};    //!< Total duration of the full handshakes
+        Time      resumedHandshakeTime{}; //!< Total duration of the resumed handshakes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty cache
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TlsSessionCache(const TlsSessionCacheSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// No socket must be using the cache anymore.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TlsSessionCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache(const TlsSessionCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache& operator=(const TlsSessionCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all client sessions
+    ///
+    /// The next connection to every host performs a full
+    /// handshake. Server sessions, and tickets issued to clients,
+    /// stay valid until they expire.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sessions kept for client connections
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getClientSessionCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a serialized client session
+    ///
+    /// Sockets using the cache store their sessions automatically.
+    /// Together with `takeClientSession`, this function lets an
+    /// application keep sessions across runs. The session replaces
+    /// the previous one stored for the same host and port. When the
+    /// cache is full, the oldest session is evicted.
+    ///
+    /// \param hostName    Host name passed to `TcpSocket::setupTlsClient`, as UTF-8
+    /// \param port        Remote port of the connection
+    /// \param sessionData Session serialized by the TLS library
+    ///
+    ////////////////////////////////////////////////////////////
+    void storeClientSession(base::StringView                hostName,
+                            unsigned short                  port,
+                            base::Span<const unsigned char> sessionData);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove and return the client session stored for a host and port
+    ///
+    /// A session is only offered once, so it is removed from the
+    /// cache even if it expired.
+    ///
+    /// \param hostName Host name passed to `TcpSocket::setupTlsClient`, as UTF-8
+    /// \param port     Remote port of the connection
+    ///
+    /// \return Serialized session, or an empty vector if there is no unexpired one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Vector<unsigned char> takeClientSession(base::StringView hostName, unsigned short port);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the handshake metrics collected so far
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the handshake metrics
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+    friend TcpSocket;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TlsSessionCache
+/// \ingroup network
+///
+/// A full TLS handshake costs two round trips and the expensive
+/// public key operations of certificate verification and key
+/// exchange. When a client reconnects to a server it talked to
+/// recently, both sides can instead resume the previous session:
+/// a single round trip, and no certificate.
+///
+/// `sf::TlsSessionCache` stores what resumption needs. A client
+/// remembers the last session of every host and port it
+/// connected to. A server issues session tickets (the session
+/// state is encrypted with a key only known to the server and
+/// kept by the client) and, for TLS 1.2 clients without ticket
+/// support, keeps sessions indexed by their ID.
+///
+/// A cache is attached to sockets with `TcpSocket::setTlsSessionCache`
+/// before setting up TLS. All the sockets of a client, or all the
+/// sockets accepted by a server, should share the same cache. It
+/// can be used by several threads at once.
+///
+/// With TLS 1.3, tickets are sent by the server after the
+/// handshake. `TcpSocket::receive` returns `sf::Socket::Status::Partial`
+/// when it processes one, the call must then be repeated.
+///
+/// Usage example:
+/// \code
+/// sf::TlsSessionCache sessionCache;
+///
+/// for (const auto& request : requests)
+/// {
+///     sf::TcpSocket socket(/* isBlocking */ true);
+///     socket.setTlsSessionCache(&sessionCache);
+///
+///     if (socket.connect(address, 443) == sf::Socket::Status::Done &&
+///         socket.setupTlsClient("example.com") == sf::TcpSocket::TlsStatus::HandshakeComplete)
+///     {
+///         // Only the first handshake is a full one
+///         sf::cOut() << socket.isTlsSessionResumed() << ' '
+///                    << socket.getTlsHandshakeDuration().asMilliseconds() << "ms\n";
+///         ...
+///     }
+/// }
+/// \endcode
+///
+/// \see sf::TcpSocket
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,290 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Socket.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Packet;
+class UdpSocket;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Settings of a `UdpConnection`
+///
+/// Both peers must use the same `protocolId` and `maxDatagramSize`.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] UdpConnectionSettings
+{
+    base::U32   protocolId{0x53'46'4D'4Cu};         //!< Identifies datagrams of this protocol, others are ignored
+    base::SizeT maxDatagramSize{1200u};             //!< Largest datagram sent or received, must match on both peers
+    Time        timeout{seconds(10.f)};             //!< Disconnect if nothing is received for this long
+    Time        keepAliveInterval{seconds(0.1f)};   //!< Send an empty datagram if nothing was sent for this long
+    float       initialSendRate{256.f * 1024.f};    //!< Initial paced send rate, in bytes per second
+    float       minSendRate{16.f * 1024.f};         //!< Lower bound of the paced send rate, in bytes per second
+    float       maxSendRate{8.f * 1024.f * 1024.f}; //!< Upper bound of the paced send rate, in bytes per second
+
+    float     simulatedPacketLoss{0.f}; //!< Probability in [0, 1] of dropping an outgoing datagram, for testing
+    Time      simulatedLatency{};       //!< Delay added to every outgoing datagram, for testing
+    Time      simulatedJitter{};        //!< Maximum random delay added on top of `simulatedLatency`, for testing
+    base::U32 simulationSeed{1u};       //!< Seed of the random generator driving the simulated conditions
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Connection to a single peer over UDP, with
+///        unreliable, reliable and ordered channels
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API UdpConnection
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Delivery guarantees of a message
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Channel : base::U8
+    {
+        Unreliable      = 0u, //!< Sent once, may be lost or arrive out of order
+        Reliable        = 1u, //!< Resent until acknowledged, delivered once in any order
+        ReliableOrdered = 2u, //!< Resent until acknowledged, delivered once in the order it was sent
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Connection statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Statistics
+    {
+        Time      roundTripTime;         //!< Smoothed round-trip time
+        Time      retransmissionTimeout; //!< Time after which an unacknowledged fragment is resent
+        float     sendRate;              //!< Current paced send rate, in bytes per second
+        base::U64 datagramsSent;         //!< Number of datagrams sent, including simulated drops
+        base::U64 datagramsReceived;     //!< Number of valid datagrams received from the peer
+        base::U64 fragmentsResent;       //!< Number of reliable fragments sent more than once
+        base::U64 datagramsDropped;      //!< Number of datagrams dropped by `simulatedPacketLoss`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a connection to a peer
+    ///
+    /// The connection does not own `socket`, which must already
+    /// be bound and must outlive the connection. The socket is
+    /// switched to non-blocking mode, and datagrams it receives
+    /// from other peers are discarded by `update`.
+    ///
+    /// \param socket        Bound socket used to exchange datagrams
+    /// \param remoteAddress Address of the peer
+    /// \param remotePort    Port of the peer
+    /// \param settings      Connection settings
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit UdpConnection(UdpSocket&                   socket,
+                                         IpAddress                    remoteAddress,
+                                         unsigned short               remotePort,
+                                         const UdpConnectionSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UdpConnection();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(const UdpConnection&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UdpConnection& operator=(UdpConnection&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a message for sending
+    ///
+    /// The message is copied, and actually sent by the next
+    /// calls to `update`. Messages larger than a datagram are
+    /// split into fragments and reassembled by the peer.
+    ///
+    /// This function fails if the message needs more than 255
+    /// fragments, or if 1024 reliable messages of the same
+    /// channel are already waiting for an acknowledgement.
+    ///
+    /// \param channel Delivery guarantees of the message
+    /// \param data    Pointer to the bytes to send
+    /// \param size    Number of bytes to send
+    ///
+    /// \return `true` if the message was queued, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(Channel channel, const void* data, base::SizeT size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the contents of a packet for sending
+    ///
+    /// \see `send(Channel, const void*, base::SizeT)`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool send(Channel channel, const Packet& packet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop the next message received from the peer
+    ///
+    /// \param packet  Packet to fill with the message, cleared first
+    /// \param channel Filled with the channel the message was sent on
+    ///
+    /// \return `true` if a message was received, `false` if none is pending
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool receive(Packet& packet, Channel& channel);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Exchange datagrams with the peer
+    ///
+    /// Receives all pending datagrams, processes acknowledgements,
+    /// then sends queued messages, resends timed out reliable
+    /// fragments and acknowledges received ones, at the current
+    /// paced send rate. Must be called regularly, typically once
+    /// per frame.
+    ///
+    /// \param deltaTime Time elapsed since the previous call
+    ///
+    /// \return `Status::Done` on success, `Status::Disconnected` if
+    ///         the peer timed out, `Status::Error` on socket errors
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status update(Time deltaTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the peer has not timed out yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isConnected() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of reliable messages not yet acknowledged by the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getPendingReliableMessageCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the statistics of the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address of the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IpAddress getRemoteAddress() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the port of the peer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned short getRemotePort() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UdpConnection
+/// \ingroup network
+///
+/// `sf::UdpConnection` adds a lightweight protocol on top of
+/// `sf::UdpSocket`, suited to real-time applications where a
+/// lost datagram must not stall everything sent after it, as
+/// it does with `sf::TcpSocket`.
+///
+/// Every datagram carries a sequence number and acknowledges
+/// the last 33 datagrams received from the peer. Reliable
+/// messages are split into fragments that fit in a datagram;
+/// only the fragments that were not acknowledged within the
+/// retransmission timeout are resent. The timeout is derived
+/// from a smoothed round-trip time estimate.
+///
+/// Outgoing datagrams are paced by a token bucket. The send
+/// rate grows with every acknowledged byte and is halved, at
+/// most once per round-trip, when a fragment has to be resent.
+///
+/// Three channels are available:
+/// \li `Channel::Unreliable`: fire and forget, for state that is
+///     superseded by the next update (e.g. positions)
+/// \li `Channel::Reliable`: delivered exactly once, as soon as
+///     it arrives (e.g. independent events)
+/// \li `Channel::ReliableOrdered`: delivered exactly once, in
+///     order (e.g. chat messages, commands)
+///
+/// Packet loss, latency and jitter can be simulated on the
+/// outgoing side to test the application on loopback.
+///
+/// Usage example:
+/// \code
+/// sf::UdpSocket socket(/* isBlocking */ false);
+/// if (socket.bind(54000) != sf::Socket::Status::Done)
+///     return;
+///
+/// sf::UdpConnection connection(socket, serverAddress, 55000);
+///
+/// sf::Packet packet;
+/// packet << "hello";
+/// (void)connection.send(sf::UdpConnection::Channel::ReliableOrdered, packet);
+///
+/// sf::Clock clock;
+/// while (connection.update(clock.restart()) == sf::Socket::Status::Done)
+/// {
+///     sf::UdpConnection::Channel channel{};
+///     while (connection.receive(packet, channel))
+///         ...;
+/// }
+/// \endcode
+///
+/// \see sf::UdpConnectionSettings, sf::UdpSocket, sf::Packet
+///
+////////////////////////////////////////////////////////////
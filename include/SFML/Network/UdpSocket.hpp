@@ -9,17 +9,28 @@
 #include "SFML/Network/Export.hpp"
 
 #include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/PacketView.hpp"
 #include "SFML/Network/Socket.hpp"
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/Vector.hpp"
 
 
 namespace sf
 {
 class Packet;
+} // namespace sf
+
+namespace sf::priv
+{
+struct BatchDatagram;
+} // namespace sf::priv
+
 
+namespace sf
+{
 ////////////////////////////////////////////////////////////
 /// \brief Specialized socket using the UDP protocol
 ///
@@ -35,6 +46,122 @@ public:
         MaxDatagramSize = 65'507ul //!< The maximum number of bytes that can be sent in a single UDP datagram
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram received by a batched `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] ReceivedDatagram
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Get a packet view over the received bytes, without copying them
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] PacketView toPacketView() const
+        {
+            return PacketView{data, size};
+        }
+
+        const void*    data;          //!< Received bytes, stored in the `DatagramBatch`
+        base::SizeT    size;          //!< Number of received bytes
+        IpAddress      remoteAddress; //!< Address of the peer that sent the datagram
+        unsigned short remotePort;    //!< Port of the peer that sent the datagram
+        bool           truncated;     //!< Whether the datagram did not fit in the batch and was clipped to `size` bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram to send with a batched `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] OutgoingDatagram
+    {
+        const void*    data;          //!< Bytes to send, must not be larger than `MaxDatagramSize`
+        base::SizeT    size;          //!< Number of bytes to send
+        IpAddress      remoteAddress; //!< Address of the receiver
+        unsigned short remotePort;    //!< Port of the receiver
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Preallocated pool of datagrams for batched receives
+    ///
+    /// The memory for all datagrams is allocated once, on
+    /// construction. Each batched `receive` overwrites the
+    /// datagrams of the previous one.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API DatagramBatch
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the pool
+        ///
+        /// Received datagrams larger than `maxDatagramSize` are
+        /// truncated and flagged as such, so it should match the
+        /// largest datagram the application expects.
+        ///
+        /// \param capacity        Maximum number of datagrams received at once
+        /// \param maxDatagramSize Maximum size of each datagram, in bytes
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] explicit DatagramBatch(base::SizeT capacity, base::SizeT maxDatagramSize = MaxDatagramSize);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        ////////////////////////////////////////////////////////////
+        ~DatagramBatch();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        DatagramBatch(const DatagramBatch&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        DatagramBatch& operator=(const DatagramBatch&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] DatagramBatch(DatagramBatch&&) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        DatagramBatch& operator=(DatagramBatch&&) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the maximum number of datagrams received at once
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::SizeT getCapacity() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the datagrams received by the last batched `receive`
+        ///
+        /// The datagrams refer to memory owned by the batch, and
+        /// are invalidated by the next `receive` into the batch.
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::Span<const ReceivedDatagram> getDatagrams() const;
+
+    private:
+        friend UdpSocket;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        base::Vector<char>                m_pool;            //!< Storage for all datagrams, `m_maxDatagramSize` bytes each
+        base::Vector<ReceivedDatagram>    m_datagrams;       //!< Datagrams received by the last `receive`
+        base::Vector<priv::BatchDatagram> m_entries;         //!< System call arguments, one per slot of the pool
+        base::SizeT                       m_capacity;        //!< Maximum number of datagrams received at once
+        base::SizeT                       m_maxDatagramSize; //!< Maximum size of each datagram, in bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -174,6 +301,41 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, base::Optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive multiple datagrams at once
+    ///
+    /// Receives up to `batch.getCapacity()` datagrams directly into
+    /// the memory of `batch`, with as few system calls as possible
+    /// (a single `recvmmsg` call on Linux). Nothing is copied.
+    ///
+    /// In blocking mode, this function only waits until the first
+    /// datagram is available, then returns it along with all the
+    /// other datagrams that are already pending.
+    ///
+    /// \param batch Datagram pool to receive into
+    ///
+    /// \return Status code
+    ///
+    /// \see `DatagramBatch::getDatagrams`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(DatagramBatch& batch);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send multiple datagrams at once
+    ///
+    /// Sends the datagrams with as few system calls as possible
+    /// (a single `sendmmsg` call on Linux).
+    ///
+    /// \param datagrams Datagrams to send
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return `Status::Done` if all datagrams were sent, `Status::Partial`
+    ///         if only some of them were sent, or the error status
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(base::Span<const OutgoingDatagram> datagrams, base::SizeT& sent);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -268,6 +430,18 @@ private:
 /// socket.send(message.c_str(), message.size() + 1, sender, port);
 /// \endcode
 ///
+/// Servers handling many clients can reduce the per-datagram
+/// overhead with the batched functions, which receive or send
+/// many datagrams per system call. Received datagrams are not
+/// copied: they are read in place with `sf::PacketView`.
+/// \code
+/// sf::UdpSocket::DatagramBatch batch(/* capacity */ 256, /* maxDatagramSize */ 1200);
+///
+/// if (socket.receive(batch) == sf::Socket::Status::Done)
+///     for (const sf::UdpSocket::ReceivedDatagram& datagram : batch.getDatagrams())
+///         handleMessage(datagram.remoteAddress, datagram.remotePort, datagram.toPacketView());
+/// \endcode
+///
 /// \see `sf::Socket`, `sf::TcpSocket`, `sf::Packet`
 ///
 ////////////////////////////////////////////////////////////
@@ -12,6 +12,7 @@
 #include "SFML/System/Utf.hpp"
 
 #include "SFML/Base/BackInserter.hpp"
+#include "SFML/Base/Trait/IsConvertible.hpp"
 
 
 namespace sf
@@ -30,6 +31,9 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create a new sf::UnicodeString from a UTF-8 encoded string
     ///
+    /// Contiguous byte ranges given as pointers are
+    /// transcoded with the vectorized `sf::UtfBulk::utf8ToUtf32`.
+    ///
     /// \param begin Forward iterator to the beginning of the UTF-8 sequence
     /// \param end   Forward iterator to the end of the UTF-8 sequence
     ///
@@ -41,9 +45,20 @@ public:
     template <typename T>
     [[nodiscard]] static UnicodeString fromUtf8(T begin, T end)
     {
-        UnicodeString string;
-        Utf8::toUtf32(begin, end, base::BackInserter(string));
-        return string;
+        if constexpr (SFML_BASE_IS_CONVERTIBLE(T, const char*))
+        {
+            return fromContiguousUtf8(begin, end);
+        }
+        else if constexpr (SFML_BASE_IS_CONVERTIBLE(T, const char8_t*) || SFML_BASE_IS_CONVERTIBLE(T, const unsigned char*))
+        {
+            return fromContiguousUtf8(reinterpret_cast<const char*>(begin), reinterpret_cast<const char*>(end));
+        }
+        else
+        {
+            UnicodeString string;
+            Utf8::toUtf32(begin, end, base::BackInserter(string));
+            return string;
+        }
     }
 
     ////////////////////////////////////////////////////////////
@@ -87,6 +102,13 @@ public:
         string.assign(begin, end);
         return string;
     }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Vectorized implementation of `fromUtf8` for contiguous input
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static UnicodeString fromContiguousUtf8(const char* begin, const char* end);
 };
 
 } // namespace sf
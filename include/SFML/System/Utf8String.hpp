@@ -0,0 +1,410 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Export.hpp"
+
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/String.hpp"
+#include "SFML/Base/StringView.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class UnicodeString;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Compact string storing UTF-8 and iterating code points
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_SYSTEM_API Utf8String
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward iterator decoding one code point at a time
+    ///
+    ////////////////////////////////////////////////////////////
+    class [[nodiscard]] ConstIterator
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        using value_type = char32_t; //!< Decoded code point type
+
+        ////////////////////////////////////////////////////////////
+        [[nodiscard, gnu::always_inline]] explicit ConstIterator(const char* const ptr, const char* const end) noexcept :
+            m_ptr{ptr},
+            m_end{end}
+        {
+            decodeCurrent();
+        }
+
+        ////////////////////////////////////////////////////////////
+        [[nodiscard, gnu::always_inline, gnu::pure]] char32_t operator*() const noexcept
+        {
+            return m_codepoint;
+        }
+
+        ////////////////////////////////////////////////////////////
+        [[gnu::always_inline]] ConstIterator& operator++() noexcept
+        {
+            m_ptr = m_next;
+            decodeCurrent();
+
+            return *this;
+        }
+
+        ////////////////////////////////////////////////////////////
+        [[gnu::always_inline]] ConstIterator operator++(int) noexcept
+        {
+            ConstIterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get a pointer to the first byte of the current code point
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard, gnu::always_inline, gnu::pure]] const char* getBytePointer() const noexcept
+        {
+            return m_ptr;
+        }
+
+        ////////////////////////////////////////////////////////////
+        [[nodiscard, gnu::always_inline, gnu::pure]] friend bool operator==(const ConstIterator& lhs,
+                                                                            const ConstIterator& rhs) noexcept
+        {
+            return lhs.m_ptr == rhs.m_ptr;
+        }
+
+    private:
+        ////////////////////////////////////////////////////////////
+        [[gnu::always_inline]] void decodeCurrent() noexcept
+        {
+            if (m_ptr == m_end)
+            {
+                m_next = m_end;
+                return;
+            }
+
+            if (static_cast<base::U8>(*m_ptr) < 0x80u) [[likely]]
+            {
+                m_codepoint = static_cast<char32_t>(*m_ptr);
+                m_next      = m_ptr + 1;
+                return;
+            }
+
+            m_next = Utf8::decode(m_ptr, m_end, m_codepoint, 0);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        const char* m_ptr;           //!< First byte of the current code point
+        const char* m_end;           //!< One past the last byte of the string
+        const char* m_next{nullptr}; //!< First byte of the next code point
+        char32_t    m_codepoint{0u}; //!< Decoded current code point
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Random access by code point index, optimized for sequential access
+    ///
+    /// Remembers the position of the last accessed code point, so
+    /// that forward or repeated access is amortized constant time.
+    /// A cursor is meant to be used by a single thread, and is
+    /// invalidated by any modification of its string.
+    ///
+    ////////////////////////////////////////////////////////////
+    class [[nodiscard]] SFML_SYSTEM_API Cursor
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct a cursor at the beginning of `string`
+        ///
+        /// The string must outlive the cursor.
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard, gnu::always_inline]] explicit Cursor(const Utf8String& string) noexcept : m_string{&string}
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the code point at a given index
+        ///
+        /// \param index Index of the code point, must be less than `getSize()`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] char32_t operator[](base::SizeT index);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the byte offset of the code point at a given index
+        ///
+        /// \param index Index of the code point, can be equal to `getSize()`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::SizeT getByteOffset(base::SizeT index);
+
+    private:
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        const Utf8String* m_string;    //!< String being accessed
+        base::SizeT       m_index{0u}; //!< Index of the last accessed code point
+        base::SizeT       m_byte{0u};  //!< Byte offset of the last accessed code point
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using value_type = char32_t; //!< Character type (as seen through iteration)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor, creates an empty string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Utf8String() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from a null-terminated UTF-8 string
+    ///
+    /// Explicit, as `const char*` is interpreted as ANSI by `sf::UnicodeString`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Utf8String(const char* utf8String);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from a UTF-8 string view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Utf8String(base::StringView utf8String);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from a `sf::UnicodeString`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Utf8String(const UnicodeString& unicodeString);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert to a `sf::UnicodeString` (UTF-32)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UnicodeString toUnicodeString() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of code points
+    ///
+    /// The count is computed once, when the string is modified.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] base::SizeT getSize() const noexcept
+    {
+        return m_codepointCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the UTF-8 representation, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] base::SizeT getByteSize() const noexcept
+    {
+        return m_bytes.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the string is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] bool isEmpty() const noexcept
+    {
+        return m_bytes.empty();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether every code point is encoded as a single byte
+    ///
+    /// For valid UTF-8 input, this is equivalent to the string only
+    /// containing ASCII characters. Such strings support constant-time
+    /// code point indexing.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] bool isAscii() const noexcept
+    {
+        return m_codepointCount == m_bytes.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the code point at a given index
+    ///
+    /// Constant time for ASCII strings, linear time otherwise.
+    /// Use a `Cursor` to access other strings sequentially.
+    ///
+    /// \param index Index of the code point, must be less than `getSize()`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] char32_t operator[](base::SizeT index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the byte offset of the code point at a given index
+    ///
+    /// Constant time for ASCII strings, linear time otherwise.
+    ///
+    /// \param index Index of the code point, can be equal to `getSize()`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getByteOffset(base::SizeT index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a code point, encoded as UTF-8
+    ///
+    ////////////////////////////////////////////////////////////
+    void pushBack(char32_t codepoint);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a UTF-8 string
+    ///
+    ////////////////////////////////////////////////////////////
+    Utf8String& operator+=(const Utf8String& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a UTF-8 string view
+    ///
+    ////////////////////////////////////////////////////////////
+    Utf8String& operator+=(base::StringView rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the string
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear() noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the null-terminated UTF-8 representation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const char* getData() const noexcept
+    {
+        return m_bytes.cStr();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a view over the UTF-8 representation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] base::StringView toStringView() const noexcept
+    {
+        return m_bytes.toStringView();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a code point iterator to the beginning of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] ConstIterator begin() const noexcept
+    {
+        return ConstIterator{m_bytes.data(), m_bytes.data() + m_bytes.size()};
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a code point iterator to the end of the string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] ConstIterator end() const noexcept
+    {
+        const char* const last = m_bytes.data() + m_bytes.size();
+        return ConstIterator{last, last};
+    }
+
+private:
+    friend SFML_SYSTEM_API bool operator==(const Utf8String& lhs, const Utf8String& rhs);
+    friend SFML_SYSTEM_API bool operator<(const Utf8String& lhs, const Utf8String& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count the code points of the bytes appended after `fromByte`
+    ///
+    /// A truncated trailing sequence is replaced with U+0000, so that
+    /// `m_bytes` always consists of complete sequences.
+    ///
+    ////////////////////////////////////////////////////////////
+    void onBytesAppended(base::SizeT fromByte);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::String m_bytes;              //!< UTF-8 representation (small strings are stored inline)
+    base::SizeT  m_codepointCount{0u}; //!< Cached number of code points
+};
+
+////////////////////////////////////////////////////////////
+/// \relates Utf8String
+/// \brief Overload of `operator==` to compare two UTF-8 strings
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool operator==(const Utf8String& lhs, const Utf8String& rhs);
+
+////////////////////////////////////////////////////////////
+/// \relates Utf8String
+/// \brief Overload of `operator<` to compare two UTF-8 strings
+///
+/// The order is the same as comparing the decoded code points.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API bool operator<(const Utf8String& lhs, const Utf8String& rhs);
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Utf8String
+/// \ingroup system
+///
+/// `sf::Utf8String` is a compact alternative to `sf::UnicodeString`
+/// that stores its contents as UTF-8 instead of UTF-32. ASCII text
+/// takes one byte per character, and short strings are stored
+/// inline without any heap allocation.
+///
+/// Iteration yields decoded `char32_t` code points, so code written
+/// against ranges of code points (e.g. `sf::TextUtils`) works with
+/// both string types:
+///
+/// \code
+/// const sf::Utf8String label{"Score: 100"};
+///
+/// for (const char32_t c : label)
+///     ...;
+///
+/// const auto quadCount = sf::TextUtils::precomputeTextQuadCount(label, sf::TextStyle::Regular);
+/// \endcode
+///
+/// Random access by code point index is constant time for ASCII
+/// strings. Other strings are scanned from the beginning, unless
+/// they are accessed through a `sf::Utf8String::Cursor`, which
+/// makes sequential access amortized constant time:
+///
+/// \code
+/// sf::Utf8String::Cursor cursor{label};
+///
+/// for (sf::base::SizeT i = 0u; i < label.getSize(); ++i)
+///     process(cursor[i]);
+/// \endcode
+///
+/// Like the standard containers, `sf::Utf8String` can be read
+/// concurrently from multiple threads, as long as no thread
+/// modifies it.
+///
+/// \see sf::UnicodeString, sf::Utf, sf::UtfBulk
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Export.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Vectorized transcoding of contiguous UTF buffers
+///
+/// These functions produce exactly the same output as the
+/// iterator-based `sf::Utf<N>` conversions with a replacement
+/// of `0` (i.e. invalid characters are skipped), but operate on
+/// raw contiguous buffers. Runs of ASCII characters are processed
+/// 16 bytes at a time using SSE2 (x86-64) or NEON (AArch64), with
+/// a portable word-at-a-time fallback on other targets. Non-ASCII
+/// characters are handled by the scalar decoder/encoder.
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API UtfBulk
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the length of the leading run of ASCII characters
+    ///
+    /// \param begin Pointer to the beginning of the UTF-8 sequence
+    /// \param end   Pointer to the end of the UTF-8 sequence
+    ///
+    /// \return Number of leading bytes below `0x80`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::SizeT asciiPrefixLength(const char* begin, const char* end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a UTF-8 buffer to UTF-32
+    ///
+    /// `output` must have room for at least `end - begin` elements.
+    ///
+    /// \param begin  Pointer to the beginning of the UTF-8 sequence
+    /// \param end    Pointer to the end of the UTF-8 sequence
+    /// \param output Pointer to the beginning of the output buffer
+    ///
+    /// \return Number of UTF-32 characters written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::SizeT utf8ToUtf32(const char* begin, const char* end, char32_t* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a UTF-8 buffer to UTF-16
+    ///
+    /// `output` must have room for at least `end - begin` elements.
+    ///
+    /// \param begin  Pointer to the beginning of the UTF-8 sequence
+    /// \param end    Pointer to the end of the UTF-8 sequence
+    /// \param output Pointer to the beginning of the output buffer
+    ///
+    /// \return Number of UTF-16 elements written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::SizeT utf8ToUtf16(const char* begin, const char* end, char16_t* output);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes needed to encode a UTF-32 buffer as UTF-8
+    ///
+    /// Invalid characters (which are skipped by `utf32ToUtf8`) are not counted.
+    ///
+    /// \param begin Pointer to the beginning of the UTF-32 sequence
+    /// \param end   Pointer to the end of the UTF-32 sequence
+    ///
+    /// \return Exact size of the UTF-8 output of `utf32ToUtf8`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::SizeT getUtf8Length(const char32_t* begin, const char32_t* end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a UTF-32 buffer to UTF-8
+    ///
+    /// `output` must have room for at least `getUtf8Length(begin, end)`
+    /// elements (`4 * (end - begin)` is always enough).
+    ///
+    /// \param begin  Pointer to the beginning of the UTF-32 sequence
+    /// \param end    Pointer to the end of the UTF-32 sequence
+    /// \param output Pointer to the beginning of the output buffer
+    ///
+    /// \return Number of UTF-8 bytes written
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::SizeT utf32ToUtf8(const char32_t* begin, const char32_t* end, char* output);
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UtfBulk
+/// \ingroup system
+///
+/// `sf::UtfBulk` is the fast path used by `sf::UnicodeString`
+/// and `sf::UnicodeStringUtfUtils` when the input or output is
+/// a contiguous buffer. It can also be used directly when
+/// parsing large amounts of text (e.g. chat logs):
+///
+/// \code
+/// const char* text = ...;
+/// const sf::base::SizeT size = ...;
+///
+/// std::u32string decoded(size, U'\0');
+/// decoded.resize(sf::UtfBulk::utf8ToUtf32(text, text + size, decoded.data()));
+/// \endcode
+///
+/// \see sf::Utf, sf::UnicodeString
+///
+////////////////////////////////////////////////////////////
@@ -8,6 +8,10 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/Export.hpp"
 
+#include "SFML/Window/WindowEnums.hpp"
+
+#include "SFML/Base/Vector.hpp"
+
 
 ////////////////////////////////////////////////////////////
 // Forward declarations
@@ -31,6 +35,17 @@ namespace sf::EventUtils
 ////////////////////////////////////////////////////////////
 [[nodiscard]] SFML_WINDOW_API bool isClosedOrEscapeKeyPressed(const Event& event);
 
+////////////////////////////////////////////////////////////
+/// \brief Merge consecutive redundant events in place, as `WindowBase::pollEvents` does
+///
+/// With `EventCoalescing::Enabled`, each run of consecutive
+/// `Event::Resized` or `Event::MouseMoved` events is replaced by
+/// its latest event, and the other events are kept in order.
+/// With `EventCoalescing::Disabled`, `events` is left untouched.
+///
+////////////////////////////////////////////////////////////
+SFML_WINDOW_API void coalesceEvents(base::Vector<Event>& events, EventCoalescing coalescing);
+
 } // namespace sf::EventUtils
 
 ////////////////////////////////////////////////////////////
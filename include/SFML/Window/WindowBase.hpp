@@ -9,6 +9,7 @@
 #include "SFML/Window/Export.hpp"
 
 #include "SFML/Window/Event.hpp"
+#include "SFML/Window/WindowEnums.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 #include "SFML/Window/WindowSettings.hpp"
 
@@ -22,6 +23,7 @@
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
@@ -133,11 +135,41 @@ public:
     ///
     /// \return The potentially pending event, `base::nullOpt` otherwise
     ///
-    /// \see `waitEvent`, `pollAndHandleEvents`
+    /// \see `waitEvent`, `pollEvents`, `pollAndHandleEvents`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> pollEvent();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Drain the event queue and return all pending events at once
+    ///
+    /// This function is not blocking: if there's no pending event then
+    /// it will return an empty view. Unlike `pollEvent`, the events are
+    /// not copied out one by one: the returned view refers to storage
+    /// owned by the window, which is reused across calls to avoid any
+    /// allocation in the steady state. The view is valid until the next
+    /// call to `pollEvent`, `pollEvents`, or `waitEvent`.
+    ///
+    /// With `EventCoalescing::Enabled`, consecutive redundant events
+    /// are merged, which greatly reduces the number of events produced
+    /// by high polling rate mice. Relative order with other events is
+    /// preserved.
+    /// \code
+    /// for (const sf::Event& event : window.pollEvents(sf::EventCoalescing::Enabled))
+    /// {
+    ///    // process event...
+    /// }
+    /// \endcode
+    ///
+    /// \param coalescing Whether to merge consecutive redundant events
+    ///
+    /// \return View over all pending events
+    ///
+    /// \see `pollEvent`, `pollAndHandleEvents`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const Event> pollEvents(EventCoalescing coalescing = EventCoalescing::Disabled);
+
     ////////////////////////////////////////////////////////////
     /// \brief Wait for an event and return it
     ///
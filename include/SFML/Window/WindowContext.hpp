@@ -136,7 +136,7 @@ private:
     friend RenderTarget;    // for `getActiveThreadLocalGlContextId`
     friend RenderTexture;   // for `[un]registerUnsharedFrameBuffer`
     friend Sensor;          // for `getSensorManager`
-    friend Shader;          // for `hasActiveThreadLocalGlContext`
+    friend Shader;          // for `hasActiveThreadLocalGlContext` and `isExtensionAvailable`
     friend TestContext;     // for `createGlContext`
     friend Texture;         // for `hasActiveThreadLocalGlContext`
     friend VertexBuffer;    // for `hasActiveThreadLocalGlContext`
@@ -39,4 +39,15 @@ enum class [[nodiscard]] State
     Fullscreen //!< Fullscreen window
 };
 
+////////////////////////////////////////////////////////////
+/// \ingroup window
+/// \brief Enumeration of the event coalescing modes of `WindowBase::pollEvents`
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] EventCoalescing
+{
+    Disabled, //!< Every event is returned
+    Enabled   //!< Consecutive `Resized`/`MouseMoved` events are merged into the latest one
+};
+
 } // namespace sf
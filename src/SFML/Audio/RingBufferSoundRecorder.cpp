@@ -0,0 +1,225 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/RingBufferSoundRecorder.hpp"
+
+#include "SFML/Audio/CaptureDevice.hpp"
+#include "SFML/Audio/SoundRecorder.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::const]] constexpr sf::base::SizeT roundUpToPowerOfTwo(const sf::base::SizeT value) noexcept
+{
+    sf::base::SizeT result = 1u;
+
+    while (result < value)
+        result <<= 1u;
+
+    return result;
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct RingBufferSoundRecorder::Impl
+{
+    explicit Impl(const base::SizeT capacity) : mask{roundUpToPowerOfTwo(capacity) - 1u}
+    {
+        samples.resize(mask + 1u);
+    }
+
+    base::Vector<base::I16> samples; //!< Preallocated ring storage, size is a power of two
+    base::SizeT             mask;    //!< `samples.size() - 1u`, used to wrap indices
+
+    std::atomic<unsigned int> channelCount{1u}; //!< Channel count of the last started capture
+
+    std::atomic<base::SizeT> writeIndex{0u}; //!< Monotonic index owned by the capture thread
+    std::atomic<base::SizeT> readIndex{0u};  //!< Monotonic index owned by the consumer thread
+
+    std::atomic<base::SizeT> overrunCount{0u};       //!< Number of chunks that did not fully fit
+    std::atomic<base::SizeT> droppedSampleCount{0u}; //!< Number of samples lost to overruns
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] base::SizeT roundDownToFrame(const base::SizeT sampleCount) const
+    {
+        const unsigned int count = channelCount.load(std::memory_order_relaxed);
+        return sampleCount - (sampleCount % count);
+    }
+
+    ////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    [[nodiscard, gnu::always_inline, gnu::flatten]] base::SizeT read(T* const out, const base::SizeT maxCount, F&& copyFn)
+    {
+        const base::SizeT r = readIndex.load(std::memory_order_relaxed);
+        const base::SizeT w = writeIndex.load(std::memory_order_acquire);
+
+        const base::SizeT count = roundDownToFrame(SFML_BASE_MIN(maxCount, w - r));
+
+        const base::SizeT start      = r & mask;
+        const base::SizeT firstChunk = SFML_BASE_MIN(count, samples.size() - start);
+
+        copyFn(out, samples.data() + start, firstChunk);
+        copyFn(out + firstChunk, samples.data(), count - firstChunk);
+
+        readIndex.store(r + count, std::memory_order_release);
+        return count;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+RingBufferSoundRecorder::RingBufferSoundRecorder(const base::SizeT capacity) : m_impl(capacity)
+{
+    SFML_BASE_ASSERT(capacity > 0u);
+}
+
+
+////////////////////////////////////////////////////////////
+RingBufferSoundRecorder::~RingBufferSoundRecorder()
+{
+    if (!stop())
+        priv::err() << "Failed to stop ring buffer sound recorder on destruction";
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::readSamples(base::I16* const samples, const base::SizeT maxCount)
+{
+    return m_impl->read(samples,
+                        maxCount,
+                        [](base::I16* const dst, const base::I16* const src, const base::SizeT count)
+    { SFML_BASE_MEMCPY(dst, src, count * sizeof(base::I16)); });
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::readSamples(float* const samples, const base::SizeT maxCount)
+{
+    return m_impl->read(samples,
+                        maxCount,
+                        [](float* const dst, const base::I16* const src, const base::SizeT count)
+    {
+        for (base::SizeT i = 0u; i < count; ++i)
+            dst[i] = static_cast<float>(src[i]) / 32'768.f;
+    });
+}
+
+
+////////////////////////////////////////////////////////////
+void RingBufferSoundRecorder::discardSamples()
+{
+    m_impl->readIndex.store(m_impl->writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::getAvailableSampleCount() const
+{
+    const base::SizeT r = m_impl->readIndex.load(std::memory_order_acquire);
+    const base::SizeT w = m_impl->writeIndex.load(std::memory_order_acquire);
+
+    return w - r;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::getCapacity() const
+{
+    return m_impl->samples.size();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RingBufferSoundRecorder::getChannelCount() const
+{
+    return m_impl->channelCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::getOverrunCount() const
+{
+    return m_impl->overrunCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RingBufferSoundRecorder::getDroppedSampleCount() const
+{
+    return m_impl->droppedSampleCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void RingBufferSoundRecorder::resetCounters()
+{
+    m_impl->overrunCount.store(0u, std::memory_order_relaxed);
+    m_impl->droppedSampleCount.store(0u, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RingBufferSoundRecorder::onStart(CaptureDevice& captureDevice)
+{
+    const unsigned int channelCount = captureDevice.getChannelCount();
+
+    if (channelCount == 0u || channelCount > m_impl->samples.size())
+    {
+        priv::err() << "Ring buffer sound recorder capacity is too small for " << channelCount << " channels";
+        return false;
+    }
+
+    // The capture thread is not running yet, so resetting the indices is safe
+    m_impl->channelCount.store(channelCount, std::memory_order_relaxed);
+    m_impl->writeIndex.store(0u, std::memory_order_relaxed);
+    m_impl->readIndex.store(0u, std::memory_order_release);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RingBufferSoundRecorder::onProcessSamples(const base::I16* const samples, const base::SizeT sampleCount)
+{
+    const base::SizeT w = m_impl->writeIndex.load(std::memory_order_relaxed);
+    const base::SizeT r = m_impl->readIndex.load(std::memory_order_acquire);
+
+    const base::SizeT freeCount = m_impl->samples.size() - (w - r);
+    const base::SizeT count     = m_impl->roundDownToFrame(SFML_BASE_MIN(sampleCount, freeCount));
+
+    const base::SizeT start      = w & m_impl->mask;
+    const base::SizeT firstChunk = SFML_BASE_MIN(count, m_impl->samples.size() - start);
+
+    SFML_BASE_MEMCPY(m_impl->samples.data() + start, samples, firstChunk * sizeof(base::I16));
+    SFML_BASE_MEMCPY(m_impl->samples.data(), samples + firstChunk, (count - firstChunk) * sizeof(base::I16));
+
+    m_impl->writeIndex.store(w + count, std::memory_order_release);
+
+    if (count < sampleCount) [[unlikely]]
+    {
+        m_impl->overrunCount.fetch_add(1u, std::memory_order_relaxed);
+        m_impl->droppedSampleCount.fetch_add(sampleCount - count, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+} // namespace sf
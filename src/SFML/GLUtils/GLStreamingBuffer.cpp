@@ -0,0 +1,19 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/GLUtils/GLStreamingBuffer.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+// Explicit instantiation definitions
+////////////////////////////////////////////////////////////
+template class GLStreamingBuffer<GLVertexBufferObject>;
+template class GLStreamingBuffer<GLElementBufferObject>;
+
+} // namespace sf
@@ -7,12 +7,14 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/CircleShape.hpp"
 
+#include "SFML/Graphics/ShapeTessellationCache.hpp"
 #include "SFML/Graphics/ShapeUtils.hpp"
 
 #include "SFML/System/Vec2.hpp"
 
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/LambdaMacros.hpp"
+#include "SFML/Base/Span.hpp"
 
 
 namespace sf
@@ -81,10 +83,11 @@ Vec2f CircleShape::getGeometricCenter() const
 ////////////////////////////////////////////////////////////
 void CircleShape::updateCircleGeometry()
 {
-    const float angleStep = sf::base::tau / static_cast<float>(m_pointCount);
+    // Same points as `ShapeUtils::computeCirclePointFromAngleStep`, without recomputing the trigonometry
+    const base::Span<const Vec2f> unitPoints = priv::getCircleTemplate(m_pointCount, /* startRadians */ 0.f);
 
     updateFromFunc([&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {
-        return ShapeUtils::computeCirclePointFromAngleStep(i, /* startAngle */ 0.f, angleStep, m_radius);
+        return Vec2f{m_radius * (1.f + unitPoints[i].x), m_radius * (1.f + unitPoints[i].y)};
     }, m_pointCount);
 }
 
@@ -0,0 +1,104 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Culling.hpp"
+
+#include "SFML/Graphics/Sprite.hpp"
+
+#include "SFML/System/Rect2.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SFML_PRIV_CULLING_SSE2
+    #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define SFML_PRIV_CULLING_NEON
+    #include <arm_neon.h>
+#endif
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+unsigned int getVisibleSpriteMask4(const Sprite* const sprites, const Rect2f& cullRect) noexcept
+{
+#if defined(SFML_PRIV_CULLING_SSE2) || defined(SFML_PRIV_CULLING_NEON)
+    // Sprites are stored as an array of structures, transpose the fields needed for the bounds
+    alignas(16) float posX[4], posY[4], originX[4], originY[4], sizeX[4], sizeY[4], scaleX[4], scaleY[4];
+
+    for (base::SizeT i = 0u; i < 4u; ++i)
+    {
+        posX[i]    = sprites[i].position.x;
+        posY[i]    = sprites[i].position.y;
+        originX[i] = sprites[i].origin.x;
+        originY[i] = sprites[i].origin.y;
+        sizeX[i]   = sprites[i].textureRect.size.x;
+        sizeY[i]   = sprites[i].textureRect.size.y;
+        scaleX[i]  = sprites[i].scale.x;
+        scaleY[i]  = sprites[i].scale.y;
+    }
+#endif
+
+#if defined(SFML_PRIV_CULLING_SSE2)
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    const auto   abs      = [&](const __m128 x) { return _mm_andnot_ps(signMask, x); };
+
+    const __m128 ox = _mm_load_ps(originX);
+    const __m128 oy = _mm_load_ps(originY);
+
+    const __m128 extentX = _mm_max_ps(abs(ox), abs(_mm_sub_ps(abs(_mm_load_ps(sizeX)), ox)));
+    const __m128 extentY = _mm_max_ps(abs(oy), abs(_mm_sub_ps(abs(_mm_load_ps(sizeY)), oy)));
+
+    const __m128 half = _mm_add_ps(_mm_mul_ps(extentX, abs(_mm_load_ps(scaleX))),
+                                   _mm_mul_ps(extentY, abs(_mm_load_ps(scaleY))));
+
+    const __m128 px = _mm_load_ps(posX);
+    const __m128 py = _mm_load_ps(posY);
+
+    const __m128 outside = _mm_or_ps(
+        _mm_or_ps(_mm_cmpgt_ps(_mm_sub_ps(px, half), _mm_set1_ps(cullRect.position.x + cullRect.size.x)),
+                  _mm_cmpgt_ps(_mm_sub_ps(py, half), _mm_set1_ps(cullRect.position.y + cullRect.size.y))),
+        _mm_or_ps(_mm_cmplt_ps(_mm_add_ps(px, half), _mm_set1_ps(cullRect.position.x)),
+                  _mm_cmplt_ps(_mm_add_ps(py, half), _mm_set1_ps(cullRect.position.y))));
+
+    return ~static_cast<unsigned int>(_mm_movemask_ps(outside)) & 0xFu;
+#elif defined(SFML_PRIV_CULLING_NEON)
+    const float32x4_t ox = vld1q_f32(originX);
+    const float32x4_t oy = vld1q_f32(originY);
+
+    const float32x4_t extentX = vmaxq_f32(vabsq_f32(ox), vabdq_f32(vabsq_f32(vld1q_f32(sizeX)), ox));
+    const float32x4_t extentY = vmaxq_f32(vabsq_f32(oy), vabdq_f32(vabsq_f32(vld1q_f32(sizeY)), oy));
+
+    const float32x4_t half = vmlaq_f32(vmulq_f32(extentX, vabsq_f32(vld1q_f32(scaleX))),
+                                       extentY,
+                                       vabsq_f32(vld1q_f32(scaleY)));
+
+    const float32x4_t px = vld1q_f32(posX);
+    const float32x4_t py = vld1q_f32(posY);
+
+    const uint32x4_t outside = vorrq_u32(
+        vorrq_u32(vcgtq_f32(vsubq_f32(px, half), vdupq_n_f32(cullRect.position.x + cullRect.size.x)),
+                  vcgtq_f32(vsubq_f32(py, half), vdupq_n_f32(cullRect.position.y + cullRect.size.y))),
+        vorrq_u32(vcltq_f32(vaddq_f32(px, half), vdupq_n_f32(cullRect.position.x)),
+                  vcltq_f32(vaddq_f32(py, half), vdupq_n_f32(cullRect.position.y))));
+
+    constexpr base::U32 laneBits[4]{1u, 2u, 4u, 8u};
+    return ~vaddvq_u32(vandq_u32(outside, vld1q_u32(laneBits))) & 0xFu;
+#else
+    unsigned int mask = 0u;
+
+    for (unsigned int i = 0u; i < 4u; ++i)
+        if (!isOutsideCullRect(getConservativeSpriteBounds(sprites[i]), cullRect))
+            mask |= 1u << i;
+
+    return mask;
+#endif
+}
+
+} // namespace sf::priv
@@ -0,0 +1,121 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Sprite.hpp"
+
+#include "SFML/System/Rect2.hpp"
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Check whether `bounds` lies entirely outside of `cullRect`
+///
+/// Touching edges count as overlapping.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::pure]] inline bool isOutsideCullRect(const Rect2f& bounds,
+                                                                           const Rect2f& cullRect) noexcept
+{
+    return bounds.position.x > cullRect.position.x + cullRect.size.x ||
+           bounds.position.y > cullRect.position.y + cullRect.size.y ||
+           bounds.position.x + bounds.size.x < cullRect.position.x ||
+           bounds.position.y + bounds.size.y < cullRect.position.y;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Axis-aligned bounds of a transformable that hold for any rotation
+///
+/// Avoids computing the sine and cosine of the rotation: the distance
+/// of any local point from the origin is bounded by the sum of its
+/// scaled horizontal and vertical distances, which is used as the
+/// half extent of a square around `position`.
+///
+/// \param localMin Top-left corner of the local geometry
+/// \param localMax Bottom-right corner of the local geometry
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::pure]] inline Rect2f getConservativeBounds(
+    const Vec2f position,
+    const Vec2f scale,
+    const Vec2f origin,
+    const Vec2f localMin,
+    const Vec2f localMax) noexcept
+{
+    const float extentX = SFML_BASE_MAX(SFML_BASE_MATH_FABSF(localMin.x - origin.x),
+                                        SFML_BASE_MATH_FABSF(localMax.x - origin.x));
+
+    const float extentY = SFML_BASE_MAX(SFML_BASE_MATH_FABSF(localMin.y - origin.y),
+                                        SFML_BASE_MATH_FABSF(localMax.y - origin.y));
+
+    const float halfExtent = extentX * SFML_BASE_MATH_FABSF(scale.x) + extentY * SFML_BASE_MATH_FABSF(scale.y);
+
+    return {position - Vec2f{halfExtent, halfExtent}, {2.f * halfExtent, 2.f * halfExtent}};
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Conservative bounds of shape data, including its outline
+///
+/// Miter joints of the outline can extend up to `miterLimit` times
+/// the outline thickness away from the local geometry.
+///
+/// \param localMin Top-left corner of the local geometry, without outline
+/// \param localMax Bottom-right corner of the local geometry, without outline
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::pure]] inline Rect2f getConservativeShapeDataBounds(const auto& descriptor,
+                                                                                          const Vec2f localMin,
+                                                                                          const Vec2f localMax) noexcept
+{
+    const float outline = SFML_BASE_MATH_FABSF(descriptor.outlineThickness) * SFML_BASE_MAX(descriptor.miterLimit, 1.f);
+
+    return getConservativeBounds(descriptor.position,
+                                 descriptor.scale,
+                                 descriptor.origin,
+                                 localMin - Vec2f{outline, outline},
+                                 localMax + Vec2f{outline, outline});
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Conservative bounds of a sprite, see `getConservativeBounds`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::pure]] inline Rect2f getConservativeSpriteBounds(const Sprite& sprite) noexcept
+{
+    return getConservativeBounds(sprite.position,
+                                 sprite.scale,
+                                 sprite.origin,
+                                 {0.f, 0.f},
+                                 {SFML_BASE_MATH_FABSF(sprite.textureRect.size.x),
+                                  SFML_BASE_MATH_FABSF(sprite.textureRect.size.y)});
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Cull four consecutive sprites at once
+///
+/// Equivalent to testing `getConservativeSpriteBounds` of each
+/// sprite against `cullRect`, vectorized with SSE2 or NEON when
+/// available.
+///
+/// \param sprites  Pointer to the first of four sprites
+/// \param cullRect Rectangle outside of which sprites are culled
+///
+/// \return Mask with bit `i` set if `sprites[i]` is visible
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getVisibleSpriteMask4(const Sprite* sprites, const Rect2f& cullRect) noexcept;
+
+} // namespace sf::priv
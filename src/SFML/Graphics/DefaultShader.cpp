@@ -14,17 +14,59 @@
 #include "SFML/Base/Optional.hpp"
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::Shader> createShaderWithCurrentTexture(const char* const vertexCode,
+                                                                           const char* const fragmentCode)
+{
+    auto result = sf::Shader::loadFromMemory({.vertexCode = vertexCode, .fragmentCode = fragmentCode});
+
+    if (result)
+    {
+        if (const sf::base::Optional ulTexture = result->getUniformLocation("sf_u_texture"))
+            result->setUniform(*ulTexture, sf::Shader::CurrentTexture);
+    }
+
+    return result;
+}
+
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 [[nodiscard]] base::Optional<Shader> DefaultShader::create()
 {
-    auto result = Shader::loadFromMemory({.vertexCode = srcVertex, .fragmentCode = srcFragment});
+    return createShaderWithCurrentTexture(srcVertex, srcFragment);
+}
 
-    if (result)
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Optional<Shader> DefaultShader::createInstancedSprite()
+{
+    return createShaderWithCurrentTexture(srcInstancedSpriteVertex, srcFragment);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Optional<Shader> DefaultShader::createMultiDraw()
+{
+    auto result = Shader::loadFromMemory({.vertexCode = srcMultiDrawVertex, .fragmentCode = srcMultiDrawFragment});
+
+    if (!result)
+        return result;
+
+    char uniformName[] = "sf_u_textures[0]";
+    static_assert(multiDrawTextureCount <= 10u, "Texture slots must be single digits");
+
+    for (unsigned int i = 0u; i < multiDrawTextureCount; ++i)
     {
-        if (const base::Optional ulTexture = result->getUniformLocation("sf_u_texture"))
-            result->setUniform(*ulTexture, Shader::CurrentTexture);
+        uniformName[14] = static_cast<char>('0' + i);
+
+        if (const base::Optional ulTexture = result->getUniformLocation(uniformName))
+            result->setUniform(*ulTexture, static_cast<int>(i));
     }
 
     return result;
@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/ArrowShapeData.hpp"
 #include "SFML/Graphics/CircleShapeData.hpp"
+#include "SFML/Graphics/Culling.hpp"
 #include "SFML/Graphics/CurvedArrowShapeData.hpp"
 #include "SFML/Graphics/DrawableBatch.hpp"
 #include "SFML/Graphics/DrawableBatchUtils.hpp"
@@ -22,6 +23,7 @@
 #include "SFML/Graphics/RingShapeData.hpp"
 #include "SFML/Graphics/RoundedRectangleShapeData.hpp"
 #include "SFML/Graphics/Shape.hpp"
+#include "SFML/Graphics/ShapeTessellationCache.hpp"
 #include "SFML/Graphics/ShapeUtils.hpp"
 #include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/StarShapeData.hpp"
@@ -276,10 +278,25 @@ void DrawableBatchImpl<TStorage>::add(const Vertex* const SFML_BASE_RESTRICT
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+[[gnu::always_inline]] inline bool DrawableBatchImpl<TStorage>::cull(auto&& getBoundsFn)
+{
+    if (!m_cullRect.hasValue() || !isOutsideCullRect(getBoundsFn(), *m_cullRect)) [[likely]]
+        return false;
+
+    ++m_numCulled;
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::add(const Text& text)
 {
+    if (cull([&] { return text.getGlobalBounds(); }))
+        return;
+
     const auto [data, size] = text.getVertices();
     SFML_BASE_ASSERT(size % 4u == 0);
 
@@ -299,8 +316,11 @@ void DrawableBatchImpl<TStorage>::add(const Text& text)
 
 ////////////////////////////////////////////////////////////
 template <typename TStorage>
-void DrawableBatchImpl<TStorage>::add(const Sprite& sprite) // TODO P1: batched versions for (Sprite* b, Sprite* e)
+void DrawableBatchImpl<TStorage>::add(const Sprite& sprite)
 {
+    if (cull([&] { return getConservativeSpriteBounds(sprite); }))
+        return;
+
     DrawableBatchUtils::appendSpriteIndicesAndVertices(sprite,
                                                        m_storage.getNumVertices(),
                                                        m_storage.reserveMoreIndices(6u),
@@ -311,6 +331,51 @@ void DrawableBatchImpl<TStorage>::add(const Sprite& sprite) // TODO P1: batched
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void DrawableBatchImpl<TStorage>::add(const Sprite* const sprites, const base::SizeT count)
+{
+    const auto appendSprite = [&](const Sprite& sprite)
+    {
+        DrawableBatchUtils::appendSpriteIndicesAndVertices(sprite,
+                                                           m_storage.getNumVertices(),
+                                                           m_storage.reserveMoreIndices(6u),
+                                                           m_storage.reserveMoreVertices(4u));
+
+        m_storage.commitMoreIndices(6u);
+        m_storage.commitMoreVertices(4u);
+    };
+
+    if (!m_cullRect.hasValue())
+    {
+        reserveQuads(count);
+
+        for (base::SizeT i = 0u; i < count; ++i)
+            appendSprite(sprites[i]);
+
+        return;
+    }
+
+    base::SizeT i = 0u;
+
+    for (; i + 4u <= count; i += 4u)
+    {
+        const unsigned int visibleMask = getVisibleSpriteMask4(sprites + i, *m_cullRect);
+
+        for (unsigned int lane = 0u; lane < 4u; ++lane)
+        {
+            if (visibleMask & (1u << lane))
+                appendSprite(sprites[i + lane]);
+            else
+                ++m_numCulled;
+        }
+    }
+
+    for (; i < count; ++i)
+        add(sprites[i]);
+}
+
+
 ////////////////////////////////////////////////////////////
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::addShapeFill(const Transform& transform, const Vertex* data, const base::SizeT size)
@@ -357,6 +422,9 @@ void DrawableBatchImpl<TStorage>::addShapeOutline(const Transform& transform, co
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::add(const Shape& shape)
 {
+    if (cull([&] { return shape.getGlobalBounds(); }))
+        return;
+
     const auto transform = shape.getTransform();
 
     const auto [fillData, fillSize]       = shape.getFillVertices();
@@ -374,6 +442,41 @@ VertexSpan DrawableBatchImpl<TStorage>::drawTriangleFanShapeFromPoints(
     const auto&       descriptor,
     auto&&            pointFn,
     const Vec2f       centerOffset)
+{
+    return drawTriangleFanShapeFromPositions(nPoints,
+                                             descriptor,
+                                             [&](const Transform& transform, Vertex* const pointVertexPtr)
+    {
+        pointVertexPtr[0].position = transform.transformPoint(pointFn(0u));
+
+        priv::PointBounds bounds{pointVertexPtr[0].position, pointVertexPtr[0].position};
+
+        for (unsigned int i = 1u; i < nPoints; ++i)
+        {
+            Vertex& v = pointVertexPtr[i];
+
+            v.position = transform.transformPoint(pointFn(i));
+
+            bounds.min.x = SFML_BASE_MIN(bounds.min.x, v.position.x);
+            bounds.min.y = SFML_BASE_MIN(bounds.min.y, v.position.y);
+
+            bounds.max.x = SFML_BASE_MAX(bounds.max.x, v.position.x);
+            bounds.max.y = SFML_BASE_MAX(bounds.max.y, v.position.y);
+        }
+
+        return bounds;
+    },
+                                             centerOffset);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+VertexSpan DrawableBatchImpl<TStorage>::drawTriangleFanShapeFromPositions(
+    const base::SizeT nPoints,
+    const auto&       descriptor,
+    auto&&            positionsFn,
+    const Vec2f       centerOffset)
 {
     if (nPoints < 3u) [[unlikely]]
         return {};
@@ -391,26 +494,10 @@ VertexSpan DrawableBatchImpl<TStorage>::drawTriangleFanShapeFromPoints(
 
     //
     // Update fill vertex positions and compute inside bounds
-    fillVertexPtr[1].position    = transform.transformPoint(pointFn(0u)); // first point
-    sf::Vec2f fillBoundsPosition = fillVertexPtr[1].position;             // left and top
-
-    float fillBoundsMaxX = fillVertexPtr[1].position.x; // right
-    float fillBoundsMaxY = fillVertexPtr[1].position.y; // bottom
+    const priv::PointBounds fillBounds = positionsFn(transform, fillVertexPtr + 1u); // skip center
 
-    for (unsigned int i = 1u; i < nPoints; ++i)
-    {
-        Vertex& v = fillVertexPtr[1u + i];
-
-        v.position = transform.transformPoint(pointFn(i));
-
-        fillBoundsPosition.x = SFML_BASE_MIN(fillBoundsPosition.x, v.position.x);
-        fillBoundsPosition.y = SFML_BASE_MIN(fillBoundsPosition.y, v.position.y);
-
-        fillBoundsMaxX = SFML_BASE_MAX(fillBoundsMaxX, v.position.x);
-        fillBoundsMaxY = SFML_BASE_MAX(fillBoundsMaxY, v.position.y);
-    }
-
-    const sf::Vec2f fillBoundsSize{fillBoundsMaxX - fillBoundsPosition.x, fillBoundsMaxY - fillBoundsPosition.y};
+    const sf::Vec2f fillBoundsPosition = fillBounds.min;
+    const sf::Vec2f fillBoundsSize     = fillBounds.max - fillBounds.min;
 
     fillVertexPtr[0].position            = fillBoundsPosition + fillBoundsSize / 2.f + centerOffset; // center
     fillVertexPtr[1u + nPoints].position = fillVertexPtr[1].position; // repeated first point
@@ -499,13 +586,26 @@ template <typename TStorage>
 VertexSpan DrawableBatchImpl<TStorage>::add(const CircleShapeData& sdCircle)
 {
     SFML_BASE_ASSERT(sdCircle.pointCount != 0u);
-    const float angleStep = base::tau / static_cast<float>(sdCircle.pointCount);
 
-    return drawTriangleFanShapeFromPoints(sdCircle.pointCount,
-                                          sdCircle,
-                                          [&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
+    if (cull([&] { return getConservativeShapeDataBounds(sdCircle, {}, Vec2f{2.f, 2.f} * sdCircle.radius); }))
+        return {};
+
+    const base::Span<const Vec2f> unitPoints = priv::getCircleTemplate(sdCircle.pointCount,
+                                                                       sdCircle.startAngle.asRadians());
+
+    return drawTriangleFanShapeFromPositions(sdCircle.pointCount,
+                                             sdCircle,
+                                             [&](const Transform& transform, Vertex* const pointVertexPtr)
     {
-        return ShapeUtils::computeCirclePointFromAngleStep(i, sdCircle.startAngle.asRadians(), angleStep, sdCircle.radius);
+        // Local point is `radius * (1 + unitPoint)`, see `ShapeUtils::computeCirclePointFromAngleStep`
+        const float     r = sdCircle.radius;
+        const Transform local{.a00 = r, .a01 = 0.f, .a02 = r, .a10 = 0.f, .a11 = r, .a12 = r};
+
+        return priv::transformTemplatePoints(unitPoints.data(),
+                                             unitPoints.size(),
+                                             transform * local,
+                                             pointVertexPtr,
+                                             /* vertexStride */ 1u);
     });
 }
 
@@ -716,17 +816,27 @@ template <typename TStorage>
 VertexSpan DrawableBatchImpl<TStorage>::add(const EllipseShapeData& sdEllipse)
 {
     SFML_BASE_ASSERT(sdEllipse.pointCount != 0u);
-    const float angleStep = base::tau / static_cast<float>(sdEllipse.pointCount);
 
-    return drawTriangleFanShapeFromPoints(sdEllipse.pointCount,
-                                          sdEllipse,
-                                          [&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
+    const Vec2f radii{sdEllipse.horizontalRadius, sdEllipse.verticalRadius};
+
+    if (cull([&] { return getConservativeShapeDataBounds(sdEllipse, {}, radii * 2.f); }))
+        return {};
+
+    const base::Span<const Vec2f> unitPoints = priv::getCircleTemplate(sdEllipse.pointCount,
+                                                                       sdEllipse.startAngle.asRadians());
+
+    return drawTriangleFanShapeFromPositions(sdEllipse.pointCount,
+                                             sdEllipse,
+                                             [&](const Transform& transform, Vertex* const pointVertexPtr)
     {
-        return ShapeUtils::computeEllipsePointFromAngleStep(i,
-                                                            sdEllipse.startAngle.asRadians(),
-                                                            angleStep,
-                                                            sdEllipse.horizontalRadius,
-                                                            sdEllipse.verticalRadius);
+        // Local point is `radii * (1 + unitPoint)`, see `ShapeUtils::computeEllipsePointFromAngleStep`
+        const Transform local{.a00 = radii.x, .a01 = 0.f, .a02 = radii.x, .a10 = 0.f, .a11 = radii.y, .a12 = radii.y};
+
+        return priv::transformTemplatePoints(unitPoints.data(),
+                                             unitPoints.size(),
+                                             transform * local,
+                                             pointVertexPtr,
+                                             /* vertexStride */ 1u);
     });
 }
 
@@ -754,6 +864,9 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const PieSliceShapeData& sdPieSlice)
             .pointCount         = sdPieSlice.pointCount - 2u,
         });
 
+    if (cull([&] { return getConservativeShapeDataBounds(sdPieSlice, {}, Vec2f{2.f, 2.f} * sdPieSlice.radius); }))
+        return {};
+
     const float arcAngleStep = ShapeUtils::computePieSliceArcAngleStep(sdPieSlice.sweepAngle.asRadians(), sdPieSlice.pointCount);
 
     return drawTriangleFanShapeFromPoints(sdPieSlice.pointCount,
@@ -772,6 +885,9 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const PieSliceShapeData& sdPieSlice)
 template <typename TStorage>
 VertexSpan DrawableBatchImpl<TStorage>::add(const RectangleShapeData& sdRectangle)
 {
+    if (cull([&] { return getConservativeShapeDataBounds(sdRectangle, {}, sdRectangle.size); }))
+        return {};
+
     return drawTriangleFanShapeFromPoints(4u, sdRectangle, [&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {
         return ShapeUtils::computeRectanglePoint(i, sdRectangle.size);
     });
@@ -782,14 +898,53 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const RectangleShapeData& sdRectangl
 template <typename TStorage>
 VertexSpan DrawableBatchImpl<TStorage>::add(const RoundedRectangleShapeData& sdRoundedRectangle)
 {
-    return drawTriangleFanShapeFromPoints(sdRoundedRectangle.cornerPointCount * 4u,
-                                          sdRoundedRectangle,
-                                          [&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
+    if (cull([&] { return getConservativeShapeDataBounds(sdRoundedRectangle, {}, sdRoundedRectangle.size); }))
+        return {};
+
+    const unsigned int cornerPointCount = sdRoundedRectangle.cornerPointCount;
+
+    if (cornerPointCount == 0u) [[unlikely]]
+        return {};
+
+    const base::Span<const Vec2f> unitPoints = priv::getRoundedRectangleTemplate(cornerPointCount);
+
+    return drawTriangleFanShapeFromPositions(cornerPointCount * 4u,
+                                             sdRoundedRectangle,
+                                             [&](const Transform& transform, Vertex* const pointVertexPtr)
     {
-        return ShapeUtils::computeRoundedRectanglePoint(i,
-                                                        sdRoundedRectangle.size,
-                                                        sdRoundedRectangle.cornerRadius,
-                                                        sdRoundedRectangle.cornerPointCount);
+        const Vec2f size = sdRoundedRectangle.size;
+        const float r    = sdRoundedRectangle.cornerRadius;
+
+        priv::PointBounds bounds{};
+
+        // Local point is `cornerCenter + cornerRadius * unitPoint`, see `ShapeUtils::computeRoundedRectanglePoint`
+        for (unsigned int corner = 0u; corner < 4u; ++corner)
+        {
+            const Vec2f center{(corner == 0u || corner == 3u) ? size.x - r : r, (corner < 2u) ? r : size.y - r};
+            const Transform local{.a00 = r, .a01 = 0.f, .a02 = center.x, .a10 = 0.f, .a11 = r, .a12 = center.y};
+
+            const base::SizeT firstPoint = corner * cornerPointCount;
+
+            const priv::PointBounds cornerBounds = priv::transformTemplatePoints(unitPoints.data() + firstPoint,
+                                                                                 cornerPointCount,
+                                                                                 transform * local,
+                                                                                 pointVertexPtr + firstPoint,
+                                                                                 /* vertexStride */ 1u);
+
+            if (corner == 0u)
+            {
+                bounds = cornerBounds;
+                continue;
+            }
+
+            bounds.min.x = SFML_BASE_MIN(bounds.min.x, cornerBounds.min.x);
+            bounds.min.y = SFML_BASE_MIN(bounds.min.y, cornerBounds.min.y);
+
+            bounds.max.x = SFML_BASE_MAX(bounds.max.x, cornerBounds.max.x);
+            bounds.max.y = SFML_BASE_MAX(bounds.max.y, cornerBounds.max.y);
+        }
+
+        return bounds;
     });
 }
 
@@ -802,11 +957,13 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const RingShapeData& sdRing)
         sdRing.pointCount < 3u) [[unlikely]]
         return {};
 
+    if (cull([&] { return getConservativeShapeDataBounds(sdRing, {}, Vec2f{2.f, 2.f} * sdRing.outerRadius); }))
+        return {};
+
     const auto [sine, cosine] = base::sinCosLookup(sdRing.rotation.asRadians());
     const auto transform = Transform::fromPositionScaleOriginSinCos(sdRing.position, sdRing.scale, sdRing.origin, sine, cosine);
 
-    const unsigned int nPoints   = sdRing.pointCount;
-    const float        angleStep = base::tau / static_cast<float>(nPoints);
+    const unsigned int nPoints = sdRing.pointCount;
 
     //
     // Local origin `(0, 0)` is top-left of the bounding box
@@ -821,9 +978,32 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const RingShapeData& sdRing)
     const IndexType   firstFillVertexIndex = m_storage.getNumVertices();
     Vertex* const     fillVertexPtr        = m_storage.reserveMoreVertices(fillVertexCount);
 
-    generateRingVertices(sdRing.textureRect, sdRing.fillColor, sdRing.outerRadius, sdRing.innerRadius, [&](const Vec2f p) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {
-        return transform.transformPoint(p);
-    }, nPoints, sdRing.startAngle.asRadians(), angleStep, invLocalBoundsSize, fillVertexPtr);
+    {
+        // Same points as `ShapeUtils::computeRingPointsFromAngleStep`, the template stores `(sine, cosine)` pairs
+        const base::Span<const Vec2f> unitPoints = priv::getCircleTemplate(nPoints, sdRing.startAngle.asRadians());
+
+        const float     ro = sdRing.outerRadius;
+        const float     ri = sdRing.innerRadius;
+        const Transform outerLocal{.a00 = 0.f, .a01 = ro, .a02 = ro, .a10 = ro, .a11 = 0.f, .a12 = ro};
+        const Transform innerLocal{.a00 = 0.f, .a01 = ri, .a02 = ro, .a10 = ri, .a11 = 0.f, .a12 = ro};
+
+        // Outer and inner vertices are interleaved
+        priv::transformTemplatePoints(unitPoints.data(), nPoints, transform * outerLocal, fillVertexPtr, 2u);
+        priv::transformTemplatePoints(unitPoints.data(), nPoints, transform * innerLocal, fillVertexPtr + 1u, 2u);
+
+        const Rect2f& texRect = sdRing.textureRect;
+
+        for (unsigned int i = 0u; i < nPoints; ++i)
+        {
+            const Vec2f ratioO = outerLocal.transformPoint(unitPoints[i]).componentWiseMul(invLocalBoundsSize);
+            const Vec2f ratioI = innerLocal.transformPoint(unitPoints[i]).componentWiseMul(invLocalBoundsSize);
+
+            fillVertexPtr[2u * i + 0u].color     = sdRing.fillColor;
+            fillVertexPtr[2u * i + 0u].texCoords = texRect.position + texRect.size.componentWiseMul(ratioO);
+            fillVertexPtr[2u * i + 1u].color     = sdRing.fillColor;
+            fillVertexPtr[2u * i + 1u].texCoords = texRect.position + texRect.size.componentWiseMul(ratioI);
+        }
+    }
 
     //
     // Repeat first pair to close the strip
@@ -938,6 +1118,11 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const RingPieSliceShapeData& sdRingP
             .pointCount         = sdRingPieSlice.pointCount - 1u,
         });
 
+    const float outerDiameter = 2.f * sdRingPieSlice.outerRadius;
+
+    if (cull([&] { return getConservativeShapeDataBounds(sdRingPieSlice, {}, {outerDiameter, outerDiameter}); }))
+        return {};
+
     const auto [sine, cosine] = base::sinCosLookup(sdRingPieSlice.rotation.asRadians());
     const auto transform      = Transform::fromPositionScaleOriginSinCos(sdRingPieSlice.position,
                                                                     sdRingPieSlice.scale,
@@ -1049,6 +1234,15 @@ VertexSpan DrawableBatchImpl<TStorage>::add(const StarShapeData& sdStar)
     const auto nPoints = sdStar.pointCount * 2u;
 
     SFML_BASE_ASSERT(nPoints != 0u);
+
+    // Points lie within `maxRadius` of the local center `(outerRadius, outerRadius)`
+    const float maxRadius = SFML_BASE_MAX(sdStar.outerRadius, sdStar.innerRadius);
+    const Vec2f center{sdStar.outerRadius, sdStar.outerRadius};
+    const Vec2f extent{maxRadius, maxRadius};
+
+    if (cull([&] { return getConservativeShapeDataBounds(sdStar, center - extent, center + extent); }))
+        return {};
+
     const float angleStep = base::tau / static_cast<float>(nPoints);
 
     return drawTriangleFanShapeFromPoints(nPoints, sdStar, [&](const base::SizeT i) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {
@@ -32,6 +32,7 @@ namespace sf
 struct GraphicsContextImpl
 {
     Shader  builtInShader;
+    Shader  builtInInstancedSpriteShader;
     Texture builtInWhiteDotTexture;
 };
 
@@ -91,6 +92,12 @@ base::Optional<GraphicsContext> GraphicsContext::create()
     if (!shader.hasValue())
         return fail("built-in shader initialization failure");
 
+    //
+    // Initialize built-in instanced sprite shader
+    auto instancedSpriteShader = DefaultShader::createInstancedSprite();
+    if (!instancedSpriteShader.hasValue())
+        return fail("built-in instanced sprite shader initialization failure");
+
     //
     // Initialize built-in texture
     auto texture = Texture::loadFromImage(*Image::create({2u, 2u}, Color::White));
@@ -99,7 +106,9 @@ base::Optional<GraphicsContext> GraphicsContext::create()
 
     //
     // Install graphics context
-    installedGraphicsContext.emplace(*SFML_BASE_MOVE(shader), *SFML_BASE_MOVE(texture));
+    installedGraphicsContext.emplace(*SFML_BASE_MOVE(shader),
+                                     *SFML_BASE_MOVE(instancedSpriteShader),
+                                     *SFML_BASE_MOVE(texture));
 
     return base::makeOptional<GraphicsContext>(base::PassKey<GraphicsContext>{}, SFML_BASE_MOVE(windowContext));
 }
@@ -142,6 +151,13 @@ Shader& GraphicsContext::getBuiltInShader()
 }
 
 
+////////////////////////////////////////////////////////////
+Shader& GraphicsContext::getBuiltInInstancedSpriteShader()
+{
+    return ensureInstalled().builtInInstancedSpriteShader;
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& GraphicsContext::getBuiltInWhiteDotTexture()
 {
@@ -206,6 +222,14 @@ Shader& GraphicsContext::getInstalledBuiltInShader()
 }
 
 
+////////////////////////////////////////////////////////////
+Shader& GraphicsContext::getInstalledBuiltInInstancedSpriteShader()
+{
+    SFML_BASE_ASSERT(installedGraphicsContext.hasValue());
+    return installedGraphicsContext->builtInInstancedSpriteShader;
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& GraphicsContext::getInstalledBuiltInWhiteDotTexture()
 {
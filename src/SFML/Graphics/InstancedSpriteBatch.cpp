@@ -0,0 +1,136 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/InstancedSpriteBatch.hpp"
+
+#include "SFML/Graphics/Sprite.hpp"
+
+#include "SFML/GLUtils/GLPersistentBuffer.hpp"
+#include "SFML/GLUtils/GLVAOGroup.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Math/Lround.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::I16 toTextureRectComponent(const float value) noexcept
+{
+    const long rounded = SFML_BASE_MATH_LROUNDF(value);
+    return static_cast<sf::base::I16>(SFML_BASE_MIN(SFML_BASE_MAX(rounded, -32'768l), 32'767l));
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+struct InstancedSpritePersistentGPUStorage::Impl
+{
+    GLVAOGroup persistentVaoGroup; //!< VAO and VBO associated with the batch (EBO unused)
+
+    GLPersistentBuffer<GLVertexBufferObject> vboPersistentBuffer; //!< GPU persistent buffer for instances
+
+    Impl() = default;
+
+    ~Impl()
+    {
+        vboPersistentBuffer.unmapIfNeeded(persistentVaoGroup.vbo);
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    Impl(Impl&& rhs) noexcept = default;
+
+    Impl& operator=(Impl&& rhs) noexcept
+    {
+        if (this == &rhs)
+            return *this;
+
+        // Must unmap the buffer before moving it
+        vboPersistentBuffer.unmapIfNeeded(persistentVaoGroup.vbo);
+
+        persistentVaoGroup  = SFML_BASE_MOVE(rhs.persistentVaoGroup);
+        vboPersistentBuffer = SFML_BASE_MOVE(rhs.vboPersistentBuffer);
+
+        return *this;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+InstancedSpritePersistentGPUStorage::InstancedSpritePersistentGPUStorage()  = default;
+InstancedSpritePersistentGPUStorage::~InstancedSpritePersistentGPUStorage() = default;
+InstancedSpritePersistentGPUStorage::InstancedSpritePersistentGPUStorage(
+    InstancedSpritePersistentGPUStorage&&) noexcept = default;
+InstancedSpritePersistentGPUStorage& InstancedSpritePersistentGPUStorage::operator=(
+    InstancedSpritePersistentGPUStorage&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SpriteInstance* InstancedSpritePersistentGPUStorage::reserveMoreInstances(const base::SizeT count)
+{
+    impl->vboPersistentBuffer.reserve(impl->persistentVaoGroup.vbo, sizeof(SpriteInstance) * (nInstances + count));
+    return static_cast<SpriteInstance*>(impl->vboPersistentBuffer.data()) + nInstances;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* InstancedSpritePersistentGPUStorage::getVAOGroup() const
+{
+    return &impl->persistentVaoGroup;
+}
+
+
+////////////////////////////////////////////////////////////
+void InstancedSpritePersistentGPUStorage::flushWritesToGPU(const base::SizeT count, const base::SizeT offset) const
+{
+    impl->vboPersistentBuffer.flushWritesToGPU(impl->persistentVaoGroup.vbo, sizeof(SpriteInstance), count, offset);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void InstancedSpriteBatchImpl<TStorage>::add(const Sprite& sprite)
+{
+    const auto& [rectPosition, rectSize] = sprite.textureRect;
+
+    add(SpriteInstance{
+        .position    = sprite.position,
+        .color       = sprite.color,
+        .textureRect = {toTextureRectComponent(rectPosition.x),
+                        toTextureRectComponent(rectPosition.y),
+                        toTextureRectComponent(rectSize.x),
+                        toTextureRectComponent(rectSize.y)},
+        .scale       = sprite.scale,
+        .origin      = sprite.origin,
+        .rotation    = sprite.rotation.asRadians(),
+    });
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void InstancedSpriteBatchImpl<TStorage>::add(const SpriteInstance& instance)
+{
+    *m_storage.reserveMoreInstances(1u) = instance;
+    m_storage.commitMoreInstances(1u);
+}
+
+
+////////////////////////////////////////////////////////////
+// Explicit instantiation definitions
+////////////////////////////////////////////////////////////
+template class InstancedSpriteBatchImpl<InstancedSpriteCPUStorage>;
+template class InstancedSpriteBatchImpl<InstancedSpritePersistentGPUStorage>;
+
+} // namespace sf::priv
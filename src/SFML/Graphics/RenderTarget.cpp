@@ -9,24 +9,32 @@
 
 #include "SFML/Graphics/BlendMode.hpp"
 #include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/DefaultShader.hpp"
 #include "SFML/Graphics/DrawableBatch.hpp"
 #include "SFML/Graphics/DrawableBatchUtils.hpp"
 #include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/InstancedSpriteBatch.hpp"
+#include "SFML/Graphics/MultiDrawCommandBuilder.hpp"
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RetainedBatch.hpp"
 #include "SFML/Graphics/Shader.hpp"
 #include "SFML/Graphics/Shape.hpp"
 #include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Text.hpp"
+#include "SFML/Graphics/TextLogView.hpp"
 #include "SFML/Graphics/Texture.hpp"
 #include "SFML/Graphics/Transform.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 #include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+#include "SFML/Graphics/VertexPacking.hpp"
 #include "SFML/Graphics/VertexSpan.hpp"
 #include "SFML/Graphics/View.hpp"
 
+#include "SFML/GLUtils/GLBufferObject.hpp"
 #include "SFML/GLUtils/GLCheck.hpp"
 #include "SFML/GLUtils/GLVAOGroup.hpp"
 #include "SFML/GLUtils/Glad.hpp"
@@ -40,9 +48,11 @@
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Math/Lround.hpp"
 #include "SFML/Base/MinMax.hpp"
+#include "SFML/Base/Optional.hpp"
 #include "SFML/Base/ScopeGuard.hpp"
 #include "SFML/Base/SinCosLookup.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #include <atomic>
 
@@ -192,9 +202,60 @@ SFML_PRIV_DEFINE_ENUM_TO_GLENUM_CONVERSION_FN(
 
 
 ////////////////////////////////////////////////////////////
-void setupVertexAttribPointers()
+[[gnu::always_inline, gnu::flatten]] inline void streamBytesToGPU(const GLenum          bufferType,
+                                                                  const void*           data,
+                                                                  const sf::base::SizeT byteCount)
 {
-#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(SFML_BASE_OFFSETOF(__VA_ARGS__))
+    glCheck(glBufferData(bufferType, static_cast<GLsizeiptr>(byteCount), data, GL_STREAM_DRAW));
+}
+
+
+////////////////////////////////////////////////////////////
+void setupPackedVertexAttribPointers(const sf::VertexFormat format, const sf::base::SizeT byteOffset)
+{
+#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(byteOffset + SFML_BASE_OFFSETOF(__VA_ARGS__))
+
+    // Integer and half-float attributes are converted to `vec2` by the GPU, shaders need no variant
+    glCheck(glEnableVertexAttribArray(0u));
+    glCheck(glVertexAttribPointer(/*      index */ 0u,
+                                  /*       size */ 2,
+                                  /*       type */ format == sf::VertexFormat::Int16 ? GL_SHORT : GL_HALF_FLOAT,
+                                  /* normalized */ GL_FALSE,
+                                  /*     stride */ sizeof(sf::priv::PackedVertex),
+                                  /*     offset */ SFML_PRIV_OFFSETOF(sf::priv::PackedVertex, position)));
+
+    glCheck(glEnableVertexAttribArray(1u));
+    glCheck(glVertexAttribPointer(/*      index */ 1u,
+                                  /*       size */ 4,
+                                  /*       type */ GL_UNSIGNED_BYTE,
+                                  /* normalized */ GL_TRUE,
+                                  /*     stride */ sizeof(sf::priv::PackedVertex),
+                                  /*     offset */ SFML_PRIV_OFFSETOF(sf::priv::PackedVertex, color)));
+
+    // Texture coordinates stay in pixels, they are not normalized
+    glCheck(glEnableVertexAttribArray(2u));
+    glCheck(glVertexAttribPointer(/*      index */ 2u,
+                                  /*       size */ 2,
+                                  /*       type */ GL_UNSIGNED_SHORT,
+                                  /* normalized */ GL_FALSE,
+                                  /*     stride */ sizeof(sf::priv::PackedVertex),
+                                  /*     offset */ SFML_PRIV_OFFSETOF(sf::priv::PackedVertex, texCoords)));
+
+#undef SFML_PRIV_OFFSETOF
+}
+
+
+////////////////////////////////////////////////////////////
+void setupVertexAttribPointers(const sf::VertexFormat  format     = sf::VertexFormat::Float32,
+                               const sf::base::SizeT byteOffset = 0u)
+{
+    if (format != sf::VertexFormat::Float32)
+    {
+        setupPackedVertexAttribPointers(format, byteOffset);
+        return;
+    }
+
+#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(byteOffset + SFML_BASE_OFFSETOF(__VA_ARGS__))
 
     // Hardcoded layout location `0u` for `sf_a_position`
     glCheck(glEnableVertexAttribArray(0u));
@@ -227,6 +288,37 @@ void setupVertexAttribPointers()
 }
 
 
+////////////////////////////////////////////////////////////
+void setupSpriteInstanceAttribPointers()
+{
+    const auto setupInstanceAttrib = [](const GLuint          location,
+                                        const GLint           size,
+                                        const GLenum          type,
+                                        const GLboolean       normalized,
+                                        const sf::base::SizeT offset)
+    {
+        glCheck(glEnableVertexAttribArray(location));
+        glCheck(glVertexAttribPointer(/*      index */ location,
+                                      /*       size */ size,
+                                      /*       type */ type,
+                                      /* normalized */ normalized,
+                                      /*     stride */ sizeof(sf::SpriteInstance),
+                                      /*     offset */ reinterpret_cast<const void*>(offset)));
+
+        // Advance once per sprite rather than once per vertex
+        glCheck(glVertexAttribDivisor(location, 1u));
+    };
+
+    // Hardcoded layout locations, see `sf::DefaultShader::srcInstancedSpriteVertex`
+    setupInstanceAttrib(0u, 2, GL_FLOAT, GL_FALSE, SFML_BASE_OFFSETOF(sf::SpriteInstance, position));
+    setupInstanceAttrib(1u, 4, GL_UNSIGNED_BYTE, GL_TRUE, SFML_BASE_OFFSETOF(sf::SpriteInstance, color));
+    setupInstanceAttrib(2u, 4, GL_SHORT, GL_FALSE, SFML_BASE_OFFSETOF(sf::SpriteInstance, textureRect));
+    setupInstanceAttrib(3u, 2, GL_FLOAT, GL_FALSE, SFML_BASE_OFFSETOF(sf::SpriteInstance, scale));
+    setupInstanceAttrib(4u, 2, GL_FLOAT, GL_FALSE, SFML_BASE_OFFSETOF(sf::SpriteInstance, origin));
+    setupInstanceAttrib(5u, 1, GL_FLOAT, GL_FALSE, SFML_BASE_OFFSETOF(sf::SpriteInstance, rotation));
+}
+
+
 ////////////////////////////////////////////////////////////
 constexpr unsigned int precomputedQuadIndices[]{
 #include "SFML/Graphics/PrecomputedQuadIndices.inl"
@@ -340,15 +432,19 @@ struct [[nodiscard]] StatesCache
 struct [[nodiscard]] RenderTarget::Impl
 {
     ////////////////////////////////////////////////////////////
-    View                     view;     //!< Current view
-    StatesCache              cache{};  //!< Render states cache
-    RenderTargetImpl::IdType id{};     //!< Unique number that identifies the render target
-    GLVAOGroup               vaoGroup; //!< Associated VAO, VBO, and EBO (non-persistent storage)
+    View                     view;                    //!< Current view
+    StatesCache              cache{};                 //!< Render states cache
+    RenderTargetImpl::IdType id{};                    //!< Unique number that identifies the render target
+    GLVAOGroup               vaoGroup;                //!< Associated VAO, VBO, and EBO (non-persistent storage)
+    GLVAOGroup               instancedSpriteVaoGroup; //!< VAO and VBO used to stream sprite instances (EBO unused)
 
     ////////////////////////////////////////////////////////////
-    CPUDrawableBatch cpuAutoBatch; //!< Internal CPU autobatch
+    CPUDrawableBatch       cpuAutoBatch;  //!< Internal CPU autobatch
+    base::Vector<base::U8> packingBuffer; //!< CPU batch geometry packed in a compact vertex format
 
-#ifndef SFML_OPENGL_ES
+#ifdef SFML_OPENGL_ES
+    StreamingGPUDrawableBatch streamingAutoBatch; //!< Internal GPU autobatch (no persistent mapping on OpenGL ES)
+#else
     RenderTargetImpl::PersistentGPUAutoBatchState gpuAutoBatchStates[RenderTargetImpl::maxGPUAutoBatchFramesInFlight]{};
     sf::base::SizeT currentGPUAutoBatchIndex{0u}; //!< Cycles `0`, `1`, ..., `maxGPUAutoBatchFramesInFlight - 1`
 
@@ -357,8 +453,85 @@ struct [[nodiscard]] RenderTarget::Impl
     {
         return gpuAutoBatchStates[currentGPUAutoBatchIndex];
     }
+
+    ////////////////////////////////////////////////////////////
+    MultiDrawCommandBuilder<const Texture*> multiDrawCommands{
+        DefaultShader::multiDrawTextureCount}; //!< Texture changes recorded in the current GPU autobatch
+
+    base::Optional<Shader>                     multiDrawShader;              //!< Created on the first multi-draw
+    base::Optional<GLVertexBufferObject>       multiDrawSlotVBO;             //!< Texture slots, one per instance
+    base::Optional<GLDrawIndirectBufferObject> multiDrawIndirectBuffer;      //!< Streamed indirect draw commands
+    bool                                       multiDrawShaderFailed{false}; //!< Fall back to one draw per command
+
+    ////////////////////////////////////////////////////////////
+    void recordMultiDrawCommand(const Texture* const texture)
+    {
+        const auto& [batch, fence, indexOffset, vertexOffset] = currentGPUAutoBatchState();
+        const auto  commands                                  = multiDrawCommands.getCommands();
+
+        // Geometry added since the previous command, or since the last flush
+        const base::SizeT firstIndex = commands.size() == 0u
+                                           ? indexOffset
+                                           : commands[commands.size() - 1u].firstIndex +
+                                                 commands[commands.size() - 1u].count;
+
+        multiDrawCommands.addDraw(texture != nullptr ? texture : &GraphicsContext::getInstalledBuiltInWhiteDotTexture(),
+                                  firstIndex,
+                                  batch.getNumIndices() - firstIndex);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Shader* getOrCreateMultiDrawResources()
+    {
+        if (multiDrawShader.hasValue() || multiDrawShaderFailed) [[likely]]
+            return multiDrawShader.asPtr();
+
+        multiDrawShader       = DefaultShader::createMultiDraw();
+        multiDrawShaderFailed = !multiDrawShader.hasValue();
+
+        if (multiDrawShaderFailed)
+        {
+            priv::err() << "Failed to create the multi-draw shader, falling back to one draw call per texture";
+            return nullptr;
+        }
+
+        // Instance `i` reads slot `i`, commands select their slot with `baseInstance`
+        base::U32 slots[DefaultShader::multiDrawTextureCount];
+        for (base::U32 i = 0u; i < DefaultShader::multiDrawTextureCount; ++i)
+            slots[i] = i;
+
+        multiDrawSlotVBO.emplace();
+        multiDrawSlotVBO->bind();
+        glCheck(glBufferData(GL_ARRAY_BUFFER, sizeof(slots), slots, GL_STATIC_DRAW));
+
+        multiDrawIndirectBuffer.emplace();
+
+        return multiDrawShader.asPtr();
+    }
 #endif
 
+    ////////////////////////////////////////////////////////////
+    bool      autoBatchCulling{false};      //!< Skip auto-batched drawables outside of the view
+    bool      autoBatchCullRectDirty{true}; //!< Must `autoBatchCullRect` be recomputed?
+    Transform autoBatchCullTransform;       //!< Render states transform `autoBatchCullRect` was computed for
+    Rect2f    autoBatchCullRect;            //!< View bounds in the local space of auto-batched geometry
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Rect2f& getAutoBatchCullRect(const Transform& renderStatesTransform)
+    {
+        if (autoBatchCullRectDirty || renderStatesTransform != autoBatchCullTransform) [[unlikely]]
+        {
+            // Map the normalized device coordinates square back to the local space of the geometry
+            const Transform inverse = (view.getTransform() * renderStatesTransform).getInverse();
+
+            autoBatchCullRect      = inverse.transformRect({{-1.f, -1.f}, {2.f, 2.f}});
+            autoBatchCullTransform = renderStatesTransform;
+            autoBatchCullRectDirty = false;
+        }
+
+        return autoBatchCullRect;
+    }
+
     ////////////////////////////////////////////////////////////
     explicit Impl(const View& theView) :
         view(theView),
@@ -386,19 +559,28 @@ auto RenderTarget::addToAutoBatch(auto&&... xs)
 
     const auto addImpl = [&](auto& batch) SFML_BASE_LAMBDA_ALWAYS_INLINE
     {
+        if (m_impl->autoBatchCulling)
+            batch.setCullRect(base::makeOptional(m_impl->getAutoBatchCullRect(m_lastRenderStates.transform)));
+
         const auto prevVertices = batch.getNumVertices();
-        SFML_BASE_SCOPE_GUARD({ m_numAutoBatchVertices += batch.getNumVertices() - prevVertices; });
+        const auto prevCulled   = batch.getNumCulled();
+
+        SFML_BASE_SCOPE_GUARD({
+            m_numAutoBatchVertices += batch.getNumVertices() - prevVertices;
+            m_currentDrawStats.culledDrawables += batch.getNumCulled() - prevCulled;
+        });
 
         return batch.add(SFML_BASE_FORWARD(xs)...);
     };
 
-#ifdef SFML_OPENGL_ES
-    return addImpl(m_impl->cpuAutoBatch);
-#else
     if (m_autoBatchMode == AutoBatchMode::CPUStorage)
         return addImpl(m_impl->cpuAutoBatch);
 
     SFML_BASE_ASSERT(m_autoBatchMode == AutoBatchMode::GPUStorage);
+
+#ifdef SFML_OPENGL_ES
+    return addImpl(m_impl->streamingAutoBatch);
+#else
     return addImpl(m_impl->currentGPUAutoBatchState().batch);
 #endif
 }
@@ -482,8 +664,9 @@ void RenderTarget::setView(const View& view)
 
     flush();
 
-    m_impl->view              = view;
-    m_impl->cache.viewChanged = true;
+    m_impl->view                   = view;
+    m_impl->cache.viewChanged      = true;
+    m_impl->autoBatchCullRectDirty = true;
 }
 
 
@@ -530,6 +713,93 @@ base::SizeT RenderTarget::getAutoBatchVertexThreshold() const
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setAutoBatchVertexFormat(const VertexFormat format)
+{
+    if (m_impl->cpuAutoBatch.getVertexFormat() == format)
+        return;
+
+    flush();
+    m_impl->cpuAutoBatch.setVertexFormat(format);
+
+#ifdef SFML_OPENGL_ES
+    m_impl->streamingAutoBatch.setVertexFormat(format);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+VertexFormat RenderTarget::getAutoBatchVertexFormat() const
+{
+    return m_impl->cpuAutoBatch.getVertexFormat();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setAutoBatchCullingEnabled(const bool enabled)
+{
+    if (m_impl->autoBatchCulling == enabled)
+        return;
+
+    m_impl->autoBatchCulling = enabled;
+
+    // The cull rectangle is only refreshed while culling is enabled
+    if (enabled)
+        return;
+
+    m_impl->cpuAutoBatch.setCullRect(base::nullOpt);
+
+#ifdef SFML_OPENGL_ES
+    m_impl->streamingAutoBatch.setCullRect(base::nullOpt);
+#else
+    for (auto& gpuAutoBatchState : m_impl->gpuAutoBatchStates)
+        gpuAutoBatchState.batch.setCullRect(base::nullOpt);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isAutoBatchCullingEnabled() const
+{
+    return m_impl->autoBatchCulling;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setAutoBatchMultiDrawEnabled(const bool enabled)
+{
+    if (m_autoBatchMultiDraw == enabled)
+        return;
+
+    if (enabled && !isAutoBatchMultiDrawAvailable())
+    {
+        priv::err() << "Multi-draw auto-batching requires OpenGL 4.3 or `GL_ARB_multi_draw_indirect`";
+        return;
+    }
+
+    flush();
+    m_autoBatchMultiDraw = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isAutoBatchMultiDrawEnabled() const
+{
+    return m_autoBatchMultiDraw;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isAutoBatchMultiDrawAvailable()
+{
+#ifdef SFML_OPENGL_ES
+    return false;
+#else
+    return GLAD_GL_VERSION_4_3 || (GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_base_instance);
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////
 Rect2i RenderTarget::getViewport(const View& view) const
 {
@@ -701,6 +971,16 @@ void RenderTarget::draw(const Text& text, RenderStates states)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const TextLogView& textLogView, RenderStates states)
+{
+    states.transform *= textLogView.getTransform();
+
+    for (base::SizeT i = 0u; i < textLogView.getLineCount(); ++i)
+        draw(textLogView.getLine(i), states);
+}
+
+
 ////////////////////////////////////////////////////////////
 struct [[nodiscard]] RenderTarget::DrawGuard
 {
@@ -775,21 +1055,238 @@ void RenderTarget::immediateDrawPersistentMappedIndexedVertices(
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::immediateMultiDrawGPUAutoBatch()
+{
+#ifdef SFML_OPENGL_ES
+    priv::err() << "FATAL ERROR: Multi-draw submission is not available in OpenGL ES";
+    base::abort();
+#else
+    auto& commandBuilder = m_impl->multiDrawCommands;
+    SFML_BASE_SCOPE_GUARD({ commandBuilder.clear(); });
+
+    // Nothing to draw or inactive target
+    if (commandBuilder.isEmpty() || !setActive(true))
+        return;
+
+    const auto& batch       = m_impl->currentGPUAutoBatchState().batch;
+    const auto  commands    = commandBuilder.getCommands();
+    const auto  submissions = commandBuilder.getSubmissions();
+    const auto  textures    = commandBuilder.getTextures();
+
+    const Shader* const multiDrawShader = m_impl->getOrCreateMultiDrawResources();
+
+    // Autobatching compares against the states of the batch, not the ones used to draw it
+    const RenderStates batchRenderStates = m_lastRenderStates;
+    SFML_BASE_SCOPE_GUARD({ m_lastRenderStates = batchRenderStates; });
+
+    // Without the shader, draw each command with the regular path
+    if (multiDrawShader == nullptr) [[unlikely]]
+    {
+        for (const auto& submission : submissions)
+            for (base::SizeT i = submission.firstCommand; i < submission.firstCommand + submission.commandCount; ++i)
+            {
+                RenderStates commandStates = batchRenderStates;
+                commandStates.texture      = textures[submission.firstTexture + commands[i].baseInstance];
+
+                immediateDrawPersistentMappedIndexedVertices({
+                    .gpuDrawableBatch = batch,
+                    .indexCount       = commands[i].count,
+                    .indexOffset      = commands[i].firstIndex,
+                    .vertexOffset     = 0u,
+                    .primitiveType    = PrimitiveType::Triangles,
+                    .renderStates     = commandStates,
+                });
+            }
+
+        return;
+    }
+
+    const auto& vaoGroup = *static_cast<const GLVAOGroup*>(batch.m_storage.getVAOGroup());
+
+    RenderStates multiDrawStates = batchRenderStates;
+    multiDrawStates.texture      = nullptr; // Bound per submission below
+    multiDrawStates.shader       = multiDrawShader;
+
+    // Creating the multi-draw resources may have changed the bound array buffer
+    vaoGroup.vbo.bind();
+
+    const DrawGuard drawGuard{*this, multiDrawStates, vaoGroup};
+
+    // Hardcoded layout location `3u` for `sf_a_textureSlot`, see `sf::DefaultShader::srcMultiDrawVertex`
+    m_impl->multiDrawSlotVBO->bind();
+    glCheck(glEnableVertexAttribArray(3u));
+    glCheck(glVertexAttribIPointer(/*  index */ 3u,
+                                   /*   size */ 1,
+                                   /*   type */ GL_UNSIGNED_INT,
+                                   /* stride */ 0,
+                                   /* offset */ nullptr));
+    glCheck(glVertexAttribDivisor(3u, 1u));
+    vaoGroup.vbo.bind();
+
+    m_impl->multiDrawIndirectBuffer->bind();
+    RenderTargetImpl::streamBytesToGPU(GL_DRAW_INDIRECT_BUFFER,
+                                       commands.data(),
+                                       sizeof(DrawElementsIndirectCommand) * commands.size());
+
+    base::SizeT maxTextureCount = 0u;
+
+    for (const auto& submission : submissions)
+    {
+        for (base::SizeT slot = 0u; slot < submission.textureCount; ++slot)
+        {
+            glCheck(glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(slot)));
+            textures[submission.firstTexture + slot]->bind();
+        }
+
+        maxTextureCount = base::max(maxTextureCount, submission.textureCount);
+
+        m_currentDrawStats.drawCalls += 1u;
+
+        for (base::SizeT i = submission.firstCommand; i < submission.firstCommand + submission.commandCount; ++i)
+            m_currentDrawStats.drawnVertices += commands[i].count;
+
+        const base::SizeT commandsByteOffset = submission.firstCommand * sizeof(DrawElementsIndirectCommand);
+
+        glCheck(glMultiDrawElementsIndirect(/*  primitive type */ GL_TRIANGLES,
+                                            /*      index type */ GL_UNSIGNED_INT,
+                                            /* commands offset */ reinterpret_cast<const void*>(commandsByteOffset),
+                                            /*   command count */ static_cast<GLsizei>(submission.commandCount),
+                                            /*          stride */ 0));
+    }
+
+    glCheck(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0u));
+
+    glCheck(glVertexAttribDivisor(3u, 0u));
+    glCheck(glDisableVertexAttribArray(3u));
+
+    // Only texture unit `0` is used outside of multi-draws
+    for (base::SizeT slot = maxTextureCount; slot-- > 1u;)
+    {
+        glCheck(glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(slot)));
+        Texture::unbind();
+    }
+
+    glCheck(glActiveTexture(GL_TEXTURE0));
+    unapplyTexture();
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::recordAutoBatchTextureChange([[maybe_unused]] const RenderStates& states)
+{
+#ifdef SFML_OPENGL_ES
+    return false;
+#else
+    if (m_autoBatchMode != AutoBatchMode::GPUStorage || states.shader != nullptr)
+        return false;
+
+    RenderStates statesWithLastTexture = states;
+    statesWithLastTexture.texture      = m_lastRenderStates.texture;
+
+    if (statesWithLastTexture != m_lastRenderStates)
+        return false;
+
+    m_impl->recordMultiDrawCommand(m_lastRenderStates.texture);
+    return true;
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::immediateDrawDrawableBatch(const CPUDrawableBatch& drawableBatch, RenderStates states)
 {
-    SFML_BASE_ASSERT(drawableBatch.m_storage.indices.size() % 3u == 0u);
+    const auto& storage = drawableBatch.m_storage;
+    SFML_BASE_ASSERT(storage.indices.size() % 3u == 0u);
 
     states.transform *= drawableBatch.getTransform();
 
-    immediateDrawIndexedVertices({
-        .vertexData    = drawableBatch.m_storage.vertices.data(),
-        .vertexCount   = drawableBatch.m_storage.vertices.size(),
-        .indexData     = drawableBatch.m_storage.indices.data(),
-        .indexCount    = drawableBatch.m_storage.indices.size(),
-        .primitiveType = PrimitiveType::Triangles,
-        .renderStates  = states,
-    });
+    if (storage.vertexFormat == VertexFormat::Float32)
+    {
+        immediateDrawIndexedVertices({
+            .vertexData    = storage.vertices.data(),
+            .vertexCount   = storage.vertices.size(),
+            .indexData     = storage.indices.data(),
+            .indexCount    = storage.indices.size(),
+            .primitiveType = PrimitiveType::Triangles,
+            .renderStates  = states,
+        });
+
+        return;
+    }
+
+    // Nothing to draw or inactive target
+    if (storage.vertices.empty() || storage.indices.empty() || !setActive(true))
+        return;
+
+    const priv::PackedGeometry packed = priv::packGeometry(storage.vertexFormat,
+                                                           storage.vertices.data(),
+                                                           storage.vertices.size(),
+                                                           storage.indices.data(),
+                                                           storage.indices.size(),
+                                                           m_impl->packingBuffer);
+
+    const DrawGuard drawGuard{*this, states, m_impl->vaoGroup};
+
+    RenderTargetImpl::streamBytesToGPU(GL_ARRAY_BUFFER, packed.vertexData, packed.vertexByteCount);
+    RenderTargetImpl::streamBytesToGPU(GL_ELEMENT_ARRAY_BUFFER, packed.indexData, packed.indexByteCount);
+    RenderTargetImpl::setupVertexAttribPointers(storage.vertexFormat);
+
+    invokePrimitiveDrawCallIndexed(PrimitiveType::Triangles,
+                                   storage.indices.size(),
+                                   /* indexOffset */ 0u,
+                                   packed.shortIndices);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::immediateDrawDrawableBatch(const StreamingGPUDrawableBatch& drawableBatch, RenderStates states)
+{
+    const auto& storage = drawableBatch.m_storage;
+    SFML_BASE_ASSERT(storage.indices.size() % 3u == 0u);
+
+    // Nothing to draw or inactive target
+    if (storage.vertices.empty() || storage.indices.empty() || !setActive(true))
+        return;
+
+    states.transform *= drawableBatch.getTransform();
+
+    const DrawGuard drawGuard{*this, states, *static_cast<const GLVAOGroup*>(storage.acquireVAOGroup())};
+
+    const auto [vertexByteOffset, indexOffset, shortIndices] = storage.uploadToGPU();
+
+    // Base vertex is not available on OpenGL ES, point the attributes at the first vertex instead
+    RenderTargetImpl::setupVertexAttribPointers(storage.vertexFormat, vertexByteOffset);
+
+    invokePrimitiveDrawCallIndexed(PrimitiveType::Triangles, storage.indices.size(), indexOffset, shortIndices);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::immediateDrawSpriteInstances(const GLVAOGroup& vaoGroup,
+                                                const void* const instanceData,
+                                                const base::SizeT instanceCount,
+                                                RenderStates      states)
+{
+    SFML_BASE_ASSERT(states.texture != nullptr);
+
+    // Nothing to draw or inactive target
+    if (instanceCount == 0u || !setActive(true))
+        return;
+
+    if (states.shader == nullptr)
+        states.shader = &GraphicsContext::getInstalledBuiltInInstancedSpriteShader();
+
+    const DrawGuard drawGuard{*this, states, vaoGroup};
+
+    if (instanceData != nullptr)
+        RenderTargetImpl::streamBytesToGPU(GL_ARRAY_BUFFER, instanceData, sizeof(SpriteInstance) * instanceCount);
+
+    RenderTargetImpl::setupSpriteInstanceAttribPointers();
+
+    // Quad corners are derived from `gl_VertexID` in the shader, there is no per-vertex data
+    invokeInstancedPrimitiveDrawCall(PrimitiveType::TriangleStrip, 0u, 4u, instanceCount);
 }
 
 
@@ -931,6 +1428,77 @@ void RenderTarget::draw(const PersistentGPUDrawableBatch& drawableBatch, RenderS
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const StreamingGPUDrawableBatch& drawableBatch, const RenderStates& states)
+{
+    if (m_autoBatchMode != AutoBatchMode::Disabled)
+        flush();
+
+    immediateDrawDrawableBatch(drawableBatch, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const CPUInstancedSpriteBatch& spriteBatch, RenderStates states)
+{
+    if (m_autoBatchMode != AutoBatchMode::Disabled)
+        flush();
+
+    states.transform *= spriteBatch.getTransform();
+
+    const auto& storage = spriteBatch.m_storage;
+    immediateDrawSpriteInstances(m_impl->instancedSpriteVaoGroup,
+                                 storage.instances.data(),
+                                 storage.instances.size(),
+                                 states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const PersistentGPUInstancedSpriteBatch& spriteBatch, RenderStates states)
+{
+    if (m_autoBatchMode != AutoBatchMode::Disabled)
+        flush();
+
+    const auto& storage = spriteBatch.m_storage;
+
+    if (storage.getNumInstances() == 0u)
+        return;
+
+    states.transform *= spriteBatch.getTransform();
+
+    storage.flushWritesToGPU(storage.getNumInstances(), 0u);
+
+    immediateDrawSpriteInstances(*static_cast<const GLVAOGroup*>(storage.getVAOGroup()),
+                                 /* instanceData */ nullptr,
+                                 storage.getNumInstances(),
+                                 states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const RetainedBatch& retainedBatch, RenderStates states)
+{
+    if (m_autoBatchMode != AutoBatchMode::Disabled)
+        flush();
+
+    // Nothing to draw or inactive target
+    if (retainedBatch.getNumIndices() == 0u || !setActive(true))
+        return;
+
+    states.transform *= retainedBatch.getTransform();
+
+    const DrawGuard drawGuard{*this, states, *static_cast<const GLVAOGroup*>(retainedBatch.getVAOGroup())};
+
+    retainedBatch.uploadToGPU();
+
+    invokePrimitiveDrawCallIndexed(PrimitiveType::Triangles,
+                                   retainedBatch.getNumIndices(),
+                                   /* indexOffset */ 0u,
+                                   /* shortIndices */ false);
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
 {
@@ -1228,13 +1796,6 @@ RenderTarget::DrawStatistics RenderTarget::flush()
     if (m_autoBatchMode == AutoBatchMode::Disabled)
         return m_currentDrawStats;
 
-#ifdef SFML_OPENGL_ES
-
-    immediateDrawDrawableBatch(m_impl->cpuAutoBatch, m_lastRenderStates);
-    m_impl->cpuAutoBatch.clear();
-
-#else
-
     if (m_autoBatchMode == AutoBatchMode::CPUStorage)
     {
         immediateDrawDrawableBatch(m_impl->cpuAutoBatch, m_lastRenderStates);
@@ -1244,6 +1805,13 @@ RenderTarget::DrawStatistics RenderTarget::flush()
     {
         SFML_BASE_ASSERT(m_autoBatchMode == AutoBatchMode::GPUStorage);
 
+#ifdef SFML_OPENGL_ES
+
+        immediateDrawDrawableBatch(m_impl->streamingAutoBatch, m_lastRenderStates);
+        m_impl->streamingAutoBatch.clear();
+
+#else
+
         auto& [batch, fence, indexOffset, vertexOffset] = m_impl->currentGPUAutoBatchState();
 
         const auto vertexCount = batch.getNumVertices() - vertexOffset;
@@ -1255,20 +1823,29 @@ RenderTarget::DrawStatistics RenderTarget::flush()
         batch.flushVertexWritesToGPU(vertexCount, vertexOffset);
         batch.flushIndexWritesToGPU(indexCount, indexOffset);
 
-        immediateDrawPersistentMappedIndexedVertices({
-            .gpuDrawableBatch = batch,
-            .indexCount       = indexCount,
-            .indexOffset      = indexOffset,
-            .vertexOffset     = 0u, // Vertex offset is always `0` for GPU autobatching
-            .primitiveType    = PrimitiveType::Triangles,
-            .renderStates     = m_lastRenderStates,
-        });
+        if (m_impl->multiDrawCommands.isEmpty())
+        {
+            immediateDrawPersistentMappedIndexedVertices({
+                .gpuDrawableBatch = batch,
+                .indexCount       = indexCount,
+                .indexOffset      = indexOffset,
+                .vertexOffset     = 0u, // Vertex offset is always `0` for GPU autobatching
+                .primitiveType    = PrimitiveType::Triangles,
+                .renderStates     = m_lastRenderStates,
+            });
+        }
+        else
+        {
+            // The geometry drawn with the current texture becomes the last command
+            m_impl->recordMultiDrawCommand(m_lastRenderStates.texture);
+            immediateMultiDrawGPUAutoBatch();
+        }
 
         indexOffset  = batch.getNumIndices();
         vertexOffset = batch.getNumVertices();
-    }
 
 #endif
+    }
 
     return m_currentDrawStats;
 }
@@ -1467,6 +2044,11 @@ void RenderTarget::setupDraw(const GLVAOGroup& vaoGroup, const RenderStates& sta
         usedShader.bind();
         m_impl->cache.lastProgramId = usedNativeHandle;
     }
+    else
+    {
+        // Uniforms may have been set since the shader was bound
+        usedShader.applyPendingUniforms();
+    }
 
     // Apply the view
     const bool viewChanged = !m_impl->cache.enable || m_impl->cache.viewChanged;
@@ -1586,15 +2168,20 @@ void RenderTarget::invokePrimitiveDrawCall(const PrimitiveType type, const base:
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::invokePrimitiveDrawCallIndexed(const PrimitiveType type, const base::SizeT indexCount, const base::SizeT indexOffset)
+void RenderTarget::invokePrimitiveDrawCallIndexed(const PrimitiveType type,
+                                                  const base::SizeT   indexCount,
+                                                  const base::SizeT   indexOffset,
+                                                  const bool          shortIndices)
 {
     m_currentDrawStats.drawCalls += 1u;
     m_currentDrawStats.drawnVertices += indexCount;
 
+    const base::SizeT indexSize = shortIndices ? sizeof(base::U16) : sizeof(IndexType);
+
     glCheck(glDrawElements(/* primitive type */ RenderTargetImpl::primitiveTypeToOpenGLMode(type),
                            /*    index count */ static_cast<GLsizei>(indexCount),
-                           /*     index type */ GL_UNSIGNED_INT,
-                           /*   index offset */ reinterpret_cast<void*>(indexOffset * sizeof(IndexType))));
+                           /*     index type */ shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT,
+                           /*   index offset */ reinterpret_cast<void*>(indexOffset * indexSize)));
 }
 
 
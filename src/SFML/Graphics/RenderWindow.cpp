@@ -131,6 +131,22 @@ base::Optional<Event> RenderWindow::pollEvent()
 }
 
 
+////////////////////////////////////////////////////////////
+base::Span<const Event> RenderWindow::pollEvents(const EventCoalescing coalescing)
+{
+    const base::Span<const Event> events = WindowBase::pollEvents(coalescing);
+
+    for (const Event& event : events)
+        if (event.getIf<Event::Resized>())
+        {
+            onResize();
+            break;
+        }
+
+    return events;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<Event> RenderWindow::waitEvent(Time timeout)
 {
@@ -0,0 +1,399 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/RetainedBatch.hpp"
+
+#include "SFML/Graphics/DrawableBatch.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/GLUtils/GLCheck.hpp"
+#include "SFML/GLUtils/GLVAOGroup.hpp"
+#include "SFML/GLUtils/Glad.hpp"
+
+#include "SFML/Base/Algorithm/Sort.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct RetainedBatch::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct Range
+    {
+        base::SizeT begin; //!< First element of the range
+        base::SizeT end;   //!< One past the last element of the range
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct GPUBuffer
+    {
+        base::SizeT         capacity{};  //!< Number of elements allocated on the GPU
+        base::Vector<Range> dirtyRanges; //!< Ranges modified since the last upload
+
+        ////////////////////////////////////////////////////////////
+        void markDirty(const base::SizeT begin, const base::SizeT end)
+        {
+            // Consecutive writes are common (e.g. adding drawables in a loop), extend the last range
+            if (!dirtyRanges.empty() && begin <= dirtyRanges.back().end && end >= dirtyRanges.back().begin)
+            {
+                dirtyRanges.back().begin = SFML_BASE_MIN(dirtyRanges.back().begin, begin);
+                dirtyRanges.back().end   = SFML_BASE_MAX(dirtyRanges.back().end, end);
+                return;
+            }
+
+            dirtyRanges.pushBack({begin, end});
+        }
+
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::SizeT getPendingElementCount(const base::SizeT size) const
+        {
+            if (size > capacity)
+                return size;
+
+            base::SizeT count = 0u;
+
+            for (const Range& range : dirtyRanges)
+                count += range.end - range.begin;
+
+            return count;
+        }
+
+        ////////////////////////////////////////////////////////////
+        template <typename TBufferObject, typename T>
+        void upload(const TBufferObject& bufferObject, const base::Vector<T>& data)
+        {
+            // Small gaps are cheaper to re-upload than to issue separate calls for
+            constexpr base::SizeT mergeGap = 64u;
+
+            if (dirtyRanges.empty() && data.size() <= capacity)
+                return;
+
+            bufferObject.bind();
+
+            if (data.size() > capacity)
+            {
+                capacity = SFML_BASE_MAX(data.size(), capacity + capacity / 2u);
+
+                glCheck(glBufferData(TBufferObject::bufferType,
+                                     static_cast<GLsizeiptr>(sizeof(T) * capacity),
+                                     nullptr,
+                                     GL_STATIC_DRAW));
+
+                glCheck(glBufferSubData(TBufferObject::bufferType,
+                                        0,
+                                        static_cast<GLsizeiptr>(sizeof(T) * data.size()),
+                                        data.data()));
+
+                dirtyRanges.clear();
+                return;
+            }
+
+            base::quickSort(dirtyRanges.begin(),
+                            dirtyRanges.end(),
+                            [](const Range& a, const Range& b) { return a.begin < b.begin; });
+
+            const auto uploadRange = [&](const Range& range)
+            {
+                glCheck(glBufferSubData(TBufferObject::bufferType,
+                                        static_cast<GLintptr>(sizeof(T) * range.begin),
+                                        static_cast<GLsizeiptr>(sizeof(T) * (range.end - range.begin)),
+                                        data.data() + range.begin));
+            };
+
+            Range merged = dirtyRanges[0];
+
+            for (base::SizeT i = 1u; i < dirtyRanges.size(); ++i)
+            {
+                if (dirtyRanges[i].begin <= merged.end + mergeGap)
+                {
+                    merged.end = SFML_BASE_MAX(merged.end, dirtyRanges[i].end);
+                    continue;
+                }
+
+                uploadRange(merged);
+                merged = dirtyRanges[i];
+            }
+
+            uploadRange(merged);
+            dirtyRanges.clear();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GLVAOGroup vaoGroup;     //!< VAO, VBO, and EBO associated with the batch
+    GPUBuffer  vertexBuffer; //!< State of the VBO
+    GPUBuffer  indexBuffer;  //!< State of the EBO
+};
+
+
+////////////////////////////////////////////////////////////
+RetainedBatch::RetainedBatch()                                    = default;
+RetainedBatch::~RetainedBatch()                                   = default;
+RetainedBatch::RetainedBatch(RetainedBatch&&) noexcept            = default;
+RetainedBatch& RetainedBatch::operator=(RetainedBatch&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::remove(const Handle handle)
+{
+    SFML_BASE_ASSERT(contains(handle));
+
+    Item& item = m_items[handle.index];
+
+    eraseItemIndices(item);
+
+    item.alive = false;
+    ++item.generation;
+
+    m_freeItems.pushBack(handle.index);
+    --m_numDrawables;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RetainedBatch::contains(const Handle handle) const
+{
+    return handle.index < m_items.size() && m_items[handle.index].alive &&
+           m_items[handle.index].generation == handle.generation;
+}
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::clear()
+{
+    // New items start past all existing generations, so that handles to the old items cannot alias them
+    for (const Item& item : m_items)
+        m_baseGeneration = SFML_BASE_MAX(m_baseGeneration, item.generation + 1u);
+
+    m_vertices.clear();
+    m_indices.clear();
+    m_items.clear();
+    m_freeItems.clear();
+    m_numDrawables = 0u;
+
+    m_impl->vertexBuffer.dirtyRanges.clear();
+    m_impl->indexBuffer.dirtyRanges.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RetainedBatch::getNumDrawables() const
+{
+    return m_numDrawables;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RetainedBatch::getNumVertices() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RetainedBatch::getNumIndices() const
+{
+    return m_indices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RetainedBatch::getPendingUploadByteCount() const
+{
+    return m_impl->vertexBuffer.getPendingElementCount(m_vertices.size()) * sizeof(Vertex) +
+           m_impl->indexBuffer.getPendingElementCount(m_indices.size()) * sizeof(IndexType);
+}
+
+
+////////////////////////////////////////////////////////////
+RetainedBatch::Handle RetainedBatch::addFromScratchBatch()
+{
+    const base::SizeT vertexCount = m_scratchBatch.m_storage.vertices.size();
+    const base::SizeT indexCount  = m_scratchBatch.m_storage.indices.size();
+
+    base::U32 itemIndex{};
+
+    if (const base::SizeT freePos = findFreeItem(vertexCount, indexCount); freePos != m_freeItems.size())
+    {
+        itemIndex = m_freeItems[freePos];
+
+        m_freeItems[freePos] = m_freeItems.back();
+        m_freeItems.popBack();
+    }
+    else
+    {
+        itemIndex = static_cast<base::U32>(m_items.size());
+        m_items.pushBack(appendItemStorage(vertexCount, indexCount));
+    }
+
+    Item& item = m_items[itemIndex];
+    item.alive = true;
+
+    writeItem(item);
+    ++m_numDrawables;
+
+    return {itemIndex, item.generation};
+}
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::updateFromScratchBatch(const Handle handle)
+{
+    SFML_BASE_ASSERT(contains(handle));
+
+    const base::SizeT vertexCount = m_scratchBatch.m_storage.vertices.size();
+    const base::SizeT indexCount  = m_scratchBatch.m_storage.indices.size();
+
+    {
+        const Item& item = m_items[handle.index];
+
+        if (vertexCount <= item.vertexCapacity && indexCount <= item.indexCapacity)
+        {
+            writeItem(item);
+            return;
+        }
+    }
+
+    // Relocate: the old space becomes a free item, the drawable keeps its handle
+    eraseItemIndices(m_items[handle.index]);
+
+    Item newStorage{};
+
+    if (const base::SizeT freePos = findFreeItem(vertexCount, indexCount); freePos != m_freeItems.size())
+    {
+        Item& freeItem = m_items[m_freeItems[freePos]];
+        newStorage     = freeItem;
+
+        freeItem.vertexOffset   = m_items[handle.index].vertexOffset;
+        freeItem.vertexCapacity = m_items[handle.index].vertexCapacity;
+        freeItem.indexOffset    = m_items[handle.index].indexOffset;
+        freeItem.indexCapacity  = m_items[handle.index].indexCapacity;
+    }
+    else
+    {
+        newStorage = appendItemStorage(vertexCount, indexCount);
+
+        Item oldStorage       = m_items[handle.index];
+        oldStorage.alive      = false;
+        oldStorage.generation = m_baseGeneration;
+
+        m_freeItems.pushBack(static_cast<base::U32>(m_items.size()));
+        m_items.pushBack(oldStorage);
+    }
+
+    Item& item          = m_items[handle.index];
+    item.vertexOffset   = newStorage.vertexOffset;
+    item.vertexCapacity = newStorage.vertexCapacity;
+    item.indexOffset    = newStorage.indexOffset;
+    item.indexCapacity  = newStorage.indexCapacity;
+
+    writeItem(item);
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RetainedBatch::findFreeItem(const base::SizeT vertexCount, const base::SizeT indexCount) const
+{
+    for (base::SizeT i = 0u; i < m_freeItems.size(); ++i)
+    {
+        const Item& item = m_items[m_freeItems[i]];
+
+        if (vertexCount <= item.vertexCapacity && indexCount <= item.indexCapacity)
+            return i;
+    }
+
+    return m_freeItems.size();
+}
+
+
+////////////////////////////////////////////////////////////
+RetainedBatch::Item RetainedBatch::appendItemStorage(const base::SizeT vertexCount, const base::SizeT indexCount)
+{
+    const Item item{.vertexOffset   = m_vertices.size(),
+                    .vertexCapacity = vertexCount,
+                    .indexOffset    = m_indices.size(),
+                    .indexCapacity  = indexCount,
+                    .generation     = m_baseGeneration,
+                    .alive          = false};
+
+    m_vertices.resize(m_vertices.size() + vertexCount);
+    m_indices.resize(m_indices.size() + indexCount);
+
+    return item;
+}
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::writeItem(const Item& item)
+{
+    const auto& scratchVertices = m_scratchBatch.m_storage.vertices;
+    const auto& scratchIndices  = m_scratchBatch.m_storage.indices;
+
+    SFML_BASE_ASSERT(scratchVertices.size() <= item.vertexCapacity);
+    SFML_BASE_ASSERT(scratchIndices.size() <= item.indexCapacity);
+
+    Vertex* const vertices = m_vertices.data() + item.vertexOffset;
+
+    for (base::SizeT i = 0u; i < scratchVertices.size(); ++i)
+        vertices[i] = scratchVertices[i];
+
+    // Scratch indices start from zero, rebase them on the vertices of the item
+    IndexType* const indices    = m_indices.data() + item.indexOffset;
+    const auto       baseVertex = static_cast<IndexType>(item.vertexOffset);
+
+    for (base::SizeT i = 0u; i < scratchIndices.size(); ++i)
+        indices[i] = baseVertex + scratchIndices[i];
+
+    // Unused capacity is filled with degenerate triangles
+    for (base::SizeT i = scratchIndices.size(); i < item.indexCapacity; ++i)
+        indices[i] = baseVertex;
+
+    if (!scratchVertices.empty())
+        m_impl->vertexBuffer.markDirty(item.vertexOffset, item.vertexOffset + scratchVertices.size());
+
+    if (item.indexCapacity > 0u)
+        m_impl->indexBuffer.markDirty(item.indexOffset, item.indexOffset + item.indexCapacity);
+}
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::eraseItemIndices(const Item& item)
+{
+    IndexType* const indices    = m_indices.data() + item.indexOffset;
+    const auto       baseVertex = static_cast<IndexType>(item.vertexOffset);
+
+    for (base::SizeT i = 0u; i < item.indexCapacity; ++i)
+        indices[i] = baseVertex;
+
+    if (item.indexCapacity > 0u)
+        m_impl->indexBuffer.markDirty(item.indexOffset, item.indexOffset + item.indexCapacity);
+}
+
+
+////////////////////////////////////////////////////////////
+const void* RetainedBatch::getVAOGroup() const
+{
+    return &m_impl->vaoGroup;
+}
+
+
+////////////////////////////////////////////////////////////
+void RetainedBatch::uploadToGPU() const
+{
+    m_impl->vertexBuffer.upload(m_impl->vaoGroup.vbo, m_vertices);
+    m_impl->indexBuffer.upload(m_impl->vaoGroup.ebo, m_indices);
+}
+
+} // namespace sf
@@ -13,11 +13,14 @@
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Texture.hpp"
 
+#include "SFML/GLUtils/GLBufferObject.hpp"
 #include "SFML/GLUtils/GLCheck.hpp"
 #include "SFML/GLUtils/GLSharedContextGuard.hpp"
 #include "SFML/GLUtils/GLUtils.hpp"
 #include "SFML/GLUtils/Glad.hpp"
 
+#include "SFML/Window/WindowContext.hpp"
+
 #include "SFML/System/Err.hpp"
 #include "SFML/System/IO.hpp"
 #include "SFML/System/InputStream.hpp"
@@ -28,9 +31,14 @@
 
 #include "SFML/Base/AnkerlUnorderedDense.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memcmp.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/Builtin/Strlen.hpp"
 #include "SFML/Base/Exchange.hpp"
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PtrDiffT.hpp"
 #include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/StringView.hpp"
 #include "SFML/Base/Vector.hpp"
@@ -64,6 +72,125 @@ namespace
 }
 
 
+////////////////////////////////////////////////////////////
+// Retrieve the maximum number of uniform buffer binding points available
+[[nodiscard]] sf::base::SizeT getMaxUniformBufferBindings()
+{
+    static const auto maxBindings = static_cast<sf::base::SizeT>(
+        sf::priv::getGLInteger(GL_MAX_UNIFORM_BUFFER_BINDINGS));
+    return maxBindings;
+}
+
+
+////////////////////////////////////////////////////////////
+using UniformBufferObjectFuncs = sf::priv::GLBufferObjectFuncs<GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING>;
+
+
+////////////////////////////////////////////////////////////
+// GLSL type of a shadowed uniform
+enum class [[nodiscard]] UniformType : unsigned char
+{
+    Float1,
+    Float2,
+    Float3,
+    Float4,
+    Int1,
+    Int2,
+    Int3,
+    Int4,
+    Mat3,
+    Mat4
+};
+
+
+////////////////////////////////////////////////////////////
+// CPU-side copy of the value of a uniform, uploaded lazily when the program is bound
+struct [[nodiscard]] UniformShadow
+{
+    sf::base::U32 bits[16]; //!< Raw value (floats or ints, depending on `type`)
+    UniformType   type;     //!< Type of the value
+    bool          dirty;    //!< Has the value changed since the last upload?
+};
+
+
+////////////////////////////////////////////////////////////
+// Upload a shadowed uniform value, the program must be currently bound
+void uploadUniform(const int location, const UniformShadow& shadow)
+{
+    float floats[16];
+    int   ints[4];
+
+    if (shadow.type >= UniformType::Int1 && shadow.type <= UniformType::Int4)
+        SFML_BASE_MEMCPY(ints, shadow.bits, sizeof(ints));
+    else
+        SFML_BASE_MEMCPY(floats, shadow.bits, sizeof(floats));
+
+    switch (shadow.type)
+    {
+        // clang-format off
+        case UniformType::Float1: glCheck(glUniform1f(location, floats[0]));                                  break;
+        case UniformType::Float2: glCheck(glUniform2f(location, floats[0], floats[1]));                       break;
+        case UniformType::Float3: glCheck(glUniform3f(location, floats[0], floats[1], floats[2]));            break;
+        case UniformType::Float4: glCheck(glUniform4f(location, floats[0], floats[1], floats[2], floats[3])); break;
+        case UniformType::Int1:   glCheck(glUniform1i(location, ints[0]));                                    break;
+        case UniformType::Int2:   glCheck(glUniform2i(location, ints[0], ints[1]));                           break;
+        case UniformType::Int3:   glCheck(glUniform3i(location, ints[0], ints[1], ints[2]));                  break;
+        case UniformType::Int4:   glCheck(glUniform4i(location, ints[0], ints[1], ints[2], ints[3]));         break;
+        case UniformType::Mat3:   glCheck(glUniformMatrix3fv(location, 1, GL_FALSE, floats));                 break;
+        case UniformType::Mat4:   glCheck(glUniformMatrix4fv(location, 1, GL_FALSE, floats));                 break;
+        // clang-format on
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// CPU-side copy of the values of an array uniform, uploaded lazily when the program is bound
+struct [[nodiscard]] UniformArrayShadow
+{
+    sf::base::Vector<float> values; //!< Flattened elements of the array
+    UniformType             type;   //!< Type of each element (float vector or matrix)
+    bool                    dirty;  //!< Has the value changed since the last upload?
+};
+
+
+////////////////////////////////////////////////////////////
+// Upload a shadowed array uniform, the program must be currently bound
+void uploadUniformArray(const int location, const UniformArrayShadow& shadow)
+{
+    const float* const data = shadow.values.data();
+    const auto         size = static_cast<GLsizei>(shadow.values.size());
+
+    switch (shadow.type)
+    {
+        // clang-format off
+        case UniformType::Float1: glCheck(glUniform1fv(location, size, data));                       break;
+        case UniformType::Float2: glCheck(glUniform2fv(location, size / 2, data));                   break;
+        case UniformType::Float3: glCheck(glUniform3fv(location, size / 3, data));                   break;
+        case UniformType::Float4: glCheck(glUniform4fv(location, size / 4, data));                   break;
+        case UniformType::Mat3:   glCheck(glUniformMatrix3fv(location, size / 9, GL_FALSE, data));  break;
+        case UniformType::Mat4:   glCheck(glUniformMatrix4fv(location, size / 16, GL_FALSE, data)); break;
+        // clang-format on
+
+        case UniformType::Int1:
+        case UniformType::Int2:
+        case UniformType::Int3:
+        case UniformType::Int4:
+            SFML_BASE_ASSERT(false && "Integer array uniforms are not supported");
+            break;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Association between a uniform block of a program and the buffer backing it
+struct [[nodiscard]] UniformBlockBinding
+{
+    unsigned int blockIndex; //!< Index of the uniform block in the program
+    unsigned int buffer;     //!< Uniform buffer object assigned to the block
+    bool         dirty;      //!< Whether the buffer changed since the binding point was last bound
+};
+
+
 ////////////////////////////////////////////////////////////
 // Pair of indices into thread-local buffer
 struct [[nodiscard]] BufferSlice
@@ -214,13 +341,12 @@ struct [[nodiscard]] BufferSlice
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard]] sf::base::StringView adjustPreamble(sf::base::StringView src)
-{
-    constexpr sf::base::StringView preamble{
+// `#version` (and float precision if required) prepended to all shader sources
+constexpr sf::base::StringView shaderPreamble{
 #if defined(SFML_SYSTEM_EMSCRIPTEN)
 
-        // Emscripten/WebGL always requires `#version 300 es` and precision
-        R"glsl(#version 300 es
+    // Emscripten/WebGL always requires `#version 300 es` and precision
+    R"glsl(#version 300 es
 
 precision highp float;
 
@@ -228,8 +354,8 @@ precision highp float;
 
 #elif defined(SFML_OPENGL_ES)
 
-        // Desktop/mobile GLES can use `#version 310 es` and precision
-        R"glsl(#version 310 es
+    // Desktop/mobile GLES can use `#version 310 es` and precision
+    R"glsl(#version 310 es
 
 precision highp float;
 
@@ -237,18 +363,22 @@ precision highp float;
 
 #else
 
-        // Desktop GL can use `#version 430 core`
-        R"glsl(#version 430 core
+    // Desktop GL can use `#version 430 core`
+    R"glsl(#version 430 core
 
 )glsl"
 
 #endif
-    };
+};
 
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::StringView adjustPreamble(sf::base::StringView src)
+{
     static thread_local sf::base::Vector<char> buffer; // Cannot reuse the other buffer here
     buffer.clear();
 
-    buffer.emplaceRange(preamble.data(), preamble.size() - 1);
+    buffer.emplaceRange(shaderPreamble.data(), shaderPreamble.size() - 1);
     buffer.emplaceRange(src.data(), src.size() - 1);
 
     return {buffer.data(), buffer.size()};
@@ -280,6 +410,175 @@ void printLinesWithNumbers(auto& os, sf::base::StringView text)
 }
 
 
+////////////////////////////////////////////////////////////
+// From `KHR_parallel_shader_compile`, not exposed by the loader
+constexpr GLenum completionStatusKHR = 0x91'B1;
+
+
+////////////////////////////////////////////////////////////
+// Magic number at the beginning of program binary cache files ("SFPB")
+constexpr sf::base::U32 programBinaryMagic = 0x42'50'46'53u;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isProgramBinaryAvailable()
+{
+    return sf::priv::getGLInteger(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+// Program binaries are driver-specific, so the driver is part of the cache key, along with the complete sources
+[[nodiscard]] sf::Path getProgramBinaryCachePath(const sf::Path&              directory,
+                                                 const sf::base::StringView vertexShaderCode,
+                                                 const sf::base::StringView geometryShaderCode,
+                                                 const sf::base::StringView fragmentShaderCode)
+{
+    namespace wyhash = ankerl::unordered_dense::detail::wyhash;
+
+    sf::base::U64 key = 0u;
+
+    const auto combine = [&key](const void* data, const sf::base::SizeT size)
+    { key = wyhash::hash(key ^ wyhash::hash(data, size)); };
+
+    combine(shaderPreamble.data(), shaderPreamble.size());
+    combine(vertexShaderCode.data(), vertexShaderCode.size());
+    combine(geometryShaderCode.data(), geometryShaderCode.size());
+    combine(fragmentShaderCode.data(), fragmentShaderCode.size());
+
+    const auto combineGLString = [&](const GLenum name)
+    {
+        const auto* str = reinterpret_cast<const char*>(glCheck(glGetString(name)));
+        combine(str, str == nullptr ? 0u : SFML_BASE_STRLEN(str));
+    };
+
+    combineGLString(GL_VENDOR);
+    combineGLString(GL_RENDERER);
+    combineGLString(GL_VERSION);
+
+    char fileName[]{"0000000000000000.glbin"};
+
+    for (int i = 15; i >= 0; --i, key >>= 4u)
+        fileName[i] = "0123456789abcdef"[key & 0xFu];
+
+    return directory / fileName;
+}
+
+
+////////////////////////////////////////////////////////////
+// Returns a linked program, or zero if the cache file is missing or stale
+[[nodiscard]] GLhandle loadProgramBinary(const sf::Path& cachePath)
+{
+    sf::InFileStream file(cachePath, sf::FileOpenMode::bin);
+
+    if (!file)
+        return 0u;
+
+    constexpr auto headerSize = static_cast<sf::base::PtrDiffT>(sizeof(sf::base::U32) * 2u);
+
+    file.seekg(0, sf::SeekDir::end);
+    const auto size = file.tellg();
+
+    if (size <= headerSize)
+        return 0u;
+
+    sf::base::Vector<char> contents(static_cast<sf::base::SizeT>(size));
+
+    file.seekg(0, sf::SeekDir::beg);
+    file.read(contents.data(), size);
+
+    if (file.gcount() != size)
+        return 0u;
+
+    sf::base::U32 header[2]{};
+    SFML_BASE_MEMCPY(header, contents.data(), sizeof(header));
+
+    if (header[0] != programBinaryMagic)
+        return 0u;
+
+    const GLhandle program = glCheck(glCreateProgram());
+
+    glCheck(glProgramBinary(program,
+                            static_cast<GLenum>(header[1]),
+                            contents.data() + headerSize,
+                            static_cast<GLsizei>(size - headerSize)));
+
+    // The driver can reject binaries it produced, e.g. after an update
+    GLint success = GL_FALSE;
+    glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+
+    if (success == GL_FALSE)
+    {
+        glCheck(glDeleteProgram(program));
+        return 0u;
+    }
+
+    return program;
+}
+
+
+////////////////////////////////////////////////////////////
+void saveProgramBinary(const GLhandle program, const sf::Path& cachePath)
+{
+    GLint length = 0;
+    glCheck(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length));
+
+    if (length <= 0)
+        return;
+
+    constexpr sf::base::SizeT headerSize = sizeof(sf::base::U32) * 2u;
+    sf::base::Vector<char>    contents(headerSize + static_cast<sf::base::SizeT>(length));
+
+    GLenum  format  = 0u;
+    GLsizei written = 0;
+    glCheck(glGetProgramBinary(program, length, &written, &format, contents.data() + headerSize));
+
+    if (written <= 0)
+        return;
+
+    const sf::base::U32 header[2]{programBinaryMagic, static_cast<sf::base::U32>(format)};
+    SFML_BASE_MEMCPY(contents.data(), header, sizeof(header));
+
+    sf::OutFileStream file(cachePath, sf::FileOpenMode::bin | sf::FileOpenMode::out | sf::FileOpenMode::trunc);
+
+    if (!file)
+    {
+        sf::priv::err() << "Failed to write program binary cache file\n" << sf::priv::PathDebugFormatter{cachePath};
+        return;
+    }
+
+    file.write(contents.data(), static_cast<sf::base::PtrDiffT>(headerSize) + written);
+}
+
+
+////////////////////////////////////////////////////////////
+// Used when the status checks were deferred, so the sources are not available anymore
+void printProgramErrors(const GLhandle program)
+{
+    // Shaders flagged for deletion stay alive while attached, and keep their compile log
+    GLhandle shaders[3]{};
+    GLsizei  shaderCount = 0;
+    glCheck(glGetAttachedShaders(program, 3, &shaderCount, shaders));
+
+    char log[1024]{};
+
+    for (GLsizei i = 0; i < shaderCount; ++i)
+    {
+        GLint success = GL_FALSE;
+        glCheck(glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &success));
+
+        if (success != GL_FALSE)
+            continue;
+
+        glCheck(glGetShaderInfoLog(shaders[i], sizeof(log), nullptr, log));
+        sf::priv::err() << "Failed to compile shader:" << '\n' << static_cast<const char*>(log);
+    }
+
+    glCheck(glGetProgramInfoLog(program, sizeof(log), nullptr, log));
+    sf::priv::err() << "Failed to link shader:" << '\n' << static_cast<const char*>(log);
+}
+
+
 ////////////////////////////////////////////////////////////
 void destroyProgramIfNeeded(const unsigned int program)
 {
@@ -308,6 +607,20 @@ struct Shader::Impl
     // TODO P1: protect with mutex? Change API?
     mutable ankerl::unordered_dense::map<int, const Texture*> textures; //!< Texture variables in the shader, mapped to their location
 
+    mutable ankerl::unordered_dense::map<int, UniformShadow> uniforms; //!< Shadowed uniform values, mapped to their location
+    mutable base::Vector<base::SizeT> dirtyUniforms; //!< Indices into `uniforms` of the values awaiting upload
+
+    mutable ankerl::unordered_dense::map<int, UniformArrayShadow> uniformArrays; //!< Shadowed array uniforms, by location
+    mutable base::Vector<base::SizeT> dirtyUniformArrays; //!< Indices into `uniformArrays` awaiting upload
+
+    mutable base::Vector<UniformBlockBinding> uniformBlocks; //!< Uniform blocks in the shader, indexed by binding point
+    mutable base::Vector<base::SizeT> dirtyUniformBlocks; //!< Binding points whose buffer changed since they were bound
+
+    mutable bool linkPending{false};     //!< Whether the driver is still compiling and linking the program
+    mutable bool linkFailed{false};      //!< Whether the deferred compile and link status checks failed
+    bool         loadedFromCache{false}; //!< Whether the program was restored from `binaryCachePath`
+    Path         binaryCachePath;        //!< Program binary cache file, empty if not cached
+
     explicit Impl(unsigned int theShaderProgram) : shaderProgram(theShaderProgram)
     {
     }
@@ -315,68 +628,217 @@ struct Shader::Impl
     explicit Impl(Impl&& rhs) noexcept :
         shaderProgram(base::exchange(rhs.shaderProgram, 0u)),
         currentTexture(base::exchange(rhs.currentTexture, -1)),
-        textures(SFML_BASE_MOVE(rhs.textures))
+        textures(SFML_BASE_MOVE(rhs.textures)),
+        uniforms(SFML_BASE_MOVE(rhs.uniforms)),
+        dirtyUniforms(SFML_BASE_MOVE(rhs.dirtyUniforms)),
+        uniformArrays(SFML_BASE_MOVE(rhs.uniformArrays)),
+        dirtyUniformArrays(SFML_BASE_MOVE(rhs.dirtyUniformArrays)),
+        uniformBlocks(SFML_BASE_MOVE(rhs.uniformBlocks)),
+        dirtyUniformBlocks(SFML_BASE_MOVE(rhs.dirtyUniformBlocks)),
+        linkPending(base::exchange(rhs.linkPending, false)),
+        linkFailed(base::exchange(rhs.linkFailed, false)),
+        loadedFromCache(base::exchange(rhs.loadedFromCache, false)),
+        binaryCachePath(SFML_BASE_MOVE(rhs.binaryCachePath))
     {
     }
-};
-
 
-////////////////////////////////////////////////////////////
-Shader::UniformLocation::UniformLocation(int location) : m_value(location)
-{
-    SFML_BASE_ASSERT(m_value != -1);
-}
-
-
-////////////////////////////////////////////////////////////
-class [[nodiscard]] Shader::UniformBinder
-{
-public:
     ////////////////////////////////////////////////////////////
-    /// \brief Constructor: set up state before uniform is set
+    /// \brief Check the result of a deferred compilation
+    ///
+    /// Blocks if the driver is not done yet.
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline]] explicit UniformBinder(unsigned int shaderProgram) :
-        m_currentProgram(static_cast<GLhandle>(castToGlHandle(shaderProgram)))
+    void finishLink() const
     {
-        SFML_BASE_ASSERT(m_currentProgram != 0);
+        SFML_BASE_ASSERT(linkPending);
+        linkPending = false;
+
+        const GLhandle program = castToGlHandle(shaderProgram);
+
+        GLint success = GL_FALSE;
+        glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
 
-        // Enable program object
-        glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, reinterpret_cast<GLint*>(&m_savedProgram)));
+        if (success == GL_FALSE)
+        {
+            printProgramErrors(program);
+            linkFailed = true;
+            return;
+        }
 
-        if (m_currentProgram != m_savedProgram)
-            glCheck(glUseProgram(m_currentProgram));
+        if (!binaryCachePath.empty())
+            saveProgramBinary(program, binaryCachePath);
     }
 
     ////////////////////////////////////////////////////////////
-    /// \brief Destructor: restore state after uniform is set
+    /// \brief Store a new uniform value, to be uploaded on next bind
+    ///
+    /// Values identical to the stored ones are ignored.
     ///
     ////////////////////////////////////////////////////////////
-    [[gnu::always_inline]] ~UniformBinder()
+    void setShadowedUniform(const int location, const UniformType type, const void* const data, const base::SizeT size) const
     {
-        // Disable program object
-        if (m_currentProgram && (m_currentProgram != m_savedProgram))
-            glCheck(glUseProgram(m_savedProgram));
+        SFML_BASE_ASSERT(shaderProgram != 0u);
+        SFML_BASE_ASSERT(size <= sizeof(UniformShadow::bits));
+
+        auto [it, inserted] = uniforms.try_emplace(location);
+        UniformShadow& shadow = it->second;
+
+        if (!inserted && shadow.type == type && SFML_BASE_MEMCMP(shadow.bits, data, size) == 0)
+            return;
+
+        SFML_BASE_MEMCPY(shadow.bits, data, size);
+        shadow.type = type;
+
+        if (inserted || !shadow.dirty)
+        {
+            shadow.dirty = true;
+            dirtyUniforms.pushBack(static_cast<base::SizeT>(it - uniforms.begin()));
+        }
     }
 
     ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy constructor
+    /// \brief Store new array uniform values, to be uploaded on next bind
     ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(const UniformBinder&) = delete;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy assignment
+    /// Values identical to the stored ones are ignored.
     ///
     ////////////////////////////////////////////////////////////
-    UniformBinder& operator=(const UniformBinder&) = delete;
+    void setShadowedUniformArray(const int          location,
+                                 const UniformType  type,
+                                 const float* const data,
+                                 const base::SizeT  count) const
+    {
+        SFML_BASE_ASSERT(shaderProgram != 0u);
+
+        auto [it, inserted]        = uniformArrays.try_emplace(location);
+        UniformArrayShadow& shadow = it->second;
+
+        if (!inserted && shadow.type == type && shadow.values.size() == count &&
+            (count == 0u || SFML_BASE_MEMCMP(shadow.values.data(), data, sizeof(float) * count) == 0))
+            return;
+
+        shadow.values.resize(count);
+
+        if (count > 0u)
+            SFML_BASE_MEMCPY(shadow.values.data(), data, sizeof(float) * count);
 
-private:
-    GLhandle m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
-    GLhandle m_savedProgram{}; //!< Handle to the previously active program object
+        shadow.type = type;
+
+        if (inserted || !shadow.dirty)
+        {
+            shadow.dirty = true;
+            dirtyUniformArrays.pushBack(static_cast<base::SizeT>(it - uniformArrays.begin()));
+        }
+    }
 };
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformBlock::UniformBlock(base::PassKey<UniformBlock>&&, const unsigned int buffer, const base::SizeT size) :
+    m_buffer{buffer},
+    m_size{size}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Shader::UniformBlock> Shader::UniformBlock::create(const base::SizeT size)
+{
+    SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
+
+    unsigned int buffer = 0u;
+    UniformBufferObjectFuncs::create(buffer);
+
+    if (buffer == 0u)
+    {
+        priv::err() << "Could not create uniform buffer, generation failed";
+        return base::nullOpt;
+    }
+
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, buffer));
+    glCheck(glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW));
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, 0u));
+
+    return base::makeOptional<UniformBlock>(base::PassKey<UniformBlock>{}, buffer, size);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformBlock::~UniformBlock()
+{
+    if (m_buffer != 0u)
+        UniformBufferObjectFuncs::destroy(m_buffer);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformBlock::UniformBlock(UniformBlock&& rhs) noexcept :
+    m_buffer{base::exchange(rhs.m_buffer, 0u)},
+    m_size{base::exchange(rhs.m_size, 0u)}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformBlock& Shader::UniformBlock::operator=(UniformBlock&& rhs) noexcept
+{
+    if (&rhs == this)
+        return *this;
+
+    if (m_buffer != 0u)
+        UniformBufferObjectFuncs::destroy(m_buffer);
+
+    m_buffer = base::exchange(rhs.m_buffer, 0u);
+    m_size   = base::exchange(rhs.m_size, 0u);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::UniformBlock::update(const void* const data, const base::SizeT size, const base::SizeT offset)
+{
+    SFML_BASE_ASSERT(m_buffer != 0u);
+    SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
+
+    if (data == nullptr || offset + size > m_size)
+        return false;
+
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, m_buffer));
+    glCheck(glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data));
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, 0u));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT Shader::UniformBlock::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Shader::UniformBlock::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformLocation::UniformLocation(int location) : m_value(location)
+{
+    SFML_BASE_ASSERT(m_value != -1);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader::UniformBlockIndex::UniformBlockIndex(unsigned int index) : m_value(index)
+{
+    SFML_BASE_ASSERT(m_value != GL_INVALID_INDEX);
+}
+
+
 ////////////////////////////////////////////////////////////
 Shader::~Shader()
 {
@@ -401,6 +863,20 @@ Shader& Shader::operator=(Shader&& rhs) noexcept
     m_impl->currentTexture = base::exchange(rhs.m_impl->currentTexture, -1);
     m_impl->textures       = SFML_BASE_MOVE(rhs.m_impl->textures);
 
+    m_impl->uniforms      = SFML_BASE_MOVE(rhs.m_impl->uniforms);
+    m_impl->dirtyUniforms = SFML_BASE_MOVE(rhs.m_impl->dirtyUniforms);
+
+    m_impl->uniformArrays      = SFML_BASE_MOVE(rhs.m_impl->uniformArrays);
+    m_impl->dirtyUniformArrays = SFML_BASE_MOVE(rhs.m_impl->dirtyUniformArrays);
+
+    m_impl->uniformBlocks      = SFML_BASE_MOVE(rhs.m_impl->uniformBlocks);
+    m_impl->dirtyUniformBlocks = SFML_BASE_MOVE(rhs.m_impl->dirtyUniformBlocks);
+
+    m_impl->linkPending     = base::exchange(rhs.m_impl->linkPending, false);
+    m_impl->linkFailed      = base::exchange(rhs.m_impl->linkFailed, false);
+    m_impl->loadedFromCache = base::exchange(rhs.m_impl->loadedFromCache, false);
+    m_impl->binaryCachePath = SFML_BASE_MOVE(rhs.m_impl->binaryCachePath);
+
     return *this;
 }
 
@@ -446,14 +922,20 @@ base::Optional<Shader> Shader::loadFromFile(const LoadFromFileSettings& settings
 
     return compile(vertexShaderSlice.hasValue() ? vertexShaderSlice->toView(buffer) : base::StringView{},
                    geometryShaderSlice.hasValue() ? geometryShaderSlice->toView(buffer) : base::StringView{},
-                   fragmentShaderSlice.hasValue() ? fragmentShaderSlice->toView(buffer) : base::StringView{});
+                   fragmentShaderSlice.hasValue() ? fragmentShaderSlice->toView(buffer) : base::StringView{},
+                   settings.binaryCacheDirectory,
+                   settings.parallelCompile);
 }
 
 
 ////////////////////////////////////////////////////////////
 base::Optional<Shader> Shader::loadFromMemory(const LoadFromMemorySettings& settings)
 {
-    return compile(settings.vertexCode, settings.geometryCode, settings.fragmentCode);
+    return compile(settings.vertexCode,
+                   settings.geometryCode,
+                   settings.fragmentCode,
+                   settings.binaryCacheDirectory,
+                   settings.parallelCompile);
 }
 
 
@@ -498,7 +980,49 @@ base::Optional<Shader> Shader::loadFromStream(const LoadFromStreamSettings& sett
 
     return compile(vertexShaderSlice.hasValue() ? vertexShaderSlice->toView(buffer) : base::StringView{},
                    geometryShaderSlice.hasValue() ? geometryShaderSlice->toView(buffer) : base::StringView{},
-                   fragmentShaderSlice.hasValue() ? fragmentShaderSlice->toView(buffer) : base::StringView{});
+                   fragmentShaderSlice.hasValue() ? fragmentShaderSlice->toView(buffer) : base::StringView{},
+                   settings.binaryCacheDirectory,
+                   settings.parallelCompile);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isReady() const
+{
+    if (!m_impl->linkPending)
+        return true;
+
+    SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
+
+    GLint completed = GL_FALSE;
+    glCheck(glGetProgramiv(castToGlHandle(m_impl->shaderProgram), completionStatusKHR, &completed));
+
+    if (completed == GL_FALSE)
+        return false;
+
+    m_impl->finishLink();
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::hasCompilationFailed() const
+{
+    return isReady() && m_impl->linkFailed;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isLoadedFromBinaryCache() const
+{
+    return m_impl->loadedFromCache;
+}
+
+
+////////////////////////////////////////////////////////////
+const Path& Shader::getBinaryCachePath() const
+{
+    return m_impl->binaryCachePath;
 }
 
 
@@ -523,67 +1047,86 @@ base::Optional<Shader::UniformLocation> Shader::getUniformLocation(base::StringV
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<Shader::UniformBlockIndex> Shader::getUniformBlockIndex(base::StringView blockName) const
+{
+    enum : base::SizeT
+    {
+        maxBlockNameLength = 256
+    };
+
+    SFML_BASE_ASSERT(blockName.size() < maxBlockNameLength && "Uniform block name too long");
+
+    // To get a a null-terminated string
+    char blockNameBuffer[maxBlockNameLength];
+    SFML_BASE_MEMCPY(blockNameBuffer, blockName.data(), blockName.size());
+    blockNameBuffer[blockName.size()] = '\0';
+
+    // Request the index from OpenGL
+    const GLuint index = glCheck(glGetUniformBlockIndex(castToGlHandle(m_impl->shaderProgram), blockNameBuffer));
+    return index == GL_INVALID_INDEX ? base::nullOpt : base::makeOptional(UniformBlockIndex{index});
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, float x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1f(location.m_value, x));
+    m_impl->setShadowedUniform(location.m_value, UniformType::Float1, &x, sizeof(x));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform2f(location.m_value, v.x, v.y));
+    const float data[]{v.x, v.y};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Float2, data, sizeof(data));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform3f(location.m_value, v.x, v.y, v.z));
+    const float data[]{v.x, v.y, v.z};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Float3, data, sizeof(data));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform4f(location.m_value, v.x, v.y, v.z, v.w));
+    const float data[]{v.x, v.y, v.z, v.w};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Float4, data, sizeof(data));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, int x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1i(location.m_value, x));
+    m_impl->setShadowedUniform(location.m_value, UniformType::Int1, &x, sizeof(x));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform2i(location.m_value, v.x, v.y));
+    const int data[]{v.x, v.y};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Int2, data, sizeof(data));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform3i(location.m_value, v.x, v.y, v.z));
+    const int data[]{v.x, v.y, v.z};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Int3, data, sizeof(data));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform4i(location.m_value, v.x, v.y, v.z, v.w));
+    const int data[]{v.x, v.y, v.z, v.w};
+    m_impl->setShadowedUniform(location.m_value, UniformType::Int4, data, sizeof(data));
 }
 
 
@@ -618,16 +1161,14 @@ void Shader::setUniform(UniformLocation location, const Glsl::Bvec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix3fv(location.m_value, 1, GL_FALSE, matrix.array));
+    m_impl->setShadowedUniform(location.m_value, UniformType::Mat3, matrix.array, sizeof(matrix.array));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setMat4Uniform(UniformLocation location, const float* matrixPtr) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix4fv(location.m_value, 1, GL_FALSE, matrixPtr));
+    m_impl->setShadowedUniform(location.m_value, UniformType::Mat4, matrixPtr, sizeof(float) * 16u);
 }
 
 
@@ -680,8 +1221,7 @@ void Shader::setUniform(UniformLocation location, CurrentTextureType)
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(UniformLocation location, const float* scalarArray, base::SizeT length)
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1fv(location.m_value, static_cast<GLsizei>(length), scalarArray));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Float1, scalarArray, length);
 }
 
 
@@ -689,8 +1229,7 @@ void Shader::setUniformArray(UniformLocation location, const float* scalarArray,
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vecArray, base::SizeT length)
 {
     base::Vector<float> contiguous = flatten(vecArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform2fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Float2, contiguous.data(), contiguous.size());
 }
 
 
@@ -698,8 +1237,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vecArra
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vecArray, base::SizeT length)
 {
     base::Vector<float> contiguous = flatten(vecArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform3fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Float3, contiguous.data(), contiguous.size());
 }
 
 
@@ -707,8 +1245,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vecArra
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec4* vecArray, base::SizeT length)
 {
     base::Vector<float> contiguous = flatten(vecArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform4fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Float4, contiguous.data(), contiguous.size());
 }
 
 
@@ -722,8 +1259,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat3* matrixA
     for (base::SizeT i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix3fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Mat3, contiguous.data(), contiguous.size());
 }
 
 
@@ -737,8 +1273,53 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat4* matrixA
     for (base::SizeT i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix4fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    m_impl->setShadowedUniformArray(location.m_value, UniformType::Mat4, contiguous.data(), contiguous.size());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(UniformBlockIndex index, const UniformBlock& uniformBlock) const
+{
+    SFML_BASE_ASSERT(m_impl->shaderProgram);
+    SFML_BASE_ASSERT(uniformBlock.getNativeHandle() != 0u);
+    SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
+
+    auto& blocks = m_impl->uniformBlocks;
+
+    for (base::SizeT i = 0u; i < blocks.size(); ++i)
+    {
+        UniformBlockBinding& block = blocks[i];
+
+        if (block.blockIndex != index.m_value)
+            continue;
+
+        // Block already bound, just replace the buffer
+        if (block.buffer != uniformBlock.getNativeHandle() && !block.dirty)
+        {
+            block.dirty = true;
+            m_impl->dirtyUniformBlocks.pushBack(i);
+        }
+
+        block.buffer = uniformBlock.getNativeHandle();
+        return true;
+    }
+
+    // New entry, make sure there are enough binding points
+    if (blocks.size() + 1 > getMaxUniformBufferBindings())
+    {
+        priv::err() << "Impossible to use uniform block \"" << index.m_value << '"'
+                    << " for shader: all available binding points are used";
+
+        return false;
+    }
+
+    // The binding point of a block is its position in `blocks`
+    glCheck(glUniformBlockBinding(castToGlHandle(m_impl->shaderProgram), index.m_value, static_cast<GLuint>(blocks.size())));
+
+    m_impl->dirtyUniformBlocks.pushBack(blocks.size());
+    blocks.pushBack({index.m_value, uniformBlock.getNativeHandle(), /* dirty */ true});
+
+    return true;
 }
 
 
@@ -755,6 +1336,12 @@ void Shader::bind() const
     SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
     SFML_BASE_ASSERT(m_impl->shaderProgram != 0u);
 
+    // Wait for the driver if the shader is still being compiled in the background
+    if (m_impl->linkPending)
+        m_impl->finishLink();
+
+    SFML_BASE_ASSERT(!m_impl->linkFailed && "Shader failed to compile");
+
     // Enable the program
     SFML_BASE_ASSERT(glCheck(glIsProgram(castToGlHandle(m_impl->shaderProgram))));
     glCheck(glUseProgram(castToGlHandle(m_impl->shaderProgram)));
@@ -765,6 +1352,20 @@ void Shader::bind() const
     // Bind the current texture
     if (m_impl->currentTexture != -1)
         glCheck(glUniform1i(m_impl->currentTexture, 0));
+
+    // Bind the uniform blocks (the binding points are shared by all programs)
+    for (base::SizeT i = 0u; i < m_impl->uniformBlocks.size(); ++i)
+    {
+        UniformBlockBinding& block = m_impl->uniformBlocks[i];
+
+        glCheck(glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(i), block.buffer));
+        block.dirty = false;
+    }
+
+    m_impl->dirtyUniformBlocks.clear();
+
+    // Upload the uniforms that changed while the program was not bound
+    applyPendingUniforms();
 }
 
 
@@ -797,7 +1398,9 @@ Shader::Shader(base::PassKey<Shader>&&, unsigned int shaderProgram) : m_impl(sha
 ////////////////////////////////////////////////////////////
 base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
                                        base::StringView geometryShaderCode,
-                                       base::StringView fragmentShaderCode)
+                                       base::StringView fragmentShaderCode,
+                                       const Path&      binaryCacheDirectory,
+                                       const bool       parallelCompile)
 {
     SFML_BASE_ASSERT(GraphicsContext::hasActiveThreadLocalGlContext());
 
@@ -810,13 +1413,51 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
         return base::nullOpt;
     }
 
+    if (vertexShaderCode.data() == nullptr)
+        vertexShaderCode = DefaultShader::srcVertex;
+
+    if (fragmentShaderCode.data() == nullptr)
+        fragmentShaderCode = DefaultShader::srcFragment;
+
     // Always create programs and shaders on the shared context
     priv::GLSharedContextGuard guard;
 
+    // Skip compilation entirely if a previous run cached the linked program
+    const bool useBinaryCache  = !binaryCacheDirectory.empty() && isProgramBinaryAvailable();
+    const Path binaryCachePath = useBinaryCache ? getProgramBinaryCachePath(binaryCacheDirectory,
+                                                                            vertexShaderCode,
+                                                                            geometryShaderCode,
+                                                                            fragmentShaderCode)
+                                                : Path{};
+
+    if (useBinaryCache)
+    {
+        if (const GLhandle cachedProgram = loadProgramBinary(binaryCachePath))
+        {
+            glCheck(glFlush());
+
+            auto shader = base::makeOptional<Shader>(base::PassKey<Shader>{}, castFromGlHandle(cachedProgram));
+
+            shader->m_impl->loadedFromCache = true;
+            shader->m_impl->binaryCachePath = binaryCachePath;
+
+            return shader;
+        }
+    }
+
+    // Querying the compile and link status blocks until the driver is done,
+    // so they are deferred to `isReady` or `bind` when compiling in parallel
+    const bool deferStatusChecks = parallelCompile &&
+                                   (WindowContext::isExtensionAvailable("GL_KHR_parallel_shader_compile") ||
+                                    WindowContext::isExtensionAvailable("GL_ARB_parallel_shader_compile"));
+
     // Create the program
     const GLhandle shaderProgram = glCheck(glCreateProgram());
     SFML_BASE_ASSERT(glCheck(glIsProgram(shaderProgram)));
 
+    if (useBinaryCache)
+        glCheck(glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     const auto makeShader = [&](GLenum type, const char* typeStr, base::StringView shaderCode)
     {
         // Add `#version` (and float precision if required)
@@ -832,8 +1473,10 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
         SFML_BASE_ASSERT(glCheck(glIsShader(shader)));
 
         // Check the compile log
-        GLint success = 0;
-        glCheck(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+        GLint success = GL_TRUE;
+        if (!deferStatusChecks)
+            glCheck(glGetShaderiv(shader, GL_COMPILE_STATUS, &success));
+
         if (success == GL_FALSE)
         {
             char log[1024]{};
@@ -857,9 +1500,6 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
         return true;
     };
 
-    if (vertexShaderCode.data() == nullptr)
-        vertexShaderCode = DefaultShader::srcVertex;
-
     if (!makeShader(GL_VERTEX_SHADER, "vertex", vertexShaderCode))
         return base::nullOpt;
 
@@ -871,9 +1511,6 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
             return base::nullOpt;
     }
 
-    if (fragmentShaderCode.data() == nullptr)
-        fragmentShaderCode = DefaultShader::srcFragment;
-
     // Create the fragment shader
     if (!makeShader(GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
         return base::nullOpt;
@@ -881,6 +1518,18 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
     // Link the program
     glCheck(glLinkProgram(shaderProgram));
 
+    if (deferStatusChecks)
+    {
+        glCheck(glFlush());
+
+        auto shader = base::makeOptional<Shader>(base::PassKey<Shader>{}, castFromGlHandle(shaderProgram));
+
+        shader->m_impl->linkPending     = true;
+        shader->m_impl->binaryCachePath = binaryCachePath;
+
+        return shader;
+    }
+
     // Check the link log
     GLint success = 0;
     glCheck(glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success));
@@ -897,11 +1546,17 @@ base::Optional<Shader> Shader::compile(base::StringView vertexShaderCode,
         return base::nullOpt;
     }
 
+    if (useBinaryCache)
+        saveProgramBinary(shaderProgram, binaryCachePath);
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
 
-    return base::makeOptional<Shader>(base::PassKey<Shader>{}, castFromGlHandle(shaderProgram));
+    auto shader = base::makeOptional<Shader>(base::PassKey<Shader>{}, castFromGlHandle(shaderProgram));
+    shader->m_impl->binaryCachePath = binaryCachePath;
+
+    return shader;
 }
 
 
@@ -922,6 +1577,46 @@ void Shader::bindTextures() const
     glCheck(glActiveTexture(GL_TEXTURE0));
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::applyPendingUniforms() const
+{
+    // Bind the buffers assigned to uniform blocks since the program was bound
+    for (const base::SizeT bindingPoint : m_impl->dirtyUniformBlocks)
+    {
+        UniformBlockBinding& block = m_impl->uniformBlocks[bindingPoint];
+
+        glCheck(glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(bindingPoint), block.buffer));
+        block.dirty = false;
+    }
+
+    m_impl->dirtyUniformBlocks.clear();
+
+    auto* const uniforms = m_impl->uniforms.begin();
+
+    for (const base::SizeT index : m_impl->dirtyUniforms)
+    {
+        auto& [location, shadow] = uniforms[index];
+
+        uploadUniform(location, shadow);
+        shadow.dirty = false;
+    }
+
+    m_impl->dirtyUniforms.clear();
+
+    auto* const uniformArrays = m_impl->uniformArrays.begin();
+
+    for (const base::SizeT index : m_impl->dirtyUniformArrays)
+    {
+        auto& [location, shadow] = uniformArrays[index];
+
+        uploadUniformArray(location, shadow);
+        shadow.dirty = false;
+    }
+
+    m_impl->dirtyUniformArrays.clear();
+}
+
 } // namespace sf
 
 // TODO P2: add support for `#include` in shaders
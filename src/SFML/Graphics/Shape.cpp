@@ -42,7 +42,7 @@ void Shape::setTextureRect(const Rect2f& rect)
         return;
 
     m_textureRect = rect;
-    updateTexCoords();
+    m_dirtyFlags |= DirtyTexCoords;
 }
 
 
@@ -53,7 +53,7 @@ void Shape::setOutlineTextureRect(const Rect2f& rect)
         return;
 
     m_outlineTextureRect = rect;
-    updateOutlineTexCoords();
+    m_dirtyFlags |= DirtyOutlineTexCoords;
 }
 
 
@@ -78,7 +78,7 @@ void Shape::setFillColor(Color color)
         return;
 
     m_fillColor = color;
-    updateFillColors();
+    m_dirtyFlags |= DirtyFillColors;
 }
 
 
@@ -96,7 +96,7 @@ void Shape::setOutlineColor(Color color)
         return;
 
     m_outlineColor = color;
-    updateOutlineColors();
+    m_dirtyFlags |= DirtyOutlineColors;
 }
 
 
@@ -114,21 +114,18 @@ void Shape::setOutlineThickness(float thickness)
         return;
 
     m_outlineThickness = thickness;
-
-    const base::SizeT pointCount = m_verticesEndIndex - 2u;
-
-    m_vertices.resize(pointCount + 2u); // +2 for center and repeated first point
-
-    updateOutline();
-    updateOutlineTexCoords();
+    m_dirtyFlags |= DirtyOutline;
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shape::setMiterLimit(float miterLimit)
 {
+    if (m_miterLimit == miterLimit)
+        return;
+
     m_miterLimit = miterLimit;
-    updateOutline();
+    m_dirtyFlags |= DirtyOutline;
 }
 
 
@@ -149,6 +146,7 @@ float Shape::getOutlineThickness() const
 ////////////////////////////////////////////////////////////
 const Rect2f& Shape::getLocalBounds() const
 {
+    ensureGeometryUpdate();
     return m_bounds;
 }
 
@@ -168,7 +166,37 @@ void Shape::update(const sf::Vec2f* points, const base::SizeT pointCount)
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateFillColors()
+void Shape::updateDirtyGeometry() const
+{
+    if (m_dirtyFlags & DirtyFillColors)
+        updateFillColors();
+
+    if (m_dirtyFlags & DirtyTexCoords)
+        updateTexCoords();
+
+    if (m_dirtyFlags & DirtyOutline)
+    {
+        // Drop the previous outline, its size depends on the thickness
+        m_vertices.resize(m_verticesEndIndex);
+
+        updateOutline();
+        updateOutlineTexCoords();
+    }
+    else
+    {
+        if (m_dirtyFlags & DirtyOutlineColors)
+            updateOutlineColors();
+
+        if (m_dirtyFlags & DirtyOutlineTexCoords)
+            updateOutlineTexCoords();
+    }
+
+    m_dirtyFlags = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::updateFillColors() const
 {
     const auto* end = m_vertices.data() + m_verticesEndIndex;
     for (Vertex* vertex = m_vertices.data(); vertex != end; ++vertex)
@@ -177,7 +205,7 @@ void Shape::updateFillColors()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateTexCoords()
+void Shape::updateTexCoords() const
 {
     // Make sure not to divide by zero when the points are aligned on a vertical or horizontal line
     if (m_insideBounds.size.x == 0 || m_insideBounds.size.y == 0)
@@ -193,7 +221,7 @@ void Shape::updateTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineTexCoords()
+void Shape::updateOutlineTexCoords() const
 {
     // Make sure not to divide by zero when the points are aligned on a vertical or horizontal line
     if (m_bounds.size.x == 0 || m_bounds.size.y == 0)
@@ -209,7 +237,7 @@ void Shape::updateOutlineTexCoords()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutline()
+void Shape::updateOutline() const
 {
     // Return if there is no outline or no vertices
     if (m_outlineThickness == 0.f || m_vertices.size() < 2)
@@ -239,7 +267,7 @@ void Shape::updateOutline()
 
 
 ////////////////////////////////////////////////////////////
-void Shape::updateOutlineColors()
+void Shape::updateOutlineColors() const
 {
     const auto* end = m_vertices.data() + m_vertices.size();
     for (Vertex* vertex = m_vertices.data() + m_verticesEndIndex; vertex != end; ++vertex)
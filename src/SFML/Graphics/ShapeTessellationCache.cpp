@@ -0,0 +1,225 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ShapeTessellationCache.hpp"
+
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/Constants.hpp"
+#include "SFML/Base/FloatMax.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/Remainder.hpp"
+#include "SFML/Base/SinCosLookup.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SFML_PRIV_TESSELLATION_SSE2
+    #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define SFML_PRIV_TESSELLATION_NEON
+    #include <arm_neon.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+enum class TemplateKind : sf::base::U32
+{
+    Circle,
+    RoundedRectangle,
+};
+
+
+////////////////////////////////////////////////////////////
+struct TemplateCacheEntry
+{
+    TemplateKind                kind{};
+    unsigned int                pointCount{};
+    sf::base::U32               parameterBits{};
+    bool                        valid{};
+    sf::base::Vector<sf::Vec2f> points;
+};
+
+
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT templateCacheSize = 64u; // Direct-mapped, colliding templates evict each other
+
+
+////////////////////////////////////////////////////////////
+thread_local TemplateCacheEntry templateCache[templateCacheSize];
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Span<const sf::Vec2f> getOrCreateTemplate(const TemplateKind    kind,
+                                                                  const unsigned int    pointCount,
+                                                                  const sf::base::U32   parameterBits,
+                                                                  const sf::base::SizeT templateSize,
+                                                                  auto&&                computePointFn)
+{
+    const sf::base::U32 hash = (static_cast<sf::base::U32>(kind) * 0x9E37'79B1u) ^ (pointCount * 0x85EB'CA77u) ^
+                               (parameterBits * 0xC2B2'AE3Du);
+
+    TemplateCacheEntry& entry = templateCache[(hash ^ (hash >> 16u)) % templateCacheSize];
+
+    if (!entry.valid || entry.kind != kind || entry.pointCount != pointCount || entry.parameterBits != parameterBits)
+    {
+        entry.kind          = kind;
+        entry.pointCount    = pointCount;
+        entry.parameterBits = parameterBits;
+        entry.valid         = true;
+
+        entry.points.resize(templateSize);
+
+        for (sf::base::SizeT i = 0u; i < templateSize; ++i)
+            entry.points[i] = computePointFn(i);
+    }
+
+    return {entry.points.data(), entry.points.size()};
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+base::Span<const Vec2f> getCircleTemplate(const unsigned int pointCount, const float startRadians)
+{
+    base::U32 startBits{};
+    SFML_BASE_MEMCPY(&startBits, &startRadians, sizeof(float));
+
+    const float angleStep = base::tau / static_cast<float>(pointCount);
+
+    // Same angles as `ShapeUtils::computeEllipsePointFromAngleStep`
+    return getOrCreateTemplate(TemplateKind::Circle, pointCount, startBits, pointCount, [&](const base::SizeT i)
+    {
+        const float angle         = startRadians + static_cast<float>(i) * angleStep;
+        const auto [sine, cosine] = base::sinCosLookup(base::positiveRemainder(angle, base::tau));
+
+        return Vec2f{sine, cosine};
+    });
+}
+
+
+////////////////////////////////////////////////////////////
+base::Span<const Vec2f> getRoundedRectangleTemplate(const unsigned int cornerPointCount)
+{
+    const float deltaAngle = base::halfPi / static_cast<float>(cornerPointCount - 1u);
+
+    // Same angles as `ShapeUtils::computeRoundedRectanglePoint`
+    return getOrCreateTemplate(TemplateKind::RoundedRectangle,
+                               cornerPointCount,
+                               /* parameterBits */ 0u,
+                               cornerPointCount * 4u,
+                               [&](const base::SizeT i)
+    {
+        const base::SizeT centerIndex = i / cornerPointCount;
+        const auto [sine, cosine]     = base::sinCosLookup(deltaAngle * static_cast<float>(i - centerIndex));
+
+        return Vec2f{cosine, -sine};
+    });
+}
+
+
+////////////////////////////////////////////////////////////
+PointBounds transformTemplatePoints(const Vec2f* const points,
+                                    const base::SizeT  count,
+                                    const Transform&   transform,
+                                    Vertex* const      vertices,
+                                    const base::SizeT  vertexStride) noexcept
+{
+    PointBounds bounds{{SFML_BASE_FLOAT_MAX, SFML_BASE_FLOAT_MAX}, {-SFML_BASE_FLOAT_MAX, -SFML_BASE_FLOAT_MAX}};
+    base::SizeT i = 0u;
+
+    // Two points per iteration, each register holds `(x0, y0, x1, y1)`
+#if defined(SFML_PRIV_TESSELLATION_SSE2)
+    const __m128 col0 = _mm_setr_ps(transform.a00, transform.a10, transform.a00, transform.a10);
+    const __m128 col1 = _mm_setr_ps(transform.a01, transform.a11, transform.a01, transform.a11);
+    const __m128 col2 = _mm_setr_ps(transform.a02, transform.a12, transform.a02, transform.a12);
+
+    __m128 minValues = _mm_set1_ps(SFML_BASE_FLOAT_MAX);
+    __m128 maxValues = _mm_set1_ps(-SFML_BASE_FLOAT_MAX);
+
+    for (; i + 2u <= count; i += 2u)
+    {
+        const __m128 p  = _mm_loadu_ps(&points[i].x);
+        const __m128 xs = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 r  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, xs), _mm_mul_ps(col1, ys)), col2);
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(&vertices[i * vertexStride].position), r);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&vertices[(i + 1u) * vertexStride].position), r);
+
+        minValues = _mm_min_ps(minValues, r);
+        maxValues = _mm_max_ps(maxValues, r);
+    }
+
+    alignas(16) float minLanes[4];
+    alignas(16) float maxLanes[4];
+
+    _mm_store_ps(minLanes, _mm_min_ps(minValues, _mm_movehl_ps(minValues, minValues)));
+    _mm_store_ps(maxLanes, _mm_max_ps(maxValues, _mm_movehl_ps(maxValues, maxValues)));
+
+    bounds = {{minLanes[0], minLanes[1]}, {maxLanes[0], maxLanes[1]}};
+#elif defined(SFML_PRIV_TESSELLATION_NEON)
+    const float col0Lanes[4]{transform.a00, transform.a10, transform.a00, transform.a10};
+    const float col1Lanes[4]{transform.a01, transform.a11, transform.a01, transform.a11};
+    const float col2Lanes[4]{transform.a02, transform.a12, transform.a02, transform.a12};
+
+    const float32x4_t col0 = vld1q_f32(col0Lanes);
+    const float32x4_t col1 = vld1q_f32(col1Lanes);
+    const float32x4_t col2 = vld1q_f32(col2Lanes);
+
+    float32x4_t minValues = vdupq_n_f32(SFML_BASE_FLOAT_MAX);
+    float32x4_t maxValues = vdupq_n_f32(-SFML_BASE_FLOAT_MAX);
+
+    for (; i + 2u <= count; i += 2u)
+    {
+        const float32x4_t p  = vld1q_f32(&points[i].x);
+        const float32x4_t xs = vtrn1q_f32(p, p);
+        const float32x4_t ys = vtrn2q_f32(p, p);
+        const float32x4_t r  = vaddq_f32(vaddq_f32(vmulq_f32(col0, xs), vmulq_f32(col1, ys)), col2);
+
+        vst1_f32(&vertices[i * vertexStride].position.x, vget_low_f32(r));
+        vst1_f32(&vertices[(i + 1u) * vertexStride].position.x, vget_high_f32(r));
+
+        minValues = vminq_f32(minValues, r);
+        maxValues = vmaxq_f32(maxValues, r);
+    }
+
+    const float32x2_t minPair = vmin_f32(vget_low_f32(minValues), vget_high_f32(minValues));
+    const float32x2_t maxPair = vmax_f32(vget_low_f32(maxValues), vget_high_f32(maxValues));
+
+    bounds = {{vget_lane_f32(minPair, 0), vget_lane_f32(minPair, 1)},
+              {vget_lane_f32(maxPair, 0), vget_lane_f32(maxPair, 1)}};
+#endif
+
+    // Remaining point, or all of them without SIMD
+    for (; i < count; ++i)
+    {
+        const Vec2f p = transform.transformPoint(points[i]);
+
+        vertices[i * vertexStride].position = p;
+
+        bounds.min.x = SFML_BASE_MIN(bounds.min.x, p.x);
+        bounds.min.y = SFML_BASE_MIN(bounds.min.y, p.y);
+        bounds.max.x = SFML_BASE_MAX(bounds.max.x, p.x);
+        bounds.max.y = SFML_BASE_MAX(bounds.max.y, p.y);
+    }
+
+    return bounds;
+}
+
+} // namespace sf::priv
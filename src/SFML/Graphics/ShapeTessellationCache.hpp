@@ -0,0 +1,88 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+struct Transform;
+struct Vertex;
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Axis-aligned bounds of a set of points
+///
+////////////////////////////////////////////////////////////
+struct PointBounds
+{
+    Vec2f min; //!< Top-left corner
+    Vec2f max; //!< Bottom-right corner
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Get the unit-space points of a circle
+///
+/// Point `i` is `(sin(a), cos(a))`, where `a` is the angle of the
+/// `i`-th point computed as in `ShapeUtils::computeEllipsePointFromAngleStep`.
+/// A circle of radius `r` is obtained as `r * (1 + point)`, a ring
+/// or an ellipse by scaling each coordinate independently.
+///
+/// Templates are cached per thread and keyed by their parameters,
+/// so drawing many circles with the same point count only computes
+/// the trigonometry once.
+///
+/// \warning The returned span is invalidated by the next call to any
+///          `get*Template` function on the same thread.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Span<const Vec2f> getCircleTemplate(unsigned int pointCount, float startRadians);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Get the unit-space points of the corners of a rounded rectangle
+///
+/// Returns `4 * cornerPointCount` points. Point `i` is the offset
+/// of the `i`-th point of `ShapeUtils::computeRoundedRectanglePoint`
+/// from its corner center, for a corner radius of `1`.
+///
+/// \warning The returned span is invalidated by the next call to any
+///          `get*Template` function on the same thread.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Span<const Vec2f> getRoundedRectangleTemplate(unsigned int cornerPointCount);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Transform template points into vertex positions
+///
+/// Writes `transform.transformPoint(points[i])` to the position of
+/// `vertices[i * vertexStride]`, vectorized with SSE2 or NEON when
+/// available. The local placement of the template (radius, center)
+/// is meant to be folded into `transform` by the caller.
+///
+/// \return Bounds of the transformed points
+///
+////////////////////////////////////////////////////////////
+PointBounds transformTemplatePoints(const Vec2f*     points,
+                                    base::SizeT      count,
+                                    const Transform& transform,
+                                    Vertex*          vertices,
+                                    base::SizeT      vertexStride) noexcept;
+
+} // namespace sf::priv
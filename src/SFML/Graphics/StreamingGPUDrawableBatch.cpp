@@ -0,0 +1,265 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
+#include "SFML/Graphics/DrawableBatch.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexPacking.hpp"
+
+#include "SFML/GLUtils/GLCheck.hpp"
+#include "SFML/GLUtils/GLStreamingBuffer.hpp"
+#include "SFML/GLUtils/GLVAOGroup.hpp"
+#include "SFML/GLUtils/Glad.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Abort.hpp"
+#include "SFML/Base/Exchange.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/DrawableBatchImpl.inl" // IWYU pragma: keep
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+enum : sf::base::SizeT
+{
+    streamingBufferRingSize = 3u,                 //!< Number of vertex/index buffer pairs used in round-robin
+    minimumSlotVertexBytes  = 256u * 1024u,       //!< Vertex storage allocated for a slot on first use
+    minimumSlotIndexBytes   = 64u * 1024u,        //!< Index storage allocated for a slot on first use
+    maximumSlotGrowthBytes  = 4u * 1024u * 1024u, //!< Storage size beyond which a full slot is not grown anymore
+};
+
+
+////////////////////////////////////////////////////////////
+void insertFence([[maybe_unused]] GLsync& fence)
+{
+#ifndef SFML_SYSTEM_EMSCRIPTEN
+    if (fence != nullptr)
+        glCheck(glDeleteSync(fence));
+
+    fence = glCheck(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    if (fence == nullptr) [[unlikely]]
+    {
+        sf::priv::err() << "FATAL ERROR: Error creating fence sync object";
+        sf::base::abort();
+    }
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool tryReleaseFence([[maybe_unused]] GLsync& fence)
+{
+#ifdef SFML_SYSTEM_EMSCRIPTEN
+    // WebGL copies `bufferSubData` data immediately, there is no hazard to guard against
+    return true;
+#else
+    if (fence == nullptr)
+        return true;
+
+    // Poll only, waiting here would defeat the purpose of the ring
+    const GLenum result = glCheck(glClientWaitSync(fence, 0u, /* timeout */ 0u));
+
+    if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+        return false;
+
+    glCheck(glDeleteSync(fence));
+    fence = nullptr;
+
+    return true;
+#endif
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+struct StreamingGPUStorage::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        GLVAOGroup vaoGroup; //!< VAO, VBO, and EBO of the slot
+
+        GLStreamingBuffer<GLVertexBufferObject>  vertexBuffer; //!< Sub-allocation state of the VBO
+        GLStreamingBuffer<GLElementBufferObject> indexBuffer;  //!< Sub-allocation state of the EBO
+
+        GLsync fence{}; //!< Signaled once the GPU is done with the draws issued from the slot
+
+        Slot() = default;
+
+        ~Slot()
+        {
+            if (fence != nullptr)
+                glCheck(glDeleteSync(fence));
+        }
+
+        Slot(const Slot&)            = delete;
+        Slot& operator=(const Slot&) = delete;
+
+        Slot(Slot&& rhs) noexcept :
+            vaoGroup(SFML_BASE_MOVE(rhs.vaoGroup)),
+            vertexBuffer(rhs.vertexBuffer),
+            indexBuffer(rhs.indexBuffer),
+            fence(base::exchange(rhs.fence, nullptr))
+        {
+        }
+
+        Slot& operator=(Slot&& rhs) noexcept
+        {
+            if (this == &rhs)
+                return *this;
+
+            if (fence != nullptr)
+                glCheck(glDeleteSync(fence));
+
+            vaoGroup     = SFML_BASE_MOVE(rhs.vaoGroup);
+            vertexBuffer = rhs.vertexBuffer;
+            indexBuffer  = rhs.indexBuffer;
+            fence        = base::exchange(rhs.fence, nullptr);
+
+            return *this;
+        }
+    };
+
+    Slot                   slots[streamingBufferRingSize]; //!< Ring of buffer pairs
+    base::SizeT            currentSlot{0u};                //!< Slot receiving the uploads
+    base::SizeT            slotRotations{0u};              //!< Number of times the ring moved on to the next slot
+    base::Vector<base::U8> packingBuffer;                  //!< Vertices and indices packed in a compact format
+};
+
+
+////////////////////////////////////////////////////////////
+StreamingGPUStorage::StreamingGPUStorage() = default;
+
+
+////////////////////////////////////////////////////////////
+StreamingGPUStorage::StreamingGPUStorage(base::MemoryResource& resource) : CPUStorage{resource}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingGPUStorage::~StreamingGPUStorage()                                          = default;
+StreamingGPUStorage::StreamingGPUStorage(StreamingGPUStorage&&) noexcept            = default;
+StreamingGPUStorage& StreamingGPUStorage::operator=(StreamingGPUStorage&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+const void* StreamingGPUStorage::acquireVAOGroup() const
+{
+    const bool        shortIndices = usesShortIndices(vertexFormat, vertices.size());
+    const base::SizeT indexSize    = shortIndices ? sizeof(base::U16) : sizeof(IndexType);
+
+    const base::SizeT vertexByteCount = getVertexSize(vertexFormat) * vertices.size();
+    const base::SizeT indexByteCount  = indexSize * indices.size();
+
+    Impl::Slot* slot = &impl->slots[impl->currentSlot];
+
+    const bool vertexFits = slot->vertexBuffer.fits(vertexByteCount);
+    const bool indexFits  = slot->indexBuffer.fits(indexByteCount);
+
+    if (vertexFits && indexFits) [[likely]]
+        return &slot->vaoGroup;
+
+    // An unused slot grows to fit the upload, moving on would not help
+    if (slot->vertexBuffer.isEmpty() && slot->indexBuffer.isEmpty())
+    {
+        slot->vertexBuffer.reserve(minimumSlotVertexBytes);
+        slot->indexBuffer.reserve(minimumSlotIndexBytes);
+
+        return &slot->vaoGroup;
+    }
+
+    // A small slot is grown in place: orphaning costs as much as moving on, and larger slots rotate less often
+    const bool growable = slot->vertexBuffer.getCapacity() < maximumSlotGrowthBytes &&
+                          slot->indexBuffer.getCapacity() < maximumSlotGrowthBytes;
+
+    if (growable)
+    {
+        if (!vertexFits)
+            slot->vertexBuffer.grow(vertexByteCount);
+
+        if (!indexFits)
+            slot->indexBuffer.grow(indexByteCount);
+
+        return &slot->vaoGroup;
+    }
+
+    // The slot is full: mark the end of its draws and move on to the next one
+    insertFence(slot->fence);
+
+    impl->currentSlot = (impl->currentSlot + 1u) % streamingBufferRingSize;
+    slot              = &impl->slots[impl->currentSlot];
+
+    ++impl->slotRotations;
+
+    if (tryReleaseFence(slot->fence))
+    {
+        slot->vertexBuffer.rewind();
+        slot->indexBuffer.rewind();
+    }
+    else
+    {
+        // The GPU still reads from the slot: orphan its storage rather than stalling
+        slot->vertexBuffer.invalidate();
+        slot->indexBuffer.invalidate();
+    }
+
+    return &slot->vaoGroup;
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingGPUStorage::GPURegion StreamingGPUStorage::uploadToGPU() const
+{
+    Impl::Slot& slot = impl->slots[impl->currentSlot];
+
+    const PackedGeometry packed = packGeometry(vertexFormat,
+                                               vertices.data(),
+                                               vertices.size(),
+                                               indices.data(),
+                                               indices.size(),
+                                               impl->packingBuffer);
+
+    const base::SizeT vertexByteOffset = slot.vertexBuffer.write(packed.vertexData, packed.vertexByteCount);
+    const base::SizeT indexByteOffset  = slot.indexBuffer.write(packed.indexData, packed.indexByteCount);
+
+    return {.vertexByteOffset = vertexByteOffset,
+            .indexOffset      = indexByteOffset / (packed.shortIndices ? sizeof(base::U16) : sizeof(IndexType)),
+            .shortIndices     = packed.shortIndices};
+}
+
+
+////////////////////////////////////////////////////////////
+StreamingGPUStorage::StreamingStatistics StreamingGPUStorage::getStreamingStatistics() const
+{
+    StreamingStatistics result{.slotRotations = impl->slotRotations, .storageOrphans = 0u};
+
+    for (const Impl::Slot& slot : impl->slots)
+        result.storageOrphans += slot.vertexBuffer.getOrphanCount() + slot.indexBuffer.getOrphanCount();
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+// Explicit instantiation definitions
+////////////////////////////////////////////////////////////
+template class DrawableBatchImpl<StreamingGPUStorage>;
+
+} // namespace sf::priv
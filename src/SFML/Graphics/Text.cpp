@@ -18,10 +18,16 @@
 
 #include "SFML/System/Rect2.hpp"
 #include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/Utf8String.hpp"
 
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memmove.hpp"
 #include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/LambdaMacros.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/MinMax.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/Vector.hpp"
 
 
@@ -48,6 +54,14 @@ Text::Text(const Font& font, const Data& data) :
 }
 
 
+////////////////////////////////////////////////////////////
+Text::Text(const Font& font, const Data& data, base::MemoryResource& geometryResource) : Text(font, data)
+{
+    // Geometry is built lazily, so the vector is still empty here
+    m_vertices = VertexVector{geometryResource};
+}
+
+
 ////////////////////////////////////////////////////////////
 Text::~Text()                          = default;
 Text::Text(const Text&)                = default;
@@ -67,6 +81,48 @@ void Text::setString(const UnicodeString& string)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setString(const Utf8String& string)
+{
+    setString(string.toUnicodeString());
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::appendString(const UnicodeString& string)
+{
+    if (string.isEmpty())
+        return;
+
+    m_geometryDirtyIndex = base::min(m_geometryDirtyIndex, m_string.getSize());
+    m_string += string;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::replaceSuffix(base::SizeT suffixBegin, const UnicodeString& replaceWith)
+{
+    suffixBegin = base::min(suffixBegin, m_string.getSize());
+
+    // Skip the characters that are not actually replaced
+    base::SizeT commonCount = 0u;
+    while (suffixBegin + commonCount < m_string.getSize() && commonCount < replaceWith.getSize() &&
+           m_string[suffixBegin + commonCount] == replaceWith[commonCount])
+        ++commonCount;
+
+    if (suffixBegin + commonCount == m_string.getSize() && commonCount == replaceWith.getSize())
+        return;
+
+    m_string.replace(suffixBegin, UnicodeString::InvalidPos, replaceWith);
+
+    // An empty string has no geometry to resume from
+    if (m_string.isEmpty())
+        m_geometryNeedUpdate = true;
+    else
+        m_geometryDirtyIndex = base::min(m_geometryDirtyIndex, suffixBegin + commonCount);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setFont(const Font& font)
 {
@@ -361,15 +417,24 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate(const Font& font) const
 {
+    // Only the end of the string changed: regenerate the geometry of the affected lines
+    if (!m_geometryNeedUpdate && m_geometryDirtyIndex != UnicodeString::InvalidPos)
+    {
+        updateGeometrySuffix(font);
+        return;
+    }
+
     // Do nothing, if geometry has not changed and the font texture has not changed
     if (!m_geometryNeedUpdate)
         return;
 
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
+    m_geometryDirtyIndex = UnicodeString::InvalidPos;
 
     // Clear the previous geometry
     m_vertices.clear();
+    m_lineStarts.clear();
     m_fillVerticesStartIndex = 0u;
     m_bounds                 = {};
 
@@ -387,8 +452,10 @@ void Text::ensureGeometryUpdate(const Font& font) const
     m_vertices.resize(outlineVertexCount + fillVertexCount);
     m_fillVerticesStartIndex = outlineVertexCount;
 
-    m_bounds = TextUtils::createTextGeometryAndGetBounds<
-        /* CalculateBounds */ true>(outlineVertexCount,
+    auto cursor = TextUtils::makeTextLayoutCursor(outlineVertexCount, m_characterSize);
+
+    m_bounds = TextUtils::layoutTextGeometry<
+        /* CalculateBounds */ true>(cursor,
                                     font,
                                     m_string,
                                     m_style,
@@ -401,7 +468,118 @@ void Text::ensureGeometryUpdate(const Font& font) const
                                     [this](auto&&... xs) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
     { return TextUtils::addLine(m_vertices.data(), SFML_BASE_FORWARD(xs)...); },
                                     [this](auto&&... xs) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
-    { return TextUtils::addGlyphQuad(m_vertices.data(), SFML_BASE_FORWARD(xs)...); });
+    { return TextUtils::addGlyphQuad(m_vertices.data(), SFML_BASE_FORWARD(xs)...); },
+                                    [&](const TextUtils::TextLayoutCursor& lineCursor, const base::SizeT charCount)
+    { recordLineStart(lineCursor, charCount, outlineVertexCount); });
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateGeometrySuffix(const Font& font) const
+{
+    const base::SizeT dirtyIndex = m_geometryDirtyIndex;
+    m_geometryDirtyIndex         = UnicodeString::InvalidPos;
+
+    // Resume the layout from the last line that starts before the first modified character,
+    // the geometry of all the previous lines is still valid
+    while (!m_lineStarts.empty() && m_lineStarts.back().charIndex > dirtyIndex)
+        m_lineStarts.popBack();
+
+    auto        cursor          = TextUtils::makeTextLayoutCursor(/* outlineVertexCount */ 0u, m_characterSize);
+    base::SizeT firstCharIndex  = 0u;
+    base::SizeT keptVertexCount = 0u;
+
+    if (!m_lineStarts.empty())
+    {
+        const LineStart& lineStart = m_lineStarts.back();
+
+        cursor.y        = lineStart.y;
+        cursor.minX     = lineStart.minX;
+        cursor.minY     = lineStart.minY;
+        cursor.maxX     = lineStart.maxX;
+        cursor.maxY     = lineStart.maxY;
+        cursor.prevChar = U'\n';
+
+        firstCharIndex  = lineStart.charIndex;
+        keptVertexCount = lineStart.fillVertexCount;
+    }
+
+    const base::Span<const char32_t> suffix{m_string.getData() + firstCharIndex, m_string.getSize() - firstCharIndex};
+
+    // Dry run of the layout to count the vertices of the affected lines
+    auto countCursor = cursor;
+
+    const auto countQuad = [](base::SizeT& index, auto&&...) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN { index += 4u; };
+
+    TextUtils::layoutTextGeometry<
+        /* CalculateBounds */ false>(countCursor,
+                                     font,
+                                     suffix,
+                                     m_style,
+                                     m_characterSize,
+                                     m_letterSpacing,
+                                     m_lineSpacing,
+                                     m_outlineThickness,
+                                     m_fillColor,
+                                     m_outlineColor,
+                                     countQuad,
+                                     countQuad,
+                                     /* fOnLineStart */ [](auto&&...) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN {});
+
+    const base::SizeT fillVertexCount    = keptVertexCount + countCursor.fillIndex;
+    const base::SizeT outlineVertexCount = m_outlineThickness == 0.f ? 0u : fillVertexCount;
+
+    // Outline vertices precede fill vertices: shift the kept fill vertices if the outline section changed size
+    if (outlineVertexCount > m_fillVerticesStartIndex)
+        m_vertices.resize(outlineVertexCount + fillVertexCount);
+
+    if (outlineVertexCount != m_fillVerticesStartIndex && keptVertexCount > 0u)
+        SFML_BASE_MEMMOVE(m_vertices.data() + outlineVertexCount,
+                          m_vertices.data() + m_fillVerticesStartIndex,
+                          sizeof(Vertex) * keptVertexCount);
+
+    m_vertices.resize(outlineVertexCount + fillVertexCount);
+    m_fillVerticesStartIndex = outlineVertexCount;
+
+    cursor.fillIndex    = outlineVertexCount + keptVertexCount;
+    cursor.outlineIndex = outlineVertexCount == 0u ? 0u : keptVertexCount;
+
+    m_bounds = TextUtils::layoutTextGeometry<
+        /* CalculateBounds */ true>(cursor,
+                                    font,
+                                    suffix,
+                                    m_style,
+                                    m_characterSize,
+                                    m_letterSpacing,
+                                    m_lineSpacing,
+                                    m_outlineThickness,
+                                    m_fillColor,
+                                    m_outlineColor,
+                                    [this](auto&&... xs) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
+    { return TextUtils::addLine(m_vertices.data(), SFML_BASE_FORWARD(xs)...); },
+                                    [this](auto&&... xs) SFML_BASE_LAMBDA_ALWAYS_INLINE_FLATTEN
+    { return TextUtils::addGlyphQuad(m_vertices.data(), SFML_BASE_FORWARD(xs)...); },
+                                    [&](const TextUtils::TextLayoutCursor& lineCursor, const base::SizeT charCount)
+    { recordLineStart(lineCursor, firstCharIndex + charCount, outlineVertexCount); });
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::recordLineStart(const TextUtils::TextLayoutCursor& cursor,
+                           const base::SizeT                  charIndex,
+                           const base::SizeT                  outlineVertexCount) const
+{
+    SFML_BASE_ASSERT(outlineVertexCount == 0u || cursor.outlineIndex == cursor.fillIndex - outlineVertexCount);
+
+    m_lineStarts.pushBack({
+        .charIndex       = charIndex,
+        .fillVertexCount = cursor.fillIndex - outlineVertexCount,
+        .y               = cursor.y,
+        .minX            = cursor.minX,
+        .minY            = cursor.minY,
+        .maxX            = cursor.maxX,
+        .maxY            = cursor.maxY,
+    });
 }
 
 } // namespace sf
@@ -0,0 +1,412 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/TextLayout.hpp"
+
+#include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/Glyph.hpp"
+#include "SFML/Graphics/TextStyle.hpp"
+#include "SFML/Graphics/TextUtils.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/FloatMax.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextLayout::TextLayout(const Font& font, const TextData& data, const float wrapWidth) :
+    m_string(data.string),
+    m_font(&font),
+    m_characterSize(data.characterSize),
+    m_letterSpacing(data.letterSpacing),
+    m_lineSpacing(data.lineSpacing),
+    m_wrapWidth(wrapWidth),
+    m_style(data.style)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setString(const UnicodeString& string)
+{
+    if (m_string == string)
+        return;
+
+    m_string          = string;
+    m_wordsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setFont(const Font& font)
+{
+    if (m_font == &font)
+        return;
+
+    m_font = &font;
+    invalidateMeasurements();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setCharacterSize(const unsigned int size)
+{
+    if (m_characterSize == size)
+        return;
+
+    m_characterSize = size;
+    invalidateMeasurements();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setLetterSpacing(const float spacingFactor)
+{
+    if (m_letterSpacing == spacingFactor)
+        return;
+
+    m_letterSpacing   = spacingFactor;
+    m_wordsNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setLineSpacing(const float spacingFactor)
+{
+    m_lineSpacing = spacingFactor;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setStyle(const TextStyle style)
+{
+    if (m_style == style)
+        return;
+
+    const bool boldChanged = !!((m_style ^ style) & TextStyle::Bold);
+    m_style                = style;
+
+    if (boldChanged)
+        invalidateMeasurements();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setWrapWidth(const float wrapWidth)
+{
+    if (m_wrapWidth == wrapWidth)
+        return;
+
+    m_wrapWidth = wrapWidth;
+
+    // The greedy algorithm takes the same decisions for all widths in the valid range
+    if (wrapWidth < m_minValidWrapWidth || wrapWidth >= m_maxValidWrapWidth)
+        m_linesNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const UnicodeString& TextLayout::getString() const
+{
+    return m_string;
+}
+
+
+////////////////////////////////////////////////////////////
+const Font& TextLayout::getFont() const
+{
+    return *m_font;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextLayout::getCharacterSize() const
+{
+    return m_characterSize;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getLetterSpacing() const
+{
+    return m_letterSpacing;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getLineSpacing() const
+{
+    return m_lineSpacing;
+}
+
+
+////////////////////////////////////////////////////////////
+TextStyle TextLayout::getStyle() const
+{
+    return m_style;
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getWrapWidth() const
+{
+    return m_wrapWidth;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Span<const TextLayout::Line> TextLayout::getLines() const
+{
+    ensureLinesUpdate();
+    return {m_lines.data(), m_lines.size()};
+}
+
+
+////////////////////////////////////////////////////////////
+Vec2f TextLayout::getSize() const
+{
+    ensureLinesUpdate();
+
+    return {m_maxLineWidth,
+            static_cast<float>(m_lines.size()) * m_font->getLineSpacing(m_characterSize) * m_lineSpacing};
+}
+
+
+////////////////////////////////////////////////////////////
+UnicodeString TextLayout::getWrappedString() const
+{
+    ensureLinesUpdate();
+
+    UnicodeString result;
+
+    for (base::SizeT i = 0u; i < m_lines.size(); ++i)
+    {
+        if (i > 0u)
+            result.pushBack(U'\n');
+
+        for (base::SizeT j = m_lines[i].begin; j < m_lines[i].end; ++j)
+            result.pushBack(m_string[j]);
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::ensureWordsUpdate() const
+{
+    if (!m_wordsNeedUpdate)
+        return;
+
+    m_wordsNeedUpdate = false;
+    m_linesNeedUpdate = true;
+
+    m_words.clear();
+
+    const bool isBold = !!(m_style & TextStyle::Bold);
+
+    const auto spacing = TextUtils::precomputeSpacingConstants(*m_font,
+                                                               m_style,
+                                                               m_characterSize,
+                                                               m_letterSpacing,
+                                                               m_lineSpacing);
+
+    // Same metrics as `TextUtils::createTextGeometryAndGetBounds`, but only the advances are needed
+    float       x                   = 0.f;
+    float       prevWordEndX        = 0.f;
+    char32_t    prevChar            = 0;
+    base::SizeT spaceBegin          = 0u;
+    bool        inWord              = false;
+    bool        paragraphHasWords   = false;
+    bool        breakBeforeNextWord = true;
+
+    const auto endWord = [&](const base::SizeT end)
+    {
+        m_words.back().end   = end;
+        m_words.back().width = x - (prevWordEndX + m_words.back().spaceWidth);
+        prevWordEndX         = x;
+        inWord               = false;
+    };
+
+    // Paragraphs without words still take a line
+    const auto addEmptyParagraph = [&](const base::SizeT index)
+    {
+        m_words.pushBack({
+            .spaceBegin  = spaceBegin,
+            .begin       = index,
+            .end         = index,
+            .spaceWidth  = 0.f,
+            .width       = 0.f,
+            .breakBefore = true,
+        });
+    };
+
+    for (base::SizeT i = 0u; i < m_string.getSize(); ++i)
+    {
+        const char32_t curChar = m_string[i];
+
+        // Skip the \r char, as the text geometry does
+        if (curChar == U'\r')
+            continue;
+
+        const float kerning = m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        prevChar            = curChar;
+
+        if (curChar == U' ' || curChar == U'\t' || curChar == U'\n')
+        {
+            // The kerning before a whitespace belongs to the whitespace, which is dropped where lines are wrapped
+            if (inWord)
+            {
+                endWord(i);
+                spaceBegin = i;
+            }
+
+            x += kerning;
+
+            if (curChar == U'\n')
+            {
+                if (!paragraphHasWords)
+                    addEmptyParagraph(i);
+
+                x                   = 0.f;
+                prevWordEndX        = 0.f;
+                spaceBegin          = i + 1u;
+                paragraphHasWords   = false;
+                breakBeforeNextWord = true;
+                continue;
+            }
+
+            x += (curChar == U' ') ? spacing.whitespaceWidth : spacing.whitespaceWidth * 4.f;
+            continue;
+        }
+
+        x += kerning;
+
+        if (!inWord)
+        {
+            m_words.pushBack({
+                .spaceBegin  = spaceBegin,
+                .begin       = i,
+                .end         = i,
+                .spaceWidth  = x - prevWordEndX,
+                .width       = 0.f,
+                .breakBefore = breakBeforeNextWord,
+            });
+
+            inWord              = true;
+            paragraphHasWords   = true;
+            breakBeforeNextWord = false;
+        }
+
+        x += getGlyphAdvance(curChar, isBold) + spacing.finalLetterSpacing;
+    }
+
+    if (inWord)
+        endWord(m_string.getSize());
+    else if (!paragraphHasWords && !m_string.isEmpty())
+        addEmptyParagraph(m_string.getSize());
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::ensureLinesUpdate() const
+{
+    ensureWordsUpdate();
+
+    if (!m_linesNeedUpdate)
+        return;
+
+    m_linesNeedUpdate = false;
+
+    m_lines.clear();
+    m_maxLineWidth      = 0.f;
+    m_minValidWrapWidth = 0.f;
+    m_maxValidWrapWidth = SFML_BASE_FLOAT_MAX;
+
+    bool lineHasManyWords = false;
+
+    // Lines with a single word are kept for any smaller width, even if the word overflows
+    const auto closeLine = [&]
+    {
+        if (m_lines.empty())
+            return;
+
+        m_maxLineWidth = SFML_BASE_MAX(m_maxLineWidth, m_lines.back().width);
+
+        if (lineHasManyWords)
+            m_minValidWrapWidth = SFML_BASE_MAX(m_minValidWrapWidth, m_lines.back().width);
+
+        lineHasManyWords = false;
+    };
+
+    for (const Word& word : m_words)
+    {
+        // Paragraphs keep their leading whitespace
+        if (word.breakBefore)
+        {
+            closeLine();
+            m_lines.pushBack({.begin = word.spaceBegin, .end = word.end, .width = word.spaceWidth + word.width});
+            continue;
+        }
+
+        Line&       line          = m_lines.back();
+        const float extendedWidth = line.width + word.spaceWidth + word.width;
+
+        // Wrapped lines drop the whitespace at which they are wrapped
+        if (extendedWidth > m_wrapWidth)
+        {
+            m_maxValidWrapWidth = SFML_BASE_MIN(m_maxValidWrapWidth, extendedWidth);
+
+            closeLine();
+            m_lines.pushBack({.begin = word.begin, .end = word.end, .width = word.width});
+            continue;
+        }
+
+        line.end         = word.end;
+        line.width       = extendedWidth;
+        lineHasManyWords = true;
+    }
+
+    closeLine();
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getGlyphAdvance(const char32_t codePoint, const bool isBold) const
+{
+    if (codePoint >= 128u)
+        return m_font->getGlyph(codePoint, m_characterSize, isBold, /* outlineThickness */ 0.f).advance;
+
+    const base::U64 bit = base::U64{1u} << (codePoint % 64u);
+    base::U64&      mask = m_asciiAdvanceMask[codePoint / 64u];
+
+    if (!(mask & bit))
+    {
+        m_asciiAdvances[codePoint] = m_font->getGlyph(codePoint, m_characterSize, isBold, /* outlineThickness */ 0.f)
+                                         .advance;
+        mask |= bit;
+    }
+
+    return m_asciiAdvances[codePoint];
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::invalidateMeasurements()
+{
+    m_asciiAdvanceMask[0] = m_asciiAdvanceMask[1] = 0u;
+    m_wordsNeedUpdate                             = true;
+}
+
+} // namespace sf
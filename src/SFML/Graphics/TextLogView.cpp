@@ -0,0 +1,132 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/TextLogView.hpp"
+
+#include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/Text.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextLogView::TextLogView(const Font& font, const TextData& lineData, const base::SizeT maxLineCount) :
+    m_font(&font),
+    m_lineData(lineData),
+    m_maxLineCount(maxLineCount)
+{
+    SFML_BASE_ASSERT(m_maxLineCount > 0u);
+
+    m_lineData.string   = {};
+    m_lineData.position = {};
+    m_lineData.scale    = {1.f, 1.f};
+    m_lineData.origin   = {};
+    m_lineData.rotation = {};
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLogView::pushLine(const UnicodeString& line)
+{
+    // Reuse a previously cleared line
+    if (m_lineCount < m_lines.size())
+    {
+        ++m_lineCount;
+        getLineMut(m_lineCount - 1u).setString(line);
+        updateLinePositions();
+        return;
+    }
+
+    // Room for a new line
+    if (m_lineCount < m_maxLineCount)
+    {
+        m_lines.emplaceBack(*m_font, m_lineData).setString(line);
+        ++m_lineCount;
+        updateLinePositions();
+        return;
+    }
+
+    // View is full: recycle the top line as the new bottom line
+    m_lines[m_firstLine].setString(line);
+    m_firstLine = (m_firstLine + 1u) % m_maxLineCount;
+    updateLinePositions();
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLogView::appendToLastLine(const UnicodeString& string)
+{
+    if (m_lineCount == 0u)
+    {
+        pushLine(string);
+        return;
+    }
+
+    getLineMut(m_lineCount - 1u).appendString(string);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLogView::clear()
+{
+    m_lineCount = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT TextLogView::getLineCount() const
+{
+    return m_lineCount;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT TextLogView::getMaxLineCount() const
+{
+    return m_maxLineCount;
+}
+
+
+////////////////////////////////////////////////////////////
+const Text& TextLogView::getLine(const base::SizeT index) const
+{
+    SFML_BASE_ASSERT(index < m_lineCount);
+    return m_lines[(m_firstLine + index) % m_lines.size()];
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLogView::getLineHeight() const
+{
+    return m_font->getLineSpacing(m_lineData.characterSize) * m_lineData.lineSpacing;
+}
+
+
+////////////////////////////////////////////////////////////
+Text& TextLogView::getLineMut(const base::SizeT index)
+{
+    SFML_BASE_ASSERT(index < m_lineCount);
+    return m_lines[(m_firstLine + index) % m_lines.size()];
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLogView::updateLinePositions()
+{
+    // Only the transform of the lines changes, their geometry is kept
+    const float lineHeight = getLineHeight();
+
+    for (base::SizeT i = 0u; i < m_lineCount; ++i)
+        getLineMut(i).position = {0.f, static_cast<float>(i) * lineHeight};
+}
+
+} // namespace sf
@@ -0,0 +1,169 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/VertexPacking.hpp"
+
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/Math/Lround.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U16 toInt16Bits(const float value) noexcept
+{
+    const long rounded = SFML_BASE_MATH_LROUNDF(value);
+    const long clamped = SFML_BASE_MIN(SFML_BASE_MAX(rounded, -32'768l), 32'767l);
+
+    return static_cast<sf::base::U16>(static_cast<sf::base::I16>(clamped));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U16 toUInt16(const float value) noexcept
+{
+    const long rounded = SFML_BASE_MATH_LROUNDF(value);
+    return static_cast<sf::base::U16>(SFML_BASE_MIN(SFML_BASE_MAX(rounded, 0l), 65'535l));
+}
+
+
+////////////////////////////////////////////////////////////
+/// Round to nearest, out of range values become infinities
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::U16 toHalfFloatBits(const float value) noexcept
+{
+    sf::base::U32 bits{};
+    SFML_BASE_MEMCPY(&bits, &value, sizeof(bits));
+
+    const sf::base::U32 sign    = (bits >> 16u) & 0x80'00u;
+    const sf::base::U32 absBits = bits & 0x7F'FF'FF'FFu;
+
+    // Infinity or NaN
+    if (absBits >= 0x7F'80'00'00u)
+        return static_cast<sf::base::U16>(sign | 0x7C'00u | (absBits > 0x7F'80'00'00u ? 0x2'00u : 0u));
+
+    // Too large for a half float
+    if (absBits >= 0x47'80'00'00u)
+        return static_cast<sf::base::U16>(sign | 0x7C'00u);
+
+    // Subnormal half float, or zero
+    if (absBits < 0x38'80'00'00u)
+    {
+        if (absBits < 0x33'00'00'00u)
+            return static_cast<sf::base::U16>(sign);
+
+        const sf::base::U32 mantissa = (absBits & 0x7F'FF'FFu) | 0x80'00'00u;
+        const sf::base::U32 shift    = 126u - (absBits >> 23u);
+
+        return static_cast<sf::base::U16>(sign | ((mantissa + (1u << (shift - 1u))) >> shift));
+    }
+
+    // Rebias the exponent and round the mantissa to 10 bits
+    return static_cast<sf::base::U16>(sign | ((absBits - 0x38'00'00'00u + 0xF'FFu + ((absBits >> 13u) & 1u)) >> 13u));
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+base::SizeT getVertexSize(const VertexFormat format) noexcept
+{
+    return format == VertexFormat::Float32 ? sizeof(Vertex) : sizeof(PackedVertex);
+}
+
+
+////////////////////////////////////////////////////////////
+bool usesShortIndices(const VertexFormat format, const base::SizeT vertexCount) noexcept
+{
+    return format != VertexFormat::Float32 && vertexCount <= 65'536u;
+}
+
+
+////////////////////////////////////////////////////////////
+PackedGeometry packGeometry(const VertexFormat      format,
+                            const Vertex* const     vertexData,
+                            const base::SizeT       vertexCount,
+                            const IndexType* const  indexData,
+                            const base::SizeT       indexCount,
+                            base::Vector<base::U8>& buffer)
+{
+    if (format == VertexFormat::Float32)
+        return {
+            .vertexData      = vertexData,
+            .vertexByteCount = sizeof(Vertex) * vertexCount,
+            .indexData       = indexData,
+            .indexByteCount  = sizeof(IndexType) * indexCount,
+            .shortIndices    = false,
+        };
+
+    const bool        shortIndices    = usesShortIndices(format, vertexCount);
+    const base::SizeT vertexByteCount = sizeof(PackedVertex) * vertexCount;
+    const base::SizeT indexByteCount  = (shortIndices ? sizeof(base::U16) : sizeof(IndexType)) * indexCount;
+
+    // Packed vertices are 12 bytes, so indices that follow them stay aligned
+    buffer.clear();
+    base::U8* const bytes = buffer.reserve(vertexByteCount + indexByteCount);
+    buffer.unsafeSetSize(vertexByteCount + indexByteCount);
+
+    auto* const packedVertices = reinterpret_cast<PackedVertex*>(bytes);
+
+    if (format == VertexFormat::Int16)
+    {
+        for (base::SizeT i = 0u; i < vertexCount; ++i)
+        {
+            const Vertex& v = vertexData[i];
+
+            packedVertices[i] = {.position  = {toInt16Bits(v.position.x), toInt16Bits(v.position.y)},
+                                 .color     = v.color,
+                                 .texCoords = {toUInt16(v.texCoords.x), toUInt16(v.texCoords.y)}};
+        }
+    }
+    else
+    {
+        SFML_BASE_ASSERT(format == VertexFormat::HalfFloat);
+
+        for (base::SizeT i = 0u; i < vertexCount; ++i)
+        {
+            const Vertex& v = vertexData[i];
+
+            packedVertices[i] = {.position  = {toHalfFloatBits(v.position.x), toHalfFloatBits(v.position.y)},
+                                 .color     = v.color,
+                                 .texCoords = {toUInt16(v.texCoords.x), toUInt16(v.texCoords.y)}};
+        }
+    }
+
+    base::U8* const indexBytes = bytes + vertexByteCount;
+
+    if (shortIndices)
+    {
+        auto* const packedIndices = reinterpret_cast<base::U16*>(indexBytes);
+
+        for (base::SizeT i = 0u; i < indexCount; ++i)
+            packedIndices[i] = static_cast<base::U16>(indexData[i]);
+    }
+    else
+    {
+        SFML_BASE_MEMCPY(indexBytes, indexData, indexByteCount);
+    }
+
+    return {
+        .vertexData      = bytes,
+        .vertexByteCount = vertexByteCount,
+        .indexData       = indexBytes,
+        .indexByteCount  = indexByteCount,
+        .shortIndices    = shortIndices,
+    };
+}
+
+} // namespace sf::priv
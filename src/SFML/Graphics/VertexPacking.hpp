@@ -0,0 +1,87 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+struct Vertex;
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Vertex uploaded with `VertexFormat::Int16` or `VertexFormat::HalfFloat`
+///
+/// Position components are `I16` or half-float bits depending on
+/// the format, texture coordinates are pixel coordinates in both.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] PackedVertex
+{
+    base::U16 position[2];  //!< 2D position of the vertex
+    Color     color;        //!< Color of the vertex
+    base::U16 texCoords[2]; //!< Coordinates of the texture's pixel to map to the vertex
+};
+
+static_assert(sizeof(PackedVertex) == 12u);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Geometry ready to be uploaded to the GPU
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] PackedGeometry
+{
+    const void* vertexData;      //!< Vertices in the requested format
+    base::SizeT vertexByteCount; //!< Size of `vertexData` in bytes
+    const void* indexData;       //!< Indices, 16-bit if `shortIndices` is set
+    base::SizeT indexByteCount;  //!< Size of `indexData` in bytes
+    bool        shortIndices;    //!< Whether indices are 16-bit instead of `IndexType`
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size of a vertex uploaded in the given format
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::SizeT getVertexSize(VertexFormat format) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \brief Check whether indices are uploaded as 16-bit integers
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool usesShortIndices(VertexFormat format, base::SizeT vertexCount) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \brief Convert vertices and indices to the given format
+///
+/// `VertexFormat::Float32` geometry is returned as is, without
+/// copy. Otherwise the packed geometry is written to `buffer`,
+/// which must outlive its use.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] PackedGeometry packGeometry(VertexFormat            format,
+                                          const Vertex*           vertexData,
+                                          base::SizeT             vertexCount,
+                                          const IndexType*        indexData,
+                                          base::SizeT             indexCount,
+                                          base::Vector<base::U8>& buffer);
+
+} // namespace sf::priv
@@ -7,9 +7,29 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/ImGui/Backend.hpp"
 
+#include "SFML/Config.hpp"
+
 #include "SFML/GLUtils/GLCheck.hpp"
+#include "SFML/GLUtils/GLVAOGroup.hpp"
 #include "SFML/GLUtils/Glad.hpp"
 
+#ifdef SFML_OPENGL_ES
+    #include "SFML/GLUtils/GLStreamingBuffer.hpp"
+
+    #include "SFML/Base/Vector.hpp"
+#else
+    #include "SFML/GLUtils/GLPersistentBuffer.hpp"
+
+    #include "SFML/System/Err.hpp"
+
+    #include "SFML/Base/Abort.hpp"
+#endif
+
+#include "SFML/Base/Builtin/Memcmp.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include <imgui.h>
 
@@ -97,6 +117,8 @@
 namespace sf::priv
 {
 
+struct ImGui_ImplOpenGL3_BatchedData;
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -119,6 +141,9 @@ struct ImGui_ImplOpenGL3_Data
     bool         HasPolygonMode;
     bool         HasClipOrigin;
     bool         UseBufferSubData;
+    bool         UseBatchedRendering; // See `ImGui_ImplOpenGL3_SetBatchedRendering`
+
+    ImGui_ImplOpenGL3_BatchedData* Batched; // Created on the first batched render
 
     ImGui_ImplOpenGL3_Data()
     {
@@ -162,6 +187,53 @@ struct ImGui_ImplOpenGL3_VtxAttribState
 };
     #endif
 
+    #ifndef SFML_OPENGL_ES
+// Number of frames whose draw lists live in the persistent ring at the same time
+static constexpr base::SizeT ImGui_ImplOpenGL3_BatchedFramesInFlight = 3u;
+    #endif
+
+// Buffers used when `UseBatchedRendering` is set: all draw lists of a frame are uploaded at once.
+// On desktop OpenGL, frames are written to consecutive regions of a persistently mapped ring, guarded by fences.
+// On OpenGL ES, persistent mapping is unavailable: frames are appended to a buffer orphaned when full.
+struct ImGui_ImplOpenGL3_BatchedData
+{
+    GLVAOGroup VaoGroup; // VAO, VBO, and EBO shared by all draw lists
+
+    #ifdef SFML_OPENGL_ES
+    GLStreamingBuffer<GLVertexBufferObject>  VertexBuffer;
+    GLStreamingBuffer<GLElementBufferObject> IndexBuffer;
+
+    // Draw lists are not contiguous in memory, they are gathered here for a single upload
+    base::Vector<ImDrawVert> StagingVertices;
+    base::Vector<ImDrawIdx>  StagingIndices;
+    #else
+    GLPersistentBuffer<GLVertexBufferObject>  VertexBuffer;
+    GLPersistentBuffer<GLElementBufferObject> IndexBuffer;
+
+    GLsync      Fences[ImGui_ImplOpenGL3_BatchedFramesInFlight]{}; // Signaled once the GPU is done with a region
+    base::SizeT FrameVtxCapacity{};                                 // Number of vertices per region of the ring
+    base::SizeT FrameIdxCapacity{};                                 // Number of indices per region of the ring
+    base::SizeT CurrentFrame{};                                     // Region receiving the current frame
+    #endif
+
+    ImGui_ImplOpenGL3_BatchedData() = default;
+
+    ~ImGui_ImplOpenGL3_BatchedData()
+    {
+    #ifndef SFML_OPENGL_ES
+        for (GLsync& fence : Fences)
+            if (fence != nullptr)
+                glCheck(glDeleteSync(fence));
+
+        VertexBuffer.unmapIfNeeded(VaoGroup.vbo);
+        IndexBuffer.unmapIfNeeded(VaoGroup.ebo);
+    #endif
+    }
+
+    ImGui_ImplOpenGL3_BatchedData(const ImGui_ImplOpenGL3_BatchedData&)            = delete;
+    ImGui_ImplOpenGL3_BatchedData& operator=(const ImGui_ImplOpenGL3_BatchedData&) = delete;
+};
+
 // Functions
 bool ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
@@ -320,6 +392,50 @@ void ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateFontsTexture();
 }
 
+void ImGui_ImplOpenGL3_SetBatchedRendering(bool enabled)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+
+    // Batched buffers are kept until `ImGui_ImplOpenGL3_DestroyDeviceObjects`, in case the mode is toggled back
+    bd->UseBatchedRendering = enabled;
+}
+
+bool ImGui_ImplOpenGL3_IsBatchedRendering()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+
+    return bd->UseBatchedRendering;
+}
+
+// Setup attributes for ImDrawVert, reading vertices from `byte_offset` in the bound vertex buffer.
+// Used instead of glDrawElementsBaseVertex() to draw lists stored after each other, which GL ES and WebGL can't do.
+static void ImGui_ImplOpenGL3_SetupVertexAttribs(const ImGui_ImplOpenGL3_Data* bd, size_t byte_offset)
+{
+    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
+    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
+    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+    glCheck(glVertexAttribPointer(bd->AttribLocationVtxPos,
+                                  2,
+                                  GL_FLOAT,
+                                  GL_FALSE,
+                                  sizeof(ImDrawVert),
+                                  (GLvoid*)(byte_offset + offsetof(ImDrawVert, pos))));
+    glCheck(glVertexAttribPointer(bd->AttribLocationVtxUV,
+                                  2,
+                                  GL_FLOAT,
+                                  GL_FALSE,
+                                  sizeof(ImDrawVert),
+                                  (GLvoid*)(byte_offset + offsetof(ImDrawVert, uv))));
+    glCheck(glVertexAttribPointer(bd->AttribLocationVtxColor,
+                                  4,
+                                  GL_UNSIGNED_BYTE,
+                                  GL_TRUE,
+                                  sizeof(ImDrawVert),
+                                  (GLvoid*)(byte_offset + offsetof(ImDrawVert, col))));
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -384,6 +500,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         glCheck(glBindSampler(0, 0)); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
     #endif
 
+    if (bd->UseBatchedRendering)
+    {
+        // Vertex attributes are set up per draw list by `ImGui_ImplOpenGL3_RenderDrawListsBatched`
+        bd->Batched->VaoGroup.bind();
+        return;
+    }
+
     (void)vertex_array_object;
     #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     glCheck(glBindVertexArray(vertex_array_object));
@@ -392,122 +515,18 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     // Bind vertex/index buffers and setup attributes for ImDrawVert
     glCheck(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
     glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
-    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
-    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
-    glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
-    glCheck(glVertexAttribPointer(bd->AttribLocationVtxPos,
-                                  2,
-                                  GL_FLOAT,
-                                  GL_FALSE,
-                                  sizeof(ImDrawVert),
-                                  (GLvoid*)offsetof(ImDrawVert, pos)));
-    glCheck(
-        glVertexAttribPointer(bd->AttribLocationVtxUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
-    glCheck(glVertexAttribPointer(bd->AttribLocationVtxColor,
-                                  4,
-                                  GL_UNSIGNED_BYTE,
-                                  GL_TRUE,
-                                  sizeof(ImDrawVert),
-                                  (GLvoid*)offsetof(ImDrawVert, col)));
+    ImGui_ImplOpenGL3_SetupVertexAttribs(bd, 0);
 }
 
-// OpenGL3 Render function.
-// Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state
-// explicitly. This is in order to be able to run within an OpenGL engine that doesn't do so.
-void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
+// Render command lists, uploading each of them separately
+static void ImGui_ImplOpenGL3_RenderDrawLists(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
-    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
-    int fb_width  = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
-    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
-    if (fb_width <= 0 || fb_height <= 0)
-        return;
-
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
-    SFML_BASE_ASSERT(bd != nullptr);
-
-    // Backup GL state
-    GLenum last_active_texture;
-    glCheck(glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture));
-    glCheck(glActiveTexture(GL_TEXTURE0));
-    GLuint last_program;
-    glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program));
-    GLuint last_texture;
-    glCheck(glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture));
-    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
-    GLuint last_sampler;
-    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
-    {
-        glCheck(glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler));
-    }
-    else
-    {
-        last_sampler = 0;
-    }
-    #endif
-    GLuint last_array_buffer;
-    glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer));
-    #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
-    GLint last_element_array_buffer;
-    glCheck(glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer));
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_pos;
-    last_vtx_attrib_state_pos.GetState(bd->AttribLocationVtxPos);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_uv;
-    last_vtx_attrib_state_uv.GetState(bd->AttribLocationVtxUV);
-    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_color;
-    last_vtx_attrib_state_color.GetState(bd->AttribLocationVtxColor);
-    #endif
-    #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLuint last_vertex_array_object;
-    glCheck(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object));
-    #endif
-    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
-    GLint last_polygon_mode[2];
-    if (bd->HasPolygonMode)
-    {
-        glCheck(glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode));
-    }
-    #endif
-    GLint last_viewport[4];
-    glCheck(glGetIntegerv(GL_VIEWPORT, last_viewport));
-    GLint last_scissor_box[4];
-    glCheck(glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box));
-    GLenum last_blend_src_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb));
-    GLenum last_blend_dst_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb));
-    GLenum last_blend_src_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha));
-    GLenum last_blend_dst_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha));
-    GLenum last_blend_equation_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb));
-    GLenum last_blend_equation_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha));
-    GLboolean last_enable_blend        = glCheck(glIsEnabled(GL_BLEND));
-    GLboolean last_enable_cull_face    = glCheck(glIsEnabled(GL_CULL_FACE));
-    GLboolean last_enable_depth_test   = glCheck(glIsEnabled(GL_DEPTH_TEST));
-    GLboolean last_enable_stencil_test = glCheck(glIsEnabled(GL_STENCIL_TEST));
-    GLboolean last_enable_scissor_test = glCheck(glIsEnabled(GL_SCISSOR_TEST));
-    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
-    GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glCheck(glIsEnabled(GL_PRIMITIVE_RESTART)) : GL_FALSE;
-    #endif
-
-    // Setup desired GL state
-    // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared
-    // among GL contexts) The renderer would actually work without any VAO bound, but then our VertexAttrib calls would
-    // overwrite the default one currently bound.
-    GLuint vertex_array_object = 0;
-    #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glGenVertexArrays(1, &vertex_array_object));
-    #endif
-    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off   = draw_data->DisplayPos;       // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
-    // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -601,10 +620,306 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             }
         }
     }
+}
+
+    #ifndef SFML_OPENGL_ES
+// Wait until the GPU is done reading the ring region guarded by `fence`
+static void ImGui_ImplOpenGL3_WaitOnFence(GLsync& fence)
+{
+    if (fence == nullptr)
+        return;
+
+    const GLenum wait_result = glCheck(glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED));
+
+    if (wait_result == GL_WAIT_FAILED) [[unlikely]]
+    {
+        priv::err() << "FATAL ERROR: Error waiting on GPU fence";
+        base::abort();
+    }
+
+    glCheck(glDeleteSync(fence));
+    fence = nullptr;
+}
+    #endif
+
+// Upload all command lists at once and render them, merging consecutive commands that share a texture and a clip
+// rectangle. Requires the VAO group of the batched data to be bound.
+static void ImGui_ImplOpenGL3_RenderDrawListsBatched(ImDrawData* draw_data, int fb_width, int fb_height)
+{
+    ImGui_ImplOpenGL3_Data*        bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_BatchedData& bt = *bd->Batched;
+
+    const base::SizeT total_vtx_count = (base::SizeT)draw_data->TotalVtxCount;
+    const base::SizeT total_idx_count = (base::SizeT)draw_data->TotalIdxCount;
+    if (total_vtx_count == 0 || total_idx_count == 0)
+        return;
+
+    // Byte offsets of the vertices and indices of the frame in the buffers
+    base::SizeT vtx_offset = 0;
+    base::SizeT idx_offset = 0;
+
+    #ifdef SFML_OPENGL_ES
+    bt.StagingVertices.clear();
+    bt.StagingIndices.clear();
+    bt.StagingVertices.reserve(total_vtx_count);
+    bt.StagingIndices.reserve(total_idx_count);
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        bt.StagingVertices.unsafeEmplaceBackRange(cmd_list->VtxBuffer.Data, (base::SizeT)cmd_list->VtxBuffer.Size);
+        bt.StagingIndices.unsafeEmplaceBackRange(cmd_list->IdxBuffer.Data, (base::SizeT)cmd_list->IdxBuffer.Size);
+    }
+
+    vtx_offset = bt.VertexBuffer.write(bt.StagingVertices.data(), total_vtx_count * sizeof(ImDrawVert));
+    idx_offset = bt.IndexBuffer.write(bt.StagingIndices.data(), total_idx_count * sizeof(ImDrawIdx));
+    #else
+    bt.CurrentFrame = (bt.CurrentFrame + 1) % ImGui_ImplOpenGL3_BatchedFramesInFlight;
+    ImGui_ImplOpenGL3_WaitOnFence(bt.Fences[bt.CurrentFrame]);
+
+    if (total_vtx_count > bt.FrameVtxCapacity || total_idx_count > bt.FrameIdxCapacity)
+    {
+        bt.FrameVtxCapacity = SFML_BASE_MAX(total_vtx_count, bt.FrameVtxCapacity + bt.FrameVtxCapacity / 2);
+        bt.FrameIdxCapacity = SFML_BASE_MAX(total_idx_count, bt.FrameIdxCapacity + bt.FrameIdxCapacity / 2);
+
+        // Growing creates new buffers, pending draws keep reading from the old ones
+        const base::SizeT frames = ImGui_ImplOpenGL3_BatchedFramesInFlight;
+        (void)bt.VertexBuffer.reserve(bt.VaoGroup.vbo, sizeof(ImDrawVert) * bt.FrameVtxCapacity * frames);
+        (void)bt.IndexBuffer.reserve(bt.VaoGroup.ebo, sizeof(ImDrawIdx) * bt.FrameIdxCapacity * frames);
+
+        for (GLsync& fence : bt.Fences)
+            if (fence != nullptr)
+            {
+                glCheck(glDeleteSync(fence));
+                fence = nullptr;
+            }
+    }
+
+    vtx_offset = sizeof(ImDrawVert) * bt.FrameVtxCapacity * bt.CurrentFrame;
+    idx_offset = sizeof(ImDrawIdx) * bt.FrameIdxCapacity * bt.CurrentFrame;
+
+    {
+        char* vtx_dst = (char*)bt.VertexBuffer.data() + vtx_offset;
+        char* idx_dst = (char*)bt.IndexBuffer.data() + idx_offset;
+
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* cmd_list       = draw_data->CmdLists[n];
+            const base::SizeT vtx_byte_count = (base::SizeT)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert);
+            const base::SizeT idx_byte_count = (base::SizeT)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+
+            SFML_BASE_MEMCPY(vtx_dst, cmd_list->VtxBuffer.Data, vtx_byte_count);
+            SFML_BASE_MEMCPY(idx_dst, cmd_list->IdxBuffer.Data, idx_byte_count);
+
+            vtx_dst += vtx_byte_count;
+            idx_dst += idx_byte_count;
+        }
+    }
+
+    bt.VertexBuffer
+        .flushWritesToGPU(bt.VaoGroup.vbo, sizeof(ImDrawVert), total_vtx_count, bt.FrameVtxCapacity * bt.CurrentFrame);
+    bt.IndexBuffer
+        .flushWritesToGPU(bt.VaoGroup.ebo, sizeof(ImDrawIdx), total_idx_count, bt.FrameIdxCapacity * bt.CurrentFrame);
+    #endif
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off   = draw_data->DisplayPos;       // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Redundant state changes are skipped, until a user callback may have changed the state behind our back
+    bool        state_known        = false;
+    base::SizeT last_attrib_offset = 0;
+    ImTextureID last_texture       = 0;
+    GLint       last_scissor[4]    = {};
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, 0);
+                else
+                    pcmd->UserCallback(cmd_list, pcmd);
+
+                state_known = false;
+                continue;
+            }
+
+            // Merge the following commands drawing contiguous indices with the same state
+            unsigned int elem_count = pcmd->ElemCount;
+            while (cmd_i + 1 < cmd_list->CmdBuffer.Size)
+            {
+                const ImDrawCmd* next_cmd = &cmd_list->CmdBuffer[cmd_i + 1];
+                if (next_cmd->UserCallback != nullptr || next_cmd->GetTexID() != pcmd->GetTexID() ||
+                    next_cmd->VtxOffset != pcmd->VtxOffset || next_cmd->IdxOffset != pcmd->IdxOffset + elem_count ||
+                    SFML_BASE_MEMCMP(&next_cmd->ClipRect, &pcmd->ClipRect, sizeof(ImVec4)) != 0)
+                    break;
+
+                elem_count += next_cmd->ElemCount;
+                cmd_i++;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x,
+                            (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x,
+                            (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+
+            // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+            const GLint scissor[4] = {(GLint)clip_min.x,
+                                      (GLint)((float)fb_height - clip_max.y),
+                                      (GLint)(clip_max.x - clip_min.x),
+                                      (GLint)(clip_max.y - clip_min.y)};
+
+            if (!state_known || SFML_BASE_MEMCMP(scissor, last_scissor, sizeof(scissor)) != 0)
+            {
+                glCheck(glScissor(scissor[0], scissor[1], scissor[2], scissor[3]));
+                SFML_BASE_MEMCPY(last_scissor, scissor, sizeof(scissor));
+            }
+
+            if (!state_known || pcmd->GetTexID() != last_texture)
+            {
+                glCheck(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                last_texture = pcmd->GetTexID();
+            }
+
+            const base::SizeT attrib_offset = vtx_offset + pcmd->VtxOffset * sizeof(ImDrawVert);
+            if (!state_known || attrib_offset != last_attrib_offset)
+            {
+                ImGui_ImplOpenGL3_SetupVertexAttribs(bd, attrib_offset);
+                last_attrib_offset = attrib_offset;
+            }
+
+            state_known = true;
+
+            glCheck(glDrawElements(GL_TRIANGLES,
+                                   (GLsizei)elem_count,
+                                   sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT,
+                                   (void*)(intptr_t)(idx_offset + pcmd->IdxOffset * sizeof(ImDrawIdx))));
+        }
+
+        vtx_offset += (base::SizeT)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert);
+        idx_offset += (base::SizeT)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+    }
+
+    #ifndef SFML_OPENGL_ES
+    // Mark the end of the draws reading from the region of the ring
+    bt.Fences[bt.CurrentFrame] = glCheck(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    #endif
+}
+
+// OpenGL3 Render function.
+// Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state
+// explicitly. This is in order to be able to run within an OpenGL engine that doesn't do so.
+void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width  = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    SFML_BASE_ASSERT(bd != nullptr);
+
+    // Backup GL state
+    GLenum last_active_texture;
+    glCheck(glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture));
+    glCheck(glActiveTexture(GL_TEXTURE0));
+    GLuint last_program;
+    glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program));
+    GLuint last_texture;
+    glCheck(glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture));
+    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+    GLuint last_sampler;
+    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+    {
+        glCheck(glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler));
+    }
+    else
+    {
+        last_sampler = 0;
+    }
+    #endif
+    GLuint last_array_buffer;
+    glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer));
+    #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
+    GLint last_element_array_buffer;
+    glCheck(glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer));
+    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_pos;
+    last_vtx_attrib_state_pos.GetState(bd->AttribLocationVtxPos);
+    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_uv;
+    last_vtx_attrib_state_uv.GetState(bd->AttribLocationVtxUV);
+    ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_color;
+    last_vtx_attrib_state_color.GetState(bd->AttribLocationVtxColor);
+    #endif
+    #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    GLuint last_vertex_array_object;
+    glCheck(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object));
+    #endif
+    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
+    GLint last_polygon_mode[2];
+    if (bd->HasPolygonMode)
+    {
+        glCheck(glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode));
+    }
+    #endif
+    GLint last_viewport[4];
+    glCheck(glGetIntegerv(GL_VIEWPORT, last_viewport));
+    GLint last_scissor_box[4];
+    glCheck(glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box));
+    GLenum last_blend_src_rgb;
+    glCheck(glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb));
+    GLenum last_blend_dst_rgb;
+    glCheck(glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb));
+    GLenum last_blend_src_alpha;
+    glCheck(glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha));
+    GLenum last_blend_dst_alpha;
+    glCheck(glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha));
+    GLenum last_blend_equation_rgb;
+    glCheck(glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb));
+    GLenum last_blend_equation_alpha;
+    glCheck(glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha));
+    GLboolean last_enable_blend        = glCheck(glIsEnabled(GL_BLEND));
+    GLboolean last_enable_cull_face    = glCheck(glIsEnabled(GL_CULL_FACE));
+    GLboolean last_enable_depth_test   = glCheck(glIsEnabled(GL_DEPTH_TEST));
+    GLboolean last_enable_stencil_test = glCheck(glIsEnabled(GL_STENCIL_TEST));
+    GLboolean last_enable_scissor_test = glCheck(glIsEnabled(GL_SCISSOR_TEST));
+    #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+    GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glCheck(glIsEnabled(GL_PRIMITIVE_RESTART)) : GL_FALSE;
+    #endif
+
+    // Setup desired GL state
+    // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared
+    // among GL contexts) The renderer would actually work without any VAO bound, but then our VertexAttrib calls would
+    // overwrite the default one currently bound.
+    // In batched mode, the VAO of the batched data is reused instead.
+    GLuint vertex_array_object = 0;
+    #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    if (!bd->UseBatchedRendering)
+        glCheck(glGenVertexArrays(1, &vertex_array_object));
+    #endif
+    if (bd->UseBatchedRendering && bd->Batched == nullptr)
+        bd->Batched = IM_NEW2(ImGui_ImplOpenGL3_BatchedData)();
+    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+
+    if (bd->UseBatchedRendering)
+        ImGui_ImplOpenGL3_RenderDrawListsBatched(draw_data, fb_width, fb_height);
+    else
+        ImGui_ImplOpenGL3_RenderDrawLists(draw_data, fb_width, fb_height, vertex_array_object);
 
     // Destroy the temporary VAO
     #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glDeleteVertexArrays(1, &vertex_array_object));
+    if (vertex_array_object != 0)
+        glCheck(glDeleteVertexArrays(1, &vertex_array_object));
     #endif
 
     // Restore modified GL state
@@ -983,6 +1298,11 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
 void ImGui_ImplOpenGL3_DestroyDeviceObjects()
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->Batched)
+    {
+        IM_DELETE(bd->Batched);
+        bd->Batched = nullptr;
+    }
     if (bd->VboHandle)
     {
         glCheck(glDeleteBuffers(1, &bd->VboHandle));
@@ -26,4 +26,20 @@ void ImGui_ImplOpenGL3_NewFrame();
 // NOLINTNEXTLINE(readability-identifier-naming)
 void ImGui_ImplOpenGL3_Shutdown();
 
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable batched rendering for the current ImGui context
+///
+/// When enabled, all draw lists of a frame are uploaded at once
+/// (to a persistently mapped ring buffer on desktop OpenGL), and
+/// consecutive commands sharing a texture and a clip rectangle
+/// are drawn with a single draw call.
+///
+////////////////////////////////////////////////////////////
+// NOLINTNEXTLINE(readability-identifier-naming)
+void ImGui_ImplOpenGL3_SetBatchedRendering(bool enabled);
+
+////////////////////////////////////////////////////////////
+// NOLINTNEXTLINE(readability-identifier-naming)
+[[nodiscard]] bool ImGui_ImplOpenGL3_IsBatchedRendering();
+
 } // namespace sf::priv
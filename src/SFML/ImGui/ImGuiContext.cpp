@@ -1098,6 +1098,22 @@ void ImGuiContext::render(RenderTarget& target)
 }
 
 
+////////////////////////////////////////////////////////////
+void ImGuiContext::setBatchedRenderingEnabled(bool enabled)
+{
+    ::ImGui::SetCurrentContext(m_impl->imContext);
+    priv::ImGui_ImplOpenGL3_SetBatchedRendering(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImGuiContext::isBatchedRenderingEnabled() const
+{
+    ::ImGui::SetCurrentContext(m_impl->imContext);
+    return priv::ImGui_ImplOpenGL3_IsBatchedRendering();
+}
+
+
 ////////////////////////////////////////////////////////////
 // TODO P1: add TextureDrawParams overload, use in BubbleByte
 void ImGuiContext::image(const Texture& texture, Color tintColor, Color borderColor)
@@ -0,0 +1,254 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/DnsResolver.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/IpAddressUtils.hpp"
+#include "SFML/Network/SocketImpl.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/String.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/ThreadPool.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct DnsResolver::Lookup::State
+{
+    std::atomic<unsigned int> refCount{0u}; //!< Number of handles referring to this state
+    std::atomic<bool>         ready{false}; //!< Set once `addresses` has been written
+
+    std::mutex              mutex;             //!< Protects `ready` transitions for `wait`
+    std::condition_variable conditionVariable; //!< Notified when the lookup completes
+
+    base::String            hostName;  //!< Name being resolved
+    base::Vector<IpAddress> addresses; //!< Result, only accessed after `ready` is set
+
+    ////////////////////////////////////////////////////////////
+    void complete(base::Vector<IpAddress>&& result)
+    {
+        {
+            const std::lock_guard lock(mutex);
+
+            addresses = SFML_BASE_MOVE(result);
+            ready.store(true, std::memory_order_release);
+        }
+
+        conditionVariable.notify_all();
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup::Lookup(State& state) : m_state(&state)
+{
+    m_state->refCount.fetch_add(1u, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup::~Lookup()
+{
+    if (m_state != nullptr && m_state->refCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        delete m_state;
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup::Lookup(const Lookup& rhs) : m_state(rhs.m_state)
+{
+    SFML_BASE_ASSERT(m_state != nullptr);
+    m_state->refCount.fetch_add(1u, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup& DnsResolver::Lookup::operator=(const Lookup& rhs)
+{
+    if (&rhs == this)
+        return *this;
+
+    Lookup copy(rhs);
+    return *this = SFML_BASE_MOVE(copy);
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup::Lookup(Lookup&& rhs) noexcept : m_state(rhs.m_state)
+{
+    rhs.m_state = nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup& DnsResolver::Lookup::operator=(Lookup&& rhs) noexcept
+{
+    if (&rhs == this)
+        return *this;
+
+    Lookup old(SFML_BASE_MOVE(*this));
+
+    m_state     = rhs.m_state;
+    rhs.m_state = nullptr;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool DnsResolver::Lookup::isReady() const
+{
+    SFML_BASE_ASSERT(m_state != nullptr && "Using a moved-from lookup");
+    return m_state->ready.load(std::memory_order_acquire);
+}
+
+
+////////////////////////////////////////////////////////////
+void DnsResolver::Lookup::wait() const
+{
+    if (isReady())
+        return;
+
+    std::unique_lock lock(m_state->mutex);
+    m_state->conditionVariable.wait(lock, [this] { return m_state->ready.load(std::memory_order_acquire); });
+}
+
+
+////////////////////////////////////////////////////////////
+base::Span<const IpAddress> DnsResolver::Lookup::getAddresses() const
+{
+    if (!isReady())
+        return {};
+
+    return {m_state->addresses.data(), m_state->addresses.size()};
+}
+
+
+////////////////////////////////////////////////////////////
+struct DnsResolver::Impl
+{
+    struct CacheEntry
+    {
+        Lookup lookup;      //!< Shared with the handles returned by `resolve`
+        Time   requestedAt; //!< Time at which the lookup was started, relative to `clock`
+    };
+
+    explicit Impl(Time theTimeToLive, base::SizeT workerCount) : timeToLive(theTimeToLive), threadPool(workerCount)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    void purgeCache()
+    {
+        const Time now = clock.getElapsedTime();
+
+        for (base::SizeT i = cache.size(); i-- > 0u;)
+        {
+            const CacheEntry& entry = cache[i];
+
+            const bool expired = now - entry.requestedAt >= timeToLive;
+            const bool failed  = entry.lookup.isReady() && entry.lookup.getAddresses().empty();
+
+            if (expired || failed)
+            {
+                // Order does not matter, swap with the last entry instead of shifting the whole cache
+                if (i + 1u != cache.size())
+                    cache[i] = SFML_BASE_MOVE(cache.back());
+
+                cache.popBack();
+            }
+        }
+    }
+
+    Clock                    clock;      //!< Time reference of the cache entries
+    Time                     timeToLive; //!< How long lookups stay in the cache
+    base::Vector<CacheEntry> cache;      //!< Pending and completed lookups, at most one per host name
+
+    base::ThreadPool threadPool; //!< Runs the lookups, declared last so that it is joined first
+};
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::DnsResolver(Time timeToLive, base::SizeT workerCount) :
+    m_impl(base::makeUnique<Impl>(timeToLive, workerCount))
+{
+    SFML_BASE_ASSERT(workerCount > 0u);
+}
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::~DnsResolver() = default;
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::DnsResolver(DnsResolver&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+DnsResolver& DnsResolver::operator=(DnsResolver&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+DnsResolver::Lookup DnsResolver::resolve(base::StringView hostName)
+{
+    m_impl->purgeCache();
+
+    for (const Impl::CacheEntry& entry : m_impl->cache)
+        if (entry.lookup.m_state->hostName == hostName)
+            return entry.lookup;
+
+    auto* state     = new Lookup::State;
+    state->hostName = base::String{hostName};
+
+    Lookup lookup(*state);
+
+    // Address literals do not need a query, don't occupy a worker for them
+    const char* const cHostName = state->hostName.data();
+    if (priv::SocketImpl::inetAddr(cHostName).hasValue() || priv::SocketImpl::inetPtonV6(cHostName).hasValue())
+    {
+        state->complete(IpAddressUtils::resolveAll(state->hostName));
+        return lookup;
+    }
+
+    m_impl->cache.pushBack(Impl::CacheEntry{lookup, m_impl->clock.getElapsedTime()});
+
+    m_impl->threadPool.post([pending = lookup]
+    { pending.m_state->complete(IpAddressUtils::resolveAll(pending.m_state->hostName)); });
+
+    return lookup;
+}
+
+
+////////////////////////////////////////////////////////////
+void DnsResolver::clearCache()
+{
+    m_impl->cache.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT DnsResolver::getCacheSize() const
+{
+    return m_impl->cache.size();
+}
+
+} // namespace sf
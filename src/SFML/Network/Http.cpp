@@ -10,6 +10,7 @@
 #include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/IpAddressUtils.hpp"
 #include "SFML/Network/TcpSocket.hpp"
+#include "SFML/Network/TlsSessionCache.hpp"
 
 #include "SFML/System/IO.hpp"
 
@@ -18,6 +19,7 @@
 #include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/String.hpp"
 #include "SFML/Base/StringView.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #include <map>
 
@@ -382,15 +384,27 @@ void Http::Response::parse(const base::String& data)
 ////////////////////////////////////////////////////////////
 struct Http::Impl
 {
-    TcpSocket                 connection;   //!< Connection to the host
-    base::Optional<IpAddress> host;         //!< Web host address
-    base::String              hostName;     //!< Web host name
-    unsigned short            port{0u};     //!< Port used for connection with host
-    bool                      https{false}; //!< Use HTTPS
+    base::Optional<TlsSessionCache> tlsSessionCache; //!< Lets each HTTPS request resume the previous TLS session
+    TcpSocket                       connection;      //!< Connection to the host
+    base::Vector<IpAddress>         hosts;           //!< Web host addresses, interleaved by family
+    base::String                    hostName;        //!< Web host name
+    unsigned short                  port{0u};        //!< Port used for connection with host
+    bool                            https{false};    //!< Use HTTPS
 
     explicit Impl() : connection(/* isBlocking */ true)
     {
     }
+
+    ////////////////////////////////////////////////////////////
+    // Created on the first HTTPS request, so that plain HTTP clients do not pay for it
+    ////////////////////////////////////////////////////////////
+    void ensureTlsSessionCache()
+    {
+        if (tlsSessionCache.hasValue())
+            return;
+
+        connection.setTlsSessionCache(&tlsSessionCache.emplace(TlsSessionCacheSettings{.maxSessions = 4u}));
+    }
 };
 
 
@@ -437,8 +451,8 @@ bool Http::setHost(const base::String& host, unsigned short port)
     if (!m_impl->hostName.empty() && (m_impl->hostName.back() == '/'))
         m_impl->hostName.erase(m_impl->hostName.size() - 1);
 
-    m_impl->host = IpAddressUtils::resolve(m_impl->hostName);
-    return m_impl->host.hasValue();
+    m_impl->hosts = IpAddressUtils::resolveAll(m_impl->hostName);
+    return !m_impl->hosts.empty();
 }
 
 
@@ -473,9 +487,13 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout, con
     // Prepare the response
     Response received;
 
+    if (m_impl->https)
+        m_impl->ensureTlsSessionCache();
+
     // Connect the socket to the host
-    if (m_impl->host.hasValue() &&
-        m_impl->connection.connect(m_impl->host.value(), m_impl->port, timeout) == Socket::Status::Done)
+    if (!m_impl->hosts.empty() &&
+        m_impl->connection.connect({m_impl->hosts.data(), m_impl->hosts.size()}, m_impl->port, timeout) ==
+            Socket::Status::Done)
     {
         if (m_impl->https &&
             (m_impl->connection.setupTlsClient(m_impl->hostName, verifyServer) != TcpSocket::TlsStatus::HandshakeComplete))
@@ -13,7 +13,10 @@
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Array.hpp"
+#include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/String.hpp"
 
 
@@ -23,25 +26,62 @@ namespace sf
 const IpAddress IpAddress::Any(0, 0, 0, 0);
 const IpAddress IpAddress::LocalHost(127, 0, 0, 1);
 const IpAddress IpAddress::Broadcast(255, 255, 255, 255);
+const IpAddress IpAddress::AnyV6(base::Array<base::U8, 16>{});
+const IpAddress IpAddress::LocalHostV6(base::Array<base::U8, 16>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
 
 
 ////////////////////////////////////////////////////////////
 IpAddress::IpAddress(base::U8 byte0, base::U8 byte1, base::U8 byte2, base::U8 byte3) :
-    m_address(static_cast<base::U32>((byte0 << 24) | (byte1 << 16) | (byte2 << 8) | byte3))
+    m_bytes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, byte0, byte1, byte2, byte3},
+    m_type(Type::IpV4)
 {
 }
 
 
 ////////////////////////////////////////////////////////////
-IpAddress::IpAddress(base::U32 address) : m_address(address)
+IpAddress::IpAddress(base::U32 address) :
+    IpAddress(static_cast<base::U8>(address >> 24),
+              static_cast<base::U8>(address >> 16),
+              static_cast<base::U8>(address >> 8),
+              static_cast<base::U8>(address))
 {
 }
 
 
+////////////////////////////////////////////////////////////
+IpAddress::IpAddress(const base::Array<base::U8, 16>& bytes) : m_bytes(bytes), m_type(Type::IpV6)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress::Type IpAddress::getType() const
+{
+    return m_type;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IpAddress::isV6() const
+{
+    return m_type == Type::IpV6;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::U32 IpAddress::toInteger() const
 {
-    return m_address;
+    SFML_BASE_ASSERT(m_type == Type::IpV4 && "Only IPv4 addresses can be converted to an integer");
+
+    return (static_cast<base::U32>(m_bytes[12]) << 24) | (static_cast<base::U32>(m_bytes[13]) << 16) |
+           (static_cast<base::U32>(m_bytes[14]) << 8) | static_cast<base::U32>(m_bytes[15]);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Array<base::U8, 16> IpAddress::toBytes() const
+{
+    return m_bytes;
 }
 
 
@@ -119,7 +159,15 @@ base::Optional<IpAddress> IpAddress::getPublicAddress(Time timeout)
 ////////////////////////////////////////////////////////////
 bool operator<(IpAddress lhs, IpAddress rhs)
 {
-    return lhs.m_address < rhs.m_address;
+    // IPv4 addresses sort before IPv6 ones, then bytes are compared in network order
+    if (lhs.m_type != rhs.m_type)
+        return lhs.m_type < rhs.m_type;
+
+    for (base::SizeT i = 0u; i < 16u; ++i)
+        if (lhs.m_bytes[i] != rhs.m_bytes[i])
+            return lhs.m_bytes[i] < rhs.m_bytes[i];
+
+    return false;
 }
 
 
@@ -12,7 +12,9 @@
 
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/String.hpp"
+#include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/StringView.hpp"
+#include "SFML/Base/Vector.hpp"
 
 
 namespace sf
@@ -42,23 +44,83 @@ base::Optional<IpAddress> IpAddressUtils::resolve(base::StringView address)
     if (const auto ip = priv::SocketImpl::inetAddr(address.data()); ip.hasValue())
         return base::makeOptional<IpAddress>(priv::SocketImpl::getNtohl(*ip));
 
-    // Not a valid address, try to convert it as a host name
-    const base::Optional converted = priv::SocketImpl::convertToHostname(address.data());
+    // Try to convert the address as an IPv6 address ("xxxx:xxxx::xxxx")
+    if (const auto ip = priv::SocketImpl::inetPtonV6(address.data()); ip.hasValue())
+        return ip;
 
-    if (!converted.hasValue())
+    // Not a valid address, try to convert it as a host name, preferring IPv4
+    if (const base::Optional converted = priv::SocketImpl::convertToHostname(address.data()); converted.hasValue())
+        return base::makeOptional<IpAddress>(priv::SocketImpl::getNtohl(*converted));
+
+    // Fall back to the first IPv6 address of the host, if any
+    const base::Vector<IpAddress> addresses = priv::SocketImpl::getAddressInfo(address.data());
+
+    if (addresses.empty())
     {
         // Not generating en error message here as resolution failure is a valid outcome.
         return base::nullOpt;
     }
 
-    return base::makeOptional<IpAddress>(priv::SocketImpl::getNtohl(*converted));
+    return base::makeOptional(addresses.front());
+}
+
+
+////////////////////////////////////////////////////////////
+base::Vector<IpAddress> IpAddressUtils::resolveAll(base::StringView address)
+{
+    base::Vector<IpAddress> result;
+
+    if (address.empty())
+        return result;
+
+    // Address literals resolve to themselves
+    const bool isLiteral = priv::SocketImpl::inetAddr(address.data()).hasValue() ||
+                           priv::SocketImpl::inetPtonV6(address.data()).hasValue();
+
+    if (isLiteral)
+    {
+        if (const base::Optional ip = resolve(address); ip.hasValue())
+            result.pushBack(*ip);
+
+        return result;
+    }
+
+    const base::Vector<IpAddress> addresses = priv::SocketImpl::getAddressInfo(address.data());
+
+    // Interleave the families, starting with IPv6 (RFC 8305, section 4)
+    base::SizeT nextV6 = 0u;
+    base::SizeT nextV4 = 0u;
+
+    const auto findNext = [&](base::SizeT& index, bool v6)
+    {
+        while (index < addresses.size() && addresses[index].isV6() != v6)
+            ++index;
+
+        return index < addresses.size();
+    };
+
+    result.reserve(addresses.size());
+
+    while (result.size() < addresses.size())
+    {
+        if (findNext(nextV6, /* v6 */ true))
+            result.pushBack(addresses[nextV6++]);
+
+        if (findNext(nextV4, /* v6 */ false))
+            result.pushBack(addresses[nextV4++]);
+    }
+
+    return result;
 }
 
 
 ////////////////////////////////////////////////////////////
 base::String IpAddressUtils::toString(IpAddress ipAddress)
 {
-    return priv::SocketImpl::addrToString(priv::SocketImpl::getNtohl(ipAddress.m_address));
+    if (ipAddress.isV6())
+        return priv::SocketImpl::addrToStringV6(ipAddress.m_bytes);
+
+    return priv::SocketImpl::addrToString(priv::SocketImpl::getHtonl(ipAddress.toInteger()));
 }
 
 } // namespace sf
@@ -8,13 +8,16 @@
 #include "SFML/Network/Packet.hpp"
 
 #include "SFML/Network/SocketImpl.hpp"
+#include "SFML/Network/VarIntCodec.hpp"
 
 #include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/Utf8String.hpp"
 
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Builtin/Memcpy.hpp"
 #include "SFML/Base/Builtin/Strlen.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
 
 #include <string>
 
@@ -44,6 +47,12 @@ using Byte = unsigned char;
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+Packet::Packet(base::MemoryResource& resource) : m_data{resource}
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Packet::append(const void* data, base::SizeT sizeInBytes)
 {
@@ -368,6 +377,27 @@ Packet& Packet::operator>>(UnicodeString& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::operator>>(Utf8String& data)
+{
+    // First extract the byte length
+    base::U32 length = 0;
+    *this >> length;
+
+    data.clear();
+    if ((length > 0) && checkSize(length))
+    {
+        // Then extract the UTF-8 bytes
+        data += base::StringView{reinterpret_cast<const char*>(&m_data[m_readPos]), length};
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Packet& Packet::operator<<(bool data)
 {
@@ -568,6 +598,95 @@ Packet& Packet::operator<<(const UnicodeString& data)
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::operator<<(const Utf8String& data)
+{
+    // First insert the byte length
+    const auto length = static_cast<base::U32>(data.getByteSize());
+    *this << length;
+
+    // Then insert the UTF-8 bytes
+    if (length > 0)
+        append(data.getData(), length);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::appendVarUInt(base::U64 data)
+{
+    // At most 10 groups of 7 bits
+    unsigned char bytes[10];
+    base::SizeT   count = 0u;
+
+    while (data >= 0x80u)
+    {
+        bytes[count++] = static_cast<unsigned char>(data | 0x80u);
+        data >>= 7;
+    }
+
+    bytes[count++] = static_cast<unsigned char>(data);
+
+    append(bytes, count);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::appendVarInt(base::I64 data)
+{
+    // Zigzag encoding: the sign ends up in the least significant bit
+    const auto value = static_cast<base::U64>(data);
+    return appendVarUInt((value << 1) ^ (data < 0 ? ~base::U64{0} : base::U64{0}));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractVarUInt(base::U64& data)
+{
+    m_isValid = m_isValid && priv::decodeVarUInt(m_data.data(), m_data.size(), m_readPos, data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::extractVarInt(base::I64& data)
+{
+    base::U64 value = 0u;
+
+    if (extractVarUInt(value))
+        data = priv::zigZagDecode(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Packet::extractCountedBytes(base::SizeT elementSize, base::SizeT& count, const unsigned char*& bytes)
+{
+    SFML_BASE_ASSERT(elementSize > 0u);
+
+    base::U64 value = 0u;
+
+    if (!extractVarUInt(value))
+        return false;
+
+    // Checked by division to prevent overflows on malicious counts
+    if (value > (m_data.size() - m_readPos) / elementSize)
+    {
+        m_isValid = false;
+        return false;
+    }
+
+    count = static_cast<base::SizeT>(value);
+    bytes = m_data.data() + m_readPos;
+
+    m_readPos += count * elementSize;
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(base::SizeT size)
 {
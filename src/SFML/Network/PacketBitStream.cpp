@@ -0,0 +1,238 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/PacketBitStream.hpp"
+
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr sf::base::U64 lowBitsMask(unsigned int bitCount)
+{
+    return (sf::base::U64{1} << bitCount) - 1u;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr unsigned int bitWidth(sf::base::U64 value)
+{
+    unsigned int width = 0u;
+
+    while (value != 0u)
+    {
+        value >>= 1;
+        ++width;
+    }
+
+    return width;
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of bits needed to write any integer of [`min`, `max`]
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr unsigned int rangedIntBitCount(sf::base::I32 min, sf::base::I32 max)
+{
+    SFML_BASE_ASSERT(min <= max);
+    return bitWidth(static_cast<sf::base::U64>(static_cast<sf::base::I64>(max) - min));
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PacketBitWriter::PacketBitWriter(Packet& packet) : m_packet(packet)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PacketBitWriter::~PacketBitWriter()
+{
+    flush();
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBitWriter::writeBits(base::U32 value, unsigned int bitCount)
+{
+    SFML_BASE_ASSERT(bitCount >= 1u && bitCount <= 32u);
+
+    m_scratch |= (value & lowBitsMask(bitCount)) << m_scratchBits;
+    m_scratchBits += bitCount;
+    m_totalBitCount += bitCount;
+
+    // Append whole 32-bit words, least significant byte first
+    if (m_scratchBits >= 32u)
+    {
+        const unsigned char bytes[4]{static_cast<unsigned char>(m_scratch),
+                                     static_cast<unsigned char>(m_scratch >> 8),
+                                     static_cast<unsigned char>(m_scratch >> 16),
+                                     static_cast<unsigned char>(m_scratch >> 24)};
+
+        m_packet.append(bytes, sizeof(bytes));
+
+        m_scratch >>= 32;
+        m_scratchBits -= 32u;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBitWriter::writeBool(bool value)
+{
+    writeBits(value ? 1u : 0u, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBitWriter::writeRangedInt(base::I32 value, base::I32 min, base::I32 max)
+{
+    const unsigned int bitCount = rangedIntBitCount(min, max);
+
+    // A range of a single value needs no bits at all
+    if (bitCount == 0u)
+        return;
+
+    const base::I32 clamped = SFML_BASE_MIN(SFML_BASE_MAX(value, min), max);
+    writeBits(static_cast<base::U32>(static_cast<base::I64>(clamped) - min), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBitWriter::writeQuantizedFloat(float value, float min, float max, unsigned int bitCount)
+{
+    SFML_BASE_ASSERT(min < max);
+
+    // NaN would go through the clamping unchanged, and converting it to an integer is undefined behavior
+    if (value != value)
+        value = min;
+
+    const float  clamped    = SFML_BASE_MIN(SFML_BASE_MAX(value, min), max);
+    const double normalized = (static_cast<double>(clamped) - static_cast<double>(min)) /
+                              (static_cast<double>(max) - static_cast<double>(min));
+    const auto   steps      = static_cast<double>(lowBitsMask(bitCount));
+
+    writeBits(static_cast<base::U32>(normalized * steps + 0.5), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void PacketBitWriter::flush()
+{
+    while (m_scratchBits > 0u)
+    {
+        m_packet << static_cast<base::U8>(m_scratch);
+
+        m_scratch >>= 8;
+        m_scratchBits = m_scratchBits > 8u ? m_scratchBits - 8u : 0u;
+    }
+
+    m_scratch = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+base::U64 PacketBitWriter::getBitCount() const
+{
+    return m_totalBitCount;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketBitReader::PacketBitReader(Packet& packet) : m_packet(packet)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketBitReader::readBits(base::U32& value, unsigned int bitCount)
+{
+    SFML_BASE_ASSERT(bitCount >= 1u && bitCount <= 32u);
+
+    while (m_scratchBits < bitCount)
+    {
+        base::U8 byte = 0u;
+
+        if (!(m_packet >> byte))
+            return false;
+
+        m_scratch |= base::U64{byte} << m_scratchBits;
+        m_scratchBits += 8u;
+    }
+
+    value = static_cast<base::U32>(m_scratch & lowBitsMask(bitCount));
+
+    m_scratch >>= bitCount;
+    m_scratchBits -= bitCount;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketBitReader::readBool(bool& value)
+{
+    base::U32 bit = 0u;
+
+    if (!readBits(bit, 1u))
+        return false;
+
+    value = bit != 0u;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketBitReader::readRangedInt(base::I32& value, base::I32 min, base::I32 max)
+{
+    const unsigned int bitCount = rangedIntBitCount(min, max);
+
+    if (bitCount == 0u)
+    {
+        value = min;
+        return true;
+    }
+
+    base::U32 offset = 0u;
+
+    if (!readBits(offset, bitCount))
+        return false;
+
+    // Clamp malformed input to the range
+    value = static_cast<base::I32>(SFML_BASE_MIN(static_cast<base::I64>(min) + offset, static_cast<base::I64>(max)));
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketBitReader::readQuantizedFloat(float& value, float min, float max, unsigned int bitCount)
+{
+    SFML_BASE_ASSERT(min < max);
+
+    base::U32 quantized = 0u;
+
+    if (!readBits(quantized, bitCount))
+        return false;
+
+    const auto steps = static_cast<double>(lowBitsMask(bitCount));
+    const auto range = static_cast<double>(max) - static_cast<double>(min);
+
+    value = static_cast<float>(static_cast<double>(min) + range * (static_cast<double>(quantized) / steps));
+
+    return true;
+}
+
+} // namespace sf
@@ -0,0 +1,284 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/PacketView.hpp"
+
+#include "SFML/Network/SocketImpl.hpp"
+#include "SFML/Network/VarIntCodec.hpp"
+
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <string>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// 64-bit integers are stored in network byte order (big endian) by `sf::Packet`
+template <typename IntegerType>
+[[nodiscard]] IntegerType readBigEndian64(const unsigned char* bytes)
+{
+    IntegerType integer = 0;
+
+    for (sf::base::SizeT i = 0u; i < 8u; ++i)
+        integer |= static_cast<IntegerType>(static_cast<IntegerType>(bytes[7u - i]) << (8u * i));
+
+    return integer;
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+PacketView::PacketView(const void* data, base::SizeT size) :
+    m_data{static_cast<const unsigned char*>(data)},
+    m_size{data != nullptr ? size : 0u}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT PacketView::getReadPosition() const
+{
+    return m_readPos;
+}
+
+
+////////////////////////////////////////////////////////////
+const void* PacketView::getData() const
+{
+    return m_size > 0u ? m_data : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT PacketView::getDataSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::endOfPacket() const
+{
+    return m_readPos >= m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView::operator bool() const
+{
+    return m_isValid;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(bool& data)
+{
+    base::U8 value = 0;
+    if (*this >> value)
+        data = (value != 0);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::I8& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::U8& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::I16& data)
+{
+    base::U16 value = 0;
+    if (*this >> value)
+        data = static_cast<base::I16>(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::U16& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        data = priv::SocketImpl::getNtohs(data);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::I32& data)
+{
+    base::U32 value = 0;
+    if (*this >> value)
+        data = static_cast<base::I32>(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::U32& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        data = priv::SocketImpl::getNtohl(data);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::I64& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        data = readBigEndian64<base::I64>(m_data + m_readPos);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::U64& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        data = readBigEndian64<base::U64>(m_data + m_readPos);
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(float& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(double& data)
+{
+    if (checkSize(sizeof(data)))
+    {
+        SFML_BASE_MEMCPY(&data, m_data + m_readPos, sizeof(data));
+        m_readPos += sizeof(data);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(std::string& data)
+{
+    base::StringView view;
+    *this >> view;
+
+    data.assign(view.data(), view.size());
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::operator>>(base::StringView& data)
+{
+    // First extract string length
+    base::U32 length = 0;
+    *this >> length;
+
+    data = base::StringView{};
+    if ((length > 0) && checkSize(length))
+    {
+        // Then refer to the characters in place
+        data = base::StringView{reinterpret_cast<const char*>(m_data + m_readPos), length};
+
+        // Update reading position
+        m_readPos += length;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractVarUInt(base::U64& data)
+{
+    m_isValid = m_isValid && priv::decodeVarUInt(m_data, m_size, m_readPos, data);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+PacketView& PacketView::extractVarInt(base::I64& data)
+{
+    base::U64 value = 0u;
+
+    if (extractVarUInt(value))
+        data = priv::zigZagDecode(value);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool PacketView::checkSize(base::SizeT size)
+{
+    // Determine if size is big enough to trigger an overflow
+    const bool overflowDetected = m_readPos + size < m_readPos;
+    m_isValid                   = m_isValid && (m_readPos + size <= m_size) && !overflowDetected;
+
+    return m_isValid;
+}
+
+} // namespace sf
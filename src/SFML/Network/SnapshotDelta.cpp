@@ -0,0 +1,309 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/SnapshotDelta.hpp"
+
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/Builtin/Memset.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Longest literal run of a single token, longer runs are split
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT maxLiteralRun = 256u;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr unsigned char residualAt(sf::base::Span<const unsigned char> baseline,
+                                                 sf::base::Span<const unsigned char> snapshot,
+                                                 sf::base::SizeT                     index)
+{
+    return static_cast<unsigned char>(snapshot[index] ^ (index < baseline.size() ? baseline[index] : 0u));
+}
+
+
+////////////////////////////////////////////////////////////
+// Copy `count` baseline bytes starting at `index`, missing baseline bytes are zero
+////////////////////////////////////////////////////////////
+void copyBaseline(sf::base::Span<const unsigned char> baseline,
+                  unsigned char*                      out,
+                  sf::base::SizeT                     index,
+                  sf::base::SizeT                     count)
+{
+    const sf::base::SizeT available = index < baseline.size() ? SFML_BASE_MIN(count, baseline.size() - index) : 0u;
+
+    if (available > 0u)
+        SFML_BASE_MEMCPY(out + index, baseline.data() + index, available);
+
+    if (available < count)
+        SFML_BASE_MEMSET(out + index + available, 0, count - available);
+}
+
+
+////////////////////////////////////////////////////////////
+// Tell whether `a` was issued after `b`, robust to wrap-around
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr bool isMoreRecent(sf::base::U32 a, sf::base::U32 b)
+{
+    return a != b && static_cast<sf::base::U32>(a - b) < 0x8000'0000u;
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void SnapshotDelta::encode(base::Span<const unsigned char> baseline,
+                           base::Span<const unsigned char> snapshot,
+                           Packet&                         packet)
+{
+    packet.appendVarUInt(snapshot.size());
+
+    // Sequence of tokens: a run of unchanged bytes, then a run of XOR-ed changed bytes
+    unsigned char literals[maxLiteralRun];
+
+    base::SizeT i = 0u;
+
+    while (i < snapshot.size())
+    {
+        base::SizeT zeroRun = 0u;
+
+        while (i < snapshot.size() && residualAt(baseline, snapshot, i) == 0u)
+        {
+            ++zeroRun;
+            ++i;
+        }
+
+        base::SizeT literalCount = 0u;
+
+        while (i < snapshot.size() && literalCount < maxLiteralRun)
+        {
+            // A single unchanged byte is cheaper to keep in the literals than to start a new token
+            const bool endsHere = residualAt(baseline, snapshot, i) == 0u &&
+                                  (i + 1u == snapshot.size() || residualAt(baseline, snapshot, i + 1u) == 0u);
+
+            if (endsHere)
+                break;
+
+            literals[literalCount++] = residualAt(baseline, snapshot, i++);
+        }
+
+        packet.appendVarUInt(zeroRun);
+        packet.appendSpan(base::Span<const unsigned char>{literals, literalCount});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool SnapshotDelta::decode(Packet&                         packet,
+                           base::Span<const unsigned char> baseline,
+                           base::Vector<unsigned char>&    snapshot)
+{
+    SFML_BASE_ASSERT(baseline.data() == nullptr || baseline.data() != snapshot.data());
+
+    base::U64 size = 0u;
+
+    if (!packet.extractVarUInt(size) || size > maxSnapshotSize)
+        return false;
+
+    snapshot.resize(static_cast<base::SizeT>(size));
+
+    base::Vector<unsigned char> literals;
+    base::SizeT                 i = 0u;
+
+    while (i < snapshot.size())
+    {
+        base::U64 zeroRun = 0u;
+
+        if (!packet.extractVarUInt(zeroRun) || zeroRun > snapshot.size() - i)
+            return false;
+
+        copyBaseline(baseline, snapshot.data(), i, static_cast<base::SizeT>(zeroRun));
+        i += static_cast<base::SizeT>(zeroRun);
+
+        if (!packet.extractVector(literals) || literals.size() > snapshot.size() - i)
+            return false;
+
+        copyBaseline(baseline, snapshot.data(), i, literals.size());
+
+        for (const unsigned char literal : literals)
+            snapshot[i++] ^= literal;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+SnapshotBaselineRing::SnapshotBaselineRing(base::SizeT capacity)
+{
+    SFML_BASE_ASSERT(capacity > 0u);
+    m_entries.resize(capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+void SnapshotBaselineRing::store(base::U32 sequence, base::Span<const unsigned char> snapshot)
+{
+    SFML_BASE_ASSERT(sequence != 0u);
+
+    Entry& entry   = m_entries[sequence % m_entries.size()];
+    entry.sequence = sequence;
+
+    entry.bytes.clear();
+    entry.bytes.emplaceRange(snapshot.data(), snapshot.size());
+}
+
+
+////////////////////////////////////////////////////////////
+const base::Vector<unsigned char>* SnapshotBaselineRing::find(base::U32 sequence) const
+{
+    if (sequence == 0u)
+        return nullptr;
+
+    const Entry& entry = m_entries[sequence % m_entries.size()];
+    return entry.sequence == sequence ? &entry.bytes : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void SnapshotBaselineRing::clear()
+{
+    for (Entry& entry : m_entries)
+    {
+        entry.sequence = 0u;
+        entry.bytes.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT SnapshotBaselineRing::getCapacity() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+SnapshotDeltaEncoder::SnapshotDeltaEncoder(base::SizeT historySize) : m_history(historySize)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+base::U32 SnapshotDeltaEncoder::encode(base::Span<const unsigned char> snapshot, Packet& packet)
+{
+    const base::U32 sequence = m_nextSequence;
+
+    // Zero means "no baseline" on the wire
+    if (++m_nextSequence == 0u)
+        m_nextSequence = 1u;
+
+    // The baseline may have been overwritten if nothing was acknowledged for a whole history
+    const base::Vector<unsigned char>* baseline         = m_history.find(m_baselineSequence);
+    const base::U32                    baselineSequence = baseline != nullptr ? m_baselineSequence : 0u;
+
+    packet.appendVarUInt(sequence);
+    packet.appendVarUInt(baselineSequence);
+
+    if (baseline != nullptr)
+        SnapshotDelta::encode({baseline->data(), baseline->size()}, snapshot, packet);
+    else
+        SnapshotDelta::encode({}, snapshot, packet);
+
+    m_history.store(sequence, snapshot);
+    return sequence;
+}
+
+
+////////////////////////////////////////////////////////////
+void SnapshotDeltaEncoder::acknowledge(base::U32 sequence)
+{
+    if (m_history.find(sequence) == nullptr)
+        return;
+
+    if (m_baselineSequence == 0u || isMoreRecent(sequence, m_baselineSequence))
+        m_baselineSequence = sequence;
+}
+
+
+////////////////////////////////////////////////////////////
+base::U32 SnapshotDeltaEncoder::getBaselineSequence() const
+{
+    return m_baselineSequence;
+}
+
+
+////////////////////////////////////////////////////////////
+void SnapshotDeltaEncoder::reset()
+{
+    m_history.clear();
+    m_nextSequence     = 1u;
+    m_baselineSequence = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+SnapshotDeltaDecoder::SnapshotDeltaDecoder(base::SizeT historySize) : m_history(historySize)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool SnapshotDeltaDecoder::decode(Packet& packet, base::Vector<unsigned char>& snapshot, base::U32& sequence)
+{
+    base::U64 receivedSequence = 0u;
+    base::U64 baselineSequence = 0u;
+
+    if (!packet.extractVarUInt(receivedSequence).extractVarUInt(baselineSequence))
+        return false;
+
+    if (receivedSequence == 0u || receivedSequence > 0xFFFF'FFFFu || baselineSequence > 0xFFFF'FFFFu)
+        return false;
+
+    // Zero means that the snapshot was sent whole
+    base::Span<const unsigned char> baselineBytes;
+
+    if (baselineSequence != 0u)
+    {
+        const base::Vector<unsigned char>* const baseline = m_history.find(static_cast<base::U32>(baselineSequence));
+
+        // Too old, or never received: wait for the encoder to move to a more recent baseline
+        if (baseline == nullptr)
+            return false;
+
+        baselineBytes = {baseline->data(), baseline->size()};
+    }
+
+    if (!SnapshotDelta::decode(packet, baselineBytes, snapshot))
+        return false;
+
+    sequence = static_cast<base::U32>(receivedSequence);
+    m_history.store(sequence, {snapshot.data(), snapshot.size()});
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SnapshotDeltaDecoder::reset()
+{
+    m_history.clear();
+}
+
+} // namespace sf
@@ -6,12 +6,16 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/Socket.hpp"
 #include "SFML/Network/SocketHandle.hpp"
 
+#include "SFML/Base/Array.hpp"
 #include "SFML/Base/InPlacePImpl.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #if defined(SFML_SYSTEM_WINDOWS)
 
@@ -19,8 +23,6 @@
 
 #else
 
-    #include "SFML/Base/SizeT.hpp"
-
     #include <sys/socket.h>
     #include <sys/types.h>
 
@@ -124,6 +126,30 @@ private:
     base::InPlacePImpl<Impl, 768> m_impl;
 };
 
+////////////////////////////////////////////////////////////
+/// \brief Datagram used by the batched send and receive functions
+///
+////////////////////////////////////////////////////////////
+struct BatchDatagram
+{
+    char*       data;      //!< Bytes to send, or buffer to receive into
+    base::SizeT size;      //!< Number of bytes to send, or capacity of the buffer (replaced by the received size)
+    base::U32   address;   //!< Address of the peer, in host byte order
+    base::U16   port;      //!< Port of the peer, in host byte order
+    bool        truncated; //!< Set when receiving: the datagram was larger than the buffer and got clipped
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Socket watched by `SocketImpl::poll`
+///
+////////////////////////////////////////////////////////////
+struct PollEntry
+{
+    SocketHandle handle;    //!< Socket to watch
+    bool         wantWrite; //!< Wait until the socket is writable instead of readable
+    bool         ready;     //!< Set by `poll`: the operation can proceed, or the socket has an error
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Helper class implementing all the non-portable
 ///        socket stuff
@@ -171,10 +197,12 @@ public:
     [[nodiscard]] static SocketHandle accept(SocketHandle handle, SockAddrIn& address, AddrLength& length);
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Start listening, with room for `backlog` pending connections
+    ///
+    /// A `backlog` of zero or less uses the system maximum (`SOMAXCONN`).
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static bool listen(SocketHandle handle);
+    [[nodiscard]] static bool listen(SocketHandle handle, int backlog);
 
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
@@ -188,6 +216,12 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool getPeerName(SocketHandle handle, SockAddrIn& address, AddrLength& length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the address and port of the peer of a connected socket, of any family
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<IpAddress> getPeerAddress(SocketHandle handle, unsigned short& port);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -200,6 +234,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool connect(SocketHandle handle, SockAddrIn& address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Connect a socket to an IPv4 or IPv6 address
+    ///
+    /// The socket must have been created for the family of `address`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool connect(SocketHandle handle, IpAddress address, unsigned short port);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get and clear the pending error of a socket (`SO_ERROR`)
+    ///
+    /// \return 0 if there is no pending error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static int getPendingError(SocketHandle handle);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -248,12 +298,32 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static const char* addrToString(base::U32 addr);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Parse an IPv6 address in text form
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<IpAddress> inetPtonV6(const char* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Format an IPv6 address in text form
+    ///
+    /// \return Pointer to a thread-local buffer, valid until the next call
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static const char* addrToStringV6(const base::Array<base::U8, 16>& bytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static SocketHandle tcpSocket();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a TCP socket for the given address family
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static SocketHandle tcpSocket(IpAddress::Type type);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -274,6 +344,35 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool disableNagle(SocketHandle handle);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Disable the Nagle algorithm if `noDelay` is `true`, enable it otherwise (`TCP_NODELAY`)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool setNoDelay(SocketHandle handle, bool noDelay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Let several sockets bind the same address and port (`SO_REUSEPORT`)
+    ///
+    /// Must be called before `bind`. Incoming connections are
+    /// distributed among the listening sockets by the system.
+    ///
+    /// \return `false` if the system doesn't support it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool enableReusePort(SocketHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the kernel send buffer (`SO_SNDBUF`)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool setSendBufferSize(SocketHandle handle, int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the kernel receive buffer (`SO_RCVBUF`)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool setReceiveBufferSize(SocketHandle handle, int size);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -316,12 +415,57 @@ public:
         SockAddrIn&      address,
         AddrLength&      length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive up to `count` datagrams, with as few system calls as possible
+    ///
+    /// A blocking socket only blocks until the first datagram
+    /// is available, the following ones are only received if
+    /// they are already pending.
+    ///
+    /// Datagrams larger than their buffer are clipped, and
+    /// reported through `BatchDatagram::truncated`.
+    ///
+    /// \return Number of datagrams received, or -1 on error (check `getErrorStatus`)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static int recvBatch(SocketHandle handle, BatchDatagram* datagrams, base::SizeT count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send up to `count` datagrams, with as few system calls as possible
+    ///
+    /// \return Number of datagrams sent, or -1 on error (check `getErrorStatus`)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static int sendBatch(SocketHandle handle, const BatchDatagram* datagrams, base::SizeT count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until at least one of the sockets is ready, or the timeout expires
+    ///
+    /// Errors and hang-ups make a socket ready, so that the next
+    /// operation on it reports them.
+    ///
+    /// \param timeoutMs Maximum time to wait in milliseconds, negative to wait forever
+    ///
+    /// \return Number of ready sockets, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static int poll(PollEntry* entries, base::SizeT count, int timeoutMs);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<NetworkLong> convertToHostname(const char* address);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resolve a host name to all its IPv4 and IPv6 addresses
+    ///
+    /// Blocks until the system resolver returns. Addresses are
+    /// returned in the order given by the system, duplicates removed.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Vector<IpAddress> getAddressInfo(const char* hostName);
+
     ////////////////////////////////////////////////////////////
     /// \brief Close and destroy a socket
     ///
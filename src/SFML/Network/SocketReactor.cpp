@@ -0,0 +1,646 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/SocketReactor.hpp"
+
+#include "SFML/Network/Packet.hpp"
+#include "SFML/Network/SocketImpl.hpp"
+#include "SFML/Network/TcpListener.hpp"
+#include "SFML/Network/TcpSocket.hpp"
+#include "SFML/Network/UdpSocket.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Sleep.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Remove the first occurrence of `item` from `items`, tell whether it was found
+////////////////////////////////////////////////////////////
+template <typename T>
+bool eraseFirst(sf::base::Vector<T>& items, const T& item)
+{
+    for (T& candidate : items)
+    {
+        if (candidate != item)
+            continue;
+
+        items.erase(&candidate);
+        return true;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+// Convert a duration to a poll timeout, rounded up so that deadlines have expired on wake-up
+////////////////////////////////////////////////////////////
+[[nodiscard]] int toPollTimeout(sf::Time duration)
+{
+    if (duration <= sf::Time{})
+        return 0;
+
+    const auto milliseconds = (duration.asMicroseconds() + 999) / 1000;
+    return milliseconds > 0x7FFF'FFFF ? 0x7FFF'FFFF : static_cast<int>(milliseconds);
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SocketReactor::Impl
+{
+    base::Vector<Operation*>              waiting;     //!< Operations waiting for their socket or deadline
+    base::Vector<Operation*>              completed;   //!< Operations whose coroutine must be resumed
+    base::Vector<Operation*>              resuming;    //!< Completed operations being resumed, null once destroyed
+    base::Vector<std::coroutine_handle<>> toStart;     //!< Spawned tasks that did not start yet
+    base::Vector<std::coroutine_handle<>> tasks;       //!< Spawned tasks that did not complete yet
+    base::Vector<priv::PollEntry>         pollEntries; //!< Sockets passed to `poll`, reused between steps
+    base::Vector<Operation*>              polled;      //!< Operation of each entry of `pollEntries`
+    Clock                                 clock;       //!< Time reference of the deadlines
+    bool                                  stopped{};   //!< Whether `stop` was called during `run`
+
+    ////////////////////////////////////////////////////////////
+    void complete(Operation& operation)
+    {
+        operation.m_state = Operation::State::Completed;
+        completed.pushBack(&operation);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasImmediateWork() const
+    {
+        return !toStart.empty() || !completed.empty();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void resumeReady()
+    {
+        // New tasks and completions may be added while resuming, loop until none are left
+        while (hasImmediateWork())
+        {
+            base::Vector<std::coroutine_handle<>> starting;
+            starting.swap(toStart);
+
+            for (const std::coroutine_handle<> handle : starting)
+                handle.resume();
+
+            resuming.clear();
+            resuming.swap(completed);
+
+            for (Operation*& operation : resuming)
+            {
+                // Destroyed by a coroutine resumed before it
+                if (operation == nullptr)
+                    continue;
+
+                Operation& current = *operation;
+                operation          = nullptr;
+                current.m_state    = Operation::State::Idle;
+                current.m_awaiting.resume();
+            }
+
+            resuming.clear();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Wait at most `maxWaitMs` (negative for no limit) for sockets and deadlines, complete what is ready
+    ////////////////////////////////////////////////////////////
+    void wait(int maxWaitMs)
+    {
+        const Time now = clock.getElapsedTime();
+
+        // Wake up for the nearest deadline
+        bool hasDeadline = false;
+        Time nearest;
+
+        for (const Operation* operation : waiting)
+        {
+            if (operation->m_timeout <= Time{} || (hasDeadline && operation->m_deadline >= nearest))
+                continue;
+
+            nearest     = operation->m_deadline;
+            hasDeadline = true;
+        }
+
+        int timeoutMs = maxWaitMs;
+
+        if (hasDeadline)
+        {
+            const int untilDeadline = toPollTimeout(nearest - now);
+            timeoutMs               = timeoutMs < 0 ? untilDeadline : SFML_BASE_MIN(timeoutMs, untilDeadline);
+        }
+
+        pollEntries.clear();
+        polled.clear();
+
+        for (Operation* operation : waiting)
+        {
+            if (operation->m_socket == nullptr)
+                continue;
+
+            pollEntries.pushBack({operation->m_socket->getNativeHandle(), operation->isWaitingForWrite(), false});
+            polled.pushBack(operation);
+        }
+
+        if (!pollEntries.empty())
+        {
+            if (priv::SocketImpl::poll(pollEntries.data(), pollEntries.size(), timeoutMs) > 0)
+            {
+                for (base::SizeT i = 0u; i < pollEntries.size(); ++i)
+                {
+                    Operation& operation = *polled[i];
+
+                    if (!pollEntries[i].ready || !operation.attempt())
+                        continue;
+
+                    (void)eraseFirst(waiting, &operation);
+                    complete(operation);
+                }
+            }
+        }
+        else if (timeoutMs != 0)
+        {
+            // Only timers are pending
+            SFML_BASE_ASSERT(timeoutMs > 0 && "Waiting forever without any socket");
+            sf::sleep(milliseconds(timeoutMs));
+        }
+
+        // Expire the deadlines
+        const Time after = clock.getElapsedTime();
+
+        for (base::SizeT i = 0u; i < waiting.size();)
+        {
+            Operation& operation = *waiting[i];
+
+            if (operation.m_timeout <= Time{} || operation.m_deadline > after)
+            {
+                ++i;
+                continue;
+            }
+
+            if (operation.m_kind == Operation::Kind::Sleep)
+                operation.m_result.status = Socket::Status::Done;
+            else
+                operation.m_result.timedOut = true;
+
+            waiting.erase(waiting.begin() + i);
+            complete(operation);
+        }
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation::Operation(SocketReactor& reactor, Kind kind, Socket* socket, Time timeout) :
+    m_reactor(&reactor),
+    m_kind(kind),
+    m_socket(socket),
+    m_timeout(timeout)
+{
+    SFML_BASE_ASSERT((socket == nullptr || !socket->isBlocking()) && "Sockets used by a reactor must be non-blocking");
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation::~Operation()
+{
+    Impl& impl = *m_reactor->m_impl;
+
+    if (m_state == State::Waiting)
+    {
+        (void)eraseFirst(impl.waiting, this);
+    }
+    else if (m_state == State::Completed && !eraseFirst(impl.completed, this))
+    {
+        for (Operation*& operation : impl.resuming)
+            if (operation == this)
+                operation = nullptr;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketReactor::Operation::await_ready()
+{
+    if (m_kind == Kind::Sleep)
+    {
+        m_result.status = Socket::Status::Done;
+        return m_timeout <= Time{};
+    }
+
+    return attempt();
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::Operation::await_suspend(std::coroutine_handle<> awaiting)
+{
+    Impl& impl = *m_reactor->m_impl;
+
+    m_awaiting = awaiting;
+    m_deadline = impl.clock.getElapsedTime() + m_timeout;
+    m_state    = State::Waiting;
+
+    impl.waiting.pushBack(this);
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Result SocketReactor::Operation::await_resume() const
+{
+    return m_result;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketReactor::Operation::attempt()
+{
+    // Store the final status, `false` if the operation must wait for its socket
+    const auto finish = [&](Socket::Status status)
+    {
+        if (status == Socket::Status::NotReady || status == Socket::Status::Partial)
+            return false;
+
+        m_result.status = status;
+        return true;
+    };
+
+    const auto finishTls = [&](TcpSocket::TlsStatus status)
+    {
+        switch (status)
+        {
+            case TcpSocket::TlsStatus::HandshakeStarted:
+                return false;
+            case TcpSocket::TlsStatus::HandshakeComplete:
+                return finish(Socket::Status::Done);
+            case TcpSocket::TlsStatus::NotConnected:
+                return finish(Socket::Status::Disconnected);
+            case TcpSocket::TlsStatus::Error:
+                break;
+        }
+
+        return finish(Socket::Status::Error);
+    };
+
+    const auto tcpSocket = [&]() -> TcpSocket& { return static_cast<TcpSocket&>(*m_socket); };
+    const auto udpSocket = [&]() -> UdpSocket& { return static_cast<UdpSocket&>(*m_socket); };
+
+    switch (m_kind)
+    {
+        case Kind::Sleep:
+            return false;
+
+        case Kind::Receive:
+            return finish(tcpSocket().receive(m_data, m_size, m_result.transferred));
+
+        case Kind::ReceivePacket:
+            return finish(tcpSocket().receive(*m_packet));
+
+        case Kind::Send:
+        {
+            if (m_size == 0u)
+                return finish(Socket::Status::Done);
+
+            // Resume after the bytes sent by the previous attempts
+            const base::SizeT    offset = m_result.transferred;
+            base::SizeT          sent   = 0u;
+            const Socket::Status status = tcpSocket().send(static_cast<const unsigned char*>(m_constData) + offset,
+                                                           m_size - offset,
+                                                           sent);
+
+            m_result.transferred += sent;
+            return finish(status);
+        }
+
+        case Kind::SendPacket:
+            return finish(tcpSocket().send(*m_packet));
+
+        case Kind::ReceiveDatagram:
+            return finish(
+                udpSocket().receive(m_data, m_size, m_result.transferred, m_result.remoteAddress, m_result.remotePort));
+
+        case Kind::SendDatagram:
+        {
+            const Socket::Status status = udpSocket().send(m_constData, m_size, *m_address, m_port);
+
+            if (status == Socket::Status::Done)
+                m_result.transferred = m_size;
+
+            return finish(status);
+        }
+
+        case Kind::Accept:
+            return finish(static_cast<TcpListener&>(*m_socket).accept(*m_acceptedSocket));
+
+        case Kind::Connect:
+        {
+            if (!m_started)
+            {
+                m_started = true;
+                return finish(tcpSocket().connect(*m_address, m_port));
+            }
+
+            // Only attempted again once the socket is writable: the connection is established or failed
+            const int error = priv::SocketImpl::getPendingError(tcpSocket().getNativeHandle());
+            return finish(error == 0 ? Socket::Status::Done : Socket::Status::Error);
+        }
+
+        case Kind::TlsClient:
+            return finishTls(tcpSocket().setupTlsClient(*m_hostName, m_verifyPeer));
+
+        case Kind::TlsServer:
+            return finishTls(tcpSocket().setupTlsServer(m_certificateChain, m_privateKey, m_privateKeyPassword));
+    }
+
+    return finish(Socket::Status::Error);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketReactor::Operation::isWaitingForWrite() const
+{
+    switch (m_kind)
+    {
+        case Kind::Send:
+        case Kind::SendPacket:
+            return static_cast<const TcpSocket&>(*m_socket).isWaitingForWrite(true);
+
+        case Kind::Receive:
+        case Kind::ReceivePacket:
+        case Kind::TlsClient:
+        case Kind::TlsServer:
+            return static_cast<const TcpSocket&>(*m_socket).isWaitingForWrite(false);
+
+        case Kind::SendDatagram:
+        case Kind::Connect:
+            return true;
+
+        case Kind::Sleep:
+        case Kind::ReceiveDatagram:
+        case Kind::Accept:
+            break;
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::SocketReactor() : m_impl(base::makeUnique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::~SocketReactor()
+{
+    // Destroying a task destroys its pending operations, which unregister themselves
+    base::Vector<std::coroutine_handle<>> tasks;
+    tasks.swap(m_impl->tasks);
+
+    for (const std::coroutine_handle<> handle : tasks)
+        handle.destroy();
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::spawn(Task<void>&& task)
+{
+    SFML_BASE_ASSERT(task.m_handle && "Spawned an empty or moved-from task");
+
+    const auto handle = task.m_handle;
+    task.m_handle     = nullptr;
+
+    handle.promise().owner                = this;
+    handle.promise().onDetachedCompletion = &SocketReactor::onTaskCompletion;
+
+    m_impl->toStart.pushBack(handle);
+    m_impl->tasks.pushBack(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::run()
+{
+    m_impl->stopped = false;
+
+    while (!m_impl->stopped && !m_impl->tasks.empty())
+    {
+        m_impl->resumeReady();
+
+        if (m_impl->stopped || m_impl->tasks.empty())
+            break;
+
+        // Nothing can resume the remaining tasks
+        if (m_impl->waiting.empty())
+            break;
+
+        m_impl->wait(/* maxWaitMs */ -1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketReactor::runOnce(Time maxWait)
+{
+    m_impl->resumeReady();
+
+    if (!m_impl->waiting.empty())
+    {
+        m_impl->wait(toPollTimeout(maxWait));
+        m_impl->resumeReady();
+    }
+
+    return !m_impl->tasks.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::stop()
+{
+    m_impl->stopped = true;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT SocketReactor::cancel(const Socket& socket)
+{
+    base::SizeT count = 0u;
+
+    for (base::SizeT i = 0u; i < m_impl->waiting.size();)
+    {
+        Operation& operation = *m_impl->waiting[i];
+
+        if (operation.m_socket != &socket)
+        {
+            ++i;
+            continue;
+        }
+
+        operation.m_result.status    = Socket::Status::NotReady;
+        operation.m_result.cancelled = true;
+
+        m_impl->waiting.erase(m_impl->waiting.begin() + i);
+        m_impl->complete(operation);
+        ++count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT SocketReactor::getTaskCount() const
+{
+    return m_impl->tasks.size();
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::sleep(Time duration)
+{
+    return Operation(*this, Operation::Kind::Sleep, nullptr, duration);
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::receive(TcpSocket& socket, void* data, base::SizeT size, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::Receive, &socket, timeout);
+    operation.m_data = data;
+    operation.m_size = size;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::receive(TcpSocket& socket, Packet& packet, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::ReceivePacket, &socket, timeout);
+    operation.m_packet = &packet;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::send(TcpSocket& socket, const void* data, base::SizeT size, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::Send, &socket, timeout);
+    operation.m_constData = data;
+    operation.m_size      = size;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::send(TcpSocket& socket, Packet& packet, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::SendPacket, &socket, timeout);
+    operation.m_packet = &packet;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::receive(UdpSocket& socket, void* data, base::SizeT size, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::ReceiveDatagram, &socket, timeout);
+    operation.m_data = data;
+    operation.m_size = size;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::send(
+    UdpSocket&     socket,
+    const void*    data,
+    base::SizeT    size,
+    IpAddress      remoteAddress,
+    unsigned short remotePort,
+    Time           timeout)
+{
+    Operation operation(*this, Operation::Kind::SendDatagram, &socket, timeout);
+    operation.m_constData = data;
+    operation.m_size      = size;
+    operation.m_address.emplace(remoteAddress);
+    operation.m_port = remotePort;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::accept(TcpListener& listener, TcpSocket& socket, Time timeout)
+{
+    Operation operation(*this, Operation::Kind::Accept, &listener, timeout);
+    operation.m_acceptedSocket = &socket;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::connect(TcpSocket&     socket,
+                                                IpAddress      remoteAddress,
+                                                unsigned short remotePort,
+                                                Time           timeout)
+{
+    Operation operation(*this, Operation::Kind::Connect, &socket, timeout);
+    operation.m_address.emplace(remoteAddress);
+    operation.m_port = remotePort;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::setupTlsClient(TcpSocket&           socket,
+                                                       const UnicodeString& hostName,
+                                                       bool                 verifyPeer,
+                                                       Time                 timeout)
+{
+    Operation operation(*this, Operation::Kind::TlsClient, &socket, timeout);
+    operation.m_hostName   = &hostName;
+    operation.m_verifyPeer = verifyPeer;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketReactor::Operation SocketReactor::setupTlsServer(TcpSocket&       socket,
+                                                       base::StringView certificateChainData,
+                                                       base::StringView privateKeyData,
+                                                       base::StringView privateKeyPasswordData,
+                                                       Time             timeout)
+{
+    Operation operation(*this, Operation::Kind::TlsServer, &socket, timeout);
+    operation.m_certificateChain   = certificateChainData;
+    operation.m_privateKey         = privateKeyData;
+    operation.m_privateKeyPassword = privateKeyPasswordData;
+    return operation;
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketReactor::onTaskCompletion(void* reactor, std::coroutine_handle<> handle)
+{
+    (void)eraseFirst(static_cast<SocketReactor*>(reactor)->m_impl->tasks, handle);
+    handle.destroy();
+}
+
+} // namespace sf
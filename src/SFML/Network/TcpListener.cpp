@@ -12,6 +12,10 @@
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
 
 namespace sf
 {
@@ -30,6 +34,13 @@ unsigned short TcpListener::getLocalPort() const
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
+{
+    return listen(port, address, TcpListenerSettings{});
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpListener::listen(unsigned short port, IpAddress address, const TcpListenerSettings& settings)
 {
     // Close the socket if it is already bound
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
@@ -43,6 +54,21 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
+    if (address.isV6())
+    {
+        priv::err() << "TCP listeners do not support IPv6 addresses";
+        return Status::Error;
+    }
+
+    m_settings = settings;
+
+    // Share the port with the other listeners, must be done before binding
+    if (settings.reusePort && !priv::SocketImpl::enableReusePort(getNativeHandle()))
+    {
+        priv::err() << "Failed to set socket option \"SO_REUSEPORT\", port sharing is not supported";
+        return Status::Error;
+    }
+
     // Bind the socket to the specified port
     priv::SockAddrIn addr = priv::SocketImpl::createAddress(address.toInteger(), port);
     if (!priv::SocketImpl::bind(getNativeHandle(), addr))
@@ -53,7 +79,7 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
     }
 
     // Listen to the bound port
-    if (!priv::SocketImpl::listen(getNativeHandle()))
+    if (!priv::SocketImpl::listen(getNativeHandle(), settings.backlog))
     {
         // Oops, socket is deaf
         priv::err() << "Failed to listen to port " << port;
@@ -95,10 +121,55 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     if (socket.getNativeHandle() != priv::SocketImpl::invalidSocket())
         (void)socket.close(); // Intentionally discard
 
-    if (socket.create(remote))
-        return Status::Done;
+    if (!socket.create(remote))
+        return Status::Error;
+
+    // Sockets disable the Nagle algorithm when they are created
+    // Failures are reported, the connection remains usable with the default options
+    if (!m_settings.noDelay)
+        (void)socket.setNoDelay(false);
+
+    if (m_settings.sendBufferSize > 0u || m_settings.receiveBufferSize > 0u)
+        (void)socket.setBufferSizes(m_settings.sendBufferSize, m_settings.receiveBufferSize);
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpListener::acceptMany(base::Vector<TcpSocket>& sockets,
+                                       base::SizeT              maxCount,
+                                       bool                     acceptedSocketsBlocking)
+{
+    // Make sure that we're listening
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket())
+    {
+        priv::err() << "Failed to accept new connections, the socket is not listening";
+        return Status::Error;
+    }
+
+    base::SizeT accepted = 0u;
+    Status      status   = Status::Done;
+
+    while (accepted < maxCount)
+    {
+        TcpSocket socket(acceptedSocketsBlocking);
+        status = accept(socket);
+
+        if (status != Status::Done)
+            break;
+
+        sockets.pushBack(SFML_BASE_MOVE(socket));
+
+        // Only wait for the first connection, then drain the ones that are already pending
+        if (++accepted == 1u && isBlocking())
+            priv::SocketImpl::setBlocking(getNativeHandle(), false);
+    }
+
+    if (accepted > 0u && isBlocking())
+        priv::SocketImpl::setBlocking(getNativeHandle(), true);
 
-    return Status::Error;
+    return accepted > 0u ? Status::Done : status;
 }
 
 } // namespace sf
@@ -10,7 +10,9 @@
 #include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/Packet.hpp"
 #include "SFML/Network/SocketImpl.hpp"
+#include "SFML/Network/TlsSessionCache.hpp"
 
+#include "SFML/System/Clock.hpp"
 #include "SFML/System/Err.hpp"
 #include "SFML/System/Path.hpp"
 #include "SFML/System/UnicodeString.hpp"
@@ -19,10 +21,14 @@
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Builtin/Memcpy.hpp"
 #include "SFML/Base/Builtin/Strlen.hpp"
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/MinMax.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/String.hpp"
+#include "SFML/Base/StringView.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 #include "SFML/Base/Vector.hpp"
 
@@ -37,6 +43,14 @@
 #include <mbedtls/net_sockets.h>
 #include <mbedtls/ssl.h>
 
+#if defined(MBEDTLS_SSL_CACHE_C)
+    #include <mbedtls/ssl_cache.h>
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+    #include <mbedtls/ssl_ticket.h>
+#endif
+
 #if defined(SFML_SYSTEM_WINDOWS)
     #include "SFML/System/WindowsHeader.hpp"
 
@@ -354,11 +368,350 @@ struct MbedTlsSharedState
 };
 
 [[maybe_unused]] MbedTlsSharedState mbedTlsSharedState;
+
+
+////////////////////////////////////////////////////////////
+// Set by the server session callbacks when the handshake step running on this thread resumes a session
+////////////////////////////////////////////////////////////
+thread_local constinit bool serverSessionResumed = false;
+
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+////////////////////////////////////////////////////////////
+int getCachedServerSession(void*                data,
+                           const unsigned char* sessionId,
+                           sf::base::SizeT      sessionIdLength,
+                           mbedtls_ssl_session* session)
+{
+    const int result = mbedtls_ssl_cache_get(data, sessionId, sessionIdLength, session);
+    serverSessionResumed |= (result == 0);
+    return result;
+}
+#endif
+
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+////////////////////////////////////////////////////////////
+int parseSessionTicket(void* ticketContext, mbedtls_ssl_session* session, unsigned char* buffer, sf::base::SizeT length)
+{
+    const int result = mbedtls_ssl_ticket_parse(ticketContext, session, buffer, length);
+    serverSessionResumed |= (result == 0);
+    return result;
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Certificates are only received, and verified, during full handshakes
+////////////////////////////////////////////////////////////
+int onPeerCertificate(void* peerCertificateReceived, mbedtls_x509_crt*, int, sf::base::U32*)
+{
+    *static_cast<bool*>(peerCertificateReceived) = true;
+    return 0;
+}
+
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct TlsSessionCache::Impl
+{
+    struct ClientSession
+    {
+        base::String                hostName; //!< Host name passed to `setupTlsClient`
+        unsigned short              port{};   //!< Remote port of the connection
+        base::Vector<unsigned char> data;     //!< Session serialized with `mbedtls_ssl_session_save`
+        Time                        storedAt; //!< Time at which the session was stored, relative to `clock`
+    };
+
+    explicit Impl(const TlsSessionCacheSettings& theSettings) : settings(theSettings)
+    {
+#if defined(MBEDTLS_SSL_CACHE_C)
+        mbedtls_ssl_cache_init(&serverCache);
+        mbedtls_ssl_cache_set_max_entries(&serverCache, static_cast<int>(settings.maxSessions));
+
+    #if defined(MBEDTLS_HAVE_TIME)
+        mbedtls_ssl_cache_set_timeout(&serverCache, static_cast<int>(settings.sessionLifetime.asSeconds()));
+    #endif
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+        mbedtls_ssl_ticket_init(&ticketContext);
+
+        const auto ticketLifetime = static_cast<base::U32>(settings.sessionLifetime.asSeconds());
+
+    #if (MBEDTLS_VERSION_MAJOR < 4)
+        const int result = mbedtls_ssl_ticket_setup(&ticketContext,
+                                                    mbedtls_ctr_drbg_random,
+                                                    &mbedTlsSharedState.ctrDrbgContext,
+                                                    MBEDTLS_CIPHER_AES_256_GCM,
+                                                    ticketLifetime);
+    #else
+        const int result = mbedtls_ssl_ticket_setup(&ticketContext,
+                                                    PSA_ALG_GCM,
+                                                    PSA_KEY_TYPE_AES,
+                                                    256u,
+                                                    ticketLifetime);
+    #endif
+
+        if (result == 0)
+            ticketContextReady = true;
+        else
+            priv::err() << "Failed to set up TLS session tickets: " << tlsErrorString(result);
+#endif
+    }
+
+    ~Impl()
+    {
+#if defined(MBEDTLS_SSL_TICKET_C)
+        mbedtls_ssl_ticket_free(&ticketContext);
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+        mbedtls_ssl_cache_free(&serverCache);
+#endif
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    void configure([[maybe_unused]] mbedtls_ssl_config& config, bool isServer)
+    {
+        if (!isServer)
+        {
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+            mbedtls_ssl_conf_session_tickets(&config, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+#if defined(MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED)
+            // TLS 1.3 tickets arrive after the handshake, and are discarded unless signaled to the application
+            mbedtls_ssl_conf_tls13_enable_signal_new_session_tickets(
+                &config,
+                MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED);
+#endif
+            return;
+        }
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+        if (settings.enableSessionIds)
+            mbedtls_ssl_conf_session_cache(&config, &serverCache, getCachedServerSession, mbedtls_ssl_cache_set);
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+        if (settings.enableSessionTickets && ticketContextReady)
+            mbedtls_ssl_conf_session_tickets_cb(&config, mbedtls_ssl_ticket_write, parseSessionTicket, &ticketContext);
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Offer the last session established with `hostName`:`port`, each session is offered only once
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool restoreClientSession(const base::String&  hostName,
+                                            unsigned short       port,
+                                            mbedtls_ssl_context& sslContext)
+    {
+        const base::Vector<unsigned char> data = takeSessionData(hostName.toStringView(), port);
+
+        if (data.empty())
+            return false;
+
+        mbedtls_ssl_session session;
+        mbedtls_ssl_session_init(&session);
+
+        const bool restored = mbedtls_ssl_session_load(&session, data.data(), data.size()) == 0 &&
+                              mbedtls_ssl_set_session(&sslContext, &session) == 0;
+
+        mbedtls_ssl_session_free(&session);
+        return restored;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void storeClientSession(const base::String& hostName, unsigned short port, const mbedtls_ssl_context& sslContext)
+    {
+        base::Vector<unsigned char> data;
+
+        mbedtls_ssl_session session;
+        mbedtls_ssl_session_init(&session);
+
+        // With TLS 1.3, this fails until the server sends a ticket
+        if (mbedtls_ssl_get_session(&sslContext, &session) == 0)
+        {
+            base::SizeT size = 0u;
+
+            if (mbedtls_ssl_session_save(&session, nullptr, 0u, &size) == MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL)
+            {
+                data.resize(size);
+
+                if (mbedtls_ssl_session_save(&session, data.data(), data.size(), &size) != 0)
+                    data.clear();
+            }
+        }
+
+        mbedtls_ssl_session_free(&session);
+
+        if (!data.empty())
+            storeSessionData(hostName.toStringView(), port, SFML_BASE_MOVE(data));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Replace the session of `hostName`:`port`, or evict the oldest session when full
+    ////////////////////////////////////////////////////////////
+    void storeSessionData(const base::StringView hostName, unsigned short port, base::Vector<unsigned char>&& data)
+    {
+        const std::lock_guard lock(mutex);
+
+        ClientSession* target = nullptr;
+
+        for (ClientSession& clientSession : clientSessions)
+            if (clientSession.hostName == hostName && clientSession.port == port)
+                target = &clientSession;
+
+        if (target == nullptr && clientSessions.size() < settings.maxSessions)
+            target = &clientSessions.emplaceBack(ClientSession{base::String{hostName}, port, {}, {}});
+
+        // Full: replace the oldest session
+        if (target == nullptr)
+            for (ClientSession& clientSession : clientSessions)
+                if (target == nullptr || clientSession.storedAt < target->storedAt)
+                    target = &clientSession;
+
+        if (target == nullptr)
+            return;
+
+        target->hostName = base::String{hostName};
+        target->port     = port;
+        target->data     = SFML_BASE_MOVE(data);
+        target->storedAt = clock.getElapsedTime();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Remove the session of `hostName`:`port`, and return it unless it expired
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Vector<unsigned char> takeSessionData(const base::StringView hostName, unsigned short port)
+    {
+        base::Vector<unsigned char> data;
+
+        const std::lock_guard lock(mutex);
+
+        for (auto* it = clientSessions.begin(); it != clientSessions.end(); ++it)
+        {
+            if (!(it->hostName == hostName) || it->port != port)
+                continue;
+
+            if (clock.getElapsedTime() - it->storedAt < settings.sessionLifetime)
+                data = SFML_BASE_MOVE(it->data);
+
+            clientSessions.erase(it);
+            break;
+        }
+
+        return data;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void recordHandshake(bool resumed, Time duration)
+    {
+        const std::lock_guard lock(mutex);
+
+        if (resumed)
+        {
+            ++statistics.resumedHandshakes;
+            statistics.resumedHandshakeTime += duration;
+        }
+        else
+        {
+            ++statistics.fullHandshakes;
+            statistics.fullHandshakeTime += duration;
+        }
+    }
+
+    TlsSessionCacheSettings     settings;       //!< Settings passed to the constructor
+    mutable std::mutex          mutex;          //!< Protects the client sessions and the statistics
+    Clock                       clock;          //!< Time reference of the client sessions
+    base::Vector<ClientSession> clientSessions; //!< Sessions to resume as a client
+    Statistics                  statistics;     //!< Handshake metrics
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_context serverCache{}; //!< Sessions to resume by ID as a server, has its own lock
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_context ticketContext{};      //!< Keys protecting the tickets issued as a server
+    bool                       ticketContextReady{}; //!< Whether `ticketContext` was set up successfully
+#endif
+};
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::TlsSessionCache(const TlsSessionCacheSettings& settings) : m_impl(base::makeUnique<Impl>(settings))
+{
+    SFML_BASE_ASSERT(settings.maxSessions > 0u);
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::~TlsSessionCache() = default;
+
+
+////////////////////////////////////////////////////////////
+void TlsSessionCache::clear()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->clientSessions.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT TlsSessionCache::getClientSessionCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->clientSessions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSessionCache::storeClientSession(const base::StringView               hostName,
+                                         const unsigned short                 port,
+                                         const base::Span<const unsigned char> sessionData)
+{
+    if (sessionData.empty())
+        return;
+
+    base::Vector<unsigned char> data(sessionData.size());
+    SFML_BASE_MEMCPY(data.data(), sessionData.data(), sessionData.size());
+
+    m_impl->storeSessionData(hostName, port, SFML_BASE_MOVE(data));
+}
+
+
+////////////////////////////////////////////////////////////
+base::Vector<unsigned char> TlsSessionCache::takeClientSession(const base::StringView hostName,
+                                                               const unsigned short   port)
+{
+    return m_impl->takeSessionData(hostName, port);
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::Statistics TlsSessionCache::getStatistics() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSessionCache::resetStatistics()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
 struct TcpSocket::Impl
 {
     TcpSocket::TlsStatus setupTls(
@@ -458,8 +811,26 @@ struct TcpSocket::Impl
             mbedtls_ssl_conf_rng(&state.sslConfig, mbedtls_ctr_drbg_random, &mbedTlsSharedState.ctrDrbgContext);
 #endif
 
+            state.isServer     = isServer;
+            state.sessionCache = tlsSessionCache;
+
             // Set up peer verification mode
-            mbedtls_ssl_conf_authmode(&state.sslConfig, verifyPeer ? MBEDTLS_SSL_VERIFY_REQUIRED : MBEDTLS_SSL_VERIFY_NONE);
+            // A client detects resumed sessions by the absence of a certificate to verify, so
+            // the certificate must at least be examined when sessions can be resumed
+            if (verifyPeer)
+                mbedtls_ssl_conf_authmode(&state.sslConfig, MBEDTLS_SSL_VERIFY_REQUIRED);
+            else if (!isServer && state.sessionCache != nullptr)
+                mbedtls_ssl_conf_authmode(&state.sslConfig, MBEDTLS_SSL_VERIFY_OPTIONAL);
+            else
+                mbedtls_ssl_conf_authmode(&state.sslConfig, MBEDTLS_SSL_VERIFY_NONE);
+
+            if (state.sessionCache != nullptr)
+            {
+                state.sessionCache->m_impl->configure(state.sslConfig, isServer);
+
+                if (!isServer)
+                    mbedtls_ssl_conf_verify(&state.sslConfig, onPeerCertificate, &state.peerCertificateReceived);
+            }
 
             // Set the CA chain to use for verification
             // Set our own certificate if we are a server
@@ -491,16 +862,21 @@ struct TcpSocket::Impl
 
             if (!isServer)
             {
+                state.hostName = hostname.toUtf8<base::String>();
+
                 // Set the hostname that is used for peer verification and sent via SNI if it is supported
-                if (auto result = mbedtls_ssl_set_hostname(&state.sslContext,
-                                                           reinterpret_cast<const char*>(
-                                                               hostname.toUtf8<base::String>().cStr()));
-                    result != 0)
+                if (auto result = mbedtls_ssl_set_hostname(&state.sslContext, state.hostName.cStr()); result != 0)
                 {
                     priv::err() << "Failed to set up TLS: " << tlsErrorString(result);
                     tlsState.reset();
                     return TlsStatus::Error;
                 }
+
+                // Offer the previous session with this server, if any
+                if (state.sessionCache != nullptr)
+                    state.sessionOffered = state.sessionCache->m_impl->restoreClientSession(state.hostName,
+                                                                                            socket.getRemotePort(),
+                                                                                            state.sslContext);
             }
 
             // Set up how the TLS implementation communicates with the underlying socket
@@ -545,6 +921,9 @@ struct TcpSocket::Impl
 #pragma GCC diagnostic pop
             },
                                 nullptr);
+
+            // Certificates and keys are loaded, the handshake itself starts now
+            state.handshakeClock.restart();
         }
 
         auto& state = *tlsState;
@@ -552,10 +931,19 @@ struct TcpSocket::Impl
         // Perform the TLS handshake if it isn't complete yet
         if (!state.handshakeComplete)
         {
-            if (auto result = mbedtls_ssl_handshake(&state.sslContext); result != 0)
+            serverSessionResumed = false;
+
+            const auto result = mbedtls_ssl_handshake(&state.sslContext);
+
+            state.sessionResumed = state.sessionResumed || serverSessionResumed;
+
+            if (result != 0)
             {
                 if (result == MBEDTLS_ERR_SSL_WANT_READ || result == MBEDTLS_ERR_SSL_WANT_WRITE)
+                {
+                    state.wantsWrite = result == MBEDTLS_ERR_SSL_WANT_WRITE;
                     return TlsStatus::HandshakeStarted;
+                }
 
 #if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
                 if (result == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
@@ -628,11 +1016,33 @@ struct TcpSocket::Impl
             }
 
             state.handshakeComplete = true;
+            state.handshakeDuration = state.handshakeClock.getElapsedTime();
+
+            if (!state.isServer)
+                state.sessionResumed = state.sessionOffered && !state.peerCertificateReceived;
+
+            if (state.sessionCache != nullptr)
+            {
+                storeClientSession(socket);
+                state.sessionCache->m_impl->recordHandshake(state.sessionResumed, state.handshakeDuration);
+            }
         }
 
         return TlsStatus::HandshakeComplete;
     }
 
+    ////////////////////////////////////////////////////////////
+    // Keep the current session for the next connection to the same server, if this is a client
+    ////////////////////////////////////////////////////////////
+    void storeClientSession(const TcpSocket& socket)
+    {
+        if (!tlsState.hasValue() || tlsState->isServer || tlsState->sessionCache == nullptr)
+            return;
+
+        auto& state = *tlsState;
+        state.sessionCache->m_impl->storeClientSession(state.hostName, socket.getRemotePort(), state.sslContext);
+    }
+
     struct TlsState
     {
         TlsState()
@@ -654,6 +1064,15 @@ struct TcpSocket::Impl
         }
 
         bool                handshakeComplete{};
+        bool                isServer{};
+        base::String        hostName;
+        TlsSessionCache*    sessionCache{};
+        bool                sessionOffered{};
+        bool                peerCertificateReceived{};
+        bool                sessionResumed{};
+        bool                wantsWrite{}; //!< Whether the last blocked operation was waiting to write
+        Clock               handshakeClock;
+        Time                handshakeDuration;
         mbedtls_net_context netContext{-1};
         mbedtls_ssl_context sslContext{};
         mbedtls_ssl_config  sslConfig{};
@@ -663,6 +1082,7 @@ struct TcpSocket::Impl
     };
 
     base::Optional<TlsState> tlsState;
+    TlsSessionCache*         tlsSessionCache{};
 };
 
 
@@ -701,16 +1121,13 @@ base::Optional<IpAddress> TcpSocket::getRemoteAddress() const
     }
 
     // Retrieve information about the remote end of the socket
-    priv::SockAddrIn address{};
-    auto             size = address.size();
+    unsigned short port    = 0;
+    auto           address = priv::SocketImpl::getPeerAddress(getNativeHandle(), port);
 
-    if (!priv::SocketImpl::getPeerName(getNativeHandle(), address, size))
-    {
+    if (!address.hasValue())
         priv::err() << "Failed to retrieve remote address of invalid TCP socket";
-        return base::nullOpt;
-    }
 
-    return base::makeOptional<IpAddress>(priv::SocketImpl::getNtohl(address));
+    return address;
 }
 
 
@@ -724,16 +1141,15 @@ unsigned short TcpSocket::getRemotePort() const
     }
 
     // Retrieve information about the remote end of the socket
-    priv::SockAddrIn address{};
-    auto             size = address.size();
+    unsigned short port = 0;
 
-    if (!priv::SocketImpl::getPeerName(getNativeHandle(), address, size))
+    if (!priv::SocketImpl::getPeerAddress(getNativeHandle(), port).hasValue())
     {
         priv::err() << "Failed to retrieve remote port of TCP socket";
         return 0;
     }
 
-    return priv::SocketImpl::getNtohs(address.sinPort());
+    return port;
 }
 
 
@@ -744,19 +1160,31 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
     if (getNativeHandle() != priv::SocketImpl::invalidSocket())
         (void)disconnect(); // Intentionally discard
 
-    // Create the internal socket if it doesn't exist
-    if (!create())
-        return Status::Error;
+    // Create the internal socket, for the family of the remote address
+    if (remoteAddress.isV6())
+    {
+        const SocketHandle handle = priv::SocketImpl::tcpSocket(IpAddress::Type::IpV6);
 
-    // Create the remote address
-    priv::SockAddrIn address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
+        if (handle == priv::SocketImpl::invalidSocket())
+        {
+            priv::err() << "Failed to create IPv6 socket";
+            return Status::Error;
+        }
+
+        if (!create(handle))
+            return Status::Error;
+    }
+    else if (!create())
+    {
+        return Status::Error;
+    }
 
     if (timeout <= Time{})
     {
         // ----- We're not using a timeout: just try to connect -----
 
         // Connect the socket
-        if (!priv::SocketImpl::connect(getNativeHandle(), address))
+        if (!priv::SocketImpl::connect(getNativeHandle(), remoteAddress, remotePort))
             return priv::SocketImpl::getErrorStatus();
 
         // Connection succeeded
@@ -773,7 +1201,7 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
         setBlocking(false);
 
     // Try to connect to the remote address
-    if (priv::SocketImpl::connect(getNativeHandle(), address))
+    if (priv::SocketImpl::connect(getNativeHandle(), remoteAddress, remotePort))
     {
         // We got instantly connected! (it may no happen a lot...)
         setBlocking(savedBlockingState);
@@ -813,6 +1241,159 @@ Socket::Status TcpSocket::connect(IpAddress remoteAddress, unsigned short remote
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::connect(base::Span<const IpAddress> remoteAddresses, unsigned short remotePort, Time timeout)
+{
+    if (remoteAddresses.empty())
+    {
+        priv::err() << "Attempted to connect TCP socket to an empty list of addresses";
+        return Status::Error;
+    }
+
+    if (remoteAddresses.size() == 1u)
+        return connect(remoteAddresses[0], remotePort, timeout);
+
+    // Disconnect the socket if it is already connected
+    if (getNativeHandle() != priv::SocketImpl::invalidSocket())
+        (void)disconnect(); // Intentionally discard
+
+    // Delay before starting the next attempt while the previous ones are still pending (RFC 8305, section 5)
+    constexpr Time attemptDelay = milliseconds(250);
+
+    base::Vector<SocketHandle> pending;
+    base::SizeT                nextAddress = 0u;
+    Time                       nextAttemptAt{};
+    SocketHandle               winner = priv::SocketImpl::invalidSocket();
+    Status                     status = Status::Error;
+
+    const auto startAttempt = [&]
+    {
+        const IpAddress    address = remoteAddresses[nextAddress++];
+        const SocketHandle handle  = priv::SocketImpl::tcpSocket(address.getType());
+
+        if (handle == priv::SocketImpl::invalidSocket())
+            return;
+
+        priv::SocketImpl::setBlocking(handle, false);
+
+        if (priv::SocketImpl::connect(handle, address, remotePort))
+        {
+            winner = handle;
+            return;
+        }
+
+        status = priv::SocketImpl::getErrorStatus();
+
+        if (status == Status::NotReady)
+            pending.pushBack(handle);
+        else
+            priv::SocketImpl::close(handle);
+    };
+
+    const Clock clock;
+
+    while (winner == priv::SocketImpl::invalidSocket())
+    {
+        const Time now = clock.getElapsedTime();
+
+        if (timeout > Time{} && now >= timeout)
+        {
+            status = Status::NotReady;
+            break;
+        }
+
+        // Start the next attempt when it is due, or right away if all the previous ones failed
+        if (nextAddress < remoteAddresses.size() && (pending.empty() || now >= nextAttemptAt))
+        {
+            startAttempt();
+            nextAttemptAt = now + attemptDelay;
+            continue;
+        }
+
+        // Every address has been tried and has failed
+        if (pending.empty())
+            break;
+
+        // Wait until an attempt completes, the next attempt is due, or the timeout expires
+        Time waitTime = nextAddress < remoteAddresses.size() ? nextAttemptAt - now : Time{};
+
+        if (timeout > Time{} && (waitTime == Time{} || timeout - now < waitTime))
+            waitTime = timeout - now;
+
+        priv::FDSet writeSet;
+        priv::FDSet exceptSet;
+        priv::FDSet readSet;
+        priv::SocketImpl::fdZero(readSet);
+        priv::SocketImpl::fdZero(writeSet);
+        priv::SocketImpl::fdZero(exceptSet);
+
+        SocketHandle maxHandle = 0;
+
+        for (const SocketHandle handle : pending)
+        {
+            priv::SocketImpl::fdSet(handle, writeSet);
+            priv::SocketImpl::fdSet(handle, exceptSet);
+            maxHandle = SFML_BASE_MAX(maxHandle, handle);
+        }
+
+        // A null wait time blocks until an attempt completes
+        const long long waitTimeUs = waitTime == Time{}
+                                         ? 0ll
+                                         : SFML_BASE_MAX(static_cast<long long>(waitTime.asMicroseconds()), 1ll);
+
+        const int readyCount = priv::SocketImpl::select(static_cast<int>(maxHandle + 1),
+                                                        &readSet,
+                                                        &writeSet,
+                                                        &exceptSet,
+                                                        waitTimeUs);
+
+        // Only a timeout can be retried, the pending attempts are closed below on error
+        if (readyCount < 0)
+        {
+            priv::err() << "Failed to wait for the TCP connection attempts";
+            status = Status::Error;
+            break;
+        }
+
+        if (readyCount == 0)
+            continue;
+
+        // Check the attempts that completed, keeping the earliest started success
+        for (base::SizeT i = 0u; i < pending.size();)
+        {
+            const SocketHandle handle = pending[i];
+
+            if (!priv::SocketImpl::fdIsSet(handle, writeSet) && !priv::SocketImpl::fdIsSet(handle, exceptSet))
+            {
+                ++i;
+                continue;
+            }
+
+            pending.erase(pending.begin() + i);
+
+            if (winner == priv::SocketImpl::invalidSocket() && priv::SocketImpl::getPendingError(handle) == 0)
+            {
+                winner = handle;
+                continue;
+            }
+
+            status = Status::Error;
+            priv::SocketImpl::close(handle);
+        }
+    }
+
+    // Abandon the attempts that lost the race
+    for (const SocketHandle handle : pending)
+        priv::SocketImpl::close(handle);
+
+    if (winner == priv::SocketImpl::invalidSocket())
+        return status;
+
+    // Adopt the winner, which restores the blocking mode of this socket
+    return create(winner) ? Status::Done : Status::Error;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool TcpSocket::disconnect()
 {
@@ -948,6 +1529,84 @@ base::Optional<base::String> TcpSocket::getCurrentCiphersuiteName() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool TcpSocket::setNoDelay(bool noDelay)
+{
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket())
+        return false;
+
+    if (!priv::SocketImpl::setNoDelay(getNativeHandle(), noDelay))
+    {
+        priv::err() << "Failed to set socket option \"TCP_NODELAY\"";
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::setBufferSizes(base::SizeT sendBufferSize, base::SizeT receiveBufferSize)
+{
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket())
+        return false;
+
+    constexpr base::SizeT maxBufferSize = 0x7FFF'FFFFu;
+
+    if (sendBufferSize > 0u &&
+        !priv::SocketImpl::setSendBufferSize(getNativeHandle(),
+                                             static_cast<int>(SFML_BASE_MIN(sendBufferSize, maxBufferSize))))
+    {
+        priv::err() << "Failed to set socket option \"SO_SNDBUF\"";
+        return false;
+    }
+
+    if (receiveBufferSize > 0u &&
+        !priv::SocketImpl::setReceiveBufferSize(getNativeHandle(),
+                                                static_cast<int>(SFML_BASE_MIN(receiveBufferSize, maxBufferSize))))
+    {
+        priv::err() << "Failed to set socket option \"SO_RCVBUF\"";
+        return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TcpSocket::setTlsSessionCache(TlsSessionCache* sessionCache)
+{
+    m_impl->tlsSessionCache = sessionCache;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::isTlsSessionResumed() const
+{
+    return m_impl->tlsState.hasValue() && m_impl->tlsState->handshakeComplete && m_impl->tlsState->sessionResumed;
+}
+
+
+////////////////////////////////////////////////////////////
+Time TcpSocket::getTlsHandshakeDuration() const
+{
+    if (!m_impl->tlsState.hasValue() || !m_impl->tlsState->handshakeComplete)
+        return Time{};
+
+    return m_impl->tlsState->handshakeDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::isWaitingForWrite(bool sending) const
+{
+    if (!m_impl->tlsState.hasValue())
+        return sending;
+
+    return m_impl->tlsState->wantsWrite;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(const void* data, base::SizeT size)
 {
@@ -990,18 +1649,22 @@ Socket::Status TcpSocket::send(const void* data, base::SizeT size, base::SizeT&
                                        static_cast<const unsigned char*>(data) + sent,
                                        size - sent);
 
+            if (result == MBEDTLS_ERR_SSL_WANT_READ || result == MBEDTLS_ERR_SSL_WANT_WRITE)
+                m_impl->tlsState->wantsWrite = result == MBEDTLS_ERR_SSL_WANT_WRITE;
+
             switch (result)
             {
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+                case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
+                    m_impl->storeClientSession(*this);
+                    [[fallthrough]];
+#endif
                 case MBEDTLS_ERR_SSL_WANT_READ:
                     [[fallthrough]];
                 case MBEDTLS_ERR_SSL_WANT_WRITE:
                     [[fallthrough]];
                 case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
                     [[fallthrough]];
-#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
-                case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
-                    [[fallthrough]];
-#endif
                 case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
                     return Status::Partial;
                 case MBEDTLS_ERR_NET_CONN_RESET:
@@ -1076,6 +1739,9 @@ Socket::Status TcpSocket::receive(void* data, base::SizeT size, base::SizeT& rec
 
         sizeReceived = mbedtls_ssl_read(&m_impl->tlsState->sslContext, static_cast<unsigned char*>(data), size);
 
+        if (sizeReceived == MBEDTLS_ERR_SSL_WANT_READ || sizeReceived == MBEDTLS_ERR_SSL_WANT_WRITE)
+            m_impl->tlsState->wantsWrite = sizeReceived == MBEDTLS_ERR_SSL_WANT_WRITE;
+
         switch (sizeReceived)
         {
             case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
@@ -1083,16 +1749,18 @@ Socket::Status TcpSocket::receive(void* data, base::SizeT size, base::SizeT& rec
             case MBEDTLS_ERR_NET_CONN_RESET:
                 received = 0;
                 return Status::Disconnected;
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+            case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
+                // TLS 1.3 tickets arrive after the handshake
+                m_impl->storeClientSession(*this);
+                [[fallthrough]];
+#endif
             case MBEDTLS_ERR_SSL_WANT_READ:
                 [[fallthrough]];
             case MBEDTLS_ERR_SSL_WANT_WRITE:
                 [[fallthrough]];
             case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
                 [[fallthrough]];
-#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
-            case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
-                [[fallthrough]];
-#endif
             case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
                 received = 0;
                 return Status::Partial;
@@ -0,0 +1,1055 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/UdpConnection.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Packet.hpp"
+#include "SFML/Network/UdpSocket.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Array.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+#include "SFML/Base/Vector.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Wire format (all integers big endian):
+//
+//   Datagram: U32 protocolId, U16 sequence, U8 flags, U16 ack, U32 ackBits, then messages until the end
+//   Message:  U8 channel (bit 7 set if fragmented), U16 messageId,
+//             [U8 fragmentIndex, U8 fragmentCount,] U16 payloadSize, payload
+//
+// `ack` is the most recent sequence received from the peer, bit `i` of `ackBits` is set
+// if sequence `ack - 1 - i` was also received. Both are only meaningful if `hasAckFlag`
+// is set in `flags`, i.e. once the sender has received at least one datagram.
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT datagramHeaderSize   = 4u + 2u + 1u + 2u + 4u;
+constexpr sf::base::U8    hasAckFlag           = 0x01u;
+constexpr sf::base::SizeT messageHeaderSize    = 1u + 2u + 2u;
+constexpr sf::base::SizeT fragmentHeaderSize   = messageHeaderSize + 1u + 1u;
+constexpr sf::base::U8    fragmentedFlag       = 0x80u;
+constexpr sf::base::SizeT maxFragmentCount     = 255u;
+constexpr sf::base::SizeT windowSize           = 1024u; // Reliable messages in flight per channel, and sent datagrams tracked
+constexpr sf::base::SizeT unreliableSlotCount  = 64u;   // Unreliable messages being reassembled at once
+constexpr sf::base::SizeT reliableChannelCount = 2u;
+constexpr sf::base::SizeT receiveBatchSize     = 32u;
+
+
+////////////////////////////////////////////////////////////
+constexpr float initialRetransmissionTimeout = 0.2f;
+constexpr float minRetransmissionTimeout     = 0.02f;
+constexpr float maxRetransmissionTimeout     = 2.f;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Compare sequence numbers, accounting for wrap-around
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline constexpr bool sequenceGreaterThan(sf::base::U16 a, sf::base::U16 b)
+{
+    constexpr sf::base::U16 half = 32'768u;
+    return ((a > b) && (sf::base::U16(a - b) <= half)) || ((a < b) && (sf::base::U16(b - a) > half));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline constexpr sf::base::U16 sequenceDistance(sf::base::U16 from, sf::base::U16 to)
+{
+    return static_cast<sf::base::U16>(to - from);
+}
+
+
+////////////////////////////////////////////////////////////
+void writeBigEndian(sf::base::Vector<char>& buffer, sf::base::U32 value, sf::base::SizeT byteCount)
+{
+    for (sf::base::SizeT i = byteCount; i-- > 0u;)
+        buffer.pushBack(static_cast<char>((value >> (8u * i)) & 0xFFu));
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Bounds-checked big endian reader over a received datagram
+///
+////////////////////////////////////////////////////////////
+struct Reader
+{
+    [[nodiscard]] bool canRead(sf::base::SizeT byteCount) const
+    {
+        return valid && static_cast<sf::base::SizeT>(end - cursor) >= byteCount;
+    }
+
+    [[nodiscard]] sf::base::U32 read(sf::base::SizeT byteCount)
+    {
+        if (!canRead(byteCount))
+        {
+            valid = false;
+            return 0u;
+        }
+
+        sf::base::U32 value = 0u;
+
+        for (sf::base::SizeT i = 0u; i < byteCount; ++i)
+            value = (value << 8u) | static_cast<sf::base::U32>(*cursor++);
+
+        return value;
+    }
+
+    [[nodiscard]] const unsigned char* skip(sf::base::SizeT byteCount)
+    {
+        if (!canRead(byteCount))
+        {
+            valid = false;
+            return nullptr;
+        }
+
+        const unsigned char* result = cursor;
+        cursor += byteCount;
+        return result;
+    }
+
+    const unsigned char* cursor;
+    const unsigned char* end;
+    bool                 valid{true};
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Small deterministic generator for the simulated network conditions
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] float nextRandomFloat(sf::base::U32& state)
+{
+    // xorshift32
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+
+    return static_cast<float>(state >> 8u) / static_cast<float>(1u << 24u);
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct UdpConnection::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct OutgoingFragment
+    {
+        base::SizeT offset;       //!< Offset of the fragment in the message payload
+        base::SizeT size;         //!< Size of the fragment
+        Time        lastSendTime; //!< When the fragment was last sent
+        bool        sent;         //!< Whether the fragment was sent at least once
+        bool        acked;        //!< Whether the peer acknowledged the fragment
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct OutgoingMessage
+    {
+        bool                           inUse{false};
+        base::U16                      id{};
+        base::SizeT                    ackedCount{};
+        base::Vector<char>             payload;
+        base::Vector<OutgoingFragment> fragments;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct IncomingMessage
+    {
+        bool                             inUse{false};
+        bool                             complete{false};
+        bool                             delivered{false};
+        base::U16                        id{};
+        base::SizeT                      fragmentCount{};
+        base::SizeT                      receivedCount{};
+        base::Vector<bool>               received;
+        base::Vector<base::Vector<char>> fragments;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct FragmentRef
+    {
+        base::U8  channelIndex;
+        base::U16 messageId;
+        base::U8  fragmentIndex;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct SentDatagram
+    {
+        bool                      inUse{false};
+        bool                      acked{false};
+        base::U16                 sequence{};
+        Time                      sendTime;
+        base::SizeT               size{};
+        base::Vector<FragmentRef> fragments; //!< Reliable fragments carried by the datagram
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct QueuedUnreliableFragment
+    {
+        base::U16   messageId;
+        base::U8    fragmentIndex;
+        base::U8    fragmentCount;
+        base::SizeT offset; //!< Offset in `unreliableQueueBytes`
+        base::SizeT size;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct DeliveredMessage
+    {
+        Channel     channel;
+        base::SizeT offset; //!< Offset in `deliveredBytes`
+        base::SizeT size;
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct DelayedDatagram
+    {
+        Time               dueTime;
+        base::Vector<char> bytes;
+    };
+
+    ////////////////////////////////////////////////////////////
+    explicit Impl(UdpSocket& theSocket, IpAddress theRemoteAddress, unsigned short theRemotePort, const UdpConnectionSettings& theSettings) :
+        socket(&theSocket),
+        remoteAddress(theRemoteAddress),
+        remotePort(theRemotePort),
+        settings(theSettings),
+        sendRate(theSettings.initialSendRate),
+        randomState(theSettings.simulationSeed != 0u ? theSettings.simulationSeed : 1u),
+        receiveBatch(receiveBatchSize, theSettings.maxDatagramSize + 1u) // One spare byte detects oversized datagrams
+    {
+        SFML_BASE_ASSERT(settings.maxDatagramSize > datagramHeaderSize + fragmentHeaderSize);
+        SFML_BASE_ASSERT(settings.maxDatagramSize <= UdpSocket::MaxDatagramSize);
+
+        outgoing.resize(reliableChannelCount * windowSize);
+        incoming.resize(reliableChannelCount * windowSize);
+
+        incomingUnreliable.resize(unreliableSlotCount);
+        sentDatagrams.resize(windowSize);
+
+        sendTokens = 4.f * static_cast<float>(settings.maxDatagramSize);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] OutgoingMessage& getOutgoing(base::SizeT channelIndex, base::U16 messageId)
+    {
+        return outgoing[channelIndex * windowSize + messageId % windowSize];
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IncomingMessage& getIncoming(base::SizeT channelIndex, base::U16 messageId)
+    {
+        return incoming[channelIndex * windowSize + messageId % windowSize];
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getMaxFragmentPayload() const
+    {
+        return settings.maxDatagramSize - datagramHeaderSize - fragmentHeaderSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getFragmentCount(base::SizeT size) const
+    {
+        const base::SizeT maxPayload = getMaxFragmentPayload();
+        return size == 0u ? 1u : (size + maxPayload - 1u) / maxPayload;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getRetransmissionTimeout() const
+    {
+        return seconds(retransmissionTimeout);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void addRoundTripSample(float sample)
+    {
+        // Smoothed estimate as in RFC 6298
+        if (!hasRoundTripSample)
+        {
+            smoothedRoundTripTime = sample;
+            roundTripTimeVariance = sample * 0.5f;
+            hasRoundTripSample    = true;
+        }
+        else
+        {
+            const float error     = smoothedRoundTripTime > sample ? smoothedRoundTripTime - sample
+                                                                   : sample - smoothedRoundTripTime;
+            roundTripTimeVariance = 0.75f * roundTripTimeVariance + 0.25f * error;
+            smoothedRoundTripTime = 0.875f * smoothedRoundTripTime + 0.125f * sample;
+        }
+
+        const float timeout   = smoothedRoundTripTime + 4.f * roundTripTimeVariance;
+        retransmissionTimeout = SFML_BASE_MIN(SFML_BASE_MAX(timeout, minRetransmissionTimeout), maxRetransmissionTimeout);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void onBytesAcked(base::SizeT byteCount)
+    {
+        // Additive increase: every acknowledged byte raises the rate by one byte per second
+        sendRate = SFML_BASE_MIN(sendRate + static_cast<float>(byteCount), settings.maxSendRate);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void onFragmentLost()
+    {
+        ++statistics.fragmentsResent;
+
+        // Multiplicative decrease, at most once per round-trip so that a burst of losses counts once
+        if (hasRateDecrease && (time - lastRateDecreaseTime).asSeconds() < smoothedRoundTripTime)
+            return;
+
+        sendRate             = SFML_BASE_MAX(sendRate * 0.5f, settings.minSendRate);
+        lastRateDecreaseTime = time;
+        hasRateDecrease      = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void deliver(Channel channel, const IncomingMessage& message)
+    {
+        const base::SizeT offset = deliveredBytes.size();
+
+        for (const base::Vector<char>& fragment : message.fragments)
+            deliveredBytes.emplaceRange(fragment.data(), fragment.size());
+
+        deliveredMessages.emplaceBack(channel, offset, deliveredBytes.size() - offset);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a fragment in `message`, return `true` if the message was just completed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool storeFragment(IncomingMessage&     message,
+                                            base::U16            messageId,
+                                            base::SizeT          fragmentIndex,
+                                            base::SizeT          fragmentCount,
+                                            const unsigned char* payload,
+                                            base::SizeT          payloadSize)
+    {
+        if (!message.inUse || message.id != messageId)
+        {
+            message.inUse         = true;
+            message.complete      = false;
+            message.delivered     = false;
+            message.id            = messageId;
+            message.fragmentCount = fragmentCount;
+            message.receivedCount = 0u;
+
+            message.received.clear();
+            message.received.resize(fragmentCount, false);
+
+            message.fragments.resize(fragmentCount);
+            for (base::Vector<char>& fragment : message.fragments)
+                fragment.clear();
+        }
+
+        if (message.complete || message.fragmentCount != fragmentCount || message.received[fragmentIndex])
+            return false;
+
+        const char* bytes = reinterpret_cast<const char*>(payload);
+        message.fragments[fragmentIndex].emplaceRange(bytes, payloadSize);
+        message.received[fragmentIndex] = true;
+
+        message.complete = ++message.receivedCount == message.fragmentCount;
+        return message.complete;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleReliableFragment(base::SizeT          channelIndex,
+                                base::U16            messageId,
+                                base::SizeT          fragmentIndex,
+                                base::SizeT          fragmentCount,
+                                const unsigned char* payload,
+                                base::SizeT          payloadSize)
+    {
+        base::U16& base = receiveBase[channelIndex];
+
+        // Already delivered, or too far ahead to be buffered: drop it, the sender will resend
+        if (sequenceGreaterThan(base, messageId) || sequenceDistance(base, messageId) >= windowSize)
+            return;
+
+        const auto       channel = static_cast<Channel>(channelIndex + 1u);
+        IncomingMessage& message = getIncoming(channelIndex, messageId);
+
+        if (storeFragment(message, messageId, fragmentIndex, fragmentCount, payload, payloadSize) &&
+            channel == Channel::Reliable)
+        {
+            deliver(channel, message);
+            message.delivered = true;
+        }
+
+        // Slide the window over completed messages, delivering ordered ones in sequence
+        for (IncomingMessage* next = &getIncoming(channelIndex, base); next->inUse && next->id == base && next->complete;
+             next                  = &getIncoming(channelIndex, base))
+        {
+            if (!next->delivered)
+                deliver(channel, *next);
+
+            next->inUse = false;
+            ++base;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleUnreliableFragment(base::U16            messageId,
+                                  base::SizeT          fragmentIndex,
+                                  base::SizeT          fragmentCount,
+                                  const unsigned char* payload,
+                                  base::SizeT          payloadSize)
+    {
+        if (fragmentCount == 1u)
+        {
+            const base::SizeT offset = deliveredBytes.size();
+            deliveredBytes.emplaceRange(reinterpret_cast<const char*>(payload), payloadSize);
+            deliveredMessages.emplaceBack(Channel::Unreliable, offset, payloadSize);
+            return;
+        }
+
+        // Partially received messages are simply overwritten when their slot is reused
+        IncomingMessage& message = incomingUnreliable[messageId % unreliableSlotCount];
+
+        if (storeFragment(message, messageId, fragmentIndex, fragmentCount, payload, payloadSize))
+        {
+            deliver(Channel::Unreliable, message);
+            message.inUse = false;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleAck(base::U16 sequence)
+    {
+        SentDatagram& datagram = sentDatagrams[sequence % windowSize];
+
+        if (!datagram.inUse || datagram.sequence != sequence || datagram.acked)
+            return;
+
+        datagram.acked = true;
+        addRoundTripSample((time - datagram.sendTime).asSeconds());
+        onBytesAcked(datagram.size);
+
+        for (const FragmentRef& ref : datagram.fragments)
+        {
+            OutgoingMessage& message = getOutgoing(ref.channelIndex, ref.messageId);
+
+            if (!message.inUse || message.id != ref.messageId)
+                continue;
+
+            OutgoingFragment& fragment = message.fragments[ref.fragmentIndex];
+
+            if (fragment.acked)
+                continue;
+
+            fragment.acked = true;
+
+            if (++message.ackedCount == message.fragments.size())
+            {
+                message.inUse = false;
+                --pendingReliableMessageCount;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void handleDatagram(const void* data, base::SizeT size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        Reader      reader{bytes, bytes + size};
+
+        const base::U32 protocolId  = reader.read(4u);
+        const auto      sequence    = static_cast<base::U16>(reader.read(2u));
+        const auto      headerFlags = static_cast<base::U8>(reader.read(1u));
+        const auto      ack         = static_cast<base::U16>(reader.read(2u));
+        const base::U32 ackBits     = reader.read(4u);
+
+        if (!reader.valid || protocolId != settings.protocolId)
+            return;
+
+        ++statistics.datagramsReceived;
+        lastReceiveTime = time;
+
+        // Record the sequence so that it is acknowledged by the next outgoing datagram
+        if (!hasRemoteSequence || sequenceGreaterThan(sequence, remoteSequence))
+        {
+            const base::SizeT shift = hasRemoteSequence ? sequenceDistance(remoteSequence, sequence) : 0u;
+
+            if (!hasRemoteSequence)
+                receivedBits = 0u;
+            else if (shift > 32u)
+                receivedBits = 0u;
+            else
+                receivedBits = static_cast<base::U32>((static_cast<base::U64>(receivedBits) << shift) |
+                                                      (base::U64{1u} << (shift - 1u)));
+
+            remoteSequence    = sequence;
+            hasRemoteSequence = true;
+        }
+        else if (const base::SizeT distance = sequenceDistance(sequence, remoteSequence); distance >= 1u && distance <= 32u)
+        {
+            receivedBits |= base::U32{1u} << (distance - 1u);
+        }
+
+        // Process acknowledgements of our own datagrams, if the peer has received any
+        if (headerFlags & hasAckFlag)
+        {
+            handleAck(ack);
+
+            for (base::U32 i = 0u; i < 32u; ++i)
+                if ((ackBits >> i) & 1u)
+                    handleAck(static_cast<base::U16>(ack - 1u - i));
+        }
+
+        // Process messages
+        while (reader.canRead(1u))
+        {
+            const auto flags     = static_cast<base::U8>(reader.read(1u));
+            const auto messageId = static_cast<base::U16>(reader.read(2u));
+
+            base::SizeT fragmentIndex = 0u;
+            base::SizeT fragmentCount = 1u;
+
+            if (flags & fragmentedFlag)
+            {
+                fragmentIndex = reader.read(1u);
+                fragmentCount = reader.read(1u);
+            }
+
+            const base::SizeT    payloadSize = reader.read(2u);
+            const unsigned char* payload     = reader.skip(payloadSize);
+
+            const base::U8 channelIndex = flags & static_cast<base::U8>(~fragmentedFlag);
+
+            if (!reader.valid || channelIndex > static_cast<base::U8>(Channel::ReliableOrdered) ||
+                fragmentIndex >= fragmentCount)
+                return;
+
+            if (channelIndex == static_cast<base::U8>(Channel::Unreliable))
+            {
+                handleUnreliableFragment(messageId, fragmentIndex, fragmentCount, payload, payloadSize);
+            }
+            else
+            {
+                handleReliableFragment(channelIndex - 1u, messageId, fragmentIndex, fragmentCount, payload, payloadSize);
+                ackPending = true;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void beginDatagram()
+    {
+        datagramBuffer.clear();
+
+        writeBigEndian(datagramBuffer, settings.protocolId, 4u);
+        writeBigEndian(datagramBuffer, localSequence, 2u);
+        writeBigEndian(datagramBuffer, hasRemoteSequence ? hasAckFlag : base::U8{0u}, 1u);
+        writeBigEndian(datagramBuffer, remoteSequence, 2u);
+        writeBigEndian(datagramBuffer, hasRemoteSequence ? receivedBits : 0u, 4u);
+
+        SentDatagram& datagram = sentDatagrams[localSequence % windowSize];
+
+        datagram.inUse    = false;
+        datagram.sequence = localSequence;
+        datagram.fragments.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool fitsInDatagram(base::SizeT payloadSize) const
+    {
+        return datagramBuffer.size() + fragmentHeaderSize + payloadSize <= settings.maxDatagramSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void appendMessage(base::U8    channelIndex,
+                       base::U16   messageId,
+                       base::SizeT fragmentIndex,
+                       base::SizeT fragmentCount,
+                       const char* payload,
+                       base::SizeT payloadSize)
+    {
+        const bool fragmented = fragmentCount > 1u;
+
+        writeBigEndian(datagramBuffer, channelIndex | (fragmented ? fragmentedFlag : 0u), 1u);
+        writeBigEndian(datagramBuffer, messageId, 2u);
+
+        if (fragmented)
+        {
+            writeBigEndian(datagramBuffer, static_cast<base::U32>(fragmentIndex), 1u);
+            writeBigEndian(datagramBuffer, static_cast<base::U32>(fragmentCount), 1u);
+        }
+
+        writeBigEndian(datagramBuffer, static_cast<base::U32>(payloadSize), 2u);
+        datagramBuffer.emplaceRange(payload, payloadSize);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sealDatagram()
+    {
+        SentDatagram& datagram = sentDatagrams[localSequence % windowSize];
+
+        datagram.inUse    = true;
+        datagram.acked    = false;
+        datagram.sendTime = time;
+        datagram.size     = datagramBuffer.size();
+
+        ++localSequence;
+        lastSendTime = time;
+        ackPending   = false;
+        sendTokens -= static_cast<float>(datagramBuffer.size());
+
+        transmit(datagramBuffer.data(), datagramBuffer.size());
+    }
+
+    ////////////////////////////////////////////////////////////
+    void transmit(const char* data, base::SizeT size)
+    {
+        ++statistics.datagramsSent;
+
+        if (settings.simulatedPacketLoss > 0.f && nextRandomFloat(randomState) < settings.simulatedPacketLoss)
+        {
+            ++statistics.datagramsDropped;
+            return;
+        }
+
+        if (settings.simulatedLatency > Time{} || settings.simulatedJitter > Time{})
+        {
+            const Time delay = settings.simulatedLatency + settings.simulatedJitter * nextRandomFloat(randomState);
+
+            DelayedDatagram& delayed = delayedDatagrams.emplaceBack();
+            delayed.dueTime          = time + delay;
+            delayed.bytes.emplaceRange(data, size);
+            return;
+        }
+
+        // Datagrams that the socket cannot send right away are treated as lost
+        (void)socket->send(data, size, remoteAddress, remotePort);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void flushDelayedDatagrams()
+    {
+        base::SizeT kept = 0u;
+
+        for (base::SizeT i = 0u; i < delayedDatagrams.size(); ++i)
+        {
+            DelayedDatagram& delayed = delayedDatagrams[i];
+
+            if (delayed.dueTime <= time)
+            {
+                (void)socket->send(delayed.bytes.data(), delayed.bytes.size(), remoteAddress, remotePort);
+                continue;
+            }
+
+            if (kept != i)
+                delayedDatagrams[kept] = SFML_BASE_MOVE(delayed);
+
+            ++kept;
+        }
+
+        delayedDatagrams.resize(kept);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make room for a message in the current datagram, return `false` if pacing forbids it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool prepareDatagramFor(base::SizeT payloadSize, bool& hasOpenDatagram)
+    {
+        if (hasOpenDatagram && fitsInDatagram(payloadSize))
+            return true;
+
+        if (hasOpenDatagram)
+        {
+            sealDatagram();
+            hasOpenDatagram = false;
+        }
+
+        if (sendTokens <= 0.f)
+            return false;
+
+        beginDatagram();
+        hasOpenDatagram = true;
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void sendQueued()
+    {
+        bool hasOpenDatagram = false;
+        bool paced           = false;
+
+        // Reliable fragments first: never sent, or not acknowledged within the retransmission timeout
+        for (base::SizeT channelIndex = 0u; channelIndex < reliableChannelCount && !paced; ++channelIndex)
+        {
+            base::U16& first = oldestOutgoing[channelIndex];
+
+            while (first != nextOutgoingId[channelIndex] && !getOutgoing(channelIndex, first).inUse)
+                ++first;
+
+            for (base::U16 id = first; id != nextOutgoingId[channelIndex] && !paced; ++id)
+            {
+                OutgoingMessage& message = getOutgoing(channelIndex, id);
+
+                if (!message.inUse)
+                    continue;
+
+                for (base::SizeT i = 0u; i < message.fragments.size(); ++i)
+                {
+                    OutgoingFragment& fragment = message.fragments[i];
+
+                    if (fragment.acked || (fragment.sent && time - fragment.lastSendTime < getRetransmissionTimeout()))
+                        continue;
+
+                    if (!prepareDatagramFor(fragment.size, hasOpenDatagram))
+                    {
+                        paced = true;
+                        break;
+                    }
+
+                    if (fragment.sent)
+                        onFragmentLost();
+
+                    appendMessage(static_cast<base::U8>(channelIndex + 1u),
+                                  message.id,
+                                  i,
+                                  message.fragments.size(),
+                                  message.payload.data() + fragment.offset,
+                                  fragment.size);
+
+                    sentDatagrams[localSequence % windowSize].fragments.emplaceBack(static_cast<base::U8>(channelIndex),
+                                                                                    message.id,
+                                                                                    static_cast<base::U8>(i));
+
+                    fragment.sent         = true;
+                    fragment.lastSendTime = time;
+                }
+            }
+        }
+
+        // Then unreliable fragments, which stay queued while pacing forbids sending them
+        base::SizeT sentUnreliable = 0u;
+
+        for (; !paced && sentUnreliable < unreliableQueue.size(); ++sentUnreliable)
+        {
+            const QueuedUnreliableFragment& fragment = unreliableQueue[sentUnreliable];
+
+            if (!prepareDatagramFor(fragment.size, hasOpenDatagram))
+                break;
+
+            appendMessage(static_cast<base::U8>(Channel::Unreliable),
+                          fragment.messageId,
+                          fragment.fragmentIndex,
+                          fragment.fragmentCount,
+                          unreliableQueueBytes.data() + fragment.offset,
+                          fragment.size);
+        }
+
+        if (sentUnreliable == unreliableQueue.size())
+        {
+            unreliableQueue.clear();
+            unreliableQueueBytes.clear();
+        }
+        else if (sentUnreliable > 0u)
+        {
+            unreliableQueue.erase(unreliableQueue.begin(), unreliableQueue.begin() + sentUnreliable);
+        }
+
+        if (hasOpenDatagram)
+            sealDatagram();
+
+        // Acknowledge received reliable messages, and keep the connection alive, even without payload
+        if (ackPending || time - lastSendTime >= settings.keepAliveInterval)
+        {
+            beginDatagram();
+            sealDatagram();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Socket::Status receiveAll()
+    {
+        while (true)
+        {
+            const Socket::Status status = socket->receive(receiveBatch);
+
+            if (status == Socket::Status::NotReady)
+                return Socket::Status::Done;
+
+            if (status != Socket::Status::Done)
+                return status;
+
+            // Datagrams filling the spare byte were truncated, they cannot come from a matching peer
+            for (const UdpSocket::ReceivedDatagram& datagram : receiveBatch.getDatagrams())
+                if (datagram.remoteAddress == remoteAddress && datagram.remotePort == remotePort &&
+                    datagram.size <= settings.maxDatagramSize)
+                    handleDatagram(datagram.data, datagram.size);
+
+            if (receiveBatch.getDatagrams().size() < receiveBatch.getCapacity())
+                return Socket::Status::Done;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    UdpSocket*     socket;
+    IpAddress      remoteAddress;
+    unsigned short remotePort;
+    UdpConnectionSettings settings;
+
+    Time time;
+    Time lastSendTime;
+    Time lastReceiveTime;
+    bool connected{true};
+
+    // Sending side
+    base::Vector<OutgoingMessage>                outgoing; //!< `windowSize` slots per reliable channel
+    base::Array<base::U16, reliableChannelCount> nextOutgoingId{};
+    base::Array<base::U16, reliableChannelCount> oldestOutgoing{};
+    base::SizeT                                  pendingReliableMessageCount{};
+
+    base::Vector<QueuedUnreliableFragment> unreliableQueue;
+    base::Vector<char>                     unreliableQueueBytes;
+    base::U16                              nextUnreliableId{};
+
+    base::Vector<SentDatagram> sentDatagrams;
+    base::Vector<char>         datagramBuffer;
+    base::U16                  localSequence{};
+
+    // Receiving side
+    base::Vector<IncomingMessage>                incoming; //!< `windowSize` slots per reliable channel
+    base::Array<base::U16, reliableChannelCount> receiveBase{};
+    base::Vector<IncomingMessage>                incomingUnreliable;
+
+    base::U16 remoteSequence{};
+    base::U32 receivedBits{};
+    bool      hasRemoteSequence{false};
+    bool      ackPending{false};
+
+    base::Vector<DeliveredMessage> deliveredMessages;
+    base::Vector<char>             deliveredBytes;
+    base::SizeT                    nextDelivered{};
+
+    // Round-trip time estimation and pacing
+    float smoothedRoundTripTime{};
+    float roundTripTimeVariance{};
+    float retransmissionTimeout{initialRetransmissionTimeout};
+    bool  hasRoundTripSample{false};
+
+    float sendRate;
+    float sendTokens{};
+    Time  lastRateDecreaseTime;
+    bool  hasRateDecrease{false};
+
+    // Simulated network conditions
+    base::U32                     randomState;
+    base::Vector<DelayedDatagram> delayedDatagrams;
+
+    UdpSocket::DatagramBatch receiveBatch;
+    Statistics               statistics{};
+};
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpSocket&                   socket,
+                             IpAddress                    remoteAddress,
+                             unsigned short               remotePort,
+                             const UdpConnectionSettings& settings) :
+    m_impl(base::makeUnique<Impl>(socket, remoteAddress, remotePort, settings))
+{
+    socket.setBlocking(false);
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::~UdpConnection() = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::UdpConnection(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+UdpConnection& UdpConnection::operator=(UdpConnection&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::send(Channel channel, const void* data, base::SizeT size)
+{
+    const base::SizeT fragmentCount = m_impl->getFragmentCount(size);
+    const base::SizeT maxPayload    = m_impl->getMaxFragmentPayload();
+    const char*       bytes         = static_cast<const char*>(data);
+
+    if (fragmentCount > maxFragmentCount)
+    {
+        priv::err() << "Cannot send message over UDP connection (message of " << size
+                    << " bytes needs more than 255 fragments)";
+        return false;
+    }
+
+    if (channel == Channel::Unreliable)
+    {
+        const base::U16 id = m_impl->nextUnreliableId++;
+
+        for (base::SizeT i = 0u; i < fragmentCount; ++i)
+        {
+            const base::SizeT offset       = i * maxPayload;
+            const base::SizeT fragmentSize = SFML_BASE_MIN(maxPayload, size - offset);
+
+            m_impl->unreliableQueue.emplaceBack(id,
+                                                static_cast<base::U8>(i),
+                                                static_cast<base::U8>(fragmentCount),
+                                                m_impl->unreliableQueueBytes.size(),
+                                                fragmentSize);
+
+            m_impl->unreliableQueueBytes.emplaceRange(bytes + offset, fragmentSize);
+        }
+
+        return true;
+    }
+
+    const auto      channelIndex = static_cast<base::SizeT>(channel) - 1u;
+    const base::U16 id           = m_impl->nextOutgoingId[channelIndex];
+
+    Impl::OutgoingMessage& message = m_impl->getOutgoing(channelIndex, id);
+
+    if (message.inUse || sequenceDistance(m_impl->oldestOutgoing[channelIndex], id) >= windowSize)
+    {
+        priv::err() << "Cannot send message over UDP connection (too many unacknowledged reliable messages)";
+        return false;
+    }
+
+    message.inUse      = true;
+    message.id         = id;
+    message.ackedCount = 0u;
+
+    message.payload.clear();
+    message.payload.emplaceRange(bytes, size);
+
+    message.fragments.clear();
+    for (base::SizeT i = 0u; i < fragmentCount; ++i)
+    {
+        const base::SizeT offset = i * maxPayload;
+        message.fragments.emplaceBack(offset, SFML_BASE_MIN(maxPayload, size - offset), Time{}, false, false);
+    }
+
+    ++m_impl->nextOutgoingId[channelIndex];
+    ++m_impl->pendingReliableMessageCount;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::send(Channel channel, const Packet& packet)
+{
+    return send(channel, packet.getData(), packet.getDataSize());
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::receive(Packet& packet, Channel& channel)
+{
+    if (m_impl->nextDelivered == m_impl->deliveredMessages.size())
+        return false;
+
+    const Impl::DeliveredMessage& message = m_impl->deliveredMessages[m_impl->nextDelivered++];
+
+    packet.clear();
+    packet.append(m_impl->deliveredBytes.data() + message.offset, message.size);
+    channel = message.channel;
+
+    if (m_impl->nextDelivered == m_impl->deliveredMessages.size())
+    {
+        m_impl->deliveredMessages.clear();
+        m_impl->deliveredBytes.clear();
+        m_impl->nextDelivered = 0u;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpConnection::update(Time deltaTime)
+{
+    if (!m_impl->connected)
+        return Socket::Status::Disconnected;
+
+    m_impl->time += deltaTime;
+
+    if (const Socket::Status status = m_impl->receiveAll(); status != Socket::Status::Done)
+        return status;
+
+    if (m_impl->time - m_impl->lastReceiveTime > m_impl->settings.timeout)
+    {
+        m_impl->connected = false;
+        return Socket::Status::Disconnected;
+    }
+
+    // Refill the token bucket, allowing short bursts of a few datagrams
+    const float burst  = SFML_BASE_MAX(m_impl->sendRate * 0.05f, 4.f * static_cast<float>(m_impl->settings.maxDatagramSize));
+    m_impl->sendTokens = SFML_BASE_MIN(m_impl->sendTokens + m_impl->sendRate * deltaTime.asSeconds(), burst);
+
+    m_impl->flushDelayedDatagrams();
+    m_impl->sendQueued();
+
+    return Socket::Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpConnection::isConnected() const
+{
+    return m_impl->connected;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UdpConnection::getPendingReliableMessageCount() const
+{
+    return m_impl->pendingReliableMessageCount;
+}
+
+
+////////////////////////////////////////////////////////////
+UdpConnection::Statistics UdpConnection::getStatistics() const
+{
+    Statistics result            = m_impl->statistics;
+    result.roundTripTime         = seconds(m_impl->smoothedRoundTripTime);
+    result.retransmissionTimeout = m_impl->getRetransmissionTimeout();
+    result.sendRate              = m_impl->sendRate;
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+IpAddress UdpConnection::getRemoteAddress() const
+{
+    return m_impl->remoteAddress;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned short UdpConnection::getRemotePort() const
+{
+    return m_impl->remotePort;
+}
+
+} // namespace sf
@@ -13,11 +13,52 @@
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+UdpSocket::DatagramBatch::DatagramBatch(base::SizeT capacity, base::SizeT maxDatagramSize) :
+    m_pool(capacity * maxDatagramSize),
+    m_capacity(capacity),
+    m_maxDatagramSize(maxDatagramSize)
+{
+    m_datagrams.reserve(capacity);
+    m_entries.reserve(capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+UdpSocket::DatagramBatch::~DatagramBatch() = default;
+
+
+////////////////////////////////////////////////////////////
+UdpSocket::DatagramBatch::DatagramBatch(DatagramBatch&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+UdpSocket::DatagramBatch& UdpSocket::DatagramBatch::operator=(DatagramBatch&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UdpSocket::DatagramBatch::getCapacity() const
+{
+    return m_capacity;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Span<const UdpSocket::ReceivedDatagram> UdpSocket::DatagramBatch::getDatagrams() const
+{
+    return {m_datagrams.data(), m_datagrams.size()};
+}
+
+
 ////////////////////////////////////////////////////////////
 UdpSocket::UdpSocket(bool isBlocking) : Socket(Type::Udp, isBlocking), m_buffer(MaxDatagramSize)
 {
@@ -46,6 +87,12 @@ Socket::Status UdpSocket::bind(unsigned short port, IpAddress address)
     if (address == IpAddress::Broadcast)
         return Status::Error;
 
+    if (address.isV6())
+    {
+        priv::err() << "UDP sockets do not support IPv6 addresses";
+        return Status::Error;
+    }
+
     // Bind the socket
     priv::SockAddrIn addr = priv::SocketImpl::createAddress(address.toInteger(), port);
     if (!priv::SocketImpl::bind(getNativeHandle(), addr))
@@ -69,7 +116,7 @@ bool UdpSocket::unbind()
 Socket::Status UdpSocket::send(const void* data, base::SizeT size, IpAddress remoteAddress, unsigned short remotePort)
 {
     // Create the internal socket if it doesn't exist
-    if (!create())
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket() && !create())
         return Status::Error;
 
     // Make sure that all the data will fit in one datagram
@@ -81,6 +128,12 @@ Socket::Status UdpSocket::send(const void* data, base::SizeT size, IpAddress rem
         return Status::Error;
     }
 
+    if (remoteAddress.isV6())
+    {
+        priv::err() << "UDP sockets do not support IPv6 addresses";
+        return Status::Error;
+    }
+
     // Build the target address
     priv::SockAddrIn address = priv::SocketImpl::createAddress(remoteAddress.toInteger(), remotePort);
 
@@ -188,4 +241,103 @@ Socket::Status UdpSocket::receive(Packet& packet, base::Optional<IpAddress>& rem
     return status;
 }
 
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(DatagramBatch& batch)
+{
+    batch.m_datagrams.clear();
+
+    if (batch.m_capacity == 0u)
+        return Status::Done;
+
+    // Each entry points into the pool, and is filled by the system call with the datagram's size and sender
+    batch.m_entries.clear();
+
+    for (base::SizeT i = 0u; i < batch.m_capacity; ++i)
+        batch.m_entries.emplaceBack(batch.m_pool.data() + i * batch.m_maxDatagramSize,
+                                    batch.m_maxDatagramSize,
+                                    0u,
+                                    base::U16{0u},
+                                    false);
+
+    const int received = priv::SocketImpl::recvBatch(getNativeHandle(), batch.m_entries.data(), batch.m_entries.size());
+
+    if (received < 0)
+        return priv::SocketImpl::getErrorStatus();
+
+    for (base::SizeT i = 0u; i < static_cast<base::SizeT>(received); ++i)
+    {
+        const priv::BatchDatagram& entry = batch.m_entries[i];
+        batch.m_datagrams.emplaceBack(entry.data, entry.size, IpAddress(entry.address), entry.port, entry.truncated);
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const base::Span<const OutgoingDatagram> datagrams, base::SizeT& sent)
+{
+    sent = 0u;
+
+    // Create the internal socket if it doesn't exist
+    if (getNativeHandle() == priv::SocketImpl::invalidSocket() && !create())
+        return Status::Error;
+
+    if (datagrams.empty())
+        return Status::Done;
+
+    // Validate everything upfront, so that an invalid datagram does not leave the batch half-sent
+    for (const OutgoingDatagram& datagram : datagrams)
+    {
+        // Make sure that all the data will fit in one datagram
+        if (datagram.size > MaxDatagramSize)
+        {
+            priv::err() << "Cannot send data over the network (the number of bytes to send is greater than "
+                           "sf::UdpSocket::MaxDatagramSize)";
+
+            return Status::Error;
+        }
+
+        if (datagram.remoteAddress.isV6())
+        {
+            priv::err() << "UDP sockets do not support IPv6 addresses";
+            return Status::Error;
+        }
+    }
+
+    // Avoid heap allocations by converting the datagrams in fixed-size chunks
+    constexpr base::SizeT chunkSize = 64u;
+    priv::BatchDatagram   entries[chunkSize];
+
+    while (sent < datagrams.size())
+    {
+        const base::SizeT chunkCount = SFML_BASE_MIN(chunkSize, datagrams.size() - sent);
+
+        for (base::SizeT i = 0u; i < chunkCount; ++i)
+        {
+            const OutgoingDatagram& datagram = datagrams[sent + i];
+
+            // The buffer is only read from, despite the non-const pointer required by the system call
+            entries[i] = {static_cast<char*>(const_cast<void*>(datagram.data)),
+                          datagram.size,
+                          datagram.remoteAddress.toInteger(),
+                          base::U16{datagram.remotePort},
+                          false};
+        }
+
+        const int result = priv::SocketImpl::sendBatch(getNativeHandle(), entries, chunkCount);
+
+        if (result < 0)
+            return sent == 0u ? priv::SocketImpl::getErrorStatus() : Status::Partial;
+
+        sent += static_cast<base::SizeT>(result);
+
+        if (static_cast<base::SizeT>(result) < chunkCount)
+            break;
+    }
+
+    return sent == datagrams.size() ? Status::Done : Status::Partial;
+}
+
 } // namespace sf
@@ -7,16 +7,24 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Network/SocketImpl.hpp"
 
+#include "SFML/Network/IpAddress.hpp"
+
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Array.hpp"
 #include "SFML/Base/Builtin/Memcpy.hpp"
 #include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include <cerrno>
@@ -24,6 +32,92 @@
 // TODO P1: major repetition with Win32 impl
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+/// \brief Fill `storage` with the socket address of `address` and `port`, return its length
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] socklen_t makeSockAddr(sockaddr_storage& storage, sf::IpAddress address, unsigned short port)
+{
+    storage = sockaddr_storage{};
+
+    if (address.isV6())
+    {
+        sockaddr_in6 in6{};
+        in6.sin6_family = AF_INET6;
+        in6.sin6_port   = htons(port);
+
+#if defined(SFML_SYSTEM_MACOS)
+        in6.sin6_len = sizeof(in6);
+#endif
+
+        const sf::base::Array<sf::base::U8, 16> bytes = address.toBytes();
+        SFML_BASE_MEMCPY(&in6.sin6_addr, bytes.data(), sizeof(in6.sin6_addr));
+
+        SFML_BASE_MEMCPY(&storage, &in6, sizeof(in6));
+        return sizeof(in6);
+    }
+
+    sockaddr_in in{};
+    in.sin_family      = AF_INET;
+    in.sin_port        = htons(port);
+    in.sin_addr.s_addr = htonl(address.toInteger());
+
+#if defined(SFML_SYSTEM_MACOS)
+    in.sin_len = sizeof(in);
+#endif
+
+    SFML_BASE_MEMCPY(&storage, &in, sizeof(in));
+    return sizeof(in);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a socket address of any family to an `sf::IpAddress` and port
+///
+/// IPv4-mapped IPv6 addresses are converted to plain IPv4 addresses.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::IpAddress> fromSockAddr(const sockaddr_storage& storage, unsigned short& port)
+{
+    if (storage.ss_family == AF_INET)
+    {
+        sockaddr_in in{};
+        SFML_BASE_MEMCPY(&in, &storage, sizeof(in));
+
+        port = ntohs(in.sin_port);
+        return sf::base::makeOptional<sf::IpAddress>(static_cast<sf::base::U32>(ntohl(in.sin_addr.s_addr)));
+    }
+
+    if (storage.ss_family == AF_INET6)
+    {
+        sockaddr_in6 in6{};
+        SFML_BASE_MEMCPY(&in6, &storage, sizeof(in6));
+
+        sf::base::Array<sf::base::U8, 16> bytes{};
+        SFML_BASE_MEMCPY(bytes.data(), &in6.sin6_addr, sizeof(in6.sin6_addr));
+
+        port = ntohs(in6.sin6_port);
+
+        constexpr sf::base::U8 mappedPrefix[12]{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+
+        bool isMapped = true;
+        for (sf::base::SizeT i = 0u; i < 12u; ++i)
+            isMapped = isMapped && bytes[i] == mappedPrefix[i];
+
+        if (isMapped)
+            return sf::base::makeOptional<sf::IpAddress>(bytes[12], bytes[13], bytes[14], bytes[15]);
+
+        return sf::base::makeOptional<sf::IpAddress>(bytes);
+    }
+
+    return sf::base::nullOpt;
+}
+
+} // namespace
+
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
@@ -105,9 +199,9 @@ SocketHandle SocketImpl::accept(SocketHandle handle, SockAddrIn& address, AddrLe
 
 
 ////////////////////////////////////////////////////////////
-bool SocketImpl::listen(SocketHandle handle)
+bool SocketImpl::listen(SocketHandle handle, int backlog)
 {
-    return ::listen(handle, SOMAXCONN) != -1;
+    return ::listen(handle, backlog > 0 ? backlog : SOMAXCONN) != -1;
 }
 
 
@@ -139,6 +233,42 @@ bool SocketImpl::connect(SocketHandle handle, SockAddrIn& address)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::connect(SocketHandle handle, IpAddress address, unsigned short port)
+{
+    sockaddr_storage storage{};
+    const socklen_t  length = makeSockAddr(storage, address, port);
+
+    return ::connect(handle, reinterpret_cast<sockaddr*>(&storage), length) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::getPendingError(SocketHandle handle)
+{
+    int       error  = 0;
+    socklen_t length = sizeof(error);
+
+    if (::getsockopt(handle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) == -1)
+        return -1;
+
+    return error;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> SocketImpl::getPeerAddress(SocketHandle handle, unsigned short& port)
+{
+    sockaddr_storage storage{};
+    socklen_t        length = sizeof(storage);
+
+    if (::getpeername(handle, reinterpret_cast<sockaddr*>(&storage), &length) == -1)
+        return base::nullOpt;
+
+    return fromSockAddr(storage, port);
+}
+
+
 ////////////////////////////////////////////////////////////
 NetworkLong SocketImpl::getNtohl(NetworkLong netlong)
 {
@@ -243,6 +373,32 @@ const char* SocketImpl::addrToString(base::U32 addr)
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> SocketImpl::inetPtonV6(const char* data)
+{
+    in6_addr address{};
+    if (::inet_pton(AF_INET6, data, &address) != 1)
+        return base::nullOpt;
+
+    base::Array<base::U8, 16> bytes{};
+    SFML_BASE_MEMCPY(bytes.data(), &address, sizeof(address));
+
+    return base::makeOptional<IpAddress>(bytes);
+}
+
+
+////////////////////////////////////////////////////////////
+const char* SocketImpl::addrToStringV6(const base::Array<base::U8, 16>& bytes)
+{
+    thread_local char buffer[INET6_ADDRSTRLEN]{};
+
+    in6_addr address{};
+    SFML_BASE_MEMCPY(&address, bytes.data(), sizeof(address));
+
+    return ::inet_ntop(AF_INET6, &address, buffer, sizeof(buffer)) != nullptr ? buffer : "";
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::tcpSocket()
 {
@@ -250,6 +406,13 @@ SocketHandle SocketImpl::tcpSocket()
 }
 
 
+////////////////////////////////////////////////////////////
+SocketHandle SocketImpl::tcpSocket(IpAddress::Type type)
+{
+    return ::socket(type == IpAddress::Type::IpV6 ? PF_INET6 : PF_INET, SOCK_STREAM, 0);
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::udpSocket()
 {
@@ -265,6 +428,40 @@ bool SocketImpl::disableNagle(SocketHandle handle)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::setNoDelay(SocketHandle handle, bool noDelay)
+{
+    int value = noDelay ? 1 : 0;
+    return setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&value), sizeof(value)) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::enableReusePort([[maybe_unused]] SocketHandle handle)
+{
+#ifdef SO_REUSEPORT
+    int yes = 1;
+    return setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&yes), sizeof(yes)) != -1;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::setSendBufferSize(SocketHandle handle, int size)
+{
+    return setsockopt(handle, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<char*>(&size), sizeof(size)) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::setReceiveBufferSize(SocketHandle handle, int size)
+{
+    return setsockopt(handle, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&size), sizeof(size)) != -1;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SocketImpl::disableSigpipe([[maybe_unused]] SocketHandle handle)
 {
@@ -318,6 +515,184 @@ NetworkSSizeT SocketImpl::recvFrom(SocketHandle handle, char* buf, SocketImpl::S
 }
 
 
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+
+////////////////////////////////////////////////////////////
+int SocketImpl::recvBatch(SocketHandle handle, BatchDatagram* datagrams, base::SizeT count)
+{
+    // Avoid heap allocations by processing the datagrams in fixed-size chunks
+    constexpr base::SizeT chunkSize = 64u;
+
+    mmsghdr     messages[chunkSize];
+    iovec       buffers[chunkSize];
+    sockaddr_in addresses[chunkSize];
+
+    base::SizeT received = 0u;
+
+    while (received < count)
+    {
+        BatchDatagram* const chunk      = datagrams + received;
+        const base::SizeT    chunkCount = SFML_BASE_MIN(chunkSize, count - received);
+
+        for (base::SizeT i = 0u; i < chunkCount; ++i)
+        {
+            buffers[i]  = {chunk[i].data, chunk[i].size};
+            messages[i] = {};
+
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Only wait for the very first datagram, then take whatever is already pending
+        const int result = ::recvmmsg(handle,
+                                      messages,
+                                      static_cast<unsigned int>(chunkCount),
+                                      received == 0u ? MSG_WAITFORONE : MSG_DONTWAIT,
+                                      nullptr);
+
+        if (result < 0)
+            return received == 0u ? -1 : static_cast<int>(received);
+
+        for (base::SizeT i = 0u; i < static_cast<base::SizeT>(result); ++i)
+        {
+            chunk[i].size      = messages[i].msg_len;
+            chunk[i].address   = ::ntohl(addresses[i].sin_addr.s_addr);
+            chunk[i].port      = ::ntohs(addresses[i].sin_port);
+            chunk[i].truncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+        }
+
+        received += static_cast<base::SizeT>(result);
+
+        if (static_cast<base::SizeT>(result) < chunkCount)
+            break;
+    }
+
+    return static_cast<int>(received);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::sendBatch(SocketHandle handle, const BatchDatagram* datagrams, base::SizeT count)
+{
+    // Avoid heap allocations by processing the datagrams in fixed-size chunks
+    constexpr base::SizeT chunkSize = 64u;
+
+    mmsghdr     messages[chunkSize];
+    iovec       buffers[chunkSize];
+    sockaddr_in addresses[chunkSize];
+
+    base::SizeT sent = 0u;
+
+    while (sent < count)
+    {
+        const BatchDatagram* const chunk      = datagrams + sent;
+        const base::SizeT          chunkCount = SFML_BASE_MIN(chunkSize, count - sent);
+
+        for (base::SizeT i = 0u; i < chunkCount; ++i)
+        {
+            buffers[i]   = {chunk[i].data, chunk[i].size};
+            messages[i]  = {};
+            addresses[i] = *createAddress(chunk[i].address, chunk[i].port).m_impl;
+
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov     = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        const int result = ::sendmmsg(handle, messages, static_cast<unsigned int>(chunkCount), 0);
+
+        if (result < 0)
+            return sent == 0u ? -1 : static_cast<int>(sent);
+
+        sent += static_cast<base::SizeT>(result);
+
+        if (static_cast<base::SizeT>(result) < chunkCount)
+            break;
+    }
+
+    return static_cast<int>(sent);
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+int SocketImpl::recvBatch(SocketHandle handle, BatchDatagram* datagrams, base::SizeT count)
+{
+    // No `recvmmsg` on this platform, fall back to one system call per datagram
+    // (`recvmsg` rather than `recvfrom`, as only the former reports truncation)
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        sockaddr_in address{};
+        iovec       buffer{datagrams[i].data, datagrams[i].size};
+
+        msghdr message{};
+        message.msg_name    = &address;
+        message.msg_namelen = sizeof(address);
+        message.msg_iov     = &buffer;
+        message.msg_iovlen  = 1;
+
+        // Only wait for the very first datagram, then take whatever is already pending
+        const ssize_t result = ::recvmsg(handle, &message, i == 0u ? 0 : MSG_DONTWAIT);
+
+        if (result < 0)
+            return i == 0u ? -1 : static_cast<int>(i);
+
+        datagrams[i].size      = static_cast<base::SizeT>(result);
+        datagrams[i].address   = ::ntohl(address.sin_addr.s_addr);
+        datagrams[i].port      = ::ntohs(address.sin_port);
+        datagrams[i].truncated = (message.msg_flags & MSG_TRUNC) != 0;
+    }
+
+    return static_cast<int>(count);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::sendBatch(SocketHandle handle, const BatchDatagram* datagrams, base::SizeT count)
+{
+    // No `sendmmsg` on this platform, fall back to one system call per datagram
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        SockAddrIn address = createAddress(datagrams[i].address, datagrams[i].port);
+
+        if (sendTo(handle, datagrams[i].data, datagrams[i].size, 0, address) < 0)
+            return i == 0u ? -1 : static_cast<int>(i);
+    }
+
+    return static_cast<int>(count);
+}
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollEntry* entries, base::SizeT count, int timeoutMs)
+{
+    thread_local base::Vector<pollfd> fds;
+    fds.resize(count);
+
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        fds[i]        = {};
+        fds[i].fd     = entries[i].handle;
+        fds[i].events = entries[i].wantWrite ? POLLOUT : POLLIN;
+    }
+
+    const int result = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), timeoutMs);
+
+    if (result < 0)
+        return -1;
+
+    for (base::SizeT i = 0u; i < count; ++i)
+        entries[i].ready = (fds[i].revents & (fds[i].events | POLLERR | POLLHUP | POLLNVAL)) != 0;
+
+    return result;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<NetworkLong> SocketImpl::convertToHostname(const char* address)
 {
@@ -340,6 +715,46 @@ base::Optional<NetworkLong> SocketImpl::convertToHostname(const char* address)
 }
 
 
+////////////////////////////////////////////////////////////
+base::Vector<IpAddress> SocketImpl::getAddressInfo(const char* hostName)
+{
+    base::Vector<IpAddress> addresses;
+
+    addrinfo hints{}; // Zero-initialize
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM; // One entry per address, instead of one per socket type
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(hostName, nullptr, &hints, &result) != 0 || result == nullptr)
+        return addresses;
+
+    for (const addrinfo* info = result; info != nullptr; info = info->ai_next)
+    {
+        if (info->ai_addr == nullptr || static_cast<base::SizeT>(info->ai_addrlen) > sizeof(sockaddr_storage))
+            continue;
+
+        sockaddr_storage storage{};
+        SFML_BASE_MEMCPY(&storage, info->ai_addr, static_cast<base::SizeT>(info->ai_addrlen));
+
+        unsigned short       port    = 0u;
+        const base::Optional address = fromSockAddr(storage, port);
+
+        if (!address.hasValue())
+            continue;
+
+        bool duplicate = false;
+        for (const IpAddress& existing : addresses)
+            duplicate = duplicate || existing == *address;
+
+        if (!duplicate)
+            addresses.pushBack(*address);
+    }
+
+    freeaddrinfo(result);
+    return addresses;
+}
+
+
 ////////////////////////////////////////////////////////////
 int SocketImpl::select(SocketHandle handle, long long timeoutUs)
 {
@@ -0,0 +1,61 @@
+#pragma once
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Decode an unsigned integer written by `Packet::appendVarUInt`
+///
+/// Reads from `bytes[readPos]` up to `bytes[size - 1]`, and
+/// advances `readPos` past every byte it reads, even on failure.
+///
+/// \return `false` if the bytes end before the last group, or if
+///         the encoding is longer than any 64-bit value needs
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline bool decodeVarUInt(const unsigned char* bytes,
+                                        base::SizeT          size,
+                                        base::SizeT&         readPos,
+                                        base::U64&           value)
+{
+    base::U64 result = 0u;
+
+    // At most 10 groups of 7 bits
+    for (unsigned int shift = 0u; shift < 70u; shift += 7u)
+    {
+        if (readPos >= size)
+            return false;
+
+        const unsigned char byte = bytes[readPos++];
+        result |= static_cast<base::U64>(byte & 0x7Fu) << shift;
+
+        if ((byte & 0x80u) == 0u)
+        {
+            value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Undo the zigzag encoding of `Packet::appendVarInt`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline base::I64 zigZagDecode(base::U64 value)
+{
+    return static_cast<base::I64>((value >> 1) ^ (~(value & 1u) + 1u));
+}
+
+} // namespace sf::priv
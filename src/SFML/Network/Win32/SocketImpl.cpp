@@ -7,11 +7,16 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Network/SocketImpl.hpp"
 
+#include "SFML/Network/IpAddress.hpp"
+
 #include "SFML/System/WindowsHeader.hpp"
 
+#include "SFML/Base/Array.hpp"
 #include "SFML/Base/Builtin/Memcpy.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -37,6 +42,80 @@ struct SocketInitializer
         WSACleanup();
     }
 } globalInitializer;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Fill `storage` with the socket address of `address` and `port`, return its length
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] int makeSockAddr(sockaddr_storage& storage, sf::IpAddress address, unsigned short port)
+{
+    storage = sockaddr_storage{};
+
+    if (address.isV6())
+    {
+        sockaddr_in6 in6{};
+        in6.sin6_family = AF_INET6;
+        in6.sin6_port   = htons(port);
+
+        const sf::base::Array<sf::base::U8, 16> bytes = address.toBytes();
+        SFML_BASE_MEMCPY(&in6.sin6_addr, bytes.data(), sizeof(in6.sin6_addr));
+
+        SFML_BASE_MEMCPY(&storage, &in6, sizeof(in6));
+        return sizeof(in6);
+    }
+
+    sockaddr_in in{};
+    in.sin_family      = AF_INET;
+    in.sin_port        = htons(port);
+    in.sin_addr.s_addr = htonl(address.toInteger());
+
+    SFML_BASE_MEMCPY(&storage, &in, sizeof(in));
+    return sizeof(in);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a socket address of any family to an `sf::IpAddress` and port
+///
+/// IPv4-mapped IPv6 addresses are converted to plain IPv4 addresses.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::IpAddress> fromSockAddr(const sockaddr_storage& storage, unsigned short& port)
+{
+    if (storage.ss_family == AF_INET)
+    {
+        sockaddr_in in{};
+        SFML_BASE_MEMCPY(&in, &storage, sizeof(in));
+
+        port = ntohs(in.sin_port);
+        return sf::base::makeOptional<sf::IpAddress>(static_cast<sf::base::U32>(ntohl(in.sin_addr.s_addr)));
+    }
+
+    if (storage.ss_family == AF_INET6)
+    {
+        sockaddr_in6 in6{};
+        SFML_BASE_MEMCPY(&in6, &storage, sizeof(in6));
+
+        sf::base::Array<sf::base::U8, 16> bytes{};
+        SFML_BASE_MEMCPY(bytes.data(), &in6.sin6_addr, sizeof(in6.sin6_addr));
+
+        port = ntohs(in6.sin6_port);
+
+        constexpr sf::base::U8 mappedPrefix[12]{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+
+        bool isMapped = true;
+        for (sf::base::SizeT i = 0u; i < 12u; ++i)
+            isMapped = isMapped && bytes[i] == mappedPrefix[i];
+
+        if (isMapped)
+            return sf::base::makeOptional<sf::IpAddress>(bytes[12], bytes[13], bytes[14], bytes[15]);
+
+        return sf::base::makeOptional<sf::IpAddress>(bytes);
+    }
+
+    return sf::base::nullOpt;
+}
 } // namespace
 
 
@@ -154,9 +233,9 @@ SocketHandle SocketImpl::accept(SocketHandle handle, SockAddrIn& address, AddrLe
 
 
 ////////////////////////////////////////////////////////////
-bool SocketImpl::listen(SocketHandle handle)
+bool SocketImpl::listen(SocketHandle handle, int backlog)
 {
-    return ::listen(handle, SOMAXCONN) != -1;
+    return ::listen(handle, backlog > 0 ? backlog : SOMAXCONN) != -1;
 }
 
 
@@ -188,6 +267,42 @@ bool SocketImpl::connect(SocketHandle handle, SockAddrIn& address)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::connect(SocketHandle handle, IpAddress address, unsigned short port)
+{
+    sockaddr_storage storage{};
+    const int        length = makeSockAddr(storage, address, port);
+
+    return ::connect(handle, reinterpret_cast<sockaddr*>(&storage), length) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::getPendingError(SocketHandle handle)
+{
+    int error  = 0;
+    int length = sizeof(error);
+
+    if (::getsockopt(handle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) == -1)
+        return -1;
+
+    return error;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> SocketImpl::getPeerAddress(SocketHandle handle, unsigned short& port)
+{
+    sockaddr_storage storage{};
+    int              length = sizeof(storage);
+
+    if (::getpeername(handle, reinterpret_cast<sockaddr*>(&storage), &length) == -1)
+        return base::nullOpt;
+
+    return fromSockAddr(storage, port);
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::invalidSocket()
 {
@@ -266,6 +381,32 @@ const char* SocketImpl::addrToString(base::U32 addr)
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> SocketImpl::inetPtonV6(const char* data)
+{
+    in6_addr address{};
+    if (::inet_pton(AF_INET6, data, &address) != 1)
+        return base::nullOpt;
+
+    base::Array<base::U8, 16> bytes{};
+    SFML_BASE_MEMCPY(bytes.data(), &address, sizeof(address));
+
+    return base::makeOptional<IpAddress>(bytes);
+}
+
+
+////////////////////////////////////////////////////////////
+const char* SocketImpl::addrToStringV6(const base::Array<base::U8, 16>& bytes)
+{
+    thread_local char buffer[INET6_ADDRSTRLEN]{};
+
+    in6_addr address{};
+    SFML_BASE_MEMCPY(&address, bytes.data(), sizeof(address));
+
+    return ::inet_ntop(AF_INET6, &address, buffer, sizeof(buffer)) != nullptr ? buffer : "";
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::tcpSocket()
 {
@@ -273,6 +414,13 @@ SocketHandle SocketImpl::tcpSocket()
 }
 
 
+////////////////////////////////////////////////////////////
+SocketHandle SocketImpl::tcpSocket(IpAddress::Type type)
+{
+    return ::socket(type == IpAddress::Type::IpV6 ? PF_INET6 : PF_INET, SOCK_STREAM, 0);
+}
+
+
 ////////////////////////////////////////////////////////////
 SocketHandle SocketImpl::udpSocket()
 {
@@ -288,6 +436,36 @@ bool SocketImpl::disableNagle(SocketHandle handle)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::setNoDelay(SocketHandle handle, bool noDelay)
+{
+    int value = noDelay ? 1 : 0;
+    return setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&value), sizeof(value)) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::enableReusePort([[maybe_unused]] SocketHandle handle)
+{
+    // `SO_REUSEADDR` lets another socket steal the port instead of sharing it, there is no equivalent
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::setSendBufferSize(SocketHandle handle, int size)
+{
+    return setsockopt(handle, SOL_SOCKET, SO_SNDBUF, reinterpret_cast<char*>(&size), sizeof(size)) != -1;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::setReceiveBufferSize(SocketHandle handle, int size)
+{
+    return setsockopt(handle, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&size), sizeof(size)) != -1;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SocketImpl::disableSigpipe([[maybe_unused]] SocketHandle handle)
 {
@@ -336,6 +514,87 @@ NetworkSSizeT SocketImpl::recvFrom(SocketHandle handle, char* buf, SocketImpl::S
 }
 
 
+////////////////////////////////////////////////////////////
+int SocketImpl::recvBatch(SocketHandle handle, BatchDatagram* datagrams, base::SizeT count)
+{
+    // Winsock has no batched receive, fall back to one system call per datagram
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        // Only wait for the very first datagram, then take whatever is already pending
+        if (i > 0u)
+        {
+            u_long pending = 0;
+            if (::ioctlsocket(handle, FIONREAD, &pending) != 0 || pending == 0)
+                return static_cast<int>(i);
+        }
+
+        sockaddr_in address{};
+        int         addressSize = sizeof(address);
+
+        const int result = ::recvfrom(handle,
+                                      datagrams[i].data,
+                                      static_cast<int>(datagrams[i].size),
+                                      0,
+                                      reinterpret_cast<sockaddr*>(&address),
+                                      &addressSize);
+
+        // Winsock fills the buffer and fails with `WSAEMSGSIZE` when the datagram does not fit
+        const bool truncated = result < 0 && WSAGetLastError() == WSAEMSGSIZE;
+
+        if (result < 0 && !truncated)
+            return i == 0u ? -1 : static_cast<int>(i);
+
+        datagrams[i].size      = truncated ? datagrams[i].size : static_cast<base::SizeT>(result);
+        datagrams[i].address   = ::ntohl(address.sin_addr.s_addr);
+        datagrams[i].port      = ::ntohs(address.sin_port);
+        datagrams[i].truncated = truncated;
+    }
+
+    return static_cast<int>(count);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::sendBatch(SocketHandle handle, const BatchDatagram* datagrams, base::SizeT count)
+{
+    // Winsock has no batched send, fall back to one system call per datagram
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        SockAddrIn address = createAddress(datagrams[i].address, datagrams[i].port);
+
+        if (sendTo(handle, datagrams[i].data, static_cast<int>(datagrams[i].size), 0, address) < 0)
+            return i == 0u ? -1 : static_cast<int>(i);
+    }
+
+    return static_cast<int>(count);
+}
+
+
+////////////////////////////////////////////////////////////
+int SocketImpl::poll(PollEntry* entries, base::SizeT count, int timeoutMs)
+{
+    thread_local base::Vector<WSAPOLLFD> fds;
+    fds.resize(count);
+
+    for (base::SizeT i = 0u; i < count; ++i)
+    {
+        fds[i]        = {};
+        fds[i].fd     = entries[i].handle;
+        fds[i].events = entries[i].wantWrite ? POLLOUT : POLLIN;
+    }
+
+    const int result = WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), timeoutMs);
+
+    if (result < 0)
+        return -1;
+
+    for (base::SizeT i = 0u; i < count; ++i)
+        entries[i].ready = (fds[i].revents & (fds[i].events | POLLERR | POLLHUP | POLLNVAL)) != 0;
+
+    return result;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<NetworkLong> SocketImpl::convertToHostname(const char* address)
 {
@@ -358,6 +617,46 @@ base::Optional<NetworkLong> SocketImpl::convertToHostname(const char* address)
 }
 
 
+////////////////////////////////////////////////////////////
+base::Vector<IpAddress> SocketImpl::getAddressInfo(const char* hostName)
+{
+    base::Vector<IpAddress> addresses;
+
+    addrinfo hints{}; // Zero-initialize
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM; // One entry per address, instead of one per socket type
+
+    addrinfo* result = nullptr;
+    if (getaddrinfo(hostName, nullptr, &hints, &result) != 0 || result == nullptr)
+        return addresses;
+
+    for (const addrinfo* info = result; info != nullptr; info = info->ai_next)
+    {
+        if (info->ai_addr == nullptr || static_cast<base::SizeT>(info->ai_addrlen) > sizeof(sockaddr_storage))
+            continue;
+
+        sockaddr_storage storage{};
+        SFML_BASE_MEMCPY(&storage, info->ai_addr, static_cast<base::SizeT>(info->ai_addrlen));
+
+        unsigned short       port    = 0u;
+        const base::Optional address = fromSockAddr(storage, port);
+
+        if (!address.hasValue())
+            continue;
+
+        bool duplicate = false;
+        for (const IpAddress& existing : addresses)
+            duplicate = duplicate || existing == *address;
+
+        if (!duplicate)
+            addresses.pushBack(*address);
+    }
+
+    freeaddrinfo(result);
+    return addresses;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SocketImpl::fdIsSet(SocketHandle handle, const FDSet& fdSet)
 {
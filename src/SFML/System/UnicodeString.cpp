@@ -7,7 +7,9 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/System/UnicodeString.hpp"
 
+#include "SFML/System/UnicodeStringUtfUtils.hpp"
 #include "SFML/System/Utf.hpp"
+#include "SFML/System/UtfBulk.hpp"
 
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/BackInserter.hpp"
@@ -190,12 +192,18 @@ TString UnicodeString::toWideString() const
 template <priv::U8StringLike TString>
 TString UnicodeString::toUtf8() const
 {
+    const char32_t* const begin = m_impl->string.data();
+    const char32_t* const end   = begin + m_impl->string.size();
+
     // Prepare the output string
     TString output;
-    output.reserve(m_impl->string.size());
+    output.resize(UtfBulk::getUtf8Length(begin, end));
 
     // Convert
-    Utf32::toUtf8(m_impl->string.begin(), m_impl->string.end(), base::BackInserter(output));
+    [[maybe_unused]] const base::SizeT written = UtfBulk::utf32ToUtf8(begin,
+                                                                       end,
+                                                                       reinterpret_cast<char*>(output.data()));
+    SFML_BASE_ASSERT(written == output.size());
 
     return output;
 }
@@ -376,6 +384,23 @@ void* UnicodeString::getImplString()
 }
 
 
+////////////////////////////////////////////////////////////
+UnicodeString UnicodeStringUtfUtils::fromContiguousUtf8(const char* begin, const char* end)
+{
+    UnicodeString string;
+
+    if (begin == end)
+        return string;
+
+    // A UTF-8 sequence never decodes to more characters than it has bytes
+    std::u32string& impl = string.m_impl->string;
+    impl.resize(static_cast<base::SizeT>(end - begin));
+    impl.resize(UtfBulk::utf8ToUtf32(begin, end, impl.data()));
+
+    return string;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool operator==(const UnicodeString& lhs, const UnicodeString& rhs)
 {
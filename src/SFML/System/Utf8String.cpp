@@ -0,0 +1,244 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Utf8String.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/UnicodeStringUtfUtils.hpp"
+#include "SFML/System/Utf.hpp"
+#include "SFML/System/UtfBulk.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtin/Memcmp.hpp"
+#include "SFML/Base/Builtin/Strlen.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MinMaxMacros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/String.hpp"
+#include "SFML/Base/StringView.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// \brief Get the number of bytes `sf::Utf8::decode` consumes for a lead byte
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::const]] inline sf::base::SizeT getSequenceLength(const sf::base::U8 leadByte)
+{
+    // clang-format off
+    if (leadByte < 0xC0u) return 1u;
+    if (leadByte < 0xE0u) return 2u;
+    if (leadByte < 0xF0u) return 3u;
+    if (leadByte < 0xF8u) return 4u;
+    if (leadByte < 0xFCu) return 5u;
+    return 6u;
+    // clang-format on
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+Utf8String::Utf8String(const char* utf8String) :
+    Utf8String(utf8String == nullptr ? base::StringView{} : base::StringView{utf8String, SFML_BASE_STRLEN(utf8String)})
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Utf8String::Utf8String(const base::StringView utf8String) : m_bytes{utf8String}
+{
+    onBytesAppended(0u);
+}
+
+
+////////////////////////////////////////////////////////////
+Utf8String::Utf8String(const UnicodeString& unicodeString)
+{
+    const char32_t* const begin = unicodeString.begin();
+    const char32_t* const end   = unicodeString.end();
+
+    m_bytes.resize(UtfBulk::getUtf8Length(begin, end));
+
+    [[maybe_unused]] const base::SizeT written = UtfBulk::utf32ToUtf8(begin, end, m_bytes.data());
+    SFML_BASE_ASSERT(written == m_bytes.size());
+
+    onBytesAppended(0u);
+}
+
+
+////////////////////////////////////////////////////////////
+UnicodeString Utf8String::toUnicodeString() const
+{
+    return UnicodeStringUtfUtils::fromUtf8(m_bytes.data(), m_bytes.data() + m_bytes.size());
+}
+
+
+////////////////////////////////////////////////////////////
+char32_t Utf8String::Cursor::operator[](const base::SizeT index)
+{
+    SFML_BASE_ASSERT(index < m_string->m_codepointCount && "Index is out of bounds");
+
+    const char* const data = m_string->m_bytes.data();
+    const char* const end  = data + m_string->m_bytes.size();
+
+    char32_t codepoint = 0;
+    Utf8::decode(data + getByteOffset(index), end, codepoint, 0);
+
+    return codepoint;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT Utf8String::Cursor::getByteOffset(const base::SizeT index)
+{
+    SFML_BASE_ASSERT(index <= m_string->m_codepointCount && "Index is out of bounds");
+
+    if (m_string->isAscii())
+        return index;
+
+    if (index == m_string->m_codepointCount)
+        return m_string->m_bytes.size();
+
+    // Resume from the last position if possible, otherwise restart from the beginning
+    if (index < m_index)
+    {
+        m_index = 0u;
+        m_byte  = 0u;
+    }
+
+    const char* const data = m_string->m_bytes.data();
+    const char* const end  = data + m_string->m_bytes.size();
+    const char*       ptr  = data + m_byte;
+
+    for (; m_index < index; ++m_index)
+        ptr = Utf8::next(ptr, end);
+
+    m_byte = static_cast<base::SizeT>(ptr - data);
+    return m_byte;
+}
+
+
+////////////////////////////////////////////////////////////
+char32_t Utf8String::operator[](const base::SizeT index) const
+{
+    return Cursor{*this}[index];
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT Utf8String::getByteOffset(const base::SizeT index) const
+{
+    return Cursor{*this}.getByteOffset(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void Utf8String::pushBack(const char32_t codepoint)
+{
+    if (codepoint < 0x80u)
+    {
+        m_bytes.pushBack(static_cast<char>(codepoint));
+        ++m_codepointCount;
+        return;
+    }
+
+    char buffer[4];
+    const auto size = UtfBulk::utf32ToUtf8(&codepoint, &codepoint + 1, buffer);
+
+    if (size == 0u) // Invalid code point, skipped
+        return;
+
+    m_bytes.append(buffer, size);
+    ++m_codepointCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Utf8String& Utf8String::operator+=(const Utf8String& rhs)
+{
+    // Both strings only contain complete sequences, so their code points do not interact
+    m_bytes.append(rhs.m_bytes.toStringView());
+    m_codepointCount += rhs.m_codepointCount;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Utf8String& Utf8String::operator+=(const base::StringView rhs)
+{
+    const base::SizeT oldByteSize = m_bytes.size();
+
+    m_bytes.append(rhs);
+    onBytesAppended(oldByteSize);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void Utf8String::clear() noexcept
+{
+    m_bytes.clear();
+
+    m_codepointCount = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+void Utf8String::onBytesAppended(const base::SizeT fromByte)
+{
+    const char* const begin = m_bytes.data();
+    const char* const end   = begin + m_bytes.size();
+
+    const base::SizeT asciiRun = UtfBulk::asciiPrefixLength(begin + fromByte, end);
+
+    const char* ptr = begin + fromByte + asciiRun;
+    m_codepointCount += asciiRun;
+
+    while (ptr != end)
+    {
+        const base::SizeT length = getSequenceLength(static_cast<base::U8>(*ptr));
+
+        if (length > static_cast<base::SizeT>(end - ptr))
+        {
+            // Truncated trailing sequence: store it as U+0000, which is what `sf::Utf8::decode`
+            // would produce, so that later appends cannot be swallowed by it
+            m_bytes.resize(static_cast<base::SizeT>(ptr - begin));
+            m_bytes.pushBack('\0');
+            ++m_codepointCount;
+            break;
+        }
+
+        ptr += length;
+        ++m_codepointCount;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool operator==(const Utf8String& lhs, const Utf8String& rhs)
+{
+    return lhs.m_bytes == rhs.m_bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+bool operator<(const Utf8String& lhs, const Utf8String& rhs)
+{
+    // Unsigned byte-wise comparison of UTF-8 is equivalent to code point comparison
+    const base::SizeT minSize = SFML_BASE_MIN(lhs.m_bytes.size(), rhs.m_bytes.size());
+    const int         result  = SFML_BASE_MEMCMP(lhs.m_bytes.data(), rhs.m_bytes.data(), minSize);
+
+    return result < 0 || (result == 0 && lhs.m_bytes.size() < rhs.m_bytes.size());
+}
+
+} // namespace sf
@@ -0,0 +1,329 @@
+// LICENSE AND COPYRIGHT (C) INFORMATION
+// https://github.com/vittorioromeo/VRSFML/blob/master/license.md
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/UtfBulk.hpp"
+
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/Base/Builtin/Memcpy.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SFML_PRIV_UTF_BULK_SSE2
+    #include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define SFML_PRIV_UTF_BULK_NEON
+    #include <arm_neon.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT blockSize = 16u;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Check whether the 16 bytes at `p` are all ASCII
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline bool isAsciiBlock(const char* p) noexcept
+{
+#if defined(SFML_PRIV_UTF_BULK_SSE2)
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return _mm_movemask_epi8(block) == 0;
+#elif defined(SFML_PRIV_UTF_BULK_NEON)
+    return vmaxvq_u8(vld1q_u8(reinterpret_cast<const sf::base::U8*>(p))) < 0x80u;
+#else
+    sf::base::U64 words[2];
+    SFML_BASE_MEMCPY(words, p, blockSize);
+    return ((words[0] | words[1]) & 0x80'80'80'80'80'80'80'80ull) == 0u;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Widen 16 ASCII bytes at `p` to 16 UTF-32 characters
+///
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline void widenAsciiBlock(const char* p, char32_t* output) noexcept
+{
+#if defined(SFML_PRIV_UTF_BULK_SSE2)
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i lo16  = _mm_unpacklo_epi8(block, zero);
+    const __m128i hi16  = _mm_unpackhi_epi8(block, zero);
+
+    auto* const out = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(lo16, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo16, zero));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi16, zero));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi16, zero));
+#elif defined(SFML_PRIV_UTF_BULK_NEON)
+    const uint8x16_t block = vld1q_u8(reinterpret_cast<const sf::base::U8*>(p));
+    const uint16x8_t lo16  = vmovl_u8(vget_low_u8(block));
+    const uint16x8_t hi16  = vmovl_u8(vget_high_u8(block));
+
+    auto* const out = reinterpret_cast<sf::base::U32*>(output);
+    vst1q_u32(out + 0u, vmovl_u16(vget_low_u16(lo16)));
+    vst1q_u32(out + 4u, vmovl_u16(vget_high_u16(lo16)));
+    vst1q_u32(out + 8u, vmovl_u16(vget_low_u16(hi16)));
+    vst1q_u32(out + 12u, vmovl_u16(vget_high_u16(hi16)));
+#else
+    for (sf::base::SizeT i = 0u; i < blockSize; ++i)
+        output[i] = static_cast<char32_t>(p[i]);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Widen 16 ASCII bytes at `p` to 16 UTF-16 characters
+///
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline void widenAsciiBlock(const char* p, char16_t* output) noexcept
+{
+#if defined(SFML_PRIV_UTF_BULK_SSE2)
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    auto* const out = reinterpret_cast<__m128i*>(output);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi8(block, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(block, zero));
+#elif defined(SFML_PRIV_UTF_BULK_NEON)
+    const uint8x16_t block = vld1q_u8(reinterpret_cast<const sf::base::U8*>(p));
+
+    auto* const out = reinterpret_cast<sf::base::U16*>(output);
+    vst1q_u16(out + 0u, vmovl_u8(vget_low_u8(block)));
+    vst1q_u16(out + 8u, vmovl_u8(vget_high_u8(block)));
+#else
+    for (sf::base::SizeT i = 0u; i < blockSize; ++i)
+        output[i] = static_cast<char16_t>(p[i]);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Narrow 16 UTF-32 characters at `input` to ASCII if all of them are below `0x80`
+///
+/// \return `false` (without writing anything) if any character is not ASCII
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline bool narrowAsciiBlock(const char32_t* input, char* output) noexcept
+{
+#if defined(SFML_PRIV_UTF_BULK_SSE2)
+    const auto*   in = reinterpret_cast<const __m128i*>(input);
+    const __m128i a  = _mm_loadu_si128(in + 0);
+    const __m128i b  = _mm_loadu_si128(in + 1);
+    const __m128i c  = _mm_loadu_si128(in + 2);
+    const __m128i d  = _mm_loadu_si128(in + 3);
+
+    const __m128i nonAscii = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                                           _mm_set1_epi32(~0x7F));
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+        return false;
+
+    // All lanes are below `0x80`, so signed saturation is lossless
+    const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), packed);
+    return true;
+#elif defined(SFML_PRIV_UTF_BULK_NEON)
+    const auto*      in = reinterpret_cast<const sf::base::U32*>(input);
+    const uint32x4_t a  = vld1q_u32(in + 0u);
+    const uint32x4_t b  = vld1q_u32(in + 4u);
+    const uint32x4_t c  = vld1q_u32(in + 8u);
+    const uint32x4_t d  = vld1q_u32(in + 12u);
+
+    if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80u)
+        return false;
+
+    const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+    const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+    vst1q_u8(reinterpret_cast<sf::base::U8*>(output), vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+    return true;
+#else
+    char32_t combined = 0;
+    for (sf::base::SizeT i = 0u; i < blockSize; ++i)
+        combined |= input[i];
+
+    if (combined >= 0x80u)
+        return false;
+
+    for (sf::base::SizeT i = 0u; i < blockSize; ++i)
+        output[i] = static_cast<char>(input[i]);
+
+    return true;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Encode a single codepoint as UTF-8, skipping invalid ones
+///
+/// Mirrors `sf::Utf8::encode` with a replacement of `0`.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline char* encodeUtf8(char32_t input, char* output) noexcept
+{
+    if ((input > 0x00'10'FF'FF) || ((input >= 0xD8'00) && (input <= 0xDB'FF)))
+        return output;
+
+    if (input < 0x80)
+    {
+        *output++ = static_cast<char>(input);
+    }
+    else if (input < 0x8'00)
+    {
+        *output++ = static_cast<char>(0xC0 | (input >> 6));
+        *output++ = static_cast<char>(0x80 | (input & 0x3F));
+    }
+    else if (input < 0x1'00'00)
+    {
+        *output++ = static_cast<char>(0xE0 | (input >> 12));
+        *output++ = static_cast<char>(0x80 | ((input >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (input & 0x3F));
+    }
+    else
+    {
+        *output++ = static_cast<char>(0xF0 | (input >> 18));
+        *output++ = static_cast<char>(0x80 | ((input >> 12) & 0x3F));
+        *output++ = static_cast<char>(0x80 | ((input >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (input & 0x3F));
+    }
+
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TChar, typename TEncodeFn>
+[[nodiscard, gnu::always_inline]] inline sf::base::SizeT decodeUtf8Impl(const char* begin,
+                                                                         const char* const end,
+                                                                         TChar* const      output,
+                                                                         TEncodeFn&&       encodeFn)
+{
+    TChar* out = output;
+
+    while (begin != end)
+    {
+        // Vectorized ASCII run
+        while (static_cast<sf::base::SizeT>(end - begin) >= blockSize && isAsciiBlock(begin))
+        {
+            widenAsciiBlock(begin, out);
+
+            begin += blockSize;
+            out += blockSize;
+        }
+
+        if (begin == end)
+            break;
+
+        // Scalar ASCII tail, or a single non-ASCII character
+        if (static_cast<sf::base::U8>(*begin) < 0x80u)
+        {
+            *out++ = static_cast<TChar>(*begin++);
+            continue;
+        }
+
+        char32_t codepoint = 0;
+        begin              = sf::Utf8::decode(begin, end, codepoint, 0);
+        out                = encodeFn(codepoint, out);
+    }
+
+    return static_cast<sf::base::SizeT>(out - output);
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::SizeT UtfBulk::asciiPrefixLength(const char* const begin, const char* const end)
+{
+    const char* p = begin;
+
+    while (static_cast<base::SizeT>(end - p) >= blockSize && isAsciiBlock(p))
+        p += blockSize;
+
+    while (p != end && static_cast<base::U8>(*p) < 0x80u)
+        ++p;
+
+    return static_cast<base::SizeT>(p - begin);
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UtfBulk::utf8ToUtf32(const char* const begin, const char* const end, char32_t* const output)
+{
+    return decodeUtf8Impl(begin,
+                          end,
+                          output,
+                          [](const char32_t codepoint, char32_t* out)
+    {
+        *out++ = codepoint;
+        return out;
+    });
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UtfBulk::utf8ToUtf16(const char* const begin, const char* const end, char16_t* const output)
+{
+    return decodeUtf8Impl(begin,
+                          end,
+                          output,
+                          [](const char32_t codepoint, char16_t* out) { return Utf16::encode(codepoint, out, 0); });
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UtfBulk::getUtf8Length(const char32_t* begin, const char32_t* const end)
+{
+    base::SizeT length = 0u;
+
+    // Branchless so that it auto-vectorizes
+    for (; begin != end; ++begin)
+    {
+        const char32_t c     = *begin;
+        const bool     valid = (c <= 0x00'10'FF'FF) && ((c < 0xD8'00) || (c > 0xDB'FF));
+
+        length += static_cast<base::SizeT>(valid) * (1u + (c >= 0x80) + (c >= 0x8'00) + (c >= 0x1'00'00));
+    }
+
+    return length;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UtfBulk::utf32ToUtf8(const char32_t* begin, const char32_t* const end, char* const output)
+{
+    char* out = output;
+
+    while (static_cast<base::SizeT>(end - begin) >= blockSize)
+    {
+        // Vectorized ASCII block
+        if (narrowAsciiBlock(begin, out))
+        {
+            begin += blockSize;
+            out += blockSize;
+            continue;
+        }
+
+        // Block contains non-ASCII characters, encode it one character at a time
+        for (base::SizeT i = 0u; i < blockSize; ++i)
+            out = encodeUtf8(*begin++, out);
+    }
+
+    while (begin != end)
+        out = encodeUtf8(*begin++, out);
+
+    return static_cast<base::SizeT>(out - output);
+}
+
+} // namespace sf
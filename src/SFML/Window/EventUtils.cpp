@@ -9,6 +9,10 @@
 
 #include "SFML/Window/Event.hpp"
 
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
 
 namespace sf::EventUtils
 {
@@ -19,4 +23,32 @@ bool isClosedOrEscapeKeyPressed(const Event& event)
            (event.is<sf::Event::KeyPressed>() && event.getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::Escape);
 }
 
+
+////////////////////////////////////////////////////////////
+void coalesceEvents(base::Vector<Event>& events, const EventCoalescing coalescing)
+{
+    if (coalescing == EventCoalescing::Disabled || events.size() < 2u)
+        return;
+
+    base::SizeT last = 0u;
+
+    for (base::SizeT i = 1u; i < events.size(); ++i)
+    {
+        Event& prev = events[last];
+        Event& curr = events[i];
+
+        if ((curr.is<Event::Resized>() && prev.is<Event::Resized>()) ||
+            (curr.is<Event::MouseMoved>() && prev.is<Event::MouseMoved>()))
+        {
+            prev = SFML_BASE_MOVE(curr);
+            continue;
+        }
+
+        if (++last != i)
+            events[last] = SFML_BASE_MOVE(curr);
+    }
+
+    events.erase(events.begin() + last + 1u, events.end());
+}
+
 } // namespace sf::EventUtils
@@ -10,6 +10,7 @@
 #include "SFML/Config.hpp"
 
 #include "SFML/Window/Event.hpp"
+#include "SFML/Window/EventUtils.hpp"
 #include "SFML/Window/Joystick.hpp"
 #include "SFML/Window/JoystickCapabilities.hpp"
 #include "SFML/Window/JoystickManager.hpp"
@@ -34,10 +35,14 @@
 #include "SFML/Base/AnkerlUnorderedDense.hpp"
 #include "SFML/Base/Builtin/Strlen.hpp"
 #include "SFML/Base/EnumArray.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/String.hpp"
 #include "SFML/Base/ToString.hpp"
 #include "SFML/Base/UniquePtr.hpp"
+#include "SFML/Base/Vector.hpp"
 
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_keycode.h>
@@ -46,8 +51,6 @@
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_video.h>
 
-#include <queue>
-
 
 ////////////////////////////////////////////////////////////
 #if defined(SFML_SYSTEM_WINDOWS)
@@ -153,7 +156,8 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 struct SDLWindowImpl::Impl
 {
-    std::queue<Event> events; //!< Queue of available events
+    base::Vector<Event> events;         //!< Queue of available events (storage is reused once drained)
+    base::SizeT         eventsHead{0u}; //!< Index of the first event of `events` not yet handed out
 
     JoystickState joystickStates[Joystick::MaxCount]{};    //!< Previous state of the joysticks
     bool          joystickConnected[Joystick::MaxCount]{}; //!< Previous connection state of the joysticks
@@ -203,6 +207,20 @@ struct SDLWindowImpl::Impl
             SDL_DestroyWindow(sdlWindow);
     }
 
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasPendingEvents() const
+    {
+        return eventsHead < events.size();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void discardConsumedEvents()
+    {
+        // Usually the whole queue has been consumed, in which case this is equivalent to `clear()`
+        events.erase(events.begin(), events.begin() + eventsHead);
+        eventsHead = 0u;
+    }
+
     ////////////////////////////////////////////////////////////
     [[nodiscard]] SDL_WindowID getWindowID() const
     {
@@ -654,12 +672,15 @@ base::Optional<Event> SDLWindowImpl::waitEvent(const Time timeout)
     };
 
     // If the event queue is empty, let's first check if new events are available from the OS
-    if (m_impl->events.empty())
+    if (!m_impl->hasPendingEvents())
+    {
+        m_impl->discardConsumedEvents();
         populateEventQueue();
+    }
 
     // Here we use a manual wait loop instead of the optimized wait-event provided by the OS,
     // so that we don't skip joystick events (which require polling)
-    while (m_impl->events.empty() && !timedOut())
+    while (!m_impl->hasPendingEvents() && !timedOut())
     {
         sleep(milliseconds(10));
         populateEventQueue();
@@ -673,23 +694,38 @@ base::Optional<Event> SDLWindowImpl::waitEvent(const Time timeout)
 base::Optional<Event> SDLWindowImpl::pollEvent()
 {
     // If the event queue is empty, let's first check if new events are available from the OS
-    if (m_impl->events.empty())
+    if (!m_impl->hasPendingEvents())
+    {
+        m_impl->discardConsumedEvents();
         populateEventQueue();
+    }
 
     return popEvent();
 }
 
 
+////////////////////////////////////////////////////////////
+base::Span<const Event> SDLWindowImpl::pollEvents(const EventCoalescing coalescing)
+{
+    // Keep the events that were not handed out yet by `pollEvent`, in order
+    m_impl->discardConsumedEvents();
+    populateEventQueue();
+
+    EventUtils::coalesceEvents(m_impl->events, coalescing);
+
+    // Everything is handed out at once, the storage is recycled on the next poll
+    m_impl->eventsHead = m_impl->events.size();
+    return {m_impl->events.data(), m_impl->events.size()};
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<Event> SDLWindowImpl::popEvent()
 {
     base::Optional<Event> event; // Use a single local variable for NRVO
 
-    if (!m_impl->events.empty())
-    {
-        event.emplace(m_impl->events.front());
-        m_impl->events.pop();
-    }
+    if (m_impl->hasPendingEvents())
+        event.emplace(SFML_BASE_MOVE(m_impl->events[m_impl->eventsHead++]));
 
     return event;
 }
@@ -725,7 +761,7 @@ SDLWindowImpl::SDLWindowImpl(const char* const context, void* const sdlWindow, c
 ////////////////////////////////////////////////////////////
 void SDLWindowImpl::pushEvent(const Event& event)
 {
-    m_impl->events.push(event);
+    m_impl->events.emplaceBack(event);
 }
 
 
@@ -1057,19 +1093,61 @@ SDL_Window* SDLWindowImpl::getSDLHandle() const
 ////////////////////////////////////////////////////////////
 void SDLWindowImpl::processEvents()
 {
+    // Consecutive events almost always target the same window, so the lookup is skipped in that case
+    SDL_WindowID   lastWindowID   = 0u; // Never a valid window ID
+    SDLWindowImpl* lastWindowImpl = nullptr;
+
     const auto dispatchSDLEvent = [&](const SDL_WindowID windowID, const SDL_Event& e)
     {
-        const auto* it = SDLWindowImplImpl::windowImplMap.find(windowID);
-        if (it == SDLWindowImplImpl::windowImplMap.end())
-            return;
+        if (windowID != lastWindowID)
+        {
+            const auto* it = SDLWindowImplImpl::windowImplMap.find(windowID);
+
+            lastWindowID   = windowID;
+            lastWindowImpl = it == SDLWindowImplImpl::windowImplMap.end() ? nullptr : it->second;
+        }
+
+        if (lastWindowImpl != nullptr)
+            lastWindowImpl->processSDLEvent(e);
+    };
+
+    // Pump the OS event queue once and retrieve the events in batches, instead of
+    // pumping on every `SDL_PollEvent` call (expensive with high polling rate mice)
+    constexpr int batchCapacity = 64;
+
+    SDL_Event batch[batchCapacity];
+    int       batchSize  = batchCapacity;
+    int       batchIndex = batchCapacity;
 
-        it->second->processSDLEvent(e);
+    const auto nextSDLEvent = [&]() -> const SDL_Event*
+    {
+        if (batchIndex == batchSize)
+        {
+            if (batchSize < batchCapacity) // Previous batch was not full, the queue is drained
+                return nullptr;
+
+            batchSize  = SDL_PeepEvents(batch, batchCapacity, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+            batchIndex = 0;
+
+            if (batchSize < 0)
+            {
+                err() << "Failed to retrieve events: " << SDL_GetError();
+                batchSize = 0;
+            }
+
+            if (batchSize == 0)
+                return nullptr;
+        }
+
+        return &batch[batchIndex++];
     };
 
-    SDL_Event e;
+    SDL_PumpEvents();
 
-    while (SDL_PollEvent(&e))
+    while (const SDL_Event* const nextEvent = nextSDLEvent())
     {
+        const SDL_Event& e = *nextEvent;
+
         switch (static_cast<SDL_EventType>(e.type))
         {
             case SDL_EVENT_FIRST:
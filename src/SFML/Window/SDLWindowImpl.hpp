@@ -7,6 +7,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/Event.hpp"
+#include "SFML/Window/WindowEnums.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 
 #include "SFML/System/Vec2.hpp"
@@ -14,6 +15,7 @@
 #include "SFML/Base/InPlacePImpl.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
@@ -128,6 +130,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> pollEvent();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return all pending window events at once
+    ///
+    /// Calls the window's internal event processing function, then
+    /// hands out the whole event queue. The returned view refers to
+    /// the internal queue storage, and is valid until the next call
+    /// to `pollEvent`, `pollEvents`, or `waitEvent`.
+    ///
+    /// \param coalescing Whether to merge consecutive redundant events
+    ///
+    /// \return View over the pending events
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Span<const Event> pollEvents(EventCoalescing coalescing);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the OS-specific handle of the window
     ///
@@ -11,6 +11,7 @@
 #include "SFML/Window/Event.hpp"
 #include "SFML/Window/SDLWindowImpl.hpp"
 #include "SFML/Window/Vulkan.hpp"
+#include "SFML/Window/WindowEnums.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 
 #include "SFML/System/UnicodeString.hpp"
@@ -19,6 +20,7 @@
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/Span.hpp"
 
 
 namespace sf
@@ -85,6 +87,20 @@ base::Optional<Event> WindowBase::pollEvent()
 }
 
 
+////////////////////////////////////////////////////////////
+base::Span<const Event> WindowBase::pollEvents(const EventCoalescing coalescing)
+{
+    const base::Span<const Event> events = m_impl->pollEvents(coalescing);
+
+    // Cache the new size if needed
+    for (const Event& event : events)
+        if (const auto* resized = event.getIf<Event::Resized>())
+            m_size = resized->size;
+
+    return events;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<Event> WindowBase::waitEvent(const Time timeout)
 {
@@ -298,7 +314,7 @@ bool WindowBase::createVulkanSurface(const Vulkan::VulkanSurfaceData& vulkanSurf
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Event> WindowBase::filterEvent(const base::Optional<Event> event)
+base::Optional<Event> WindowBase::filterEvent(base::Optional<Event> event)
 {
     // Cache the new size if needed
     if (event.hasValue() && event->getIf<Event::Resized>())
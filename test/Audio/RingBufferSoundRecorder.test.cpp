@@ -0,0 +1,109 @@
+#include "SFML/Audio/RingBufferSoundRecorder.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+struct TestRecorder : sf::RingBufferSoundRecorder
+{
+    using sf::RingBufferSoundRecorder::RingBufferSoundRecorder;
+
+    [[nodiscard]] bool push(const sf::base::I16* samples, sf::base::SizeT sampleCount)
+    {
+        return onProcessSamples(samples, sampleCount);
+    }
+};
+
+} // namespace
+
+
+TEST_CASE("[Audio] sf::RingBufferSoundRecorder")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::RingBufferSoundRecorder));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::RingBufferSoundRecorder));
+        STATIC_CHECK(!SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::RingBufferSoundRecorder));
+        STATIC_CHECK(!SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::RingBufferSoundRecorder));
+        STATIC_CHECK(SFML_BASE_HAS_VIRTUAL_DESTRUCTOR(sf::RingBufferSoundRecorder));
+    }
+
+    SECTION("Construction")
+    {
+        const TestRecorder recorder(100u);
+
+        CHECK(recorder.getCapacity() == 128u);
+        CHECK(recorder.getAvailableSampleCount() == 0u);
+        CHECK(recorder.getChannelCount() == 1u);
+        CHECK(recorder.getOverrunCount() == 0u);
+        CHECK(recorder.getDroppedSampleCount() == 0u);
+    }
+
+    SECTION("Push and read")
+    {
+        TestRecorder recorder(8u);
+
+        const sf::base::I16 input[]{1, 2, 3, 4, 5};
+        CHECK(recorder.push(input, 5u));
+        CHECK(recorder.getAvailableSampleCount() == 5u);
+
+        sf::base::I16 output[8]{};
+        CHECK(recorder.readSamples(output, 3u) == 3u);
+        CHECK(output[0] == 1);
+        CHECK(output[1] == 2);
+        CHECK(output[2] == 3);
+        CHECK(recorder.getAvailableSampleCount() == 2u);
+
+        // Wraps around the end of the ring
+        const sf::base::I16 input2[]{6, 7, 8, 9, 10};
+        CHECK(recorder.push(input2, 5u));
+        CHECK(recorder.getAvailableSampleCount() == 7u);
+
+        CHECK(recorder.readSamples(output, 8u) == 7u);
+        for (sf::base::I16 i = 0; i < 7; ++i)
+            CHECK(output[i] == i + 4);
+
+        CHECK(recorder.getAvailableSampleCount() == 0u);
+        CHECK(recorder.getOverrunCount() == 0u);
+    }
+
+    SECTION("Float conversion")
+    {
+        TestRecorder recorder(4u);
+
+        const sf::base::I16 input[]{-32'768, 0, 16'384};
+        CHECK(recorder.push(input, 3u));
+
+        float output[4]{};
+        CHECK(recorder.readSamples(output, 4u) == 3u);
+        CHECK(output[0] == -1.f);
+        CHECK(output[1] == 0.f);
+        CHECK(output[2] == 0.5f);
+    }
+
+    SECTION("Overrun")
+    {
+        TestRecorder recorder(4u);
+
+        const sf::base::I16 input[]{1, 2, 3, 4, 5, 6};
+        CHECK(recorder.push(input, 6u));
+        CHECK(recorder.getAvailableSampleCount() == 4u);
+        CHECK(recorder.getOverrunCount() == 1u);
+        CHECK(recorder.getDroppedSampleCount() == 2u);
+
+        CHECK(recorder.push(input, 1u));
+        CHECK(recorder.getOverrunCount() == 2u);
+        CHECK(recorder.getDroppedSampleCount() == 3u);
+
+        recorder.resetCounters();
+        CHECK(recorder.getOverrunCount() == 0u);
+        CHECK(recorder.getDroppedSampleCount() == 0u);
+
+        recorder.discardSamples();
+        CHECK(recorder.getAvailableSampleCount() == 0u);
+    }
+}
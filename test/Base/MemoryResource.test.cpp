@@ -0,0 +1,162 @@
+#include "SFML/Base/Allocator.hpp"
+#include "SFML/Base/FrameArena.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/MonotonicBufferResource.hpp"
+#include "SFML/Base/PoolResource.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isAligned(const void* p, const sf::base::SizeT alignment)
+{
+    return (reinterpret_cast<sf::base::SizeT>(p) & (alignment - 1u)) == 0u;
+}
+
+
+TEST_CASE("[Base] Base/MemoryResource.hpp")
+{
+    SECTION("Vector with default allocator has no overhead")
+    {
+        STATIC_CHECK(sizeof(sf::base::Vector<int>) == sizeof(void*) * 3u);
+        STATIC_CHECK(sizeof(sf::base::Vector<int, sf::base::ResourceAllocator>) == sizeof(void*) * 4u);
+    }
+
+    SECTION("ResourceAllocator without resource")
+    {
+        sf::base::Vector<int, sf::base::ResourceAllocator> v;
+        CHECK(v.getAllocator().getResource() == nullptr);
+
+        for (int i = 0; i < 100; ++i)
+            v.pushBack(i);
+
+        CHECK(v.size() == 100u);
+        CHECK(v[99] == 99);
+    }
+
+    SECTION("MonotonicBufferResource")
+    {
+        alignas(16) char buffer[64];
+        sf::base::MonotonicBufferResource resource{buffer, sizeof(buffer)};
+
+        void* const p0 = resource.allocate(10u, 1u);
+        void* const p1 = resource.allocate(8u, 8u);
+
+        CHECK(p0 == buffer);
+        CHECK(isAligned(p1, 8u));
+        CHECK(static_cast<char*>(p1) >= buffer + 10);
+        CHECK(resource.getChunkBytes() == 0u);
+
+        // Does not fit in the initial buffer anymore
+        void* const p2 = resource.allocate(256u, 16u);
+        CHECK(isAligned(p2, 16u));
+        CHECK(resource.getChunkBytes() >= 256u);
+
+        resource.release();
+        CHECK(resource.getChunkBytes() == 0u);
+        CHECK(resource.getBytesAllocated() == 0u);
+        CHECK(resource.allocate(4u, 4u) == buffer);
+    }
+
+    SECTION("Vector on MonotonicBufferResource")
+    {
+        sf::base::MonotonicBufferResource resource{128u};
+        sf::base::Vector<int, sf::base::ResourceAllocator> v{resource};
+
+        for (int i = 0; i < 1000; ++i)
+            v.pushBack(i);
+
+        CHECK(v.size() == 1000u);
+        CHECK(v.getAllocator().getResource() == &resource);
+
+        for (int i = 0; i < 1000; ++i)
+            CHECK(v[static_cast<sf::base::SizeT>(i)] == i);
+
+        // Copies and moves propagate the resource
+        const auto copy = v;
+        CHECK(copy.getAllocator() == v.getAllocator());
+
+        const auto moved = SFML_BASE_MOVE(v);
+        CHECK(moved.getAllocator().getResource() == &resource);
+        CHECK(moved.size() == 1000u);
+    }
+
+    SECTION("FrameArena")
+    {
+        sf::base::FrameArena arena{256u};
+        CHECK(arena.getChunkBytes() == 256u);
+
+        void* const first = arena.allocate(64u, 4u);
+        arena.reset();
+        CHECK(arena.allocate(64u, 4u) == first);
+        CHECK(arena.getBytesAllocated() == 64u);
+
+        // Overflow into a second block
+        (void)arena.allocate(1024u, 4u);
+        CHECK(arena.getChunkBytes() > 256u);
+
+        const auto total = arena.getChunkBytes();
+        arena.reset();
+
+        // Blocks have been coalesced, next frame fits in a single block
+        CHECK(arena.getChunkBytes() == total);
+        CHECK(arena.getPeakBytesAllocated() >= 64u + 1024u);
+
+        (void)arena.allocate(64u, 4u);
+        (void)arena.allocate(1024u, 4u);
+        CHECK(arena.getChunkBytes() == total);
+    }
+
+    SECTION("PoolResource")
+    {
+        sf::base::PoolResource pool;
+
+        void* const p0 = pool.allocate(24u, 8u);
+        CHECK(isAligned(p0, 8u));
+        CHECK(pool.getBytesInUse() == 32u);
+
+        pool.deallocate(p0, 24u, 8u);
+        CHECK(pool.getBytesInUse() == 0u);
+
+        // Same size class reuses the block
+        CHECK(pool.allocate(30u, 4u) == p0);
+
+        void* const p1 = pool.allocate(200u, 64u);
+        CHECK(isAligned(p1, 64u));
+        pool.deallocate(p1, 200u, 64u);
+
+        CHECK(pool.getLargeAllocationCount() == 0u);
+
+        void* const large = pool.allocate(1024u * 1024u, 4u);
+        CHECK(pool.getLargeAllocationCount() == 1u);
+        pool.deallocate(large, 1024u * 1024u, 4u);
+    }
+
+    SECTION("Vector on PoolResource")
+    {
+        sf::base::PoolResource pool;
+
+        {
+            sf::base::Vector<float, sf::base::ResourceAllocator> v{pool};
+
+            for (int i = 0; i < 500; ++i)
+                v.emplaceBack(static_cast<float>(i));
+
+            CHECK(v.back() == 499.f);
+
+            v.clear();
+            v.shrinkToFit();
+            CHECK(pool.getBytesInUse() == 0u);
+
+            v.emplaceBack(1.f);
+        }
+
+        CHECK(pool.getBytesInUse() == 0u);
+    }
+}
+
+} // namespace
@@ -0,0 +1,202 @@
+#include "SFML/Graphics/DrawableBatch.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/CircleShapeData.hpp"
+#include "SFML/Graphics/EllipseShapeData.hpp"
+#include "SFML/Graphics/RingShapeData.hpp"
+#include "SFML/Graphics/RoundedRectangleShapeData.hpp"
+#include "SFML/Graphics/ShapeUtils.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexSpan.hpp"
+
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/Constants.hpp"
+#include "SFML/Base/SinCosLookup.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <Doctest.hpp>
+
+#include <SystemUtil.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Same transform as the one applied by the batch to the points of a shape
+template <typename TShapeData>
+[[nodiscard]] sf::Transform getShapeDataTransform(const TShapeData& shapeData)
+{
+    const auto [sine, cosine] = sf::base::sinCosLookup(shapeData.rotation.asRadians());
+    return sf::Transform::fromPositionScaleOriginSinCos(shapeData.position,
+                                                        shapeData.scale,
+                                                        shapeData.origin,
+                                                        sine,
+                                                        cosine);
+}
+
+} // namespace
+
+
+TEST_CASE("[Graphics] sf::CPUDrawableBatch")
+{
+    // Odd point counts exercise the scalar tail of the vectorized point transform
+    constexpr unsigned int pointCounts[]{3u, 4u, 7u, 30u, 31u};
+
+    // Transformed cached points are compared against `ShapeUtils`, which evaluates the trigonometry for each point
+    sf::CPUDrawableBatch batch;
+
+    SECTION("Circle")
+    {
+        for (const unsigned int pointCount : pointCounts)
+            for (const sf::Angle startAngle : {sf::degrees(0.f), sf::degrees(37.f)})
+            {
+                const sf::CircleShapeData sdCircle{.position   = {100.f, 50.f},
+                                                   .scale      = {2.f, 0.5f},
+                                                   .origin     = {5.f, 10.f},
+                                                   .rotation   = sf::degrees(30.f),
+                                                   .radius     = 20.f,
+                                                   .startAngle = startAngle,
+                                                   .pointCount = pointCount};
+
+                const auto [data, size] = batch.add(sdCircle);
+                REQUIRE(size == pointCount + 2u); // Center, points and repeated first point
+
+                const sf::Transform transform = getShapeDataTransform(sdCircle);
+                const float         angleStep = sf::base::tau / static_cast<float>(pointCount);
+
+                for (sf::base::SizeT i = 0u; i < pointCount; ++i)
+                {
+                    const sf::Vec2f expected = transform.transformPoint(
+                        sf::ShapeUtils::computeCirclePointFromAngleStep(i,
+                                                                        startAngle.asRadians(),
+                                                                        angleStep,
+                                                                        sdCircle.radius));
+
+                    CHECK(data[1u + i].position == Approx(expected));
+                }
+
+                CHECK(data[1u + pointCount].position == data[1].position);
+            }
+    }
+
+    SECTION("Ellipse")
+    {
+        for (const unsigned int pointCount : pointCounts)
+        {
+            const sf::EllipseShapeData sdEllipse{.position         = {-40.f, 10.f},
+                                                 .rotation         = sf::degrees(200.f),
+                                                 .horizontalRadius = 30.f,
+                                                 .verticalRadius   = 12.f,
+                                                 .startAngle       = sf::degrees(90.f),
+                                                 .pointCount       = pointCount};
+
+            const auto [data, size] = batch.add(sdEllipse);
+            REQUIRE(size == pointCount + 2u);
+
+            const sf::Transform transform = getShapeDataTransform(sdEllipse);
+            const float         angleStep = sf::base::tau / static_cast<float>(pointCount);
+
+            for (sf::base::SizeT i = 0u; i < pointCount; ++i)
+            {
+                const sf::Vec2f expected = transform.transformPoint(
+                    sf::ShapeUtils::computeEllipsePointFromAngleStep(i,
+                                                                     sdEllipse.startAngle.asRadians(),
+                                                                     angleStep,
+                                                                     sdEllipse.horizontalRadius,
+                                                                     sdEllipse.verticalRadius));
+
+                CHECK(data[1u + i].position == Approx(expected));
+            }
+        }
+    }
+
+    SECTION("Ring")
+    {
+        for (const unsigned int pointCount : pointCounts)
+        {
+            const sf::RingShapeData sdRing{.position    = {15.f, 25.f},
+                                           .scale       = {1.5f, 1.5f},
+                                           .rotation    = sf::degrees(45.f),
+                                           .outerRadius = 40.f,
+                                           .innerRadius = 25.f,
+                                           .startAngle  = sf::degrees(10.f),
+                                           .pointCount  = pointCount};
+
+            const auto [data, size] = batch.add(sdRing);
+            REQUIRE(size == 2u * pointCount + 2u); // Outer and inner pairs, and repeated first pair
+
+            const sf::Transform transform    = getShapeDataTransform(sdRing);
+            const float         startRadians = sdRing.startAngle.asRadians();
+            const float         angleStep    = sf::base::tau / static_cast<float>(pointCount);
+
+            for (sf::base::SizeT i = 0u; i < pointCount; ++i)
+            {
+                const auto [outerPoint, innerPoint] = sf::ShapeUtils::computeRingPointsFromAngleStep(i,
+                                                                                                    startRadians,
+                                                                                                    angleStep,
+                                                                                                    sdRing.outerRadius,
+                                                                                                    sdRing.innerRadius);
+
+                CHECK(data[2u * i + 0u].position == Approx(transform.transformPoint(outerPoint)));
+                CHECK(data[2u * i + 1u].position == Approx(transform.transformPoint(innerPoint)));
+            }
+
+            CHECK(data[2u * pointCount + 0u].position == data[0].position);
+            CHECK(data[2u * pointCount + 1u].position == data[1].position);
+        }
+    }
+
+    SECTION("Rounded rectangle")
+    {
+        for (const unsigned int cornerPointCount : pointCounts)
+            for (const float cornerRadius : {5.f, 12.5f})
+            {
+                const sf::RoundedRectangleShapeData sdRoundedRectangle{.position         = {60.f, -20.f},
+                                                                       .scale            = {0.75f, 2.f},
+                                                                       .origin           = {40.f, 15.f},
+                                                                       .rotation         = sf::degrees(300.f),
+                                                                       .size             = {80.f, 30.f},
+                                                                       .cornerRadius     = cornerRadius,
+                                                                       .cornerPointCount = cornerPointCount};
+
+                const unsigned int pointCount = cornerPointCount * 4u;
+
+                const auto [data, size] = batch.add(sdRoundedRectangle);
+                REQUIRE(size == pointCount + 2u);
+
+                const sf::Transform transform = getShapeDataTransform(sdRoundedRectangle);
+
+                for (sf::base::SizeT i = 0u; i < pointCount; ++i)
+                {
+                    const sf::Vec2f expected = transform.transformPoint(
+                        sf::ShapeUtils::computeRoundedRectanglePoint(i,
+                                                                     sdRoundedRectangle.size,
+                                                                     cornerRadius,
+                                                                     cornerPointCount));
+
+                    CHECK(data[1u + i].position == Approx(expected));
+                }
+            }
+    }
+
+    SECTION("Cached points are not shared between shapes")
+    {
+        // Interleave shapes using different templates, so that each one replaces the cached points of the previous one
+        const sf::CircleShapeData           sdCircle{.radius = 10.f, .startAngle = sf::degrees(15.f), .pointCount = 7u};
+        const sf::RoundedRectangleShapeData sdRoundedRectangle{.size = {20.f, 10.f}, .cornerRadius = 3.f};
+
+        const auto      firstCircle = batch.add(sdCircle);
+        const sf::Vec2f firstPoint  = firstCircle[1].position;
+        const sf::Vec2f lastPoint   = firstCircle[7].position;
+
+        (void)batch.add(sdRoundedRectangle);
+        (void)batch.add(sf::CircleShapeData{.radius = 10.f, .pointCount = 8u});
+
+        const auto secondCircle = batch.add(sdCircle);
+        CHECK(secondCircle[1].position == firstPoint);
+        CHECK(secondCircle[7].position == lastPoint);
+    }
+}
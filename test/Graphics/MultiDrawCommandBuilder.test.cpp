@@ -0,0 +1,151 @@
+#include "SFML/Graphics/MultiDrawCommandBuilder.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+TEST_CASE("[Graphics] sf::MultiDrawCommandBuilder")
+{
+    using Builder = sf::MultiDrawCommandBuilder<int>;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_STANDARD_LAYOUT(sf::DrawElementsIndirectCommand));
+        STATIC_CHECK(SFML_BASE_IS_TRIVIALLY_COPYABLE(sf::DrawElementsIndirectCommand));
+        STATIC_CHECK(sizeof(sf::DrawElementsIndirectCommand) == 20u);
+
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(Builder));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(Builder));
+    }
+
+    Builder builder(/* maxTexturesPerSubmission */ 2u);
+
+    SECTION("Empty")
+    {
+        CHECK(builder.isEmpty());
+        CHECK(builder.getCommands().size() == 0u);
+        CHECK(builder.getSubmissions().size() == 0u);
+        CHECK(builder.getTextures().size() == 0u);
+        CHECK(builder.getMaxTexturesPerSubmission() == 2u);
+
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 0u);
+        CHECK(builder.isEmpty());
+        CHECK(builder.getSubmissions().size() == 0u);
+    }
+
+    SECTION("Texture slots")
+    {
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 20, /* firstIndex */ 6u, /* indexCount */ 12u);
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 18u, /* indexCount */ 3u);
+
+        REQUIRE(builder.getSubmissions().size() == 1u);
+        CHECK(builder.getSubmissions()[0].firstCommand == 0u);
+        CHECK(builder.getSubmissions()[0].commandCount == 3u);
+        CHECK(builder.getSubmissions()[0].firstTexture == 0u);
+        CHECK(builder.getSubmissions()[0].textureCount == 2u);
+
+        REQUIRE(builder.getTextures().size() == 2u);
+        CHECK(builder.getTextures()[0] == 10);
+        CHECK(builder.getTextures()[1] == 20);
+
+        const auto commands = builder.getCommands();
+        REQUIRE(commands.size() == 3u);
+
+        CHECK(commands[0].count == 6u);
+        CHECK(commands[0].firstIndex == 0u);
+        CHECK(commands[0].baseInstance == 0u);
+
+        CHECK(commands[1].count == 12u);
+        CHECK(commands[1].firstIndex == 6u);
+        CHECK(commands[1].baseInstance == 1u);
+
+        CHECK(commands[2].count == 3u);
+        CHECK(commands[2].firstIndex == 18u);
+        CHECK(commands[2].baseInstance == 0u);
+
+        for (const sf::DrawElementsIndirectCommand& command : commands)
+        {
+            CHECK(command.instanceCount == 1u);
+            CHECK(command.baseVertex == 0);
+        }
+    }
+
+    SECTION("Contiguous draws are merged")
+    {
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 6u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 12u, /* indexCount */ 0u);
+
+        REQUIRE(builder.getCommands().size() == 1u);
+        CHECK(builder.getCommands()[0].firstIndex == 0u);
+        CHECK(builder.getCommands()[0].count == 12u);
+
+        // Not contiguous
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 30u, /* indexCount */ 6u);
+        REQUIRE(builder.getCommands().size() == 2u);
+        CHECK(builder.getCommands()[1].firstIndex == 30u);
+        CHECK(builder.getSubmissions()[0].commandCount == 2u);
+    }
+
+    SECTION("Full texture table starts a new submission")
+    {
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 20, /* firstIndex */ 6u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 30, /* firstIndex */ 12u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 18u, /* indexCount */ 6u);
+
+        const auto submissions = builder.getSubmissions();
+        REQUIRE(submissions.size() == 2u);
+
+        CHECK(submissions[0].firstCommand == 0u);
+        CHECK(submissions[0].commandCount == 2u);
+        CHECK(submissions[0].firstTexture == 0u);
+        CHECK(submissions[0].textureCount == 2u);
+
+        CHECK(submissions[1].firstCommand == 2u);
+        CHECK(submissions[1].commandCount == 2u);
+        CHECK(submissions[1].firstTexture == 2u);
+        CHECK(submissions[1].textureCount == 2u);
+
+        REQUIRE(builder.getTextures().size() == 4u);
+        CHECK(builder.getTextures()[2] == 30);
+        CHECK(builder.getTextures()[3] == 10);
+
+        // Slots are relative to the texture table of the submission
+        const auto commands = builder.getCommands();
+        REQUIRE(commands.size() == 4u);
+        CHECK(commands[2].baseInstance == 0u);
+        CHECK(commands[3].baseInstance == 1u);
+    }
+
+    SECTION("Draws across submissions are not merged")
+    {
+        Builder singleTextureBuilder(/* maxTexturesPerSubmission */ 1u);
+
+        singleTextureBuilder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 6u);
+        singleTextureBuilder.addDraw(/* textureKey */ 20, /* firstIndex */ 6u, /* indexCount */ 6u);
+
+        CHECK(singleTextureBuilder.getSubmissions().size() == 2u);
+        REQUIRE(singleTextureBuilder.getCommands().size() == 2u);
+        CHECK(singleTextureBuilder.getCommands()[0].baseInstance == 0u);
+        CHECK(singleTextureBuilder.getCommands()[1].baseInstance == 0u);
+    }
+
+    SECTION("Clear")
+    {
+        builder.addDraw(/* textureKey */ 10, /* firstIndex */ 0u, /* indexCount */ 6u);
+        builder.addDraw(/* textureKey */ 20, /* firstIndex */ 6u, /* indexCount */ 6u);
+        builder.clear();
+
+        CHECK(builder.isEmpty());
+        CHECK(builder.getSubmissions().size() == 0u);
+        CHECK(builder.getTextures().size() == 0u);
+
+        builder.addDraw(/* textureKey */ 20, /* firstIndex */ 0u, /* indexCount */ 6u);
+        REQUIRE(builder.getCommands().size() == 1u);
+        CHECK(builder.getCommands()[0].baseInstance == 0u);
+        CHECK(builder.getTextures()[0] == 20);
+    }
+}
@@ -1,13 +1,25 @@
+#include "SFML/Graphics/DrawableBatch.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/InstancedSpriteBatch.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
+#include "SFML/Graphics/RectangleShapeData.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/RetainedBatch.hpp"
+#include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+#include "SFML/Graphics/VertexSpan.hpp"
 
 #include "SFML/Window/WindowContext.hpp"
 
+#include "SFML/System/Rect2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
 #include <Doctest.hpp>
 
 #include <GraphicsUtil.hpp>
@@ -398,4 +410,351 @@ TEST_CASE("[Graphics] Render Tests" * doctest::skip(skipDisplayTests))
             }
         }
     }
+
+    SECTION("Streaming GPU drawable batch")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        sf::StreamingGPUDrawableBatch batch;
+
+        // More draws than buffers in the ring, each one appended after the previous ones
+        for (int i = 0; i < 10; ++i)
+        {
+            batch.clear();
+            (void)batch.add(sf::RectangleShapeData{.position  = {static_cast<float>(i) * 10.f, 0.f},
+                                                   .fillColor = i % 2 == 0 ? sf::Color::Green : sf::Color::Blue,
+                                                   .size      = {10.f, 100.f}});
+
+            renderTexture.draw(batch);
+        }
+
+        renderTexture.display();
+
+        const auto image = renderTexture.getTexture().copyToImage();
+
+        for (unsigned int i = 0u; i < 10u; ++i)
+            CHECK(image.getPixel({i * 10u + 5u, 50u}) == (i % 2u == 0u ? sf::Color::Green : sf::Color::Blue));
+    }
+
+    SECTION("Streaming GPU drawable batch growth and rotation")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        sf::StreamingGPUDrawableBatch batch;
+
+        // The first draw allocates the minimum storage of the first slot
+        (void)batch.add(sf::RectangleShapeData{.fillColor = sf::Color::Green, .size = {100.f, 100.f}});
+        renderTexture.draw(batch);
+
+        CHECK(batch.getStreamingStatistics().slotRotations == 0u);
+        CHECK(batch.getStreamingStatistics().storageOrphans == 2u);
+
+        // Large draws grow the slot in place, then move on to the next slot once it is large enough
+        batch.clear();
+
+        for (int i = 0; i < 20'000; ++i)
+            (void)batch.add(sf::RectangleShapeData{.fillColor = sf::Color::Blue, .size = {100.f, 100.f}});
+
+        renderTexture.draw(batch);
+        CHECK(batch.getStreamingStatistics().slotRotations == 0u);
+        CHECK(batch.getStreamingStatistics().storageOrphans == 4u);
+
+        for (int i = 0; i < 64 && batch.getStreamingStatistics().slotRotations == 0u; ++i)
+            renderTexture.draw(batch);
+
+        // Allocations of both slots, and at least one more growth of the first one
+        const auto statistics = batch.getStreamingStatistics();
+        CHECK(statistics.slotRotations == 1u);
+        CHECK(statistics.storageOrphans > 6u);
+
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({50u, 50u}) == sf::Color::Blue);
+    }
+
+    SECTION("Compact vertex formats")
+    {
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.setAutoBatchMode(sf::RenderTarget::AutoBatchMode::CPUStorage);
+
+        const sf::RectangleShapeData leftHalf{.fillColor = sf::Color::Green, .size = {50.f, 100.f}};
+        const sf::RectangleShapeData rightHalf{.position  = {50.f, 0.f},
+                                               .fillColor = sf::Color::Blue,
+                                               .size      = {50.f, 100.f}};
+
+        const auto checkHalves = [&]
+        {
+            renderTexture.display();
+
+            const auto image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({25u, 50u}) == sf::Color::Green);
+            CHECK(image.getPixel({75u, 50u}) == sf::Color::Blue);
+        };
+
+        for (const auto format : {sf::VertexFormat::Float32, sf::VertexFormat::Int16, sf::VertexFormat::HalfFloat})
+        {
+            // Batches
+            sf::CPUDrawableBatch cpuBatch;
+            cpuBatch.setVertexFormat(format);
+            CHECK(cpuBatch.getVertexFormat() == format);
+            (void)cpuBatch.add(leftHalf);
+
+            sf::StreamingGPUDrawableBatch streamingBatch;
+            streamingBatch.setVertexFormat(format);
+            (void)streamingBatch.add(rightHalf);
+
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.draw(cpuBatch);
+            renderTexture.draw(streamingBatch);
+            checkHalves();
+
+            // Autobatching
+            renderTexture.setAutoBatchVertexFormat(format);
+            CHECK(renderTexture.getAutoBatchVertexFormat() == format);
+
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.draw(leftHalf);
+            renderTexture.draw(rightHalf);
+            checkHalves();
+        }
+    }
+
+    SECTION("Instanced sprite batch")
+    {
+        auto image = sf::Image::create({2u, 1u}, sf::Color::Green).value();
+        image.setPixel({1u, 0u}, sf::Color::Blue);
+
+        const auto texture = sf::Texture::loadFromImage(image).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        sf::CPUInstancedSpriteBatch batch;
+        batch.add(sf::Sprite{.scale = {50.f, 100.f}, .textureRect = {{0.f, 0.f}, {1.f, 1.f}}});
+
+        // Rotated around its center, which must stay on the right half
+        batch.add(sf::Sprite{.position    = {75.f, 50.f},
+                             .scale       = {50.f, 100.f},
+                             .origin      = {0.5f, 0.5f},
+                             .rotation    = sf::degrees(180.f),
+                             .textureRect = {{1.f, 0.f}, {1.f, 1.f}}});
+
+        CHECK(batch.getNumSprites() == 2u);
+
+        renderTexture.draw(batch, {.texture = &texture});
+        CHECK(renderTexture.display().drawCalls == 1u);
+
+        const auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25u, 50u}) == sf::Color::Green);
+        CHECK(result.getPixel({75u, 50u}) == sf::Color::Blue);
+
+        batch.clear();
+        CHECK(batch.isEmpty());
+    }
+
+#ifndef SFML_OPENGL_ES
+    SECTION("Persistent GPU instanced sprite batch")
+    {
+        auto image = sf::Image::create({2u, 1u}, sf::Color::Green).value();
+        image.setPixel({1u, 0u}, sf::Color::Blue);
+
+        const auto texture = sf::Texture::loadFromImage(image).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.clear(sf::Color::Red);
+
+        sf::PersistentGPUInstancedSpriteBatch batch;
+        batch.add(sf::Sprite{.scale = {50.f, 100.f}, .textureRect = {{0.f, 0.f}, {1.f, 1.f}}});
+
+        // Rotated around its center, which must stay on the right half
+        batch.add(sf::Sprite{.position    = {75.f, 50.f},
+                             .scale       = {50.f, 100.f},
+                             .origin      = {0.5f, 0.5f},
+                             .rotation    = sf::degrees(180.f),
+                             .textureRect = {{1.f, 0.f}, {1.f, 1.f}}});
+
+        CHECK(batch.getNumSprites() == 2u);
+
+        renderTexture.draw(batch, {.texture = &texture});
+        CHECK(renderTexture.display().drawCalls == 1u);
+
+        const auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25u, 50u}) == sf::Color::Green);
+        CHECK(result.getPixel({75u, 50u}) == sf::Color::Blue);
+
+        // Instances written after a clear replace the previous ones in the mapped buffer
+        batch.clear();
+        CHECK(batch.isEmpty());
+
+        batch.add(sf::Sprite{.scale = {100.f, 100.f}, .textureRect = {{1.f, 0.f}, {1.f, 1.f}}});
+        CHECK(batch.getNumSprites() == 1u);
+
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(batch, {.texture = &texture});
+        CHECK(renderTexture.display().drawCalls == 1u);
+
+        const auto replaced = renderTexture.getTexture().copyToImage();
+        CHECK(replaced.getPixel({25u, 50u}) == sf::Color::Blue);
+        CHECK(replaced.getPixel({75u, 50u}) == sf::Color::Blue);
+
+        // Empty batches are not drawn
+        batch.clear();
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(batch, {.texture = &texture});
+        CHECK(renderTexture.display().drawCalls == 0u);
+    }
+#endif
+
+    SECTION("Retained batch")
+    {
+        auto image = sf::Image::create({2u, 1u}, sf::Color::Green).value();
+        image.setPixel({1u, 0u}, sf::Color::Blue);
+
+        const auto texture = sf::Texture::loadFromImage(image).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+
+        const sf::Rect2f greenRect{{0.f, 0.f}, {1.f, 1.f}};
+        const sf::Rect2f blueRect{{1.f, 0.f}, {1.f, 1.f}};
+
+        sf::RetainedBatch batch;
+
+        const sf::Sprite leftSprite{.scale = {50.f, 100.f}, .textureRect = greenRect};
+        const sf::Sprite rightSprite{.position = {50.f, 0.f}, .scale = {50.f, 100.f}, .textureRect = blueRect};
+
+        const auto left  = batch.add(leftSprite);
+        const auto right = batch.add(rightSprite);
+
+        CHECK(batch.contains(left));
+        CHECK(batch.contains(right));
+        CHECK(batch.getNumDrawables() == 2u);
+        CHECK(batch.getNumVertices() == 8u);
+        CHECK(batch.getNumIndices() == 12u);
+        CHECK(batch.getPendingUploadByteCount() == 8u * sizeof(sf::Vertex) + 12u * sizeof(sf::IndexType));
+
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(batch, {.texture = &texture});
+        CHECK(renderTexture.display().drawCalls == 1u);
+        CHECK(batch.getPendingUploadByteCount() == 0u);
+
+        auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25u, 50u}) == sf::Color::Green);
+        CHECK(result.getPixel({75u, 50u}) == sf::Color::Blue);
+
+        // Only the updated sprite is uploaded again
+        sf::Sprite greenRightSprite  = rightSprite;
+        greenRightSprite.textureRect = greenRect;
+
+        batch.update(right, greenRightSprite);
+        CHECK(batch.contains(right));
+        CHECK(batch.getPendingUploadByteCount() == 4u * sizeof(sf::Vertex) + 6u * sizeof(sf::IndexType));
+
+        batch.remove(left);
+        CHECK(!batch.contains(left));
+        CHECK(batch.getNumDrawables() == 1u);
+
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.draw(batch, {.texture = &texture});
+        renderTexture.display();
+
+        result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({25u, 50u}) == sf::Color::Red);
+        CHECK(result.getPixel({75u, 50u}) == sf::Color::Green);
+
+        // The space of the removed sprite is reused, but its handle stays invalid
+        const auto reused = batch.add(sf::Sprite{.scale = leftSprite.scale, .textureRect = blueRect});
+        CHECK(reused.index == left.index);
+        CHECK(!batch.contains(left));
+        CHECK(batch.getNumVertices() == 8u);
+
+        batch.clear();
+        CHECK(!batch.contains(reused));
+        CHECK(batch.getNumDrawables() == 0u);
+    }
+
+    SECTION("Culling")
+    {
+        const sf::Rect2f textureRect{{0.f, 0.f}, {10.f, 10.f}};
+
+        sf::CPUDrawableBatch batch;
+        batch.setCullRect(sf::base::makeOptional(sf::Rect2f{{0.f, 0.f}, {100.f, 100.f}}));
+
+        const sf::Sprite sprites[]{
+            {.position = {10.f, 10.f}, .textureRect = textureRect},                                 // Inside
+            {.position = {200.f, 10.f}, .textureRect = textureRect},                                // Right
+            {.position = {-5.f, 50.f}, .textureRect = textureRect},                                 // Left edge
+            {.position = {50.f, -30.f}, .textureRect = textureRect},                                // Above
+            {.position = {105.f, 50.f}, .origin = {10.f, 0.f}, .textureRect = textureRect},         // Right edge
+            {.position = {50.f, 150.f}, .rotation = sf::degrees(45.f), .textureRect = textureRect}, // Below, rotated
+        };
+
+        batch.add(sprites, 6u);
+        CHECK(batch.getNumVertices() == 3u * 4u);
+        CHECK(batch.getNumCulled() == 3u);
+
+        batch.add(sf::Sprite{.position = {-50.f, -50.f}, .textureRect = textureRect});
+        CHECK(batch.getNumCulled() == 4u);
+
+        CHECK(batch.add(sf::RectangleShapeData{.position = {300.f, 0.f}, .size = {10.f, 10.f}}).size() == 0u);
+        CHECK(batch.getNumCulled() == 5u);
+
+        batch.clear();
+        CHECK(batch.getNumCulled() == 0u);
+
+        batch.setCullRect(sf::base::nullOpt);
+        batch.add(sprites, 6u);
+        CHECK(batch.getNumVertices() == 6u * 4u);
+        CHECK(batch.getNumCulled() == 0u);
+
+        const auto texture = sf::Texture::create({10u, 10u}).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.setAutoBatchCullingEnabled(true);
+        CHECK(renderTexture.isAutoBatchCullingEnabled());
+
+        renderTexture.clear();
+        renderTexture.draw(sprites[0], {.texture = &texture});
+        renderTexture.draw(sprites[1], {.texture = &texture});
+        renderTexture.draw(sprites[3], {.texture = &texture});
+
+        const auto stats = renderTexture.display();
+        CHECK(stats.culledDrawables == 2u);
+        CHECK(stats.drawnVertices == 6u);
+    }
+
+    SECTION("Multi-draw")
+    {
+        const auto greenImage = sf::Image::create({1u, 1u}, sf::Color::Green).value();
+        const auto blueImage  = sf::Image::create({1u, 1u}, sf::Color::Blue).value();
+
+        const auto greenTexture = sf::Texture::loadFromImage(greenImage).value();
+        const auto blueTexture  = sf::Texture::loadFromImage(blueImage).value();
+
+        auto renderTexture = sf::RenderTexture::create({100, 100}).value();
+        renderTexture.setAutoBatchMultiDrawEnabled(true);
+        CHECK(renderTexture.isAutoBatchMultiDrawEnabled() == sf::RenderTarget::isAutoBatchMultiDrawAvailable());
+
+        // Alternating textures, each change would flush the batch without multi-draw
+        renderTexture.clear(sf::Color::Red);
+
+        for (unsigned int i = 0u; i < 4u; ++i)
+            renderTexture.draw(sf::Sprite{.position    = {25.f * static_cast<float>(i), 0.f},
+                                          .scale       = {25.f, 100.f},
+                                          .textureRect = {{0.f, 0.f}, {1.f, 1.f}}},
+                               {.texture = i % 2u == 0u ? &greenTexture : &blueTexture});
+
+        const auto stats = renderTexture.display();
+        CHECK(stats.drawCalls == (renderTexture.isAutoBatchMultiDrawEnabled() ? 1u : 4u));
+        CHECK(stats.drawnVertices == 4u * 6u);
+
+        const auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({12u, 50u}) == sf::Color::Green);
+        CHECK(result.getPixel({37u, 50u}) == sf::Color::Blue);
+        CHECK(result.getPixel({62u, 50u}) == sf::Color::Green);
+        CHECK(result.getPixel({87u, 50u}) == sf::Color::Blue);
+
+        renderTexture.setAutoBatchMultiDrawEnabled(false);
+        CHECK(!renderTexture.isAutoBatchMultiDrawEnabled());
+    }
 }
@@ -1,12 +1,21 @@
 #include "SFML/Graphics/Shader.hpp"
 
 // Other 1st party headers
+#include "SFML/Graphics/BlendMode.hpp"
+#include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RectangleShape.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
 
 #include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/IO.hpp"
 #include "SFML/System/Path.hpp"
 
 #include "SFML/Base/Macros.hpp"
+#include "SFML/Base/ScopeGuard.hpp"
 
 #include <Doctest.hpp>
 
@@ -132,6 +141,42 @@ void main()
 
 )glsl";
 
+constexpr auto uniformBlockFragmentSource = R"glsl(
+
+layout(std140) uniform Globals
+{
+    vec4 tint;
+    float time;
+};
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_v_color * tint * sin(time);
+}
+
+)glsl";
+
+constexpr auto uniformArrayFragmentSource = R"glsl(
+
+uniform vec4 palette[2];
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_v_color * palette[1];
+}
+
+)glsl";
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 constexpr bool skipShaderFullTest = false;
 #else
@@ -293,4 +338,229 @@ TEST_CASE("[Graphics] sf::Shader" * doctest::skip(skipShaderFullTest))
                 CHECK(static_cast<bool>(shader->getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("setUniform()")
+    {
+        const auto shader = sf::Shader::loadFromMemory({.vertexCode = vertexSource, .fragmentCode = fragmentSource}).value();
+
+        CHECK(!shader.getUniformLocation("missing").hasValue());
+
+        const auto ulStormPosition = shader.getUniformLocation("storm_position");
+        const auto ulBlinkAlpha    = shader.getUniformLocation("blink_alpha");
+
+        REQUIRE(ulStormPosition.hasValue());
+        REQUIRE(ulBlinkAlpha.hasValue());
+
+        // Values are shadowed and uploaded on bind
+        shader.setUniform(*ulStormPosition, sf::Glsl::Vec2{1.f, 2.f});
+        shader.setUniform(*ulBlinkAlpha, 0.5f);
+        shader.setUniform(*ulBlinkAlpha, 0.5f);
+        shader.bind();
+
+        shader.setUniform(*ulBlinkAlpha, 0.25f);
+        shader.bind();
+
+        sf::Shader::unbind();
+
+        // Values set while the program is in use are uploaded before the next draw
+        auto renderTexture = sf::RenderTexture::create({10u, 10u}).value();
+
+        const sf::RectangleShape shape{{.fillColor = sf::Color::Green, .size = {10.f, 10.f}}};
+        const sf::RenderStates   states{.blendMode = sf::BlendNone, .shader = &shader};
+
+        shader.setUniform(*ulBlinkAlpha, 1.f);
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color::Green);
+
+        shader.setUniform(*ulBlinkAlpha, 0.f);
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color{0u, 255u, 0u, 0u});
+    }
+
+    SECTION("UniformBlock")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::Shader::UniformBlock));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::Shader::UniformBlock));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::Shader::UniformBlock));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::Shader::UniformBlock));
+
+        auto uniformBlock = sf::Shader::UniformBlock::create(32u).value();
+        CHECK(uniformBlock.getSize() == 32u);
+        CHECK(uniformBlock.getNativeHandle() != 0u);
+
+        const float data[8]{1.f, 1.f, 1.f, 1.f, 0.f, 0.f, 0.f, 0.f};
+        CHECK(uniformBlock.update(data, sizeof(data)));
+        CHECK(uniformBlock.update(data, 16u, 16u));
+        CHECK(!uniformBlock.update(data, sizeof(data), 4u));
+
+        const auto shader = sf::Shader::loadFromMemory({.fragmentCode = uniformBlockFragmentSource}).value();
+
+        CHECK(!shader.getUniformBlockIndex("Missing").hasValue());
+
+        const auto index = shader.getUniformBlockIndex("Globals");
+        REQUIRE(index.hasValue());
+        CHECK(shader.setUniformBlock(*index, uniformBlock));
+        CHECK(shader.setUniformBlock(*index, uniformBlock));
+
+        shader.bind();
+        sf::Shader::unbind();
+
+        // Buffers assigned while the program is in use are bound before the next draw
+        auto otherUniformBlock = sf::Shader::UniformBlock::create(32u).value();
+
+        const float redData[8]{1.f, 0.f, 0.f, 1.f, 1.5707964f, 0.f, 0.f, 0.f};
+        const float blueData[8]{0.f, 0.f, 1.f, 1.f, 1.5707964f, 0.f, 0.f, 0.f};
+        CHECK(uniformBlock.update(redData, sizeof(redData)));
+        CHECK(otherUniformBlock.update(blueData, sizeof(blueData)));
+
+        auto renderTexture = sf::RenderTexture::create({10u, 10u}).value();
+
+        const sf::RectangleShape shape{{.fillColor = sf::Color::White, .size = {10.f, 10.f}}};
+        const sf::RenderStates   states{.blendMode = sf::BlendNone, .shader = &shader};
+
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color::Red);
+
+        CHECK(shader.setUniformBlock(*index, otherUniformBlock));
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color::Blue);
+    }
+
+    SECTION("setUniformArray()")
+    {
+        auto shader = sf::Shader::loadFromMemory({.fragmentCode = uniformArrayFragmentSource}).value();
+
+        const auto ulPalette = shader.getUniformLocation("palette");
+        REQUIRE(ulPalette.hasValue());
+
+        auto renderTexture = sf::RenderTexture::create({10u, 10u}).value();
+
+        const sf::RectangleShape shape{{.fillColor = sf::Color::White, .size = {10.f, 10.f}}};
+        const sf::RenderStates   states{.blendMode = sf::BlendNone, .shader = &shader};
+
+        // Arrays are shadowed like the other uniforms and uploaded before the next draw
+        const sf::Glsl::Vec4 redPalette[2]{{0.f, 0.f, 0.f, 1.f}, {1.f, 0.f, 0.f, 1.f}};
+        shader.setUniformArray(*ulPalette, redPalette, 2u);
+
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color::Red);
+
+        // Values set while the program is in use are uploaded as well
+        const sf::Glsl::Vec4 bluePalette[2]{{0.f, 0.f, 0.f, 1.f}, {0.f, 0.f, 1.f, 1.f}};
+        shader.setUniformArray(*ulPalette, bluePalette, 2u);
+
+        renderTexture.draw(shape, states);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({5u, 5u}) == sf::Color::Blue);
+    }
+
+    SECTION("Program binary cache")
+    {
+        const sf::Shader::LoadFromMemorySettings settings{.vertexCode           = vertexSource,
+                                                          .fragmentCode         = fragmentSource,
+                                                          .binaryCacheDirectory = sf::Path::tempDirectoryPath()};
+
+        const auto loadShader = [&]
+        {
+            auto shader = sf::Shader::loadFromMemory(settings);
+
+            REQUIRE(shader.hasValue());
+            CHECK(shader->getNativeHandle() != 0u);
+            CHECK(shader->isReady());
+            CHECK(shader->getUniformLocation("storm_position").hasValue());
+
+            return shader;
+        };
+
+        const sf::Path cachePath = loadShader()->getBinaryCachePath();
+
+        // Empty when the driver does not support program binaries
+        if (cachePath.empty())
+            return;
+
+        SFML_BASE_SCOPE_GUARD({ (void)cachePath.remove(); });
+
+        // Start without a cache file, in case one was left by a previous run
+        (void)cachePath.remove();
+        REQUIRE(!cachePath.exists());
+
+        SECTION("Populated by the first load, used by the second one")
+        {
+            const auto compiled = loadShader();
+            CHECK(!compiled->isLoadedFromBinaryCache());
+            CHECK(compiled->getBinaryCachePath() == cachePath.c_str());
+            CHECK(cachePath.exists());
+
+            const auto cached = loadShader();
+            CHECK(cached->isLoadedFromBinaryCache());
+            CHECK(cached->getBinaryCachePath() == cachePath.c_str());
+        }
+
+        SECTION("Corrupted cache file")
+        {
+            {
+                sf::OutFileStream file(cachePath, sf::FileOpenMode::bin | sf::FileOpenMode::out);
+                REQUIRE(static_cast<bool>(file));
+
+                constexpr char garbage[]{"SFPB this is not a program binary"};
+                file.write(garbage, sizeof(garbage));
+            }
+
+            // Falls back to compiling, and replaces the cache file
+            const auto compiled = loadShader();
+            CHECK(!compiled->isLoadedFromBinaryCache());
+
+            const auto cached = loadShader();
+            CHECK(cached->isLoadedFromBinaryCache());
+        }
+
+        SECTION("Truncated cache file")
+        {
+            {
+                sf::OutFileStream file(cachePath, sf::FileOpenMode::bin | sf::FileOpenMode::out);
+                REQUIRE(static_cast<bool>(file));
+
+                file.write("SFPB", 4);
+            }
+
+            const auto compiled = loadShader();
+            CHECK(!compiled->isLoadedFromBinaryCache());
+        }
+    }
+
+    SECTION("Parallel compilation")
+    {
+        const auto shader = sf::Shader::loadFromMemory(
+                                {.vertexCode = vertexSource, .fragmentCode = fragmentSource, .parallelCompile = true})
+                                .value();
+
+        while (!shader.isReady())
+        {
+        }
+
+        CHECK(!shader.hasCompilationFailed());
+
+        shader.bind();
+        sf::Shader::unbind();
+
+        // Without driver support, errors are reported synchronously instead
+        const auto invalidShader = sf::Shader::loadFromMemory({.fragmentCode = "invalid\n", .parallelCompile = true});
+
+        if (invalidShader.hasValue())
+        {
+            while (!invalidShader->isReady())
+            {
+            }
+
+            CHECK(invalidShader->hasCompilationFailed());
+        }
+    }
 }
@@ -111,4 +111,27 @@ TEST_CASE("[Graphics] sf::Shape" * doctest::skip(skipDisplayTests))
             CHECK(triangleShape.getGlobalBounds() == Approx(sf::Rect2f({-7.2150f, -10.f}, {44.4300f, 55.f})));
         }
     }
+
+    SECTION("Lazy geometry")
+    {
+        TriangleShape triangleShape({30, 40});
+        triangleShape.setOutlineThickness(5);
+        triangleShape.setFillColor(sf::Color::Red);
+        triangleShape.setOutlineColor(sf::Color::Blue);
+        triangleShape.setMiterLimit(2);
+
+        const auto [fillData, fillSize]       = triangleShape.getFillVertices();
+        const auto [outlineData, outlineSize] = triangleShape.getOutlineVertices();
+
+        CHECK(fillSize == 5u);    // Center, 3 points and repeated first point
+        CHECK(outlineSize == 8u); // 3 points and repeated first point, twice
+        CHECK(fillData[0].color == sf::Color::Red);
+        CHECK(outlineData[outlineSize - 1u].color == sf::Color::Blue);
+        CHECK(triangleShape.getLocalBounds() == Approx(sf::Rect2f({-7.2150f, -10.f}, {44.4300f, 55.f})));
+
+        triangleShape.setOutlineThickness(0);
+        CHECK(triangleShape.getFillVertices().size() == 5u);
+        CHECK(triangleShape.getOutlineVertices().size() == 0u);
+        CHECK(triangleShape.getLocalBounds() == sf::Rect2f({0, 0}, {30, 40}));
+    }
 }
@@ -169,6 +169,78 @@ TEST_CASE("[Graphics] sf::Text" * doctest::skip(skipDisplayTests))
         CHECK(text.findCharacterPos(1000) == sf::Vec2f{120, 277});
     }
 
+    SECTION("Incremental string updates")
+    {
+        const auto checkSameGeometryAsFullRebuild = [&](const sf::Text& text)
+        {
+            const sf::Text reference(font,
+                                     {.string           = text.getString(),
+                                      .outlineThickness = text.getOutlineThickness(),
+                                      .style            = text.getStyle()});
+
+            const auto vertices          = text.getVertices();
+            const auto referenceVertices = reference.getVertices();
+
+            REQUIRE(vertices.size() == referenceVertices.size());
+            CHECK(text.getFillVerticesStartIndex() == reference.getFillVerticesStartIndex());
+            CHECK(text.getLocalBounds() == reference.getLocalBounds());
+
+            for (sf::base::SizeT i = 0u; i < vertices.size(); ++i)
+            {
+                CHECK(vertices[i].position == referenceVertices[i].position);
+                CHECK(vertices[i].color == referenceVertices[i].color);
+                CHECK(vertices[i].texCoords == referenceVertices[i].texCoords);
+            }
+        };
+
+        sf::Text text(font, {.string = "first line\nsecond"});
+        (void)text.getVertices();
+
+        SECTION("appendString()")
+        {
+            text.appendString(" line\nthird line\n\nfifth");
+            CHECK(text.getString() == "first line\nsecond line\nthird line\n\nfifth");
+            checkSameGeometryAsFullRebuild(text);
+
+            text.appendString("\n");
+            text.appendString("sixth");
+            checkSameGeometryAsFullRebuild(text);
+        }
+
+        SECTION("replaceSuffix()")
+        {
+            text.replaceSuffix(11, "2nd\n3rd");
+            CHECK(text.getString() == "first line\n2nd\n3rd");
+            checkSameGeometryAsFullRebuild(text);
+
+            text.replaceSuffix(3, "");
+            CHECK(text.getString() == "fir");
+            checkSameGeometryAsFullRebuild(text);
+
+            text.replaceSuffix(1000, "st");
+            CHECK(text.getString() == "first");
+            checkSameGeometryAsFullRebuild(text);
+
+            text.replaceSuffix(0, "");
+            CHECK(text.getString() == "");
+            CHECK(text.getVertices().size() == 0u);
+            CHECK(text.getLocalBounds() == sf::Rect2f());
+        }
+
+        SECTION("Outline and style")
+        {
+            text.setOutlineThickness(2.f);
+            text.setStyle(sf::Text::Style::Underlined | sf::Text::Style::StrikeThrough);
+            (void)text.getVertices();
+
+            text.appendString(" line\nthird");
+            checkSameGeometryAsFullRebuild(text);
+
+            text.replaceSuffix(3, "st\n");
+            checkSameGeometryAsFullRebuild(text);
+        }
+    }
+
     SECTION("Get bounds")
     {
         sf::Text text(font, {.string = "Test", .characterSize = 18u});
@@ -0,0 +1,101 @@
+#include "SFML/Graphics/TextLayout.hpp"
+
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Font.hpp"
+
+#include "SFML/System/Path.hpp"
+#include "SFML/System/UnicodeString.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+
+TEST_CASE("[Graphics] sf::TextLayout" * doctest::skip(skipDisplayTests))
+{
+    auto graphicsContext = sf::GraphicsContext::create().value();
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_CONSTRUCTIBLE(sf::TextLayout, const sf::Font&&, sf::TextData, float));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextLayout));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextLayout));
+    }
+
+    const auto font = sf::Font::openFromFile("tuffy.ttf").value();
+
+    SECTION("Empty string")
+    {
+        const sf::TextLayout layout(font, {}, /* wrapWidth */ 100.f);
+        CHECK(layout.getLines().size() == 0u);
+        CHECK(layout.getSize() == sf::Vec2f{});
+        CHECK(layout.getWrappedString() == "");
+    }
+
+    SECTION("No wrapping needed")
+    {
+        const sf::TextLayout layout(font, {.string = "short text"}, /* wrapWidth */ 10'000.f);
+        REQUIRE(layout.getLines().size() == 1u);
+        CHECK(layout.getLines()[0].begin == 0u);
+        CHECK(layout.getLines()[0].end == 10u);
+        CHECK(layout.getWrappedString() == "short text");
+    }
+
+    SECTION("Word wrapping")
+    {
+        sf::TextLayout layout(font, {.string = "one two three four"}, /* wrapWidth */ 10'000.f);
+        const float    fullWidth = layout.getSize().x;
+
+        // Every word on its own line
+        layout.setWrapWidth(1.f);
+        CHECK(layout.getWrappedString() == "one\ntwo\nthree\nfour");
+        CHECK(layout.getLines().size() == 4u);
+        CHECK(layout.getSize().x < fullWidth);
+        CHECK(layout.getSize().y == 4.f * font.getLineSpacing(30u));
+
+        // Lines never exceed the wrap width, unless they contain a single word
+        layout.setWrapWidth(fullWidth * 0.6f);
+        for (const sf::TextLayout::Line& line : layout.getLines())
+            CHECK(line.width <= fullWidth * 0.6f);
+
+        CHECK(layout.getLines().size() > 1u);
+        CHECK(layout.getLines().size() < 4u);
+
+        layout.setWrapWidth(fullWidth);
+        CHECK(layout.getWrappedString() == "one two three four");
+    }
+
+    SECTION("Explicit line breaks")
+    {
+        const sf::TextLayout layout(font, {.string = "first\n\n  indented\n"}, /* wrapWidth */ 10'000.f);
+        CHECK(layout.getWrappedString() == "first\n\n  indented\n");
+        CHECK(layout.getLines().size() == 4u);
+    }
+
+    SECTION("Overflowing word")
+    {
+        const sf::TextLayout layout(font, {.string = "a incomprehensibilities b"}, /* wrapWidth */ 50.f);
+        CHECK(layout.getWrappedString() == "a\nincomprehensibilities\nb");
+        CHECK(layout.getSize().x > 50.f);
+    }
+
+    SECTION("Consistent with other properties")
+    {
+        sf::TextLayout layout(font, {.string = "one two three four"}, /* wrapWidth */ 150.f);
+        const auto     wrapped = layout.getWrappedString();
+
+        layout.setLineSpacing(2.f);
+        CHECK(layout.getWrappedString() == wrapped);
+        CHECK(layout.getSize().y == static_cast<float>(layout.getLines().size()) * 2.f * font.getLineSpacing(30u));
+
+        layout.setCharacterSize(60u);
+        CHECK(layout.getLines().size() > 2u);
+
+        layout.setCharacterSize(30u);
+        CHECK(layout.getWrappedString() == wrapped);
+    }
+}
@@ -0,0 +1,94 @@
+#include "SFML/Graphics/TextLogView.hpp"
+
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/Text.hpp"
+
+#include "SFML/System/Path.hpp"
+#include "SFML/System/UnicodeString.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+
+TEST_CASE("[Graphics] sf::TextLogView" * doctest::skip(skipDisplayTests))
+{
+    auto graphicsContext = sf::GraphicsContext::create().value();
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_CONSTRUCTIBLE(sf::TextLogView, const sf::Font&&, sf::TextData, sf::base::SizeT));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextLogView));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextLogView));
+    }
+
+    const auto font = sf::Font::openFromFile("tuffy.ttf").value();
+
+    sf::TextLogView logView(font, {.characterSize = 24u, .fillColor = sf::Color::Green}, /* maxLineCount */ 3u);
+
+    SECTION("Construction")
+    {
+        CHECK(logView.getLineCount() == 0u);
+        CHECK(logView.getMaxLineCount() == 3u);
+        CHECK(logView.getLineHeight() == font.getLineSpacing(24u));
+    }
+
+    SECTION("Push lines")
+    {
+        logView.pushLine("first");
+        logView.pushLine("second");
+
+        REQUIRE(logView.getLineCount() == 2u);
+        CHECK(logView.getLine(0).getString() == "first");
+        CHECK(logView.getLine(1).getString() == "second");
+        CHECK(logView.getLine(0).getCharacterSize() == 24u);
+        CHECK(logView.getLine(0).getFillColor() == sf::Color::Green);
+        CHECK(logView.getLine(0).position == sf::Vec2f{0.f, 0.f});
+        CHECK(logView.getLine(1).position == sf::Vec2f{0.f, logView.getLineHeight()});
+    }
+
+    SECTION("Scroll out and recycle lines")
+    {
+        logView.pushLine("first");
+        logView.pushLine("second");
+        logView.pushLine("third");
+
+        const sf::Text* const firstLine = &logView.getLine(0);
+
+        logView.pushLine("fourth");
+
+        REQUIRE(logView.getLineCount() == 3u);
+        CHECK(logView.getLine(0).getString() == "second");
+        CHECK(logView.getLine(1).getString() == "third");
+        CHECK(logView.getLine(2).getString() == "fourth");
+        CHECK(&logView.getLine(2) == firstLine);
+        CHECK(logView.getLine(0).position == sf::Vec2f{0.f, 0.f});
+        CHECK(logView.getLine(2).position == sf::Vec2f{0.f, 2.f * logView.getLineHeight()});
+    }
+
+    SECTION("Append to last line")
+    {
+        logView.appendToLastLine("> ");
+        logView.appendToLastLine("help");
+
+        REQUIRE(logView.getLineCount() == 1u);
+        CHECK(logView.getLine(0).getString() == "> help");
+    }
+
+    SECTION("Clear")
+    {
+        logView.pushLine("first");
+        logView.pushLine("second");
+        logView.clear();
+        CHECK(logView.getLineCount() == 0u);
+
+        logView.pushLine("third");
+        REQUIRE(logView.getLineCount() == 1u);
+        CHECK(logView.getLine(0).getString() == "third");
+    }
+}
@@ -0,0 +1,105 @@
+#include "SFML/Network/DnsResolver.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <StringifyIpAddressUtil.hpp>
+
+
+using namespace sf::base::literals;
+
+
+TEST_CASE("[Network] sf::DnsResolver")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::DnsResolver));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::DnsResolver));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::DnsResolver));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::DnsResolver));
+
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::DnsResolver::Lookup));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::DnsResolver::Lookup));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::DnsResolver::Lookup));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::DnsResolver::Lookup));
+    }
+
+    SECTION("Address literals complete immediately")
+    {
+        sf::DnsResolver resolver;
+
+        const sf::DnsResolver::Lookup v4 = resolver.resolve("127.0.0.1"_sv);
+        REQUIRE(v4.isReady());
+        REQUIRE(v4.getAddresses().size() == 1u);
+        CHECK(v4.getAddresses()[0] == sf::IpAddress::LocalHost);
+
+        const sf::DnsResolver::Lookup v6 = resolver.resolve("::1"_sv);
+        REQUIRE(v6.isReady());
+        REQUIRE(v6.getAddresses().size() == 1u);
+        CHECK(v6.getAddresses()[0] == sf::IpAddress::LocalHostV6);
+
+        CHECK(resolver.getCacheSize() == 0u);
+    }
+
+    SECTION("Host names are resolved in the background and cached")
+    {
+        sf::DnsResolver resolver;
+
+        const sf::DnsResolver::Lookup lookup = resolver.resolve("localhost"_sv);
+        CHECK(resolver.getCacheSize() == 1u);
+
+        lookup.wait();
+        REQUIRE(lookup.isReady());
+        REQUIRE(!lookup.getAddresses().empty());
+
+        bool foundLocalHost = false;
+        for (const sf::IpAddress address : lookup.getAddresses())
+            foundLocalHost |= address == sf::IpAddress::LocalHost || address == sf::IpAddress::LocalHostV6;
+
+        CHECK(foundLocalHost);
+
+        // The cached lookup is shared
+        const sf::DnsResolver::Lookup cached = resolver.resolve("localhost"_sv);
+        CHECK(cached.isReady());
+        CHECK(cached.getAddresses().data() == lookup.getAddresses().data());
+        CHECK(resolver.getCacheSize() == 1u);
+
+        resolver.clearCache();
+        CHECK(resolver.getCacheSize() == 0u);
+        CHECK(lookup.getAddresses().size() == cached.getAddresses().size());
+    }
+
+    SECTION("Entries expire")
+    {
+        sf::DnsResolver resolver(sf::Time{});
+
+        const sf::DnsResolver::Lookup lookup = resolver.resolve("localhost"_sv);
+        const sf::DnsResolver::Lookup again  = resolver.resolve("localhost"_sv);
+        CHECK(resolver.getCacheSize() == 1u);
+
+        lookup.wait();
+        again.wait();
+        CHECK(again.getAddresses().data() != lookup.getAddresses().data());
+    }
+
+    SECTION("Lookups outlive the resolver")
+    {
+        sf::base::Optional<sf::DnsResolver::Lookup> lookup;
+
+        {
+            sf::DnsResolver resolver;
+            lookup.emplace(resolver.resolve("localhost"_sv));
+        }
+
+        lookup->wait();
+        CHECK(lookup->isReady());
+    }
+}
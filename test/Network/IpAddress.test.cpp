@@ -2,6 +2,8 @@
 
 #include "SFML/Network/IpAddressUtils.hpp"
 
+#include "SFML/Base/Array.hpp"
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/StringView.hpp"
 
 #include <Doctest.hpp>
@@ -74,6 +76,62 @@ TEST_CASE("[Network] sf::IpAddress")
         }
     }
 
+    SECTION("IPv6")
+    {
+        SECTION("Byte array constructor")
+        {
+            const sf::IpAddress ipAddress(
+                sf::base::Array<sf::base::U8, 16>{0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01});
+            CHECK(ipAddress.isV6());
+            CHECK(ipAddress.getType() == sf::IpAddress::Type::IpV6);
+            CHECK(sf::IpAddressUtils::toString(ipAddress) == "2001:db8::1"_s);
+            CHECK(ipAddress.toBytes()[1] == 0x01);
+        }
+
+        SECTION("Resolve literals")
+        {
+            const auto localHost = sf::IpAddressUtils::resolve("::1"_sv);
+            REQUIRE(localHost.hasValue());
+            CHECK(*localHost == sf::IpAddress::LocalHostV6);
+            CHECK(sf::IpAddressUtils::toString(*localHost) == "::1"_s);
+
+            const auto documentation = sf::IpAddressUtils::resolve("2001:DB8:0:0:8:800:200C:417A"_sv);
+            REQUIRE(documentation.hasValue());
+            CHECK(sf::IpAddressUtils::toString(*documentation) == "2001:db8::8:800:200c:417a"_s);
+
+            CHECK(!sf::IpAddressUtils::resolve("2001:db8::1::2"_sv).hasValue());
+
+            const auto all = sf::IpAddressUtils::resolveAll("::"_sv);
+            REQUIRE(all.size() == 1u);
+            CHECK(all[0] == sf::IpAddress::AnyV6);
+        }
+
+        SECTION("IPv4 addresses")
+        {
+            CHECK(!sf::IpAddress::LocalHost.isV6());
+            CHECK(sf::IpAddress::LocalHost.getType() == sf::IpAddress::Type::IpV4);
+
+            // IPv4 addresses are exposed as IPv4-mapped IPv6 addresses
+            const sf::base::Array<sf::base::U8, 16> bytes = sf::IpAddress(192, 0, 2, 33).toBytes();
+            CHECK(bytes[9] == 0x00);
+            CHECK(bytes[10] == 0xFF);
+            CHECK(bytes[11] == 0xFF);
+            CHECK(bytes[12] == 192);
+            CHECK(bytes[15] == 33);
+
+            // ...but are distinct from them
+            CHECK(sf::IpAddress(bytes) != sf::IpAddress(192, 0, 2, 33));
+        }
+
+        SECTION("Ordering")
+        {
+            CHECK(sf::IpAddress::Broadcast < sf::IpAddress::AnyV6);
+            CHECK(sf::IpAddress::AnyV6 < sf::IpAddress::LocalHostV6);
+            CHECK(sf::IpAddress::LocalHostV6 == sf::IpAddress::LocalHostV6);
+            CHECK(sf::IpAddress::LocalHostV6 != sf::IpAddress::LocalHost);
+        }
+    }
+
     SECTION("Static functions")
     {
         // These functions require external network access to work thus imposing an additional
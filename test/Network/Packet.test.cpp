@@ -2,9 +2,11 @@
 
 // Other 1st party headers
 #include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/Utf8String.hpp"
 
 #include "SFML/Base/Builtin/Strlen.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/Vector.hpp"
 
 #include <Doctest.hpp>
@@ -271,6 +273,22 @@ TEST_CASE("[Network] sf::Packet")
             const sf::UnicodeString string = "testing";
             CHECK_PACKET_STRING_STREAM_OPERATORS(string, 4 * string.getSize() + 4);
         }
+
+        SECTION("sf::Utf8String")
+        {
+            const sf::Utf8String string{"testing \xF0\x9F\x90\x8C"};
+
+            sf::Packet packet;
+            packet << string;
+            CHECK(packet.getDataSize() == string.getByteSize() + 4);
+
+            sf::Utf8String received;
+            packet >> received;
+            CHECK(packet.endOfPacket());
+            CHECK(bool{packet});
+            CHECK(received == string);
+            CHECK(received.getSize() == 9);
+        }
     }
 
     SECTION("onSend")
@@ -309,4 +327,79 @@ TEST_CASE("[Network] sf::Packet")
         packet >> out; // Ensure this does not trigger a crash
         CHECK(out.empty());
     }
+
+    SECTION("Variable-length integers")
+    {
+        sf::Packet packet;
+        packet.appendVarUInt(0u).appendVarUInt(127u).appendVarUInt(128u).appendVarUInt(16'384u);
+        CHECK(packet.getDataSize() == 1u + 1u + 2u + 3u);
+
+        packet.appendVarUInt(std::numeric_limits<sf::base::U64>::max());
+        CHECK(packet.getDataSize() == 7u + 10u);
+
+        packet.appendVarInt(0).appendVarInt(-1).appendVarInt(63).appendVarInt(-64).appendVarInt(64);
+        CHECK(packet.getDataSize() == 17u + 1u + 1u + 1u + 1u + 2u);
+
+        packet.appendVarInt(std::numeric_limits<sf::base::I64>::min());
+        packet.appendVarInt(std::numeric_limits<sf::base::I64>::max());
+
+        sf::base::U64 u0 = 1u, u1 = 0u, u2 = 0u, u3 = 0u, u4 = 0u;
+        packet.extractVarUInt(u0).extractVarUInt(u1).extractVarUInt(u2).extractVarUInt(u3).extractVarUInt(u4);
+        CHECK(bool{packet});
+        CHECK(u0 == 0u);
+        CHECK(u1 == 127u);
+        CHECK(u2 == 128u);
+        CHECK(u3 == 16'384u);
+        CHECK(u4 == std::numeric_limits<sf::base::U64>::max());
+
+        sf::base::I64 i[7]{};
+        for (sf::base::I64& value : i)
+            CHECK(static_cast<bool>(packet.extractVarInt(value)));
+
+        CHECK(i[0] == 0);
+        CHECK(i[1] == -1);
+        CHECK(i[2] == 63);
+        CHECK(i[3] == -64);
+        CHECK(i[4] == 64);
+        CHECK(i[5] == std::numeric_limits<sf::base::I64>::min());
+        CHECK(i[6] == std::numeric_limits<sf::base::I64>::max());
+        CHECK(packet.endOfPacket());
+
+        // Truncated encoding
+        sf::Packet truncated;
+        truncated << sf::base::U8{0x80u};
+        CHECK(!static_cast<bool>(truncated.extractVarUInt(u0)));
+    }
+
+    SECTION("Spans of trivially copyable objects")
+    {
+        struct Vertex
+        {
+            float         x, y;
+            sf::base::U32 color;
+        };
+
+        const Vertex vertices[]{{1.f, 2.f, 0xFF'00'00'FFu}, {3.f, 4.f, 0x00'FF'00'FFu}, {5.f, 6.f, 0x00'00'FF'FFu}};
+
+        sf::Packet packet;
+        packet.appendSpan<Vertex>(vertices).appendSpan(sf::base::Span<const Vertex>{});
+        CHECK(packet.getDataSize() == 1u + sizeof(vertices) + 1u);
+
+        sf::base::Vector<Vertex> received;
+        CHECK(static_cast<bool>(packet.extractVector(received)));
+        REQUIRE(received.size() == 3u);
+        CHECK(received[1].x == 3.f);
+        CHECK(received[2].color == 0x00'00'FF'FFu);
+
+        CHECK(static_cast<bool>(packet.extractVector(received)));
+        CHECK(received.empty());
+        CHECK(packet.endOfPacket());
+
+        // Announced count larger than the packet
+        sf::Packet malicious;
+        malicious.appendVarUInt(1'000'000u);
+        malicious << sf::base::U32{0u};
+        CHECK(!static_cast<bool>(malicious.extractVector(received)));
+        CHECK(received.empty());
+    }
 }
@@ -0,0 +1,207 @@
+#include "SFML/Network/PacketBitStream.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+#include <limits>
+
+
+TEST_CASE("[Network] sf::PacketBitWriter and sf::PacketBitReader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PacketBitWriter));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::PacketBitWriter));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PacketBitReader));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::PacketBitReader));
+    }
+
+    SECTION("Bits are packed")
+    {
+        sf::Packet packet;
+
+        {
+            sf::PacketBitWriter writer(packet);
+
+            for (int i = 0; i < 10; ++i)
+                writer.writeBool(i % 3 == 0);
+
+            writer.writeBits(0b101u, 3u);
+            CHECK(writer.getBitCount() == 13u);
+        }
+
+        // 13 bits, padded to 2 bytes
+        CHECK(packet.getDataSize() == 2u);
+
+        sf::PacketBitReader reader(packet);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            bool value = false;
+            CHECK(reader.readBool(value));
+            CHECK(value == (i % 3 == 0));
+        }
+
+        sf::base::U32 bits = 0u;
+        CHECK(reader.readBits(bits, 3u));
+        CHECK(bits == 0b101u);
+        CHECK(packet.endOfPacket());
+    }
+
+    SECTION("Wide values")
+    {
+        sf::Packet packet;
+
+        {
+            sf::PacketBitWriter writer(packet);
+            writer.writeBits(1u, 1u);
+            writer.writeBits(0xDEAD'BEEFu, 32u);
+            writer.writeBits(0x1234u, 31u);
+        }
+
+        CHECK(packet.getDataSize() == 8u);
+
+        sf::PacketBitReader reader(packet);
+        sf::base::U32       a = 0u;
+        sf::base::U32       b = 0u;
+        sf::base::U32       c = 0u;
+
+        CHECK(reader.readBits(a, 1u));
+        CHECK(reader.readBits(b, 32u));
+        CHECK(reader.readBits(c, 31u));
+
+        CHECK(a == 1u);
+        CHECK(b == 0xDEAD'BEEFu);
+        CHECK(c == 0x1234u);
+    }
+
+    SECTION("Ranged integers")
+    {
+        sf::Packet packet;
+
+        {
+            sf::PacketBitWriter writer(packet);
+            writer.writeRangedInt(100, 0, 100);
+            writer.writeRangedInt(-5, -10, 10);
+            writer.writeRangedInt(500, 0, 100); // clamped
+            writer.writeRangedInt(42, 42, 42);  // no bits
+            CHECK(writer.getBitCount() == 7u + 5u + 7u);
+        }
+
+        CHECK(packet.getDataSize() == 3u);
+
+        sf::PacketBitReader reader(packet);
+        sf::base::I32       a = 0;
+        sf::base::I32       b = 0;
+        sf::base::I32       c = 0;
+        sf::base::I32       d = 0;
+
+        CHECK(reader.readRangedInt(a, 0, 100));
+        CHECK(reader.readRangedInt(b, -10, 10));
+        CHECK(reader.readRangedInt(c, 0, 100));
+        CHECK(reader.readRangedInt(d, 42, 42));
+
+        CHECK(a == 100);
+        CHECK(b == -5);
+        CHECK(c == 100);
+        CHECK(d == 42);
+    }
+
+    SECTION("Quantized floats")
+    {
+        sf::Packet packet;
+
+        {
+            sf::PacketBitWriter writer(packet);
+            writer.writeQuantizedFloat(123.456f, 0.f, 360.f, 12u);
+            writer.writeQuantizedFloat(-511.f, -512.f, 512.f, 16u);
+            writer.writeQuantizedFloat(0.f, 0.f, 1.f, 8u);
+            writer.writeQuantizedFloat(1.f, 0.f, 1.f, 8u);
+            writer.writeQuantizedFloat(2.f, 0.f, 1.f, 8u); // clamped
+            writer.writeQuantizedFloat(std::numeric_limits<float>::quiet_NaN(), 0.5f, 1.f, 8u);
+        }
+
+        CHECK(packet.getDataSize() == 8u);
+
+        sf::PacketBitReader reader(packet);
+        float               angle = 0.f;
+        float               x     = 0.f;
+        float               zero  = -1.f;
+        float               one   = -1.f;
+        float               clamp = -1.f;
+        float               nan   = -1.f;
+
+        CHECK(reader.readQuantizedFloat(angle, 0.f, 360.f, 12u));
+        CHECK(reader.readQuantizedFloat(x, -512.f, 512.f, 16u));
+        CHECK(reader.readQuantizedFloat(zero, 0.f, 1.f, 8u));
+        CHECK(reader.readQuantizedFloat(one, 0.f, 1.f, 8u));
+        CHECK(reader.readQuantizedFloat(clamp, 0.f, 1.f, 8u));
+        CHECK(reader.readQuantizedFloat(nan, 0.5f, 1.f, 8u));
+
+        CHECK(angle == doctest::Approx(123.456f).epsilon(0.f).margin(360.f / 8190.f));
+        CHECK(x == doctest::Approx(-511.f).epsilon(0.f).margin(1024.f / 131'070.f));
+        CHECK(zero == 0.f);
+        CHECK(one == 1.f);
+        CHECK(clamp == 1.f);
+        CHECK(nan == 0.5f);
+    }
+
+    SECTION("Mixed with byte-aligned data")
+    {
+        sf::Packet packet;
+        packet << sf::base::U16{0xABCD};
+
+        {
+            sf::PacketBitWriter writer(packet);
+            writer.writeBool(true);
+            writer.writeRangedInt(3, 0, 7);
+        }
+
+        packet << sf::base::U32{0x1234'5678};
+
+        sf::base::U16 header  = 0u;
+        bool          flag    = false;
+        sf::base::I32 ranged  = 0;
+        sf::base::U32 trailer = 0u;
+
+        packet >> header;
+
+        {
+            sf::PacketBitReader reader(packet);
+            CHECK(reader.readBool(flag));
+            CHECK(reader.readRangedInt(ranged, 0, 7));
+        }
+
+        packet >> trailer;
+
+        CHECK(static_cast<bool>(packet));
+        CHECK(packet.endOfPacket());
+        CHECK(header == 0xABCD);
+        CHECK(flag);
+        CHECK(ranged == 3);
+        CHECK(trailer == 0x1234'5678u);
+    }
+
+    SECTION("Truncated data")
+    {
+        sf::Packet packet;
+
+        {
+            sf::PacketBitWriter writer(packet);
+            writer.writeBits(0x7Fu, 7u);
+        }
+
+        sf::PacketBitReader reader(packet);
+        sf::base::U32       bits = 0xFFu;
+
+        CHECK(!reader.readBits(bits, 9u));
+        CHECK(bits == 0xFFu);
+        CHECK(!static_cast<bool>(packet));
+    }
+}
@@ -0,0 +1,137 @@
+#include "SFML/Network/PacketStruct.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/System/Vec2.hpp"
+
+#include "SFML/Base/Array.hpp"
+#include "SFML/Base/Builtin/Memcmp.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+#include <string>
+
+
+namespace
+{
+enum class Team : sf::base::U8
+{
+    Red,
+    Blue
+};
+
+struct Item
+{
+    sf::base::U16 kind;
+    sf::base::I32 count;
+
+    [[nodiscard]] bool operator==(const Item&) const = default;
+};
+
+struct PlayerState
+{
+    sf::base::U32            id;
+    sf::Vec2f                position;
+    sf::base::I16            health;
+    Team                     team;
+    bool                     isCrouching;
+    sf::base::Array<char, 3> tag;
+    sf::base::Vector<Item>   inventory;
+    std::string              name;
+    sf::base::I64            score;
+};
+
+[[nodiscard]] PlayerState makePlayerState()
+{
+    return {.id          = 7u,
+            .position    = {12.5f, -3.25f},
+            .health      = -20,
+            .team        = Team::Blue,
+            .isCrouching = true,
+            .tag         = {'a', 'b', 'c'},
+            .inventory   = {Item{1u, 5}, Item{300u, -1}},
+            .name        = "player",
+            .score       = -1'000'000'000'000};
+}
+
+
+void checkEqual(const PlayerState& lhs, const PlayerState& rhs)
+{
+    CHECK(lhs.id == rhs.id);
+    CHECK(lhs.position == rhs.position);
+    CHECK(lhs.health == rhs.health);
+    CHECK(lhs.team == rhs.team);
+    CHECK(lhs.isCrouching == rhs.isCrouching);
+    CHECK(lhs.tag == rhs.tag);
+    CHECK(lhs.inventory == rhs.inventory);
+    CHECK(lhs.name == rhs.name);
+    CHECK(lhs.score == rhs.score);
+}
+
+} // namespace
+
+
+TEST_CASE("[Network] sf::appendStruct")
+{
+    const PlayerState sent = makePlayerState();
+
+    SECTION("Compact round trip")
+    {
+        sf::Packet packet;
+        sf::appendStruct(packet, sent);
+
+        PlayerState received{};
+        CHECK(static_cast<bool>(sf::extractStruct(packet, received)));
+        CHECK(packet.endOfPacket());
+        checkEqual(sent, received);
+    }
+
+    SECTION("Fixed round trip")
+    {
+        sf::Packet packet;
+        sf::appendStruct<sf::PacketStructEncoding::Fixed>(packet, sent);
+
+        PlayerState received{};
+        CHECK(static_cast<bool>(sf::extractStruct<sf::PacketStructEncoding::Fixed>(packet, received)));
+        CHECK(packet.endOfPacket());
+        checkEqual(sent, received);
+    }
+
+    SECTION("Compact is smaller than fixed")
+    {
+        sf::Packet compact;
+        sf::appendStruct(compact, sent);
+
+        sf::Packet fixed;
+        sf::appendStruct<sf::PacketStructEncoding::Fixed>(fixed, sent);
+
+        CHECK(compact.getDataSize() < fixed.getDataSize());
+    }
+
+    SECTION("Fixed matches the stream operators")
+    {
+        sf::Packet fixed;
+        sf::appendStruct<sf::PacketStructEncoding::Fixed>(fixed, Item{300u, -1});
+
+        sf::Packet manual;
+        manual << sf::base::U16{300u} << sf::base::I32{-1};
+
+        REQUIRE(fixed.getDataSize() == manual.getDataSize());
+        CHECK(SFML_BASE_MEMCMP(fixed.getData(), manual.getData(), manual.getDataSize()) == 0);
+    }
+
+    SECTION("Truncated data")
+    {
+        sf::Packet packet;
+        sf::appendStruct(packet, sent);
+
+        sf::Packet truncated;
+        truncated.append(packet.getData(), packet.getDataSize() - 3u);
+
+        PlayerState received{};
+        CHECK(!static_cast<bool>(sf::extractStruct(truncated, received)));
+    }
+}
@@ -0,0 +1,99 @@
+#include "SFML/Network/PacketView.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+#include <limits>
+#include <string>
+
+
+TEST_CASE("[Network] sf::PacketView")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PacketView));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::PacketView));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::PacketView));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::PacketView));
+    }
+
+    SECTION("Empty view")
+    {
+        sf::PacketView view(nullptr, 0u);
+        CHECK(view.getData() == nullptr);
+        CHECK(view.getDataSize() == 0u);
+        CHECK(view.endOfPacket());
+        CHECK(bool{view});
+
+        sf::base::U8 value = 0u;
+        view >> value;
+        CHECK(!view);
+    }
+
+    SECTION("Reads data written by sf::Packet")
+    {
+        sf::Packet packet;
+        packet << true << sf::base::I8{-8} << sf::base::U16{1616} << std::numeric_limits<sf::base::I32>::min()
+               << std::numeric_limits<sf::base::U64>::max() << sf::base::I64{-6464} << 1.5f << 2.5 << "hello"
+               << std::string("world");
+
+        sf::PacketView view(packet.getData(), packet.getDataSize());
+        CHECK(view.getData() == packet.getData());
+        CHECK(view.getDataSize() == packet.getDataSize());
+
+        bool                 b   = false;
+        sf::base::I8         i8  = 0;
+        sf::base::U16        u16 = 0;
+        sf::base::I32        i32 = 0;
+        sf::base::U64        u64 = 0;
+        sf::base::I64        i64 = 0;
+        float                f   = 0.f;
+        double               d   = 0.;
+        sf::base::StringView sv;
+        std::string          str;
+
+        CHECK(static_cast<bool>(view >> b >> i8 >> u16 >> i32 >> u64 >> i64 >> f >> d >> sv >> str));
+        CHECK(b);
+        CHECK(i8 == -8);
+        CHECK(u16 == 1616);
+        CHECK(i32 == std::numeric_limits<sf::base::I32>::min());
+        CHECK(u64 == std::numeric_limits<sf::base::U64>::max());
+        CHECK(i64 == -6464);
+        CHECK(f == 1.5f);
+        CHECK(d == 2.5);
+        CHECK(std::string(sv.data(), sv.size()) == "hello");
+        CHECK(str == "world");
+        CHECK(view.endOfPacket());
+
+        // The string view refers to the original data
+        CHECK(sv.data() > static_cast<const char*>(packet.getData()));
+        CHECK(sv.data() < static_cast<const char*>(packet.getData()) + packet.getDataSize());
+
+        // Reading past the end invalidates the view
+        sf::base::U8 extra = 0u;
+        CHECK(!(view >> extra));
+    }
+
+    SECTION("Copies have independent read positions")
+    {
+        sf::Packet packet;
+        packet << sf::base::U32{42u};
+
+        const sf::PacketView original(packet.getData(), packet.getDataSize());
+
+        sf::PacketView copy = original;
+        sf::base::U32  value = 0u;
+        copy >> value;
+
+        CHECK(value == 42u);
+        CHECK(copy.endOfPacket());
+        CHECK(original.getReadPosition() == 0u);
+    }
+}
@@ -0,0 +1,258 @@
+#include "SFML/Network/SnapshotDelta.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/Packet.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Vector<unsigned char> makeSnapshot(sf::base::SizeT size, unsigned char seed)
+{
+    sf::base::Vector<unsigned char> snapshot;
+
+    for (sf::base::SizeT i = 0u; i < size; ++i)
+        snapshot.pushBack(static_cast<unsigned char>(i * 31u + seed));
+
+    return snapshot;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Span<const unsigned char> asSpan(const sf::base::Vector<unsigned char>& bytes)
+{
+    return {bytes.data(), bytes.size()};
+}
+
+} // namespace
+
+
+TEST_CASE("[Network] sf::SnapshotDelta")
+{
+    const sf::base::Vector<unsigned char> baseline = makeSnapshot(1000u, 7u);
+
+    SECTION("Identical snapshots")
+    {
+        sf::Packet packet;
+        sf::SnapshotDelta::encode(asSpan(baseline), asSpan(baseline), packet);
+        CHECK(packet.getDataSize() <= 5u);
+
+        sf::base::Vector<unsigned char> decoded;
+        CHECK(sf::SnapshotDelta::decode(packet, asSpan(baseline), decoded));
+        CHECK(decoded == baseline);
+        CHECK(packet.endOfPacket());
+    }
+
+    SECTION("Sparse changes")
+    {
+        sf::base::Vector<unsigned char> snapshot = baseline;
+        snapshot[0] ^= 0xFFu;
+        snapshot[10] += 1u;
+        snapshot[11] += 1u;
+        snapshot[13] += 1u; // single unchanged byte in the middle
+        snapshot[500] = 0u;
+        snapshot[999] ^= 0x01u;
+
+        sf::Packet packet;
+        sf::SnapshotDelta::encode(asSpan(baseline), asSpan(snapshot), packet);
+        CHECK(packet.getDataSize() < 30u);
+
+        sf::base::Vector<unsigned char> decoded;
+        CHECK(sf::SnapshotDelta::decode(packet, asSpan(baseline), decoded));
+        CHECK(decoded == snapshot);
+    }
+
+    SECTION("Different sizes")
+    {
+        const sf::base::Vector<unsigned char> longer  = makeSnapshot(1500u, 7u);
+        const sf::base::Vector<unsigned char> shorter = makeSnapshot(300u, 7u);
+
+        sf::Packet packet;
+        sf::SnapshotDelta::encode(asSpan(baseline), asSpan(longer), packet);
+        sf::SnapshotDelta::encode(asSpan(baseline), asSpan(shorter), packet);
+
+        sf::base::Vector<unsigned char> decoded;
+        CHECK(sf::SnapshotDelta::decode(packet, asSpan(baseline), decoded));
+        CHECK(decoded == longer);
+        CHECK(sf::SnapshotDelta::decode(packet, asSpan(baseline), decoded));
+        CHECK(decoded == shorter);
+    }
+
+    SECTION("No baseline")
+    {
+        const sf::base::Vector<unsigned char> snapshot = makeSnapshot(700u, 3u);
+
+        sf::Packet packet;
+        sf::SnapshotDelta::encode({}, asSpan(snapshot), packet);
+
+        sf::base::Vector<unsigned char> decoded;
+        CHECK(sf::SnapshotDelta::decode(packet, {}, decoded));
+        CHECK(decoded == snapshot);
+    }
+
+    SECTION("Malformed data")
+    {
+        sf::Packet packet;
+        sf::SnapshotDelta::encode({}, asSpan(baseline), packet);
+
+        sf::Packet truncated;
+        truncated.append(packet.getData(), packet.getDataSize() / 2u);
+
+        sf::base::Vector<unsigned char> decoded;
+        CHECK(!sf::SnapshotDelta::decode(truncated, {}, decoded));
+
+        sf::Packet oversized;
+        oversized.appendVarUInt(sf::SnapshotDelta::maxSnapshotSize + 1u);
+        CHECK(!sf::SnapshotDelta::decode(oversized, {}, decoded));
+
+        sf::Packet overlong;
+        overlong.appendVarUInt(10u).appendVarUInt(11u);
+        CHECK(!sf::SnapshotDelta::decode(overlong, {}, decoded));
+    }
+}
+
+
+TEST_CASE("[Network] sf::SnapshotBaselineRing")
+{
+    sf::SnapshotBaselineRing ring(4u);
+    CHECK(ring.getCapacity() == 4u);
+    CHECK(ring.find(1u) == nullptr);
+
+    const sf::base::Vector<unsigned char> snapshot = makeSnapshot(16u, 1u);
+
+    for (sf::base::U32 sequence = 1u; sequence <= 5u; ++sequence)
+        ring.store(sequence, asSpan(snapshot));
+
+    CHECK(ring.find(1u) == nullptr); // overwritten by 5
+    REQUIRE(ring.find(2u) != nullptr);
+    CHECK(*ring.find(2u) == snapshot);
+    CHECK(ring.find(5u) != nullptr);
+    CHECK(ring.find(9u) == nullptr);
+    CHECK(ring.find(0u) == nullptr);
+
+    ring.clear();
+    CHECK(ring.find(5u) == nullptr);
+}
+
+
+TEST_CASE("[Network] sf::SnapshotDeltaEncoder")
+{
+    sf::SnapshotDeltaEncoder encoder(8u);
+    sf::SnapshotDeltaDecoder decoder(8u);
+
+    sf::base::Vector<unsigned char> state = makeSnapshot(2000u, 9u);
+    sf::base::Vector<unsigned char> received;
+    sf::base::U32                   sequence = 0u;
+
+    SECTION("Full snapshot until acknowledged")
+    {
+        sf::Packet first;
+        CHECK(encoder.encode(asSpan(state), first) == 1u);
+        CHECK(decoder.decode(first, received, sequence));
+        CHECK(sequence == 1u);
+        CHECK(received == state);
+
+        state[42] += 1u;
+
+        sf::Packet second;
+        CHECK(encoder.encode(asSpan(state), second) == 2u);
+        CHECK(second.getDataSize() > 1000u);
+
+        encoder.acknowledge(1u);
+        CHECK(encoder.getBaselineSequence() == 1u);
+
+        state[43] += 1u;
+
+        sf::Packet third;
+        CHECK(encoder.encode(asSpan(state), third) == 3u);
+        CHECK(third.getDataSize() < 16u);
+
+        CHECK(decoder.decode(third, received, sequence));
+        CHECK(sequence == 3u);
+        CHECK(received == state);
+    }
+
+    SECTION("Lost snapshots and stale acknowledgements")
+    {
+        sf::Packet packet;
+        encoder.encode(asSpan(state), packet);
+        CHECK(decoder.decode(packet, received, sequence));
+        encoder.acknowledge(sequence);
+
+        // Lost on the way
+        packet.clear();
+        state[0] += 1u;
+        encoder.encode(asSpan(state), packet);
+
+        packet.clear();
+        state[1] += 1u;
+        encoder.encode(asSpan(state), packet);
+        CHECK(decoder.decode(packet, received, sequence));
+        CHECK(sequence == 3u);
+        CHECK(received == state);
+
+        encoder.acknowledge(3u);
+        encoder.acknowledge(1u); // reordered, ignored
+        CHECK(encoder.getBaselineSequence() == 3u);
+
+        encoder.acknowledge(100u); // never sent, ignored
+        CHECK(encoder.getBaselineSequence() == 3u);
+    }
+
+    SECTION("Baseline evicted from the history")
+    {
+        sf::Packet packet;
+        encoder.encode(asSpan(state), packet);
+        CHECK(decoder.decode(packet, received, sequence));
+        encoder.acknowledge(sequence);
+
+        // No acknowledgement for a whole history: the baseline is overwritten by the 8th snapshot after it
+        for (int i = 0; i < 9; ++i)
+        {
+            packet.clear();
+            state[static_cast<sf::base::SizeT>(i)] += 1u;
+            encoder.encode(asSpan(state), packet);
+        }
+
+        CHECK(packet.getDataSize() > 1000u);
+        CHECK(decoder.decode(packet, received, sequence));
+        CHECK(received == state);
+    }
+
+    SECTION("Unknown baseline")
+    {
+        sf::Packet packet;
+        encoder.encode(asSpan(state), packet);
+        encoder.acknowledge(1u);
+
+        packet.clear();
+        encoder.encode(asSpan(state), packet);
+
+        // The decoder never received snapshot 1
+        CHECK(!decoder.decode(packet, received, sequence));
+    }
+
+    SECTION("Reset")
+    {
+        sf::Packet packet;
+        encoder.encode(asSpan(state), packet);
+        encoder.acknowledge(1u);
+
+        encoder.reset();
+        CHECK(encoder.getBaselineSequence() == 0u);
+
+        packet.clear();
+        CHECK(encoder.encode(asSpan(state), packet) == 1u);
+
+        decoder.reset();
+        CHECK(decoder.decode(packet, received, sequence));
+        CHECK(received == state);
+    }
+}
@@ -0,0 +1,341 @@
+#include "SFML/Network/SocketReactor.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Packet.hpp"
+#include "SFML/Network/Task.hpp"
+#include "SFML/Network/TcpListener.hpp"
+#include "SFML/Network/TcpSocket.hpp"
+#include "SFML/Network/UdpSocket.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+sf::Task<> sleepThenRecord(sf::SocketReactor& reactor, sf::Time duration, int id, sf::base::Vector<int>& order)
+{
+    const auto result = co_await reactor.sleep(duration);
+    CHECK(result.status == sf::Socket::Status::Done);
+
+    order.pushBack(id);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<int> twice(sf::SocketReactor& reactor, int value)
+{
+    (void)co_await reactor.sleep(sf::milliseconds(1));
+    co_return value * 2;
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> sumOfTwice(sf::SocketReactor& reactor, int& sum)
+{
+    const int a = co_await twice(reactor, 10);
+    const int b = co_await twice(reactor, 11);
+    sum         = a + b;
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> echoServer(sf::SocketReactor& reactor, sf::TcpListener& listener)
+{
+    sf::TcpSocket client(/* isBlocking */ false);
+
+    const auto accepted = co_await reactor.accept(listener, client);
+    CHECK(accepted.status == sf::Socket::Status::Done);
+
+    char buffer[64];
+
+    while (true)
+    {
+        const auto received = co_await reactor.receive(client, buffer, sizeof(buffer));
+        if (received.status != sf::Socket::Status::Done)
+            break;
+
+        CHECK((co_await reactor.send(client, buffer, received.transferred)).status == sf::Socket::Status::Done);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> echoClient(sf::SocketReactor& reactor, unsigned short port, sf::base::SizeT& echoed)
+{
+    sf::TcpSocket socket(/* isBlocking */ false);
+
+    const auto connected = co_await reactor.connect(socket, sf::IpAddress::LocalHost, port);
+    CHECK(connected.status == sf::Socket::Status::Done);
+
+    const char message[] = "hello reactor";
+    CHECK((co_await reactor.send(socket, message, sizeof(message))).status == sf::Socket::Status::Done);
+
+    char buffer[sizeof(message)]{};
+
+    while (echoed < sizeof(message))
+    {
+        const auto received = co_await reactor.receive(socket, buffer + echoed, sizeof(buffer) - echoed);
+        CHECK(received.status == sf::Socket::Status::Done);
+
+        if (received.status != sf::Socket::Status::Done)
+            co_return;
+
+        echoed += received.transferred;
+    }
+
+    CHECK(sf::base::StringView(buffer) == sf::base::StringView(message));
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> packetServer(sf::SocketReactor& reactor, sf::TcpListener& listener, int& value)
+{
+    sf::TcpSocket client(/* isBlocking */ false);
+
+    const auto accepted = co_await reactor.accept(listener, client);
+    CHECK(accepted.status == sf::Socket::Status::Done);
+
+    sf::Packet packet;
+
+    const auto received = co_await reactor.receive(client, packet);
+    CHECK(received.status == sf::Socket::Status::Done);
+    CHECK(packet >> value);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> packetClient(sf::SocketReactor& reactor, unsigned short port)
+{
+    sf::TcpSocket socket(/* isBlocking */ false);
+
+    const auto connected = co_await reactor.connect(socket, sf::IpAddress::LocalHost, port);
+    CHECK(connected.status == sf::Socket::Status::Done);
+
+    sf::Packet packet;
+    packet << 1234;
+    CHECK((co_await reactor.send(socket, packet)).status == sf::Socket::Status::Done);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> receiveOnce(sf::SocketReactor&         reactor,
+                       sf::TcpSocket&             socket,
+                       sf::Time                   timeout,
+                       sf::SocketReactor::Result& result)
+{
+    char buffer[16];
+    result = co_await reactor.receive(socket, buffer, sizeof(buffer), timeout);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> cancelLater(sf::SocketReactor& reactor, const sf::TcpSocket& socket, sf::base::SizeT& cancelled)
+{
+    (void)co_await reactor.sleep(sf::milliseconds(5));
+    cancelled = reactor.cancel(socket);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> receiveDatagram(sf::SocketReactor&         reactor,
+                           sf::UdpSocket&             socket,
+                           sf::SocketReactor::Result& result,
+                           char*                      buffer)
+{
+    result = co_await reactor.receive(socket, buffer, 16u);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> sendDatagram(sf::SocketReactor& reactor, sf::UdpSocket& socket, unsigned short port)
+{
+    const auto result = co_await reactor.send(socket, "ping", 5u, sf::IpAddress::LocalHost, port);
+    CHECK(result.status == sf::Socket::Status::Done);
+    CHECK(result.transferred == 5u);
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> stopReactor(sf::SocketReactor& reactor)
+{
+    reactor.stop();
+    co_return;
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Task<> sleepForever(sf::SocketReactor& reactor)
+{
+    (void)co_await reactor.sleep(sf::seconds(3600.f));
+}
+
+} // namespace
+
+
+TEST_CASE("[Network] sf::SocketReactor")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SocketReactor));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::SocketReactor));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::Task<>));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::Task<>));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::Task<int>));
+    }
+
+    sf::SocketReactor reactor;
+
+    SECTION("No task")
+    {
+        CHECK(reactor.getTaskCount() == 0u);
+        CHECK(!reactor.runOnce());
+        reactor.run();
+    }
+
+    SECTION("Timers")
+    {
+        sf::base::Vector<int> order;
+
+        reactor.spawn(sleepThenRecord(reactor, sf::milliseconds(30), 1, order));
+        reactor.spawn(sleepThenRecord(reactor, sf::milliseconds(5), 2, order));
+        reactor.spawn(sleepThenRecord(reactor, sf::Time{}, 3, order));
+        CHECK(reactor.getTaskCount() == 3u);
+
+        reactor.run();
+
+        REQUIRE(order.size() == 3u);
+        CHECK(order[0] == 3);
+        CHECK(order[1] == 2);
+        CHECK(order[2] == 1);
+        CHECK(reactor.getTaskCount() == 0u);
+    }
+
+    SECTION("Nested tasks")
+    {
+        int sum = 0;
+        reactor.spawn(sumOfTwice(reactor, sum));
+
+        CHECK(reactor.runOnce());
+        reactor.run();
+
+        CHECK(sum == 42);
+    }
+
+    SECTION("TCP echo")
+    {
+        sf::TcpListener listener(/* isBlocking */ false);
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::base::SizeT echoed = 0u;
+        reactor.spawn(echoServer(reactor, listener));
+        reactor.spawn(echoClient(reactor, listener.getLocalPort(), echoed));
+        reactor.run();
+
+        CHECK(echoed == sizeof("hello reactor"));
+        CHECK(reactor.getTaskCount() == 0u);
+    }
+
+    SECTION("Packets")
+    {
+        sf::TcpListener listener(/* isBlocking */ false);
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        int value = 0;
+        reactor.spawn(packetServer(reactor, listener, value));
+        reactor.spawn(packetClient(reactor, listener.getLocalPort()));
+        reactor.run();
+
+        CHECK(value == 1234);
+    }
+
+    SECTION("Timeout and cancellation")
+    {
+        sf::TcpListener listener(/* isBlocking */ true);
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket client(/* isBlocking */ true);
+        REQUIRE(client.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        client.setBlocking(false);
+
+        sf::TcpSocket server(/* isBlocking */ true);
+        REQUIRE(listener.accept(server) == sf::Socket::Status::Done);
+
+        sf::SocketReactor::Result result;
+
+        SECTION("Timeout")
+        {
+            reactor.spawn(receiveOnce(reactor, client, sf::milliseconds(10), result));
+            reactor.run();
+
+            CHECK(result.timedOut);
+            CHECK(!result.cancelled);
+            CHECK(result.status == sf::Socket::Status::NotReady);
+        }
+
+        SECTION("Cancel")
+        {
+            sf::base::SizeT cancelled = 0u;
+
+            reactor.spawn(receiveOnce(reactor, client, sf::Time{}, result));
+            reactor.spawn(cancelLater(reactor, client, cancelled));
+            reactor.run();
+
+            CHECK(cancelled == 1u);
+            CHECK(result.cancelled);
+            CHECK(!result.timedOut);
+            CHECK(result.status == sf::Socket::Status::NotReady);
+        }
+
+        SECTION("Disconnection")
+        {
+            (void)server.disconnect();
+
+            reactor.spawn(receiveOnce(reactor, client, sf::seconds(5.f), result));
+            reactor.run();
+
+            CHECK(result.status == sf::Socket::Status::Disconnected);
+        }
+    }
+
+    SECTION("UDP")
+    {
+        sf::UdpSocket receiver(/* isBlocking */ false);
+        sf::UdpSocket sender(/* isBlocking */ false);
+        REQUIRE(receiver.bind(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(sender.bind(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::SocketReactor::Result result;
+        char                      buffer[16]{};
+
+        reactor.spawn(receiveDatagram(reactor, receiver, result, buffer));
+        reactor.spawn(sendDatagram(reactor, sender, receiver.getLocalPort()));
+        reactor.run();
+
+        CHECK(result.status == sf::Socket::Status::Done);
+        CHECK(result.transferred == 5u);
+        REQUIRE(result.remoteAddress.hasValue());
+        CHECK(*result.remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(result.remotePort == sender.getLocalPort());
+        CHECK(sf::base::StringView(buffer) == "ping");
+    }
+
+    SECTION("Stop and destruction with pending tasks")
+    {
+        reactor.spawn(sleepForever(reactor));
+        reactor.spawn(stopReactor(reactor));
+        reactor.run();
+
+        CHECK(reactor.getTaskCount() == 1u);
+        CHECK(reactor.runOnce());
+    }
+}
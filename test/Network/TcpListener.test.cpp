@@ -1,8 +1,11 @@
 #include "SFML/Network/TcpListener.hpp"
 
 // Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/TcpSocket.hpp"
 
+#include "SFML/Base/Vector.hpp"
+
 #include <Doctest.hpp>
 
 #include <CommonTraits.hpp>
@@ -55,4 +58,96 @@ TEST_CASE("[Network] sf::TcpListener")
         sf::TcpSocket   tcpSocket(/* isBlocking */ true);
         CHECK(tcpListener.accept(tcpSocket) == sf::Socket::Status::Error);
     }
+
+    SECTION("listen() with settings")
+    {
+        sf::TcpListener tcpListener(/* isBlocking */ true);
+        CHECK(tcpListener.listen(0, sf::IpAddress::LocalHost, {.backlog = 16, .noDelay = false}) ==
+              sf::Socket::Status::Done);
+        CHECK(tcpListener.getLocalPort() != 0);
+    }
+
+#if defined(SFML_SYSTEM_LINUX)
+    SECTION("Port sharing")
+    {
+        sf::TcpListener first(/* isBlocking */ false);
+        REQUIRE(first.listen(0, sf::IpAddress::LocalHost, {.reusePort = true}) == sf::Socket::Status::Done);
+
+        sf::TcpListener second(/* isBlocking */ false);
+        CHECK(second.listen(first.getLocalPort(), sf::IpAddress::LocalHost, {.reusePort = true}) ==
+              sf::Socket::Status::Done);
+
+        sf::TcpListener exclusive(/* isBlocking */ false);
+        CHECK(exclusive.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Error);
+    }
+#endif
+
+    SECTION("acceptMany()")
+    {
+        sf::base::Vector<sf::TcpSocket> accepted;
+
+        SECTION("Not listening")
+        {
+            sf::TcpListener tcpListener(/* isBlocking */ false);
+            CHECK(tcpListener.acceptMany(accepted, 8u, /* acceptedSocketsBlocking */ false) ==
+                  sf::Socket::Status::Error);
+            CHECK(accepted.empty());
+        }
+
+        SECTION("Pending connections")
+        {
+            sf::TcpListener tcpListener(/* isBlocking */ false);
+            REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost, {.sendBufferSize = 64u * 1024u}) ==
+                    sf::Socket::Status::Done);
+
+            CHECK(tcpListener.acceptMany(accepted, 8u, /* acceptedSocketsBlocking */ false) ==
+                  sf::Socket::Status::NotReady);
+
+            sf::base::Vector<sf::TcpSocket> clients;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                clients.emplaceBack(/* isBlocking */ true);
+                REQUIRE(clients.back().connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) ==
+                        sf::Socket::Status::Done);
+            }
+
+            CHECK(tcpListener.acceptMany(accepted, 2u, /* acceptedSocketsBlocking */ true) == sf::Socket::Status::Done);
+            CHECK(accepted.size() == 2u);
+
+            CHECK(tcpListener.acceptMany(accepted, 8u, /* acceptedSocketsBlocking */ true) == sf::Socket::Status::Done);
+            CHECK(accepted.size() == 3u);
+
+            for (const sf::TcpSocket& socket : accepted)
+            {
+                CHECK(socket.isBlocking());
+                CHECK(socket.getRemotePort() != 0);
+            }
+
+            CHECK(accepted[0].setNoDelay(true));
+            CHECK(accepted[0].setBufferSizes(0u, 32u * 1024u));
+        }
+
+        SECTION("Blocking listener drains without blocking")
+        {
+            sf::TcpListener tcpListener(/* isBlocking */ true);
+            REQUIRE(tcpListener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+            sf::TcpSocket client(/* isBlocking */ true);
+            REQUIRE(client.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort()) ==
+                    sf::Socket::Status::Done);
+
+            CHECK(tcpListener.acceptMany(accepted, 8u, /* acceptedSocketsBlocking */ false) ==
+                  sf::Socket::Status::Done);
+            CHECK(accepted.size() == 1u);
+            CHECK(tcpListener.isBlocking());
+        }
+    }
+
+    SECTION("TcpSocket options")
+    {
+        sf::TcpSocket tcpSocket(/* isBlocking */ true);
+        CHECK(!tcpSocket.setNoDelay(false));
+        CHECK(!tcpSocket.setBufferSizes(1024u, 1024u));
+    }
 }
@@ -1,10 +1,13 @@
+#include "SFML/Network/IpAddress.hpp"
 #include "SFML/Network/SocketSelector.hpp"
 #include "SFML/Network/TcpListener.hpp"
 #include "SFML/Network/TcpSocket.hpp"
+#include "SFML/Network/TlsSessionCache.hpp"
 
 #include "SFML/System/Clock.hpp"
 #include "SFML/System/Time.hpp"
 
+#include "SFML/Base/Optional.hpp"
 #include "SFML/Base/String.hpp" // IWYU pragma: keep
 #include "SFML/Base/StringView.hpp"
 #include "SFML/Base/Vector.hpp"
@@ -168,6 +171,26 @@ TEST_CASE("[Network] sf::Tcp Loopback")
         CHECK(rangesAreEqual(buffer.begin(), buffer.end(), testData.begin()));
     }
 
+    SECTION("Happy Eyeballs")
+    {
+        // The listener only accepts IPv4, the IPv6 attempt is refused and the IPv4 one wins
+        const sf::IpAddress addresses[]{sf::IpAddress::LocalHostV6, sf::IpAddress::LocalHost};
+
+        sf::TcpSocket clientSocket{/* isBlocking */ true};
+        REQUIRE(clientSocket.connect(addresses, localPort, sf::milliseconds(750)) == sf::TcpSocket::Status::Done);
+        CHECK(clientSocket.isBlocking());
+        CHECK(clientSocket.getRemoteAddress() == sf::base::makeOptional(sf::IpAddress::LocalHost));
+        CHECK(clientSocket.getRemotePort() == localPort);
+
+        sf::TcpSocket serverSocket{/* isBlocking */ true};
+        const auto    start = sf::Clock::now();
+
+        while (tcpListener.accept(serverSocket) != sf::TcpListener::Status::Done)
+            REQUIRE((sf::Clock::now() - start < sf::milliseconds(750)));
+
+        CHECK(serverSocket.getRemotePort() == clientSocket.getLocalPort());
+    }
+
     SECTION("TLS")
     {
         sf::TcpSocket serverSocket{/* isBlocking */ true};
@@ -263,6 +286,98 @@ TEST_CASE("[Network] sf::Tcp Loopback")
 
         CHECK(rangesAreEqual(buffer.begin(), buffer.end(), testData.begin()));
     }
+
+    SECTION("TLS session resumption")
+    {
+        sf::TlsSessionCache serverSessionCache;
+        sf::TlsSessionCache clientSessionCache;
+
+        for (int i = 0; i < 2; ++i)
+        {
+            sf::TcpSocket serverSocket{/* isBlocking */ true};
+            sf::TcpSocket clientSocket{/* isBlocking */ false};
+
+            serverSocket.setTlsSessionCache(&serverSessionCache);
+            clientSocket.setTlsSessionCache(&clientSessionCache);
+
+            REQUIRE(clientSocket.connect(sf::IpAddress(127, 0, 0, 1), localPort, sf::milliseconds(750)) ==
+                    sf::TcpSocket::Status::NotReady);
+
+            auto start = sf::Clock::now();
+
+            while (true)
+            {
+                const auto result = tcpListener.accept(serverSocket);
+
+                REQUIRE(((result == sf::TcpListener::Status::NotReady) || (result == sf::TcpListener::Status::Done)));
+
+                if (result == sf::TcpListener::Status::Done)
+                    break;
+
+                REQUIRE((sf::Clock::now() - start < sf::milliseconds(750)));
+            }
+
+            serverSocket.setBlocking(false);
+
+            start = sf::Clock::now();
+
+            while (true)
+            {
+                const auto serverStatus = serverSocket.setupTlsServer(certificate, privateKey);
+
+                REQUIRE_FALSE(serverStatus == sf::TcpSocket::TlsStatus::Error);
+                REQUIRE_FALSE(serverStatus == sf::TcpSocket::TlsStatus::NotConnected);
+
+                const auto clientStatus = clientSocket.setupTlsClient(commonName.to<sf::base::String>(), certificate);
+
+                REQUIRE_FALSE(clientStatus == sf::TcpSocket::TlsStatus::Error);
+                REQUIRE_FALSE(clientStatus == sf::TcpSocket::TlsStatus::NotConnected);
+
+                if ((serverStatus == sf::TcpSocket::TlsStatus::HandshakeComplete) &&
+                    (clientStatus == sf::TcpSocket::TlsStatus::HandshakeComplete))
+                    break;
+
+                REQUIRE((sf::Clock::now() - start < sf::milliseconds(750)));
+            }
+
+            // Only the second connection can resume the session of the first one
+            CHECK(clientSocket.isTlsSessionResumed() == (i == 1));
+            CHECK(serverSocket.isTlsSessionResumed() == (i == 1));
+            CHECK(clientSocket.getTlsHandshakeDuration() > sf::Time{});
+
+            // With TLS 1.3, the client receives the session ticket along with the first application data
+            constexpr Byte ping[4]{'p', 'i', 'n', 'g'};
+            Byte           pong[4]{};
+
+            sf::base::SizeT sent{};
+            REQUIRE(serverSocket.send(ping, sizeof(ping), sent) == sf::TcpSocket::Status::Done);
+            REQUIRE(sent == sizeof(ping));
+
+            sf::base::SizeT receivedTotal = 0u;
+            start                         = sf::Clock::now();
+
+            while (receivedTotal < sizeof(pong))
+            {
+                sf::base::SizeT received{};
+                const auto status = clientSocket.receive(pong + receivedTotal, sizeof(pong) - receivedTotal, received);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+                receivedTotal += received;
+
+                REQUIRE((sf::Clock::now() - start < sf::milliseconds(750)));
+            }
+
+            CHECK(rangesAreEqual(pong, pong + sizeof(pong), ping));
+        }
+
+        const auto clientStatistics = clientSessionCache.getStatistics();
+        CHECK(clientStatistics.fullHandshakes == 1u);
+        CHECK(clientStatistics.resumedHandshakes == 1u);
+
+        const auto serverStatistics = serverSessionCache.getStatistics();
+        CHECK(serverStatistics.fullHandshakes == 1u);
+        CHECK(serverStatistics.resumedHandshakes == 1u);
+    }
 }
 
 #endif
@@ -29,6 +29,8 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().hasValue());
         CHECK(tcpSocket.getRemotePort() == 0);
         CHECK(!tcpSocket.getCurrentCiphersuiteName().hasValue());
+        CHECK(!tcpSocket.isTlsSessionResumed());
+        CHECK(tcpSocket.getTlsHandshakeDuration() == sf::Time{});
     }
 }
 
@@ -0,0 +1,100 @@
+#include "SFML/Network/TlsSessionCache.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+TEST_CASE("[Network] sf::TlsSessionCache")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TlsSessionCache));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TlsSessionCache));
+        STATIC_CHECK(!SFML_BASE_HAS_VIRTUAL_DESTRUCTOR(sf::TlsSessionCache));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TlsSessionCache sessionCache;
+        CHECK(sessionCache.getClientSessionCount() == 0u);
+
+        const auto statistics = sessionCache.getStatistics();
+        CHECK(statistics.fullHandshakes == 0u);
+        CHECK(statistics.resumedHandshakes == 0u);
+        CHECK(statistics.fullHandshakeTime == sf::Time{});
+        CHECK(statistics.resumedHandshakeTime == sf::Time{});
+    }
+
+    SECTION("Clear")
+    {
+        sf::TlsSessionCache sessionCache({.maxSessions = 1u, .enableSessionTickets = false});
+        sessionCache.clear();
+        sessionCache.resetStatistics();
+        CHECK(sessionCache.getClientSessionCount() == 0u);
+        CHECK(sessionCache.getStatistics().fullHandshakes == 0u);
+    }
+
+    SECTION("Store and take client sessions")
+    {
+        sf::TlsSessionCache sessionCache({.maxSessions = 2u});
+
+        const unsigned char first[3]{1, 2, 3};
+        const unsigned char second[2]{4, 5};
+
+        sessionCache.storeClientSession("example.com", 443u, first);
+        CHECK(sessionCache.getClientSessionCount() == 1u);
+
+        // Same host and port: the previous session is replaced
+        sessionCache.storeClientSession("example.com", 443u, second);
+        CHECK(sessionCache.getClientSessionCount() == 1u);
+
+        // Different port: a separate session
+        CHECK(sessionCache.takeClientSession("example.com", 8443u).empty());
+
+        const sf::base::Vector<unsigned char> taken = sessionCache.takeClientSession("example.com", 443u);
+        REQUIRE(taken.size() == 2u);
+        CHECK(taken[0] == 4u);
+        CHECK(taken[1] == 5u);
+
+        // A session is only offered once
+        CHECK(sessionCache.getClientSessionCount() == 0u);
+        CHECK(sessionCache.takeClientSession("example.com", 443u).empty());
+    }
+
+    SECTION("Eviction at maxSessions")
+    {
+        sf::TlsSessionCache sessionCache({.maxSessions = 2u});
+
+        const unsigned char data[1]{42};
+
+        sessionCache.storeClientSession("a.example.com", 443u, data);
+        sessionCache.storeClientSession("b.example.com", 443u, data);
+        CHECK(sessionCache.getClientSessionCount() == 2u);
+
+        // The oldest session makes room for the new one
+        sessionCache.storeClientSession("c.example.com", 443u, data);
+        CHECK(sessionCache.getClientSessionCount() == 2u);
+
+        CHECK(sessionCache.takeClientSession("a.example.com", 443u).empty());
+        CHECK(sessionCache.takeClientSession("b.example.com", 443u).size() == 1u);
+        CHECK(sessionCache.takeClientSession("c.example.com", 443u).size() == 1u);
+        CHECK(sessionCache.getClientSessionCount() == 0u);
+    }
+
+    SECTION("Expired sessions")
+    {
+        sf::TlsSessionCache sessionCache({.sessionLifetime = sf::Time{}});
+
+        const unsigned char data[1]{42};
+        sessionCache.storeClientSession("example.com", 443u, data);
+        CHECK(sessionCache.getClientSessionCount() == 1u);
+
+        CHECK(sessionCache.takeClientSession("example.com", 443u).empty());
+        CHECK(sessionCache.getClientSessionCount() == 0u);
+    }
+}
@@ -0,0 +1,276 @@
+#include "SFML/Network/UdpConnection.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Packet.hpp"
+#include "SFML/Network/UdpSocket.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+#ifdef SFML_RUN_LOOPBACK_TESTS
+
+namespace
+{
+////////////////////////////////////////////////////////////
+struct Peers
+{
+    explicit Peers(const sf::UdpConnectionSettings& settings = {}) : Peers(settings, settings)
+    {
+    }
+
+    explicit Peers(const sf::UdpConnectionSettings& settingsA, const sf::UdpConnectionSettings& settingsB) :
+        socketA(/* isBlocking */ false),
+        socketB(/* isBlocking */ false)
+    {
+        REQUIRE(socketA.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(socketB.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        connectionA.emplace(socketA, sf::IpAddress::LocalHost, socketB.getLocalPort(), settingsA);
+        connectionB.emplace(socketB, sf::IpAddress::LocalHost, socketA.getLocalPort(), settingsB);
+    }
+
+    void update(sf::Time deltaTime)
+    {
+        REQUIRE(connectionA->update(deltaTime) == sf::Socket::Status::Done);
+        REQUIRE(connectionB->update(deltaTime) == sf::Socket::Status::Done);
+    }
+
+    sf::UdpSocket                         socketA;
+    sf::UdpSocket                         socketB;
+    sf::base::Optional<sf::UdpConnection> connectionA;
+    sf::base::Optional<sf::UdpConnection> connectionB;
+};
+
+} // namespace
+
+#endif
+
+
+TEST_CASE("[Network] sf::UdpConnection")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::UdpConnection));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::UdpConnection));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::UdpConnection));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::UdpConnection));
+    }
+
+    SECTION("Construction")
+    {
+        sf::UdpSocket socket(/* isBlocking */ true);
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        const sf::UdpConnection connection(socket, sf::IpAddress::LocalHost, 12'345u);
+        CHECK(!socket.isBlocking());
+        CHECK(connection.isConnected());
+        CHECK(connection.getRemoteAddress() == sf::IpAddress::LocalHost);
+        CHECK(connection.getRemotePort() == 12'345u);
+        CHECK(connection.getPendingReliableMessageCount() == 0u);
+        CHECK(connection.getStatistics().datagramsSent == 0u);
+    }
+
+#ifdef SFML_RUN_LOOPBACK_TESTS
+
+    SECTION("Unreliable and reliable delivery")
+    {
+        Peers peers;
+
+        sf::Packet packet;
+        packet << sf::base::U32{7u};
+        CHECK(peers.connectionA->send(sf::UdpConnection::Channel::Unreliable, packet));
+        CHECK(peers.connectionA->send(sf::UdpConnection::Channel::Reliable, packet));
+        CHECK(peers.connectionA->getPendingReliableMessageCount() == 1u);
+
+        sf::base::SizeT            unreliableCount = 0u;
+        sf::base::SizeT            reliableCount   = 0u;
+        sf::UdpConnection::Channel channel{};
+
+        for (int i = 0; i < 100 && (unreliableCount == 0u || reliableCount == 0u); ++i)
+        {
+            peers.update(sf::milliseconds(5));
+
+            while (peers.connectionB->receive(packet, channel))
+            {
+                sf::base::U32 value = 0u;
+                CHECK(static_cast<bool>(packet >> value));
+                CHECK(value == 7u);
+
+                ++(channel == sf::UdpConnection::Channel::Unreliable ? unreliableCount : reliableCount);
+            }
+        }
+
+        CHECK(unreliableCount == 1u);
+        CHECK(reliableCount == 1u);
+
+        // The acknowledgement makes its way back
+        for (int i = 0; i < 100 && peers.connectionA->getPendingReliableMessageCount() > 0u; ++i)
+            peers.update(sf::milliseconds(5));
+
+        CHECK(peers.connectionA->getPendingReliableMessageCount() == 0u);
+        CHECK(peers.connectionA->getStatistics().roundTripTime > sf::Time{});
+    }
+
+    SECTION("First datagram lost")
+    {
+        // The first random draw of this seed is below the loss probability, later ones vary
+        sf::UdpConnectionSettings lossySettings;
+        lossySettings.simulatedPacketLoss = 0.5f;
+        lossySettings.simulationSeed      = 1u;
+
+        Peers peers(lossySettings, {});
+
+        sf::Packet packet;
+        packet << sf::base::U32{42u};
+        CHECK(peers.connectionA->send(sf::UdpConnection::Channel::Reliable, packet));
+
+        peers.update(sf::milliseconds(5));
+        REQUIRE(peers.connectionA->getStatistics().datagramsSent == 1u);
+        REQUIRE(peers.connectionA->getStatistics().datagramsDropped == 1u);
+
+        // Keep-alives of the peer, which has not received anything yet, must not acknowledge the lost datagram
+        sf::base::SizeT            receivedCount = 0u;
+        sf::UdpConnection::Channel channel{};
+
+        for (int i = 0; i < 1000 && (receivedCount == 0u || peers.connectionA->getPendingReliableMessageCount() > 0u); ++i)
+        {
+            peers.update(sf::milliseconds(5));
+
+            while (peers.connectionB->receive(packet, channel))
+            {
+                sf::base::U32 value = 0u;
+                CHECK(static_cast<bool>(packet >> value));
+                CHECK(value == 42u);
+
+                ++receivedCount;
+            }
+        }
+
+        CHECK(receivedCount == 1u);
+        CHECK(peers.connectionA->getPendingReliableMessageCount() == 0u);
+        CHECK(peers.connectionA->getStatistics().fragmentsResent > 0u);
+    }
+
+    SECTION("Fragmentation and reassembly")
+    {
+        Peers peers;
+
+        sf::base::Vector<char> message(10'000u);
+        for (sf::base::SizeT i = 0u; i < message.size(); ++i)
+            message[i] = static_cast<char>(i * 31u);
+
+        CHECK(peers.connectionA->send(sf::UdpConnection::Channel::ReliableOrdered, message.data(), message.size()));
+        CHECK(peers.connectionA->send(sf::UdpConnection::Channel::Unreliable, message.data(), message.size()));
+
+        sf::Packet                 packet;
+        sf::UdpConnection::Channel channel{};
+        sf::base::SizeT            receivedCount = 0u;
+
+        for (int i = 0; i < 100 && receivedCount < 2u; ++i)
+        {
+            peers.update(sf::milliseconds(5));
+
+            while (peers.connectionB->receive(packet, channel))
+            {
+                REQUIRE(packet.getDataSize() == message.size());
+                CHECK(sf::base::Vector<char>(static_cast<const char*>(packet.getData()),
+                                             static_cast<const char*>(packet.getData()) + packet.getDataSize()) ==
+                      message);
+
+                ++receivedCount;
+            }
+        }
+
+        CHECK(receivedCount == 2u);
+    }
+
+    SECTION("Ordered delivery under simulated loss and latency")
+    {
+        sf::UdpConnectionSettings settings;
+        settings.simulatedPacketLoss = 0.3f;
+        settings.simulatedLatency    = sf::milliseconds(20);
+        settings.simulatedJitter     = sf::milliseconds(10);
+        settings.simulationSeed      = 42u; // Deterministic, the first datagram sent by each peer is dropped
+
+        Peers peers(settings);
+
+        constexpr sf::base::U32 messageCount = 50u;
+
+        for (sf::base::U32 i = 0u; i < messageCount; ++i)
+        {
+            sf::Packet packet;
+            packet << i;
+            CHECK(peers.connectionA->send(sf::UdpConnection::Channel::ReliableOrdered, packet));
+        }
+
+        sf::Packet                 packet;
+        sf::UdpConnection::Channel channel{};
+        sf::base::U32              expected = 0u;
+
+        for (int i = 0; i < 2000 && (expected < messageCount || peers.connectionA->getPendingReliableMessageCount() > 0u);
+             ++i)
+        {
+            peers.update(sf::milliseconds(5));
+
+            while (peers.connectionB->receive(packet, channel))
+            {
+                sf::base::U32 value = 0u;
+                CHECK(static_cast<bool>(packet >> value));
+                CHECK(channel == sf::UdpConnection::Channel::ReliableOrdered);
+                CHECK(value == expected);
+
+                ++expected;
+            }
+        }
+
+        CHECK(expected == messageCount);
+        CHECK(peers.connectionA->getPendingReliableMessageCount() == 0u);
+
+        const sf::UdpConnection::Statistics statistics = peers.connectionA->getStatistics();
+        CHECK(statistics.datagramsDropped > 0u);
+        CHECK(statistics.fragmentsResent > 0u);
+        CHECK(statistics.roundTripTime >= sf::milliseconds(40));
+    }
+
+    SECTION("Oversized message")
+    {
+        Peers peers;
+
+        const sf::base::Vector<char> message(1'000'000u);
+        CHECK(!peers.connectionA->send(sf::UdpConnection::Channel::Reliable, message.data(), message.size()));
+        CHECK(peers.connectionA->getPendingReliableMessageCount() == 0u);
+    }
+
+    SECTION("Timeout")
+    {
+        sf::UdpConnectionSettings settings;
+        settings.timeout = sf::milliseconds(100);
+
+        sf::UdpSocket socket(/* isBlocking */ false);
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket silentPeer(/* isBlocking */ false);
+        REQUIRE(silentPeer.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpConnection connection(socket, sf::IpAddress::LocalHost, silentPeer.getLocalPort(), settings);
+
+        CHECK(connection.update(sf::milliseconds(50)) == sf::Socket::Status::Done);
+        CHECK(connection.isConnected());
+
+        CHECK(connection.update(sf::milliseconds(60)) == sf::Socket::Status::Disconnected);
+        CHECK(!connection.isConnected());
+        CHECK(connection.update(sf::milliseconds(10)) == sf::Socket::Status::Disconnected);
+    }
+
+#endif
+}
@@ -1,9 +1,18 @@
 #include "SFML/Network/UdpSocket.hpp"
 
+// Other 1st party headers
+#include "SFML/Network/Packet.hpp"
+#include "SFML/Network/PacketView.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
 #include <Doctest.hpp>
 
 #include <CommonTraits.hpp>
 
+#include <string>
+
 TEST_CASE("[Network] sf::UdpSocket")
 {
     SECTION("Type traits")
@@ -36,4 +45,130 @@ TEST_CASE("[Network] sf::UdpSocket")
         CHECK(udpSocket.unbind());
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("Batched send/receive")
+    {
+        sf::UdpSocket receiver(/* isBlocking */ true);
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket sender(/* isBlocking */ true);
+
+        sf::Packet packets[3];
+        for (sf::base::U32 i = 0u; i < 3u; ++i)
+            packets[i] << i << std::string("datagram");
+
+        const sf::UdpSocket::OutgoingDatagram datagrams[3]{
+            {packets[0].getData(), packets[0].getDataSize(), sf::IpAddress::LocalHost, receiver.getLocalPort()},
+            {packets[1].getData(), packets[1].getDataSize(), sf::IpAddress::LocalHost, receiver.getLocalPort()},
+            {packets[2].getData(), packets[2].getDataSize(), sf::IpAddress::LocalHost, receiver.getLocalPort()},
+        };
+
+        sf::base::SizeT sent = 0u;
+        CHECK(sender.send(datagrams, sent) == sf::Socket::Status::Done);
+        CHECK(sent == 3u);
+
+        sf::UdpSocket::DatagramBatch batch(/* capacity */ 8u, /* maxDatagramSize */ 256u);
+        CHECK(batch.getCapacity() == 8u);
+        CHECK(batch.getDatagrams().empty());
+
+        // Blocking receives return as soon as at least one datagram is available
+        sf::base::U32 receivedCount = 0u;
+        while (receivedCount < 3u)
+        {
+            REQUIRE(receiver.receive(batch) == sf::Socket::Status::Done);
+            REQUIRE(!batch.getDatagrams().empty());
+
+            for (const sf::UdpSocket::ReceivedDatagram& datagram : batch.getDatagrams())
+            {
+                CHECK(!datagram.truncated);
+                CHECK(datagram.remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(datagram.remotePort == sender.getLocalPort());
+
+                sf::PacketView view = datagram.toPacketView();
+
+                sf::base::U32 index = 0u;
+                std::string   text;
+                CHECK(static_cast<bool>(view >> index >> text));
+                CHECK(index == receivedCount);
+                CHECK(text == "datagram");
+
+                ++receivedCount;
+            }
+        }
+
+        CHECK(receivedCount == 3u);
+    }
+
+    SECTION("Batched send of an oversized datagram")
+    {
+        sf::UdpSocket socket(/* isBlocking */ true);
+
+        static const char data[1]{};
+        const sf::UdpSocket::OutgoingDatagram datagrams[1]{
+            {data, sf::UdpSocket::MaxDatagramSize + 1u, sf::IpAddress::LocalHost, 12'345u}};
+
+        sf::base::SizeT sent = 0u;
+        CHECK(socket.send(datagrams, sent) == sf::Socket::Status::Error);
+        CHECK(sent == 0u);
+    }
+
+    SECTION("Batched receive of an oversized datagram")
+    {
+        sf::UdpSocket receiver(/* isBlocking */ true);
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket sender(/* isBlocking */ true);
+
+        static const char data[16]{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p'};
+        const sf::UdpSocket::OutgoingDatagram datagrams[2]{
+            {data, sizeof(data), sf::IpAddress::LocalHost, receiver.getLocalPort()},
+            {data, 4u, sf::IpAddress::LocalHost, receiver.getLocalPort()},
+        };
+
+        sf::base::SizeT sent = 0u;
+        REQUIRE(sender.send(datagrams, sent) == sf::Socket::Status::Done);
+
+        sf::UdpSocket::DatagramBatch batch(/* capacity */ 2u, /* maxDatagramSize */ 8u);
+
+        sf::base::SizeT receivedCount = 0u;
+        while (receivedCount < 2u)
+        {
+            REQUIRE(receiver.receive(batch) == sf::Socket::Status::Done);
+
+            for (const sf::UdpSocket::ReceivedDatagram& datagram : batch.getDatagrams())
+            {
+                // Only the first datagram does not fit in the batch, and is clipped to its size
+                CHECK(datagram.truncated == (receivedCount == 0u));
+                CHECK(datagram.size == (receivedCount == 0u ? 8u : 4u));
+                CHECK(static_cast<const char*>(datagram.data)[0] == 'a');
+
+                ++receivedCount;
+            }
+        }
+    }
+
+    SECTION("Batched send from a bound socket")
+    {
+        sf::UdpSocket receiver(/* isBlocking */ true);
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket sender(/* isBlocking */ true);
+        REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        const unsigned short senderPort = sender.getLocalPort();
+
+        static const char data[1]{'x'};
+        const sf::UdpSocket::OutgoingDatagram datagrams[1]{
+            {data, sizeof(data), sf::IpAddress::LocalHost, receiver.getLocalPort()}};
+
+        // Sending must reuse the bound socket instead of recreating it
+        sf::base::SizeT sent = 0u;
+        CHECK(sender.send(datagrams, sent) == sf::Socket::Status::Done);
+        CHECK(sender.send(datagrams, sent) == sf::Socket::Status::Done);
+        CHECK(sender.getLocalPort() == senderPort);
+
+        sf::UdpSocket::DatagramBatch batch(/* capacity */ 1u, /* maxDatagramSize */ 8u);
+        REQUIRE(receiver.receive(batch) == sf::Socket::Status::Done);
+        REQUIRE(batch.getDatagrams().size() == 1u);
+        CHECK(batch.getDatagrams()[0].remotePort == senderPort);
+    }
 }
@@ -0,0 +1,126 @@
+#include "SFML/System/Utf8String.hpp"
+
+#include "SFML/System/UnicodeString.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+#include <string>
+
+
+TEST_CASE("[System] sf::Utf8String")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::Utf8String));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::Utf8String));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::Utf8String));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::Utf8String));
+        STATIC_CHECK(sizeof(sf::Utf8String) < sizeof(sf::UnicodeString));
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::Utf8String string;
+        CHECK(string.isEmpty());
+        CHECK(string.getSize() == 0u);
+        CHECK(string.getByteSize() == 0u);
+        CHECK(string.begin() == string.end());
+        CHECK(string.getData()[0] == '\0');
+    }
+
+    SECTION("ASCII")
+    {
+        const sf::Utf8String string{"hello"};
+        CHECK(string.isAscii());
+        CHECK(string.getSize() == 5u);
+        CHECK(string.getByteSize() == 5u);
+        CHECK(string[0] == U'h');
+        CHECK(string[4] == U'o');
+        CHECK(string.getByteOffset(3) == 3u);
+    }
+
+    SECTION("Multi-byte")
+    {
+        // "añ🐌b"
+        const sf::Utf8String string{"a\xC3\xB1\xF0\x9F\x90\x8C" "b"};
+        CHECK(!string.isAscii());
+        CHECK(string.getSize() == 4u);
+        CHECK(string.getByteSize() == 8u);
+
+        CHECK(string[0] == U'a');
+        CHECK(string[1] == U'ñ');
+        CHECK(string[2] == U'🐌');
+        CHECK(string[3] == U'b');
+
+        CHECK(string.getByteOffset(2) == 3u);
+        CHECK(string.getByteOffset(4) == 8u);
+
+        sf::Utf8String::Cursor cursor{string};
+        CHECK(cursor[0] == U'a');
+        CHECK(cursor[2] == U'🐌');
+        CHECK(cursor[3] == U'b');
+        CHECK(cursor.getByteOffset(4) == 8u);
+
+        // Backwards access restarts from the beginning
+        CHECK(cursor[1] == U'ñ');
+        CHECK(cursor.getByteOffset(2) == 3u);
+
+        std::u32string decoded;
+        for (const char32_t c : string)
+            decoded += c;
+
+        CHECK(decoded == U"añ🐌b");
+    }
+
+    SECTION("Truncated trailing sequence")
+    {
+        sf::Utf8String string{"ab\xE4\xBD"};
+        CHECK(string.getSize() == 3u);
+        CHECK(string[2] == U'\0');
+
+        string += sf::base::StringView{"cd"};
+        CHECK(string.getSize() == 5u);
+        CHECK(string[3] == U'c');
+    }
+
+    SECTION("UnicodeString conversions")
+    {
+        const sf::UnicodeString unicode{U"x🐌y"};
+        const sf::Utf8String    string{unicode};
+
+        CHECK(string.getSize() == 3u);
+        CHECK(string.getByteSize() == 6u);
+        CHECK(string.toUnicodeString() == unicode);
+    }
+
+    SECTION("pushBack() and operator+=")
+    {
+        sf::Utf8String string;
+        string.pushBack(U'a');
+        string.pushBack(U'é');
+        string.pushBack(0x11'00'00); // Invalid, skipped
+
+        CHECK(string.getSize() == 2u);
+        CHECK(string.getByteSize() == 3u);
+
+        string += sf::Utf8String{"\xF0\x9F\x90\x8C"};
+        CHECK(string.getSize() == 3u);
+        CHECK(string[2] == U'🐌');
+
+        string.clear();
+        CHECK(string.isEmpty());
+        CHECK(string.getSize() == 0u);
+    }
+
+    SECTION("Comparison")
+    {
+        CHECK(sf::Utf8String{"abc"} == sf::Utf8String{"abc"});
+        CHECK(sf::Utf8String{"abc"} < sf::Utf8String{"abd"});
+        CHECK(sf::Utf8String{"z"} < sf::Utf8String{"\xC3\xA9"}); // U+007A < U+00E9
+    }
+}
@@ -0,0 +1,187 @@
+#include "StringifyStdStringUtil.hpp" // IWYU pragma: keep
+
+#include "SFML/System/UtfBulk.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/UnicodeString.hpp"
+#include "SFML/System/UnicodeStringUtfUtils.hpp"
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/Base/BackInserter.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <Doctest.hpp>
+
+#include <string>
+#include <string_view>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::u32string bulkToUtf32(const std::string_view input)
+{
+    std::u32string output(input.size(), U'\0');
+    output.resize(sf::UtfBulk::utf8ToUtf32(input.data(), input.data() + input.size(), output.data()));
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::u32string scalarToUtf32(const std::string_view input)
+{
+    std::u32string output;
+    sf::Utf8::toUtf32(input.begin(), input.end(), sf::base::BackInserter(output));
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::u16string bulkToUtf16(const std::string_view input)
+{
+    std::u16string output(input.size(), u'\0');
+    output.resize(sf::UtfBulk::utf8ToUtf16(input.data(), input.data() + input.size(), output.data()));
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::u16string scalarToUtf16(const std::string_view input)
+{
+    std::u16string output;
+    sf::Utf8::toUtf16(input.begin(), input.end(), sf::base::BackInserter(output));
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string bulkToUtf8(const std::u32string_view input)
+{
+    std::string output(sf::UtfBulk::getUtf8Length(input.data(), input.data() + input.size()), '\0');
+    CHECK(sf::UtfBulk::utf32ToUtf8(input.data(), input.data() + input.size(), output.data()) == output.size());
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string scalarToUtf8(const std::u32string_view input)
+{
+    std::string output;
+    sf::Utf32::toUtf8(input.begin(), input.end(), sf::base::BackInserter(output));
+    return output;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string makeMixedText(const sf::base::SizeT repetitions)
+{
+    std::string result;
+
+    for (sf::base::SizeT i = 0u; i < repetitions; ++i)
+    {
+        result += "The quick brown fox jumps over the lazy dog. ";
+        result += "Gr\xC3\xBC\xC3\x9F" "e, \xE4\xBD\xA0\xE5\xA5\xBD, \xF0\x9F\x90\x8C! ";
+    }
+
+    return result;
+}
+
+} // namespace
+
+
+TEST_CASE("[System] sf::UtfBulk")
+{
+    SECTION("asciiPrefixLength()")
+    {
+        constexpr std::string_view ascii = "0123456789abcdefghijklmnopqrstuvwxyz";
+        CHECK(sf::UtfBulk::asciiPrefixLength(ascii.data(), ascii.data() + ascii.size()) == ascii.size());
+
+        const std::string mixed = std::string(20, 'a') + "\xC3\xA9" + "bc";
+        CHECK(sf::UtfBulk::asciiPrefixLength(mixed.data(), mixed.data() + mixed.size()) == 20u);
+
+        CHECK(sf::UtfBulk::asciiPrefixLength(ascii.data(), ascii.data()) == 0u);
+    }
+
+    SECTION("utf8ToUtf32()")
+    {
+        CHECK(bulkToUtf32("").empty());
+        CHECK(bulkToUtf32("abc") == U"abc");
+        CHECK(bulkToUtf32("0123456789abcdefghijklmnopqrstuvwxyz") == U"0123456789abcdefghijklmnopqrstuvwxyz");
+        CHECK(bulkToUtf32("\xF0\x9F\x90\x8C 0123456789abcdef \xC3\xA9") == U"🐌 0123456789abcdef é");
+
+        // Truncated sequence at the end of a block
+        const std::string truncated = std::string(31, 'x') + "\xE4\xBD";
+        CHECK(bulkToUtf32(truncated) == scalarToUtf32(truncated));
+
+        const std::string mixed = makeMixedText(10u);
+        CHECK(bulkToUtf32(mixed) == scalarToUtf32(mixed));
+    }
+
+    SECTION("utf8ToUtf16()")
+    {
+        CHECK(bulkToUtf16("abc") == u"abc");
+        CHECK(bulkToUtf16("\xF0\x9F\x90\x8C") == u"🐌");
+
+        const std::string mixed = makeMixedText(10u);
+        CHECK(bulkToUtf16(mixed) == scalarToUtf16(mixed));
+    }
+
+    SECTION("utf32ToUtf8()")
+    {
+        CHECK(bulkToUtf8(U"").empty());
+        CHECK(bulkToUtf8(U"abc") == "abc");
+        CHECK(bulkToUtf8(U"0123456789abcdefghijklmnopqrstuvwxyz") == "0123456789abcdefghijklmnopqrstuvwxyz");
+
+        // Invalid characters are skipped
+        constexpr char32_t invalid[]{U'a', 0xD8'00, U'b', 0x11'00'00, U'c'};
+        CHECK(bulkToUtf8({invalid, 5u}) == "abc");
+        CHECK(sf::UtfBulk::getUtf8Length(invalid, invalid + 5) == 3u);
+
+        const std::u32string mixed = scalarToUtf32(makeMixedText(10u));
+        CHECK(bulkToUtf8(mixed) == scalarToUtf8(mixed));
+    }
+
+    SECTION("UnicodeString round trip")
+    {
+        const std::string       mixed  = makeMixedText(4u);
+        const sf::UnicodeString string = sf::UnicodeStringUtfUtils::fromUtf8(mixed.data(), mixed.data() + mixed.size());
+
+        CHECK(string.toUtf32<std::u32string>() == scalarToUtf32(mixed));
+
+        const auto utf8 = string.toUtf8<std::u8string>();
+        CHECK(std::string_view(reinterpret_cast<const char*>(utf8.data()), utf8.size()) == mixed);
+    }
+}
+
+
+TEST_CASE("[System] sf::UtfBulk benchmark" * doctest::skip())
+{
+    const std::string    text    = makeMixedText(100'000u);
+    const std::u32string decoded = scalarToUtf32(text);
+
+    constexpr int iterations = 10;
+
+    const auto measure = [&](auto&& fn)
+    {
+        sf::Clock clock;
+
+        for (int i = 0; i < iterations; ++i)
+            fn();
+
+        return clock.getElapsedTime().asMicroseconds() / iterations;
+    };
+
+    sf::base::SizeT sink = 0u;
+
+    const auto scalarDecodeUs = measure([&] { sink += scalarToUtf32(text).size(); });
+    const auto bulkDecodeUs   = measure([&] { sink += bulkToUtf32(text).size(); });
+    const auto scalarEncodeUs = measure([&] { sink += scalarToUtf8(decoded).size(); });
+    const auto bulkEncodeUs   = measure([&] { sink += bulkToUtf8(decoded).size(); });
+
+    MESSAGE("Input: " << text.size() << " bytes, " << decoded.size() << " characters");
+    MESSAGE("UTF-8 -> UTF-32: scalar " << scalarDecodeUs << "us, bulk " << bulkDecodeUs << "us");
+    MESSAGE("UTF-32 -> UTF-8: scalar " << scalarEncodeUs << "us, bulk " << bulkEncodeUs << "us");
+
+    CHECK(sink > 0u);
+}
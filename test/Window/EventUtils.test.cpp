@@ -0,0 +1,86 @@
+#include "SFML/Window/EventUtils.hpp"
+
+#include "SFML/Window/Event.hpp"
+#include "SFML/Window/Keyboard.hpp"
+
+#include "SFML/Base/Vector.hpp"
+
+#include <Doctest.hpp>
+
+#include <SystemUtil.hpp>
+
+
+TEST_CASE("[Window] sf::EventUtils")
+{
+    SECTION("isClosedOrEscapeKeyPressed()")
+    {
+        CHECK(sf::EventUtils::isClosedOrEscapeKeyPressed(sf::Event::Closed{}));
+        CHECK(sf::EventUtils::isClosedOrEscapeKeyPressed(sf::Event::KeyPressed{.code = sf::Keyboard::Key::Escape}));
+        CHECK(!sf::EventUtils::isClosedOrEscapeKeyPressed(sf::Event::KeyPressed{.code = sf::Keyboard::Key::A}));
+        CHECK(!sf::EventUtils::isClosedOrEscapeKeyPressed(sf::Event::FocusLost{}));
+    }
+
+    SECTION("coalesceEvents()")
+    {
+        // Events as they would come out of `pollEvents` with `EventCoalescing::Disabled`
+        const sf::base::Vector<sf::Event> events{
+            sf::Event::Resized{{100u, 100u}},
+            sf::Event::Resized{{200u, 150u}},
+            sf::Event::MouseMoved{{1, 1}},
+            sf::Event::MouseMoved{{2, 3}},
+            sf::Event::MouseMoved{{4, 5}},
+            sf::Event::KeyPressed{.code = sf::Keyboard::Key::A},
+            sf::Event::MouseMoved{{6, 7}},
+            sf::Event::MouseMovedRaw{{1, 0}},
+            sf::Event::MouseMovedRaw{{1, 0}},
+            sf::Event::Resized{{300u, 200u}},
+        };
+
+        SECTION("Disabled")
+        {
+            sf::base::Vector<sf::Event> coalesced = events;
+            sf::EventUtils::coalesceEvents(coalesced, sf::EventCoalescing::Disabled);
+
+            // Every event is kept, in order
+            REQUIRE(coalesced.size() == 10u);
+            CHECK(coalesced[0].getIf<sf::Event::Resized>()->size == sf::Vec2u{100u, 100u});
+            CHECK(coalesced[1].getIf<sf::Event::Resized>()->size == sf::Vec2u{200u, 150u});
+            CHECK(coalesced[2].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{1, 1});
+            CHECK(coalesced[3].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{2, 3});
+            CHECK(coalesced[4].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{4, 5});
+            CHECK(coalesced[5].getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::A);
+            CHECK(coalesced[6].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{6, 7});
+            CHECK(coalesced[7].getIf<sf::Event::MouseMovedRaw>()->delta == sf::Vec2i{1, 0});
+            CHECK(coalesced[8].getIf<sf::Event::MouseMovedRaw>()->delta == sf::Vec2i{1, 0});
+            CHECK(coalesced[9].getIf<sf::Event::Resized>()->size == sf::Vec2u{300u, 200u});
+        }
+
+        SECTION("Enabled")
+        {
+            sf::base::Vector<sf::Event> coalesced = events;
+            sf::EventUtils::coalesceEvents(coalesced, sf::EventCoalescing::Enabled);
+
+            // Each run of resizes or mouse moves keeps its latest event, everything else is untouched
+            REQUIRE(coalesced.size() == 7u);
+            CHECK(coalesced[0].getIf<sf::Event::Resized>()->size == sf::Vec2u{200u, 150u});
+            CHECK(coalesced[1].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{4, 5});
+            CHECK(coalesced[2].getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::A);
+            CHECK(coalesced[3].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{6, 7});
+            CHECK(coalesced[4].getIf<sf::Event::MouseMovedRaw>()->delta == sf::Vec2i{1, 0});
+            CHECK(coalesced[5].getIf<sf::Event::MouseMovedRaw>()->delta == sf::Vec2i{1, 0});
+            CHECK(coalesced[6].getIf<sf::Event::Resized>()->size == sf::Vec2u{300u, 200u});
+        }
+
+        SECTION("Nothing to merge")
+        {
+            sf::base::Vector<sf::Event> empty;
+            sf::EventUtils::coalesceEvents(empty, sf::EventCoalescing::Enabled);
+            CHECK(empty.empty());
+
+            sf::base::Vector<sf::Event> single{sf::Event::MouseMoved{{1, 2}}};
+            sf::EventUtils::coalesceEvents(single, sf::EventCoalescing::Enabled);
+            REQUIRE(single.size() == 1u);
+            CHECK(single[0].getIf<sf::Event::MouseMoved>()->position == sf::Vec2i{1, 2});
+        }
+    }
+}